@@ -189,6 +189,74 @@
 */
 #define CFE_MISSION_ES_PERF_MAX_IDS 128
 
+/**
+**  \cfeescfg Number of Performance Markers in a Statistics message
+**
+**  \par Description:
+**       Defines the number of performance markers whose duration statistics
+**       are reported in each Performance Marker Statistics telemetry message.
+**
+**      This affects the layout of telemetry messages but does not affect run
+**      time behavior or internal allocation.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Note this affects the size of messages, so it must not cause any message
+**       to exceed the max length.
+**
+*/
+#define CFE_MISSION_ES_PERF_STATS_PER_PKT 8
+
+/**
+**  \cfeescfg Number of Records in a Startup Timing message
+**
+**  \par Description:
+**       Defines the number of startup timeline records reported in each
+**       Startup Timing telemetry message.
+**
+**      This affects the layout of telemetry messages but does not affect run
+**      time behavior or internal allocation.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Note this affects the size of messages, so it must not cause any message
+**       to exceed the max length.
+**
+*/
+#define CFE_MISSION_ES_STARTUP_TIMING_PER_PKT 8
+
+/**
+**  \cfeescfg Number of Jobs in a Background Jobs message
+**
+**  \par Description:
+**       Defines the number of ES background jobs whose run statistics are
+**       reported in each Background Jobs telemetry message.
+**
+**      This affects the layout of telemetry messages but does not affect run
+**      time behavior or internal allocation.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Note this affects the size of messages, so it must not cause any message
+**       to exceed the max length.
+**
+*/
+#define CFE_MISSION_ES_BACKGROUND_JOBS_PER_PKT 8
+
+/**
+**  \cfeescfg Number of Performance Marker Duration Histogram Buckets
+**
+**  \par Description:
+**       Defines the number of power of two microsecond buckets in the duration
+**       histogram of each performance marker.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Must be between 2 and 32.
+**
+*/
+#define CFE_MISSION_ES_PERF_STATS_HIST_BUCKETS 20
+
 /** \cfeescfg Maximum number of block sizes in pool structures
 **
 **  \par Description:
@@ -236,8 +304,8 @@
 **      Table Image data integrity values.
 **
 **  \par Limits
-**      Currently only CFE_ES_CrcType_CRC_16 is supported (see brief in CFE_ES_CrcType_Enum
-**      definition in cfe_es_api_typedefs.h)
+**      Currently CFE_ES_CrcType_CRC_16 and CFE_ES_CrcType_32_C are supported (see brief in
+**      CFE_ES_CrcType_Enum definition in cfe_es_api_typedefs.h)
 */
 #define CFE_MISSION_ES_DEFAULT_CRC CFE_ES_CrcType_CRC_16
 
@@ -142,9 +142,115 @@ void TestCopyRestoreCDS(void)
     UtAssert_INT32_EQ(CFE_ES_RestoreFromCDS(NULL, CDSHandlePtr), CFE_ES_BAD_ARGUMENT);
 }
 
+void TestCopyRangeCDS(void)
+{
+    CFE_ES_CDSHandle_t CDSHandlePtr;
+    size_t             BlockSize = 10;
+    const char *       Name      = "CDS_Range_Test";
+    CFE_Status_t       status;
+    char               Data[BlockSize];
+    char               DataBuff[BlockSize];
+
+    memset(DataBuff, 0, sizeof(DataBuff));
+
+    UtPrintf("Testing: CFE_ES_CopyToCDSRange");
+
+    snprintf(Data, BlockSize, "Test Data");
+
+    status = CFE_ES_RegisterCDS(&CDSHandlePtr, BlockSize, Name);
+    UtAssert_True(status == CFE_SUCCESS || status == CFE_ES_CDS_ALREADY_EXISTS, "Register CDS status = %d",
+                  (int)status);
+
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDS(CDSHandlePtr, Data), CFE_SUCCESS);
+
+    /* Change part of the data, the integrity check must still pass on restore */
+    memcpy(&Data[5], "Blob", 4);
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CDSHandlePtr, &Data[5], 5, 4), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_RestoreFromCDS(DataBuff, CDSHandlePtr), CFE_SUCCESS);
+    UtAssert_StrCmp(Data, DataBuff, "RestoreFromCDS = %s", DataBuff);
+
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CDSHandlePtr, Data, 0, BlockSize + 1), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CFE_ES_CDS_BAD_HANDLE, Data, 0, 1), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CDSHandlePtr, NULL, 0, 1), CFE_ES_BAD_ARGUMENT);
+}
+
+void TestCopyDeferredCDS(void)
+{
+    CFE_ES_CDSHandle_t CDSHandlePtr;
+    size_t             BlockSize = 10;
+    const char *       Name      = "CDS_Deferred_Test";
+    CFE_Status_t       status;
+    char               Data[BlockSize];
+    char               DataBuff[BlockSize];
+
+    memset(DataBuff, 0, sizeof(DataBuff));
+
+    UtPrintf("Testing: CFE_ES_CopyToCDSDeferred, CFE_ES_FlushCDS");
+
+    snprintf(Data, BlockSize, "Test Data");
+
+    status = CFE_ES_RegisterCDS(&CDSHandlePtr, BlockSize, Name);
+    UtAssert_True(status == CFE_SUCCESS || status == CFE_ES_CDS_ALREADY_EXISTS, "Register CDS status = %d",
+                  (int)status);
+
+    /* The latest posted data is restored, whether or not it was written yet */
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSDeferred(CDSHandlePtr, Data), CFE_SUCCESS);
+    memcpy(Data, "Blob", 4);
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSDeferred(CDSHandlePtr, Data), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_RestoreFromCDS(DataBuff, CDSHandlePtr), CFE_SUCCESS);
+    UtAssert_StrCmp(Data, DataBuff, "RestoreFromCDS = %s", DataBuff);
+
+    /* After a flush, the data is in the CDS with a matching integrity check */
+    UtAssert_INT32_EQ(CFE_ES_FlushCDS(CDSHandlePtr), CFE_SUCCESS);
+    memset(DataBuff, 0, sizeof(DataBuff));
+    UtAssert_INT32_EQ(CFE_ES_RestoreFromCDS(DataBuff, CDSHandlePtr), CFE_SUCCESS);
+    UtAssert_StrCmp(Data, DataBuff, "RestoreFromCDS = %s", DataBuff);
+    UtAssert_INT32_EQ(CFE_ES_FlushCDS(CDSHandlePtr), CFE_SUCCESS);
+
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSDeferred(CFE_ES_CDS_BAD_HANDLE, Data), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSDeferred(CDSHandlePtr, NULL), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_FlushCDS(CFE_ES_CDS_BAD_HANDLE), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+}
+
+void TestDoubleBufferedCDS(void)
+{
+    CFE_ES_CDSHandle_t CDSHandlePtr;
+    size_t             BlockSize = 10;
+    const char *       Name      = "CDS_Double_Test";
+    CFE_Status_t       status;
+    char               Data[BlockSize];
+    char               DataBuff[BlockSize];
+
+    memset(DataBuff, 0, sizeof(DataBuff));
+
+    UtPrintf("Testing: CFE_ES_RegisterCDSDoubleBuffered");
+
+    snprintf(Data, BlockSize, "Test Data");
+
+    status = CFE_ES_RegisterCDSDoubleBuffered(&CDSHandlePtr, BlockSize, Name);
+    UtAssert_True(status == CFE_SUCCESS || status == CFE_ES_CDS_ALREADY_EXISTS, "Register CDS status = %d",
+                  (int)status);
+
+    /* Each copy restores the data written last */
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDS(CDSHandlePtr, Data), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_RestoreFromCDS(DataBuff, CDSHandlePtr), CFE_SUCCESS);
+    UtAssert_StrCmp(Data, DataBuff, "RestoreFromCDS = %s", DataBuff);
+    memcpy(Data, "Blob", 4);
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDS(CDSHandlePtr, Data), CFE_SUCCESS);
+    memset(DataBuff, 0, sizeof(DataBuff));
+    UtAssert_INT32_EQ(CFE_ES_RestoreFromCDS(DataBuff, CDSHandlePtr), CFE_SUCCESS);
+    UtAssert_StrCmp(Data, DataBuff, "RestoreFromCDS = %s", DataBuff);
+
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CDSHandlePtr, Data, 0, 4), CFE_ES_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(CFE_ES_RegisterCDSDoubleBuffered(NULL, BlockSize, Name), CFE_ES_BAD_ARGUMENT);
+}
+
 void ESCDSTestSetup(void)
 {
     UtTest_Add(TestRegisterCDS, NULL, NULL, "Test Register CDS");
     UtTest_Add(TestCDSName, NULL, NULL, "Test CDS Name");
     UtTest_Add(TestCopyRestoreCDS, NULL, NULL, "Test Copy Restore CDS");
+    UtTest_Add(TestCopyRangeCDS, NULL, NULL, "Test Copy Range CDS");
+    UtTest_Add(TestCopyDeferredCDS, NULL, NULL, "Test Copy Deferred CDS");
+    UtTest_Add(TestDoubleBufferedCDS, NULL, NULL, "Test Double Buffered CDS");
 }
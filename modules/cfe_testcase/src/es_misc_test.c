@@ -48,23 +48,35 @@ void TestCalculateCRC(void)
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_CHECK_INPUT, sizeof(CRC_CHECK_INPUT) - 1, 0, CFE_ES_CrcType_16_ARC),
                        0xBB3D);
 
+    /* The CFE_ES_CrcType_32_C algorithm uses an input value of 0 and the check value result is 0xe3069283 */
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_CHECK_INPUT, sizeof(CRC_CHECK_INPUT) - 1, 0, CFE_ES_CrcType_32_C),
+                       0xE3069283);
+
     /*
-     * In this version of CFE, only CRC-16/ARC is defined, so the default must be the same.  In a future version of CFE,
-     * if more than one option is available, this can go back to an "MIR" case, and the user must compare the result
-     * to the check value for what they have actully configured as the default CRC.
+     * More than one algorithm is available, so the user must compare the result to the check value
+     * for what they have actually configured as the default CRC.
      */
-    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_CHECK_INPUT, sizeof(CRC_CHECK_INPUT) - 1, 0, CFE_MISSION_ES_DEFAULT_CRC),
-                       0xBB3D);
+    UtAssert_MIR("Default CRC check value: 0x%lx",
+                 (unsigned long)CFE_ES_CalculateCRC(CRC_CHECK_INPUT, sizeof(CRC_CHECK_INPUT) - 1, 0,
+                                                    CFE_MISSION_ES_DEFAULT_CRC));
 
     /* Compute a secondary string - the reference value obtained using 3rd party tool implementing same algorithm */
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_OTHER_INPUT, sizeof(CRC_OTHER_INPUT) - 1, 0, CFE_ES_CrcType_16_ARC),
                        0x11E3);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_OTHER_INPUT, sizeof(CRC_OTHER_INPUT) - 1, 0, CFE_ES_CrcType_32_C),
+                       0x688F6E8E);
 
     /* Test of nonzero initial value, this is used for checking CRC across non-contiguous chunks or across multiple
      * cycles */
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_CHECK_INPUT, sizeof(CRC_CHECK_INPUT) - 1, 345353, CFE_ES_CrcType_16_ARC),
                        0xE493);
 
+    /* For CRC-32C, the result of one call is the input to the next */
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&CRC_CHECK_INPUT[4], sizeof(CRC_CHECK_INPUT) - 5,
+                                           CFE_ES_CalculateCRC(CRC_CHECK_INPUT, 4, 0, CFE_ES_CrcType_32_C),
+                                           CFE_ES_CrcType_32_C),
+                       0xE3069283);
+
     /* NULL input or 0 size returns input crc */
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(NULL, sizeof(CRC_OTHER_INPUT), inputCrc, CFE_ES_CrcType_16_ARC), inputCrc);
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_OTHER_INPUT, 0, inputCrc, CFE_ES_CrcType_16_ARC), inputCrc);
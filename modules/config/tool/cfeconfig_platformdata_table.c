@@ -88,6 +88,15 @@ CFE_ConfigTool_DetailEntry_t MAP_ENTRY_LIST[] = {
                    .custom_max  = "CFE_PLATFORM_SB_MAX_BLOCK_SIZE",
                    .options     = CFE_CONFIGTOOL_LIST_DESCENDING | CFE_CONFIGTOOL_USE_LEADING_ZERO},
     },
+    {
+        .render_style = CFE_ConfigTool_RenderStyle_ARRAY,
+        .ido          = CFE_ConfigIdOffset_PLATFORM_SB_MEM_BLOCK_RESERVE,
+        .u.list       = {.prefix      = "CFE_PLATFORM_SB_MEM_BLOCK_RESERVE",
+                   .type_name   = "uint32_t",
+                   .num_entries = CFE_PLATFORM_SB_POOL_MAX_BUCKETS,
+                   .custom_max  = "CFE_PLATFORM_SB_MAX_BLOCK_RESERVE",
+                   .options     = CFE_CONFIGTOOL_LIST_DESCENDING | CFE_CONFIGTOOL_USE_LEADING_ZERO},
+    },
 
     {0} /* Keep this last */
 };
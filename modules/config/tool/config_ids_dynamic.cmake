@@ -19,4 +19,5 @@ list(APPEND CFE_CONFIG_IDS
   PLATFORM_ES_MEM_BLOCK_SIZE
   PLATFORM_ES_CDS_MEM_BLOCK_SIZE
   PLATFORM_SB_MEM_BLOCK_SIZE
+  PLATFORM_SB_MEM_BLOCK_RESERVE
 )
@@ -1061,6 +1061,44 @@ void CFE_ES_ProcessAsyncEvent(void);
 ******************************************************************************/
 CFE_Status_t CFE_ES_RegisterCDS(CFE_ES_CDSHandle_t *CDSHandlePtr, size_t BlockSize, const char *Name);
 
+/*****************************************************************************/
+/**
+** \brief Reserve space in the Critical Data Store (CDS) for a block that survives an interrupted write
+**
+** \par Description
+**        This routine is the same as #CFE_ES_RegisterCDS, but the block keeps two copies of the
+**        data, each with a sequence number.  Each #CFE_ES_CopyToCDS writes the copy that does not
+**        hold the newest data, and #CFE_ES_RestoreFromCDS returns the newest copy that passes its
+**        data integrity check.  If a Processor Reset occurs while the block is being written, the
+**        data from the previous write is restored instead of the block being lost.
+**
+** \par Assumptions, External Events, and Notes:
+**        The block takes twice as much CDS memory as a block registered with #CFE_ES_RegisterCDS.
+**        Whether the block is double buffered is not kept in the CDS, so the application must
+**        register the block with this routine every time, including after a Processor Reset.
+**        Registering an existing block with the other routine reserves a new block.
+**        #CFE_ES_CopyToCDSRange is not supported for a double buffered block.
+**
+** \param[out]   CDSHandlePtr   Pointer Application's variable that will contain the CDS Memory Block Handle @nonnull.
+**
+** \param[in]   BlockSize   The number of bytes needed in the CDS, for one copy of the data @nonzero.
+**
+** \param[in]   Name        A pointer to a character string @nonnull containing an application
+**                          unique name of #CFE_MISSION_ES_CDS_MAX_NAME_LENGTH characters or less.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS               The memory block was successfully created in the CDS.
+** \retval #CFE_ES_NOT_IMPLEMENTED    The processor does not support a Critical Data Store.
+** \retval #CFE_ES_CDS_ALREADY_EXISTS \copybrief CFE_ES_CDS_ALREADY_EXISTS
+** \retval #CFE_ES_CDS_INVALID_SIZE   \copybrief CFE_ES_CDS_INVALID_SIZE
+** \retval #CFE_ES_CDS_INVALID_NAME   \copybrief CFE_ES_CDS_INVALID_NAME
+** \retval #CFE_ES_BAD_ARGUMENT       \copybrief CFE_ES_BAD_ARGUMENT
+**
+** \sa #CFE_ES_RegisterCDS, #CFE_ES_CopyToCDS, #CFE_ES_RestoreFromCDS
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_RegisterCDSDoubleBuffered(CFE_ES_CDSHandle_t *CDSHandlePtr, size_t BlockSize, const char *Name);
+
 /*****************************************************************************/
 /**
 ** \brief Get a CDS Block ID associated with a specified CDS Block name
@@ -1143,6 +1181,103 @@ CFE_Status_t CFE_ES_GetCDSBlockName(char *BlockName, CFE_ES_CDSHandle_t BlockId,
 */
 CFE_Status_t CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, const void *DataToCopy);
 
+/*****************************************************************************/
+/**
+** \brief Save part of a block of data in the Critical Data Store (CDS)
+**
+** \par Description
+**        This routine copies a specified block of memory into a range of a Critical Data Store
+**        block that had been previously registered via #CFE_ES_RegisterCDS.  The rest of the
+**        CDS block is left as it is.
+**
+** \par Assumptions, External Events, and Notes:
+**        Only the bytes within the range that differ from the current content of the CDS are
+**        written, and the data integrity check maintained by the CDS is updated from the
+**        previous and new content of the range without reading the rest of the block.  This
+**        makes it well suited to applications that keep a large CDS block up to date with
+**        small changes.  The CDS block should have been filled using #CFE_ES_CopyToCDS at
+**        least once before, otherwise the data integrity check will not match.  This routine is not
+**        supported for blocks registered with #CFE_ES_RegisterCDSDoubleBuffered.
+**
+** \param[in]   Handle       The handle of the CDS block that was previously obtained from #CFE_ES_RegisterCDS.
+**
+** \param[in]   DataToCopy   A Pointer to the new content of the range, Size bytes long @nonnull.
+**
+** \param[in]   Offset       The offset of the range within the CDS block, in bytes.
+**
+** \param[in]   Size         The size of the range, in bytes.  The range must be entirely within the block.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID   \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_ES_BAD_ARGUMENT               \copybrief CFE_ES_BAD_ARGUMENT
+** \retval #CFE_ES_NOT_IMPLEMENTED            The CDS block is double buffered.
+**
+** \sa #CFE_ES_RegisterCDS, #CFE_ES_CopyToCDS, #CFE_ES_RestoreFromCDS
+**
+*/
+CFE_Status_t CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, const void *DataToCopy, size_t Offset, size_t Size);
+
+/*****************************************************************************/
+/**
+** \brief Post a block of data to be saved in the Critical Data Store (CDS) later
+**
+** \par Description
+**        This routine copies a specified block of memory into a RAM staging buffer for a
+**        Critical Data Store block that had been previously registered via #CFE_ES_RegisterCDS,
+**        and returns without writing to the CDS.  The ES background task writes the latest
+**        posted data to the CDS at most once every #CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_RATE
+**        milliseconds, so an application that updates its CDS block very often (e.g. every
+**        cycle) pays for the copy only, and not for a CDS write and data integrity check each
+**        time.  The block of memory to be copied must be at least as big as the size specified
+**        when registering the CDS.
+**
+** \par Assumptions, External Events, and Notes:
+**        Data that is posted but not yet written is lost if the processor resets, so the CDS
+**        may hold data up to #CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_RATE milliseconds old.  Use
+**        #CFE_ES_FlushCDS to make sure posted data is in the CDS.  #CFE_ES_RestoreFromCDS
+**        returns the latest posted data, and #CFE_ES_CopyToCDS replaces it.  If no staging
+**        buffer is available for the block, the data is written to the CDS before this
+**        routine returns, the same as #CFE_ES_CopyToCDS.
+**
+** \param[in]   Handle       The handle of the CDS block that was previously obtained from #CFE_ES_RegisterCDS.
+**
+** \param[in]   DataToCopy   A Pointer to the block of memory to be copied into the CDS @nonnull.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID   \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_ES_BAD_ARGUMENT               \copybrief CFE_ES_BAD_ARGUMENT
+**
+** \sa #CFE_ES_RegisterCDS, #CFE_ES_FlushCDS, #CFE_ES_CopyToCDS, #CFE_ES_RestoreFromCDS
+**
+*/
+CFE_Status_t CFE_ES_CopyToCDSDeferred(CFE_ES_CDSHandle_t Handle, const void *DataToCopy);
+
+/*****************************************************************************/
+/**
+** \brief Write posted data to the Critical Data Store (CDS) now
+**
+** \par Description
+**        This routine writes the data posted with #CFE_ES_CopyToCDSDeferred for the CDS block
+**        identified with the \c Handle, if it is not yet written.  When it returns successfully,
+**        all data posted for the block before the call is in the CDS.  Nothing is written if no
+**        data is pending.
+**
+** \par Assumptions, External Events, and Notes:
+**        The posted data is no longer pending after this call, even if writing it failed.
+**
+** \param[in]   Handle       The handle of the CDS block that was previously obtained from #CFE_ES_RegisterCDS.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID   \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+**
+** \sa #CFE_ES_CopyToCDSDeferred
+**
+*/
+CFE_Status_t CFE_ES_FlushCDS(CFE_ES_CDSHandle_t Handle);
+
 /*****************************************************************************/
 /**
 ** \brief Recover a block of data from the Critical Data Store (CDS)
@@ -1352,6 +1487,105 @@ CFE_Status_t CFE_ES_PoolCreateEx_WithAlignment(CFE_ES_MemHandle_t *PoolID, void
                                                uint16 NumBlockSizes, const size_t *BlockSizes, bool UseMutex,
                                                size_t Alignment);
 
+/*****************************************************************************/
+/**
+** \brief Initializes a memory pool created by an application with application specified block sizes and options.
+**
+** \par Description
+**        This routine initializes a pool of memory supplied by the calling application, in the same way as
+**        #CFE_ES_PoolCreateEx, with additional options selected by \c Flags.
+**
+**        With #CFE_ES_POOL_TASK_CACHE, each task that allocates from the pool keeps a small cache of free
+**        blocks of each size.  Buffers are taken from and returned to the calling task's cache without
+**        taking the pool mutex, which is only taken to move blocks between the cache and the pool in
+**        batches.  This suits pools that are used by several tasks at a high rate.
+**
+**        With #CFE_ES_POOL_BUDDY, the pool is managed as a binary buddy allocator instead of a fixed set
+**        of block sizes.  Freed blocks are merged with their free neighbors and can be split again for
+**        requests of any size, so pools whose mix of buffer sizes changes over time do not run out of
+**        memory while holding free blocks of the wrong size.  Each allocation and release takes a number
+**        of steps bounded by the number of block sizes.
+**
+**        With #CFE_ES_POOL_DIAGNOSTICS, the pool keeps the usage history reported by #CFE_ES_GetMemPoolDiag.
+**        Without a mutex (#CFE_ES_POOL_USE_MUTEX or #CFE_ES_POOL_TASK_CACHE) no lock times are recorded.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The size of the pool must be an integral number of 32-bit words
+**        -# The start address of the pool must be 32-bit aligned
+**        -# Blocks held in task caches are reported as free by #CFE_ES_GetMemPoolStats, but can only be
+**           allocated by the task holding them.  Up to #CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH blocks of
+**           each size may be held by each of #CFE_PLATFORM_ES_POOL_TASK_CACHES tasks.
+**        -# A buffer may be returned to the pool by a different task than the one that allocated it.
+**        -# In a buddy pool the block sizes are the powers of two, less the block overhead, from the smallest
+**           to the largest entry of \c BlockSizes.  Up to #CFE_PLATFORM_ES_POOL_MAX_BUCKETS sizes are used;
+**           if the range needs more, the smallest sizes are dropped.  Blocks only merge up to the largest
+**           size, so it should be well below the pool size.
+**
+** \param[out]   PoolID        A pointer to the variable the caller wishes to have the memory pool handle kept in
+**                             @nonnull.
+**
+** \param[in]   MemPtr         A Pointer to the pool of memory created by the calling application @nonnull.  This
+**                             address must be aligned suitably for the processor architecture.
+**
+** \param[in]   Size           The size of the pool of memory @nonzero.
+**
+** \param[in]   NumBlockSizes  The number of different block sizes specified in the \c BlockSizes array, as for
+**                             #CFE_ES_PoolCreateEx.
+**
+** \param[in]   BlockSizes     Pointer to an array of sizes, or NULL to use the default block sizes.
+**
+** \param[in]   Flags          Bitwise OR of #CFE_ES_POOL_USE_MUTEX, #CFE_ES_POOL_TASK_CACHE,
+**                             #CFE_ES_POOL_BUDDY and #CFE_ES_POOL_DIAGNOSTICS, or 0.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_ES_BAD_ARGUMENT               \copybrief CFE_ES_BAD_ARGUMENT
+** \retval #CFE_ES_NO_RESOURCE_IDS_AVAILABLE  \copybrief CFE_ES_NO_RESOURCE_IDS_AVAILABLE
+** \retval #CFE_STATUS_EXTERNAL_RESOURCE_FAIL \covtest \copybrief CFE_STATUS_EXTERNAL_RESOURCE_FAIL
+**
+** \sa #CFE_ES_PoolCreateEx, #CFE_ES_GetPoolBuf, #CFE_ES_PutPoolBuf, #CFE_ES_GetMemPoolStats
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_PoolCreateWithFlags(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
+                                        const size_t *BlockSizes, uint32 Flags);
+
+/*****************************************************************************/
+/**
+** \brief Generates a geometric set of block sizes for a memory pool
+**
+** \par Description
+**        This routine fills in a block size list for use with #CFE_ES_PoolCreateEx.  The sizes
+**        grow geometrically from \c MinBlockSize to \c MaxBlockSize, each one as large as
+**        possible while keeping the space wasted by any allocation below \c MaxWastePercent
+**        of its block.  This bounds internal fragmentation using as few block sizes as possible.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Sizes below 100 / \c MaxWastePercent bytes are spaced one byte apart, which is the
+**           closest whole-byte approximation of the bound.
+**        -# The resulting list always ends with \c MaxBlockSize.
+**
+** \param[out]   BlockSizes      Buffer to store the block sizes, in ascending order @nonnull.
+**
+** \param[inout] NumBlockSizes   On input, the number of entries in \c BlockSizes @nonnull.  On output, the
+**                               number of block sizes generated.  No more than #CFE_PLATFORM_ES_POOL_MAX_BUCKETS
+**                               sizes are generated regardless of the buffer size.
+**
+** \param[in]    MinBlockSize    The smallest block size @nonzero.
+**
+** \param[in]    MaxBlockSize    The largest block size, must not be less than \c MinBlockSize.
+**
+** \param[in]    MaxWastePercent The upper bound on the unused part of a block, from 1 to 99.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS           \copybrief CFE_SUCCESS
+** \retval #CFE_ES_BAD_ARGUMENT   \copybrief CFE_ES_BAD_ARGUMENT
+**
+** \sa #CFE_ES_PoolCreateEx
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_PoolGeometricBlockSizes(size_t *BlockSizes, uint16 *NumBlockSizes, size_t MinBlockSize,
+                                            size_t MaxBlockSize, uint16 MaxWastePercent);
+
 /*****************************************************************************/
 /**
 ** \brief Deletes a memory pool that was previously created
@@ -1482,6 +1716,37 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr);
 **
 ******************************************************************************/
 CFE_Status_t CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr, CFE_ES_MemHandle_t Handle);
+
+/*****************************************************************************/
+/**
+** \brief Extracts the diagnostics maintained by the memory pool software
+**
+** \par Description
+**        This routine fills the #CFE_ES_MemPoolDiag_t data structure with the free space and
+**        fragmentation of the memory pool and, if it was created with #CFE_ES_POOL_DIAGNOSTICS,
+**        its allocation history.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The fragmentation is the share of the free space, in tenths of a percent, that lies
+**           outside the largest free block or area.  Blocks held in task caches are not counted
+**           as free.
+**        -# Times are measured with the PSP timebase and are only meaningful if each is shorter
+**           than 2^32 ticks.
+**
+** \param[out]   BufPtr      Pointer to #CFE_ES_MemPoolDiag_t data structure @nonnull to be
+**                           filled with memory pool diagnostics.
+**
+** \param[in]   Handle      The handle to the memory pool whose diagnostics are desired.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                      \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID  \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_ES_BAD_ARGUMENT              \copybrief CFE_ES_BAD_ARGUMENT
+**
+** \sa #CFE_ES_PoolCreateWithFlags, #CFE_ES_GetMemPoolStats
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_GetMemPoolDiag(CFE_ES_MemPoolDiag_t *BufPtr, CFE_ES_MemHandle_t Handle);
 /**@}*/
 
 /** @defgroup CFEAPIESPerfMon cFE Performance Monitor APIs
@@ -1549,6 +1814,13 @@ CFE_Status_t CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr, CFE_ES_MemHan
 **      if DataStart == DataEnd then the buffer is either empty or full
 **      depending on the value of the DataCount
 **
+**  No lock is taken; concurrent callers claim buffer slots atomically,
+**  so this may be called from any task or context without blocking.
+**  The time is read after the slot is claimed, so when several tasks log
+**  at nearly the same time, entries can be slightly out of time order in
+**  the buffer and the dump file.  Analysis tools should order entries by
+**  their time values rather than their position.
+**
 **  Time is stored as 2 32 bit integers, (TimerLower32, TimerUpper32):
 **      TimerLower32 is the current value of the hardware timer register.
 **      TimerUpper32 is the number of times the timer has rolled over.
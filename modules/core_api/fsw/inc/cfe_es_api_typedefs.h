@@ -86,7 +86,7 @@ typedef void *CFE_ES_StackPointer_t; /* aka osal_stackptr_t in proposed OSAL cha
 /**
  * \brief Checksum/CRC algorithm identifiers
  *
- * Currently only CFE_ES_CrcType_16_ARC is supported.
+ * Currently CFE_ES_CrcType_16_ARC and CFE_ES_CrcType_32_C are supported.
  *
  * All defined CRC algorithms should include a check value, which is the accepted
  * result of computing the CRC across the fixed string "123456789"
@@ -112,26 +112,43 @@ typedef enum CFE_ES_CrcType_Enum
      */
     CFE_ES_CrcType_16_ARC = 1,
 
+    /**
+     * \brief Implementation of CRC-32C (Castagnoli)
+     *
+     * \par
+     *   Polynomial: 0x1EDC6F41 <br>
+     *   Initialization: 0xFFFFFFFF <br>
+     *   Reflect Input/Output: true <br>
+     *   Check value: 0xe3069283 <br>
+     *   XorOut: 0xFFFFFFFF <br>
+     *
+     * The initialization and final XOR are applied within each call, so the
+     * input CRC for the first block is 0, and for each following block of a
+     * non-contiguous region it is the result of the previous call.
+     */
+    CFE_ES_CrcType_32_C = 2,
+
     /**
      * Placeholder for end of normal enumeration list
      * This should reflect the number of algorithms defined.
      */
-    CFE_ES_CrcType_MAX = 2,
+    CFE_ES_CrcType_MAX = 3,
 
     /*
      * Backward compatibility values.
      * For compatibility with apps, these simplified symbols need to be defined,
-     * and they also must map to nonzero values.
+     * and they also must map to nonzero values.  The values are fixed, so they
+     * do not change when new algorithms are added above.
      */
 
     /** CRC-16 historically implied CRC-16/ARC */
     CFE_ES_CrcType_CRC_16 = CFE_ES_CrcType_16_ARC,
 
     /**< CRC-8 historically defined but not implemented, value must not be 0 */
-    CFE_ES_CrcType_CRC_8 = CFE_ES_CrcType_MAX + 1,
+    CFE_ES_CrcType_CRC_8 = 3,
 
     /**< CRC-32 historically defined but not implemented, value must not be 0 */
-    CFE_ES_CrcType_CRC_32 = CFE_ES_CrcType_MAX + 2,
+    CFE_ES_CrcType_CRC_32 = 4,
 
 } CFE_ES_CrcType_Enum_t;
 
@@ -240,4 +257,46 @@ typedef void *CFE_ES_MemPoolBuf_t;
 #define CFE_ES_NO_MUTEX  false /**< \brief Indicates that the memory pool selection will not use a semaphore */
 #define CFE_ES_USE_MUTEX true  /**< \brief Indicates that the memory pool selection will use a semaphore */
 
+/** \name Memory Pool Creation Flags */
+/** \{ */
+
+/**
+ * \brief Serialize all operations on the memory pool with a mutex
+ *
+ * Equivalent to #CFE_ES_USE_MUTEX for CFE_ES_PoolCreateEx().
+ */
+#define CFE_ES_POOL_USE_MUTEX 0x01
+
+/**
+ * \brief Give each task that uses the memory pool a cache of free blocks
+ *
+ * Most CFE_ES_GetPoolBuf() and CFE_ES_PutPoolBuf() calls are then served from
+ * the calling task's own cache without taking the pool mutex.  A pool using
+ * task caches is always mutex-protected, as the caches are refilled and drained
+ * under the mutex.
+ */
+#define CFE_ES_POOL_TASK_CACHE 0x02
+
+/**
+ * \brief Manage the memory pool as a binary buddy allocator
+ *
+ * Block sizes are powers of two covering the range of the given block size
+ * list.  Larger free blocks are split to satisfy smaller requests, and freed
+ * blocks are merged with their free neighbors, so memory released by one
+ * size can be reused by any other.
+ */
+#define CFE_ES_POOL_BUDDY 0x04
+
+/**
+ * \brief Keep allocation diagnostics for the memory pool
+ *
+ * The pool records how many blocks of each size are held by callers and the
+ * most held at once, the number of failed requests, and how long requests
+ * take and the pool mutex is held.  These are reported by
+ * #CFE_ES_GetMemPoolDiag at a small cost on every request.
+ */
+#define CFE_ES_POOL_DIAGNOSTICS 0x08
+
+/** \} */
+
 #endif /* CFE_ES_API_TYPEDEFS_H */
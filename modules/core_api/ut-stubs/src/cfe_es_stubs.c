@@ -109,6 +109,42 @@ CFE_Status_t CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, const void *DataToCopy)
     return UT_GenStub_GetReturnValue(CFE_ES_CopyToCDS, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_CopyToCDSDeferred()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_CopyToCDSDeferred(CFE_ES_CDSHandle_t Handle, const void *DataToCopy)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_CopyToCDSDeferred, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_CopyToCDSDeferred, CFE_ES_CDSHandle_t, Handle);
+    UT_GenStub_AddParam(CFE_ES_CopyToCDSDeferred, const void *, DataToCopy);
+
+    UT_GenStub_Execute(CFE_ES_CopyToCDSDeferred, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_CopyToCDSDeferred, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_CopyToCDSRange()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, const void *DataToCopy, size_t Offset, size_t Size)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_CopyToCDSRange, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_CopyToCDSRange, CFE_ES_CDSHandle_t, Handle);
+    UT_GenStub_AddParam(CFE_ES_CopyToCDSRange, const void *, DataToCopy);
+    UT_GenStub_AddParam(CFE_ES_CopyToCDSRange, size_t, Offset);
+    UT_GenStub_AddParam(CFE_ES_CopyToCDSRange, size_t, Size);
+
+    UT_GenStub_Execute(CFE_ES_CopyToCDSRange, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_CopyToCDSRange, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_CounterID_ToIndex()
@@ -221,6 +257,22 @@ void CFE_ES_ExitChildTask(void)
     UT_GenStub_Execute(CFE_ES_ExitChildTask, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_FlushCDS()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_FlushCDS(CFE_ES_CDSHandle_t Handle)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_FlushCDS, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_FlushCDS, CFE_ES_CDSHandle_t, Handle);
+
+    UT_GenStub_Execute(CFE_ES_FlushCDS, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_FlushCDS, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_GetAppID()
@@ -428,6 +480,23 @@ CFE_Status_t CFE_ES_GetLibName(char *LibName, CFE_ES_LibId_t LibId, size_t Buffe
     return UT_GenStub_GetReturnValue(CFE_ES_GetLibName, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_GetMemPoolDiag()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_GetMemPoolDiag(CFE_ES_MemPoolDiag_t *BufPtr, CFE_ES_MemHandle_t Handle)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_GetMemPoolDiag, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_GetMemPoolDiag, CFE_ES_MemPoolDiag_t *, BufPtr);
+    UT_GenStub_AddParam(CFE_ES_GetMemPoolDiag, CFE_ES_MemHandle_t, Handle);
+
+    UT_GenStub_Execute(CFE_ES_GetMemPoolDiag, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_GetMemPoolDiag, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_GetMemPoolStats()
@@ -735,6 +804,28 @@ CFE_Status_t CFE_ES_PoolCreateNoSem(CFE_ES_MemHandle_t *PoolID, void *MemPtr, si
     return UT_GenStub_GetReturnValue(CFE_ES_PoolCreateNoSem, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_PoolCreateWithFlags()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_PoolCreateWithFlags(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
+                                        const size_t *BlockSizes, uint32 Flags)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_PoolCreateWithFlags, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_PoolCreateWithFlags, CFE_ES_MemHandle_t *, PoolID);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateWithFlags, void *, MemPtr);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateWithFlags, size_t, Size);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateWithFlags, uint16, NumBlockSizes);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateWithFlags, const size_t *, BlockSizes);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateWithFlags, uint32, Flags);
+
+    UT_GenStub_Execute(CFE_ES_PoolCreateWithFlags, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_PoolCreateWithFlags, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_PoolDelete()
@@ -751,6 +842,27 @@ int32 CFE_ES_PoolDelete(CFE_ES_MemHandle_t PoolID)
     return UT_GenStub_GetReturnValue(CFE_ES_PoolDelete, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_PoolGeometricBlockSizes()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_PoolGeometricBlockSizes(size_t *BlockSizes, uint16 *NumBlockSizes, size_t MinBlockSize,
+                                            size_t MaxBlockSize, uint16 MaxWastePercent)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_PoolGeometricBlockSizes, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_PoolGeometricBlockSizes, size_t *, BlockSizes);
+    UT_GenStub_AddParam(CFE_ES_PoolGeometricBlockSizes, uint16 *, NumBlockSizes);
+    UT_GenStub_AddParam(CFE_ES_PoolGeometricBlockSizes, size_t, MinBlockSize);
+    UT_GenStub_AddParam(CFE_ES_PoolGeometricBlockSizes, size_t, MaxBlockSize);
+    UT_GenStub_AddParam(CFE_ES_PoolGeometricBlockSizes, uint16, MaxWastePercent);
+
+    UT_GenStub_Execute(CFE_ES_PoolGeometricBlockSizes, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_PoolGeometricBlockSizes, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_ProcessAsyncEvent()
@@ -797,6 +909,24 @@ CFE_Status_t CFE_ES_RegisterCDS(CFE_ES_CDSHandle_t *CDSHandlePtr, size_t BlockSi
     return UT_GenStub_GetReturnValue(CFE_ES_RegisterCDS, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_RegisterCDSDoubleBuffered()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_RegisterCDSDoubleBuffered(CFE_ES_CDSHandle_t *CDSHandlePtr, size_t BlockSize, const char *Name)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_RegisterCDSDoubleBuffered, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_RegisterCDSDoubleBuffered, CFE_ES_CDSHandle_t *, CDSHandlePtr);
+    UT_GenStub_AddParam(CFE_ES_RegisterCDSDoubleBuffered, size_t, BlockSize);
+    UT_GenStub_AddParam(CFE_ES_RegisterCDSDoubleBuffered, const char *, Name);
+
+    UT_GenStub_Execute(CFE_ES_RegisterCDSDoubleBuffered, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_RegisterCDSDoubleBuffered, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_RegisterGenCounter()
@@ -0,0 +1,162 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Minimal set of atomic operations shared between CFE core modules
+ *
+ * These are thin wrappers around the GCC-style compiler atomic builtins,
+ * so the core code does not require C11 <stdatomic.h> where those are
+ * available.  Other compilers fall back to the C11 <stdatomic.h>
+ * operations, which also changes the storage type to _Atomic.  All
+ * operations are sequentially consistent unless otherwise noted.  They are
+ * intended for small counters and flags that are updated outside of a
+ * module lock; anything more complex should continue to use the module mutex.
+ */
+
+#ifndef CFE_CORE_ATOMIC_H
+#define CFE_CORE_ATOMIC_H
+
+#include "common_types.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CFE_CORE_ATOMIC_USE_BUILTINS
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+#else
+#error CFE core atomic operations require the __atomic builtins or C11 <stdatomic.h>
+#endif
+
+/**
+ * @brief Atomic 32-bit storage type
+ *
+ * Use only with the CFE_Atomic functions below
+ */
+#ifdef CFE_CORE_ATOMIC_USE_BUILTINS
+typedef volatile uint32 CFE_Atomic_Uint32_t;
+#else
+typedef _Atomic uint32 CFE_Atomic_Uint32_t;
+#endif
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically read a value
+ *
+ * @param[in] Ptr  the atomic object
+ * @returns the current value
+ */
+static inline uint32 CFE_Atomic_Load(CFE_Atomic_Uint32_t *Ptr)
+{
+#ifdef CFE_CORE_ATOMIC_USE_BUILTINS
+    return __atomic_load_n(Ptr, __ATOMIC_SEQ_CST);
+#else
+    return atomic_load(Ptr);
+#endif
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically write a value
+ *
+ * @param[out] Ptr    the atomic object
+ * @param[in]  Value  the value to store
+ */
+static inline void CFE_Atomic_Store(CFE_Atomic_Uint32_t *Ptr, uint32 Value)
+{
+#ifdef CFE_CORE_ATOMIC_USE_BUILTINS
+    __atomic_store_n(Ptr, Value, __ATOMIC_SEQ_CST);
+#else
+    atomic_store(Ptr, Value);
+#endif
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically add to a value
+ *
+ * @param[in,out] Ptr    the atomic object
+ * @param[in]     Value  the amount to add
+ * @returns the value prior to the addition
+ */
+static inline uint32 CFE_Atomic_FetchAdd(CFE_Atomic_Uint32_t *Ptr, uint32 Value)
+{
+#ifdef CFE_CORE_ATOMIC_USE_BUILTINS
+    return __atomic_fetch_add(Ptr, Value, __ATOMIC_SEQ_CST);
+#else
+    return atomic_fetch_add(Ptr, Value);
+#endif
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically subtract from a value
+ *
+ * @param[in,out] Ptr    the atomic object
+ * @param[in]     Value  the amount to subtract
+ * @returns the value prior to the subtraction
+ */
+static inline uint32 CFE_Atomic_FetchSub(CFE_Atomic_Uint32_t *Ptr, uint32 Value)
+{
+#ifdef CFE_CORE_ATOMIC_USE_BUILTINS
+    return __atomic_fetch_sub(Ptr, Value, __ATOMIC_SEQ_CST);
+#else
+    return atomic_fetch_sub(Ptr, Value);
+#endif
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically replace a value if it is unchanged
+ *
+ * If the object still holds *Expected it is set to Desired.  Otherwise
+ * *Expected is updated with the value that was actually found, so the
+ * caller can recompute and retry.
+ *
+ * @param[in,out] Ptr       the atomic object
+ * @param[in,out] Expected  the value the caller last observed
+ * @param[in]     Desired   the replacement value
+ * @returns true if the value was replaced, false if another writer got there first
+ */
+static inline bool CFE_Atomic_CompareExchange(CFE_Atomic_Uint32_t *Ptr, uint32 *Expected, uint32 Desired)
+{
+#ifdef CFE_CORE_ATOMIC_USE_BUILTINS
+    return __atomic_compare_exchange_n(Ptr, Expected, Desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#else
+    return atomic_compare_exchange_strong(Ptr, Expected, Desired);
+#endif
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Order prior reads before subsequent reads
+ *
+ * Ensures that plain (non-atomic) loads issued before this call are
+ * complete before any load issued after it.  Used by sequence-checked
+ * readers to re-validate a counter after reading the data it protects.
+ */
+static inline void CFE_Atomic_ReadFence(void)
+{
+#ifdef CFE_CORE_ATOMIC_USE_BUILTINS
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+#else
+    atomic_thread_fence(memory_order_acquire);
+#endif
+}
+
+#endif /* CFE_CORE_ATOMIC_H */
@@ -35,6 +35,52 @@
 
 #include "common_types.h"
 #include "cfe_es_extern_typedefs.h"
+#include "cfe_es_api_typedefs.h"
+
+/**
+ * \brief Return address of the function this is used in
+ *
+ * For passing the allocation site to #CFE_ES_GetPoolBufForCaller.  This is 0
+ * with compilers that do not provide it.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define CFE_ES_CALLER_ADDRESS() ((cpuaddr)__builtin_return_address(0))
+#else
+#define CFE_ES_CALLER_ADDRESS() ((cpuaddr)0)
+#endif
+
+/**
+ * \brief Function called by the ES background task to do some work for a background job
+ *
+ * This uses "cooperative multitasking" -- the function should do some limited work, then return to
+ * the background task.  It will be called again after a delay period to do more work.
+ *
+ * \param ElapsedTime Time in milliseconds since the job was last called
+ * \param Arg         The JobArg the job was registered with
+ *
+ * \return true if the job is active (has more work to do), false if it is idle
+ */
+typedef bool (*CFE_ES_BackgroundJobFunc_t)(uint32 ElapsedTime, void *Arg);
+
+/**
+ * \brief Parameters of a job registered with the ES background task
+ *
+ * Periods and deadlines are in milliseconds.  A job is called once right after it is
+ * registered, and after that each time its period expires or it is woken.  A period
+ * of 0 means the job is only called again when it is woken.  A due job may be held
+ * back by the time budget of the background task until its deadline has passed, or
+ * for up to one second if it has no deadline.
+ */
+typedef struct CFE_ES_BackgroundJobConfig
+{
+    const char *               Name;         /**< Name of the job, reported in telemetry */
+    CFE_ES_BackgroundJobFunc_t RunFunc;      /**< Function that does the work of the job */
+    void *                     JobArg;       /**< Argument passed to RunFunc */
+    uint8                      Priority;     /**< Jobs that are due are called in priority order, lowest first */
+    uint32                     ActivePeriod; /**< max wait/delay time between calls when job is active */
+    uint32                     IdlePeriod;   /**< max wait/delay time between calls when job is idle */
+    uint32                     Deadline;     /**< max delay from the job becoming due to it being called, 0 for none */
+} CFE_ES_BackgroundJobConfig_t;
 
 /*
  * The internal APIs prototyped within this block are only intended to be invoked from
@@ -135,6 +181,75 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
 ******************************************************************************/
 int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices);
 
+/*****************************************************************************/
+/**
+** \brief Registers a job with the ES background task
+**
+** \par Description
+**        Adds a job to those run by the ES background task.  The background task
+**        calls the jobs that are due in order of priority, and measures the time
+**        spent in each of them for the Background Jobs telemetry packet.  Jobs that
+**        wait on outside events should use an idle period of 0 and be woken with
+**        #CFE_ES_WakeBackgroundJob when there is work for them.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Jobs cannot be removed once registered, so this is only intended for use by
+**           the core modules during their initialization.
+**        -# The name and argument must remain valid for as long as the cFE runs.
+**
+** \param[out]  JobNumPtr  Number of the job, to be passed to #CFE_ES_WakeBackgroundJob
+** \param[in]   Config     Parameters of the job
+**
+** \return #CFE_SUCCESS                      \copydoc CFE_SUCCESS
+** \return #CFE_ES_BAD_ARGUMENT              \copydoc CFE_ES_BAD_ARGUMENT
+** \return #CFE_ES_ERR_DUPLICATE_NAME        \copydoc CFE_ES_ERR_DUPLICATE_NAME
+** \return #CFE_ES_NO_RESOURCE_IDS_AVAILABLE \copydoc CFE_ES_NO_RESOURCE_IDS_AVAILABLE
+**
+******************************************************************************/
+int32 CFE_ES_RegisterBackgroundJob(uint32 *JobNumPtr, const CFE_ES_BackgroundJobConfig_t *Config);
+
+/*****************************************************************************/
+/**
+** \brief Gets a buffer from a memory pool on behalf of an application
+**
+** \par Description
+**        Same as #CFE_ES_GetPoolBuf, for core services that allocate blocks
+**        for an application inside one of their own API calls.  When pool
+**        allocations are tracked, the block is recorded at the given site
+**        rather than at the call in the core service.
+**
+** \par Assumptions, External Events, and Notes:
+**        The site is normally #CFE_ES_CALLER_ADDRESS used in the API called by
+**        the application.
+**
+** \param[out]  BufPtr      Pointer to the buffer obtained, see #CFE_ES_GetPoolBuf
+** \param[in]   Handle      The handle of the memory pool
+** \param[in]   Size        The size of the buffer requested
+** \param[in]   CallerAddr  The allocation site to record
+**
+** \return Size of the buffer, or an error code as for #CFE_ES_GetPoolBuf
+**
+******************************************************************************/
+int32 CFE_ES_GetPoolBufForCaller(CFE_ES_MemPoolBuf_t *BufPtr, CFE_ES_MemHandle_t Handle, size_t Size,
+                                 cpuaddr CallerAddr);
+
+/*****************************************************************************/
+/**
+** \brief Wakes up one job of the ES background task
+**
+** \par Description
+**        Marks the job as due and wakes the background task, so the job is called
+**        as soon as the jobs of higher priority allow, without waiting for its
+**        period to expire.
+**
+** \par Assumptions, External Events, and Notes:
+**        Job numbers that were not returned by #CFE_ES_RegisterBackgroundJob are ignored.
+**
+** \param[in]   JobNum     Number of the job to wake
+**
+******************************************************************************/
+void CFE_ES_WakeBackgroundJob(uint32 JobNum);
+
 /**@}*/
 
 #endif /* CFE_ES_CORE_INTERNAL_H */
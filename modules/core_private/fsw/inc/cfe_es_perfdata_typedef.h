@@ -28,6 +28,7 @@
 #include "common_types.h"
 #include "cfe_mission_cfg.h"  /* Required for CFE_MISSION_ES_PERF_MAX_IDS */
 #include "cfe_platform_cfg.h" /* Required for CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE */
+#include "cfe_core_atomic.h"  /* Required for CFE_Atomic_Uint32_t */
 
 #define CFE_ES_PERF_32BIT_WORDS_IN_MASK ((CFE_MISSION_ES_PERF_MAX_IDS) / 32)
 
@@ -46,27 +47,35 @@ typedef struct
     uint32 TimerTicksPerSecond;
     uint32 TimerLow32Rollover;
     /*
-     * The "State" member is marked volatile to help
-     * ensure that an optimizing compiler does not rearrange
-     * or eliminate reads/writes of this value.  It is read
-     * outside of any locking to determine whether or not
-     * the performance log function is enabled.
+     * The "State" member is read outside of any locking to determine
+     * whether or not the performance log function is enabled, and is
+     * changed by the writers when a trigger marker is logged.  It must
+     * only be accessed with the CFE_Atomic functions.
      */
-    volatile uint32 State;
-    uint32          Mode;
-    uint32          TriggerCount;
-    uint32          DataStart;
-    uint32          DataEnd;
-    uint32          DataCount;
-    uint32          InvalidMarkerReported;
-    uint32          FilterTriggerMaskSize;
-    uint32          FilterMask[CFE_ES_PERF_32BIT_WORDS_IN_MASK];
-    uint32          TriggerMask[CFE_ES_PERF_32BIT_WORDS_IN_MASK];
+    CFE_Atomic_Uint32_t State;
+    uint32              Mode;
+    uint32              TriggerCount;
+    uint32              DataStart;
+    uint32              DataEnd;
+    uint32              DataCount;
+    uint32              InvalidMarkerReported;
+    uint32              FilterTriggerMaskSize;
+    uint32              FilterMask[CFE_ES_PERF_32BIT_WORDS_IN_MASK];
+    uint32              TriggerMask[CFE_ES_PERF_32BIT_WORDS_IN_MASK];
 } CFE_ES_PerfMetaData_t;
 
 typedef struct
 {
-    CFE_ES_PerfMetaData_t  MetaData;
+    CFE_ES_PerfMetaData_t MetaData;
+
+    /*
+     * Recording state for the lock-free writers.  These are not part of the
+     * dump file; they are folded into the DataStart/DataEnd/TriggerCount
+     * members of MetaData whenever those need to be reported.
+     */
+    CFE_Atomic_Uint32_t WriteSeq;   /* sequence number of the next slot to be claimed */
+    CFE_Atomic_Uint32_t TriggerSeq; /* sequence number of the trigger entry, if triggered */
+
     CFE_ES_PerfDataEntry_t DataBuffer[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE];
 } CFE_ES_PerfData_t;
 
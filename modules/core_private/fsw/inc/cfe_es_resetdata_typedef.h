@@ -32,6 +32,7 @@
 #include "cfe_es_erlog_typedef.h"       /* Required for CFE_ES_ERLog_t definition */
 #include "cfe_es_perfdata_typedef.h"    /* Required for CFE_ES_PerfData_t definition */
 #include "cfe_evs_log_typedef.h"        /* Required for CFE_EVS_Log_t definition */
+#include "cfe_mission_cfg.h"            /* CFE_MISSION_MAX_PATH_LEN */
 #include "cfe_platform_cfg.h"           /* CFE_PLATFORM_ES_ER_LOG_ENTRIES, CFE_PLATFORM_ES_SYSTEM_LOG_SIZE */
 
 /*
@@ -47,6 +48,22 @@ typedef struct
     uint32 MaxProcessorResetCount;
 } CFE_ES_ResetVariables_t;
 
+/*
+** Startup Script Cache type
+** Holds the startup script as it was last read from a file, so that a
+** processor reset can start the applications without reading it again.
+*/
+typedef struct
+{
+    uint32 Signature;                                       /* Only set once the content is complete */
+    uint32 Crc;                                             /* CRC of the cached content */
+    uint32 Length;                                          /* Length of the cached content */
+    uint32 FileSize;                                        /* Size of the script file */
+    int64  FileTimeMsec;                                    /* Modification time of the script file */
+    char   FileName[CFE_MISSION_MAX_PATH_LEN];              /* Name of the script file */
+    char   Data[CFE_PLATFORM_ES_STARTUP_SCRIPT_CACHE_SIZE]; /* Valid script lines without whitespace */
+} CFE_ES_StartupScriptCache_t;
+
 /*
 ** Executive Services Global Reset Data type
 ** This is the special memory area for ES that is preserved
@@ -91,6 +108,11 @@ typedef struct
     ** EVS Log and associated variables. This needs to be preserved on a processor reset.
     */
     CFE_EVS_Log_t EVS_Log;
+
+    /*
+    ** Startup script as parsed on the last start
+    */
+    CFE_ES_StartupScriptCache_t StartupScript;
 } CFE_ES_ResetData_t;
 
 #endif /* CFE_ES_RESETDATA_TYPEDEF_H */
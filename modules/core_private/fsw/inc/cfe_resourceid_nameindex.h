@@ -0,0 +1,169 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Purpose:
+ *      Fixed-capacity string hash index for resource tables, for use
+ *      within CFE core only.
+ *
+ * The index maps a resource name to the position of its record in a table
+ * owned by the caller.  It does not allocate memory: the caller provides
+ * the slot array, typically sized with CFE_RESOURCEID_NAMEINDEX_SLOTS()
+ * and stored next to the table it indexes.  An all-zero slot array is a
+ * valid empty index.
+ *
+ * The index is only a hint.  Every candidate found by a lookup is confirmed
+ * against the real table through a caller-supplied match function, so a
+ * stale entry can never produce a wrong result.  Updates must be
+ * serialized by the caller, normally under the same lock that protects
+ * the table itself.
+ *
+ * If a record could not be added, the caller should remember that the
+ * index is incomplete and look up names that the index does not find with
+ * CFE_ResourceId_NameIndexScan() until the index is next cleared.
+ */
+
+#ifndef CFE_RESOURCEID_NAMEINDEX_H
+#define CFE_RESOURCEID_NAMEINDEX_H
+
+/*
+ * Includes
+ */
+#include "common_types.h"
+#include "cfe_error.h"
+
+/**
+ * @brief Number of index slots to use for a table of the given size
+ *
+ * Keeping the load factor at or below one half keeps the probe sequences
+ * short and guarantees every record of the table can be indexed.
+ */
+#define CFE_RESOURCEID_NAMEINDEX_SLOTS(n) (2 * (n))
+
+/**
+ * @brief A single slot in a name index
+ *
+ * Entry holds the table index plus one, so that zero marks an empty slot.
+ */
+typedef struct
+{
+    uint32 Hash;  /**< Hash of the name stored in the table record */
+    uint32 Entry; /**< Table index of the record plus one, or 0 if unused */
+} CFE_ResourceId_NameIndexSlot_t;
+
+/**
+ * @brief Confirms that the table record at the given index has the given name
+ *
+ * @param[in] TableIdx  table position of the candidate record
+ * @param[in] Name      the name being looked up
+ * @param[in] Arg       opaque argument passed through from the lookup
+ *
+ * @returns true if the record is in use and has the given name
+ */
+typedef bool (*CFE_ResourceId_NameMatchFunc_t)(uint32 TableIdx, const char *Name, void *Arg);
+
+/******************************************************************************
+ * Function prototypes
+ */
+
+/**
+ *  \brief Compute the hash of a resource name
+ *
+ *  \param[in] Name  Name to hash, must not be NULL
+ *
+ *  \returns Hash value of the name
+ */
+uint32 CFE_ResourceId_NameIndexHash(const char *Name);
+
+/**
+ *  \brief Remove all entries from a name index
+ *
+ *  \param[out] Index     Slot array of the index
+ *  \param[in]  NumSlots  Number of entries in the slot array
+ */
+void CFE_ResourceId_NameIndexClear(CFE_ResourceId_NameIndexSlot_t *Index, uint32 NumSlots);
+
+/**
+ *  \brief Add a table record to a name index
+ *
+ *  Adding a record that is already indexed under the same name has no effect.
+ *
+ *  \param[in,out] Index     Slot array of the index
+ *  \param[in]     NumSlots  Number of entries in the slot array
+ *  \param[in]     Name      Name of the table record
+ *  \param[in]     TableIdx  Table position of the record
+ *
+ *  \returns CFE_SUCCESS if the record is indexed, CFE_STATUS_VALIDATION_FAILURE if the
+ *           inputs are invalid, or CFE_STATUS_RANGE_ERROR if the index is full
+ */
+CFE_Status_t CFE_ResourceId_NameIndexAdd(CFE_ResourceId_NameIndexSlot_t *Index, uint32 NumSlots, const char *Name,
+                                         uint32 TableIdx);
+
+/**
+ *  \brief Remove a table record from a name index
+ *
+ *  The name must be the same one the record was added under.  Removing a
+ *  record that is not indexed has no effect.
+ *
+ *  \param[in,out] Index     Slot array of the index
+ *  \param[in]     NumSlots  Number of entries in the slot array
+ *  \param[in]     Name      Name of the table record
+ *  \param[in]     TableIdx  Table position of the record
+ */
+void CFE_ResourceId_NameIndexRemove(CFE_ResourceId_NameIndexSlot_t *Index, uint32 NumSlots, const char *Name,
+                                    uint32 TableIdx);
+
+/**
+ *  \brief Look up a table record by name
+ *
+ *  Each candidate with a matching hash is passed to MatchFunc, and the first
+ *  one it accepts is returned.
+ *
+ *  \param[in]  Index        Slot array of the index
+ *  \param[in]  NumSlots     Number of entries in the slot array
+ *  \param[in]  Name         Name to look up
+ *  \param[in]  MatchFunc    Confirms a candidate against the table
+ *  \param[in]  Arg          Opaque argument passed to MatchFunc
+ *  \param[out] TableIdxPtr  Table position of the matching record
+ *
+ *  \returns true if found, false if no indexed record has the name or the inputs are invalid
+ */
+bool CFE_ResourceId_NameIndexFind(const CFE_ResourceId_NameIndexSlot_t *Index, uint32 NumSlots, const char *Name,
+                                  CFE_ResourceId_NameMatchFunc_t MatchFunc, void *Arg, uint32 *TableIdxPtr);
+
+/**
+ *  \brief Look up a table record by name without using an index
+ *
+ *  Passes every table position to MatchFunc in turn and returns the first
+ *  one it accepts.  This is the fallback for a table whose index could not
+ *  hold every record.
+ *
+ *  \param[in]  TableSize    Number of records in the table
+ *  \param[in]  Name         Name to look up
+ *  \param[in]  MatchFunc    Confirms a candidate against the table
+ *  \param[in]  Arg          Opaque argument passed to MatchFunc
+ *  \param[out] TableIdxPtr  Table position of the matching record
+ *
+ *  \returns true if found, false if no record has the name or the inputs are invalid
+ */
+bool CFE_ResourceId_NameIndexScan(uint32 TableSize, const char *Name, CFE_ResourceId_NameMatchFunc_t MatchFunc,
+                                  void *Arg, uint32 *TableIdxPtr);
+
+#endif /* CFE_RESOURCEID_NAMEINDEX_H */
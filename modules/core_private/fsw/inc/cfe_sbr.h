@@ -100,9 +100,15 @@ void CFE_SBR_SetDestListHeadPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t
 /**
  * \brief Increment the sequence counter associated with the supplied route ID
  *
+ * The counter is advanced atomically, wrapping as defined by
+ * CFE_MSG_GetNextSequenceCount(), so this may be called without holding
+ * the SB shared data lock.  Concurrent callers each get a distinct value.
+ *
  * \param[in] RouteId Route ID
+ *
+ * \returns the new sequence counter, or 0 for an invalid route
  */
-void CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId);
+CFE_MSG_SequenceCount_t CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId);
 
 /**
  * \brief Get the sequence counter associated with the supplied route ID
@@ -113,6 +119,15 @@ void CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId);
  */
 CFE_MSG_SequenceCount_t CFE_SBR_GetSequenceCounter(CFE_SBR_RouteId_t RouteId);
 
+/**
+ * \brief Get the number of map collisions recorded when the route was added
+ *
+ * \param[in] RouteId Route ID
+ *
+ * \returns the collision count, or 0 for an invalid route
+ */
+uint32 CFE_SBR_GetRouteCollisions(CFE_SBR_RouteId_t RouteId);
+
 /**
  * \brief Call the supplied callback function for all routes
  *
@@ -104,5 +104,9 @@
 #define UT_OSP_FORMAT_VOLATILE            78
 #define UT_OSP_RELOAD_NO_FILE             79
 #define UT_OSP_EXTERNAL_APP_EXIT          80
+#define UT_OSP_GEOMETRIC_SIZES            81
+#define UT_OSP_STARTUP_CACHED             82
+#define UT_OSP_STARTUP_TOO_LARGE_TO_KEEP  83
+#define UT_OSP_STARTUP_UNKNOWN_DEPENDENCY 84
 
 #endif /* UT_OSPRINTF_STUBS_H */
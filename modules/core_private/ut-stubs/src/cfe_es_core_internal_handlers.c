@@ -32,6 +32,7 @@
 */
 #include <string.h>
 #include "cfe_es_core_internal.h"
+#include "cfe_es.h"
 #include "cfe_resourceid.h"
 #include "cfe_resourceid_basevalue.h"
 
@@ -50,6 +51,28 @@ enum
 ** Functions
 */
 
+/*------------------------------------------------------------
+ *
+ * Default handler for CFE_ES_GetPoolBufForCaller coverage stub function
+ *
+ *------------------------------------------------------------*/
+void UT_DefaultHandler_CFE_ES_GetPoolBufForCaller(void *UserObj, UT_EntryKey_t FuncKey,
+                                                   const UT_StubContext_t *Context)
+{
+    CFE_ES_MemPoolBuf_t *BufPtr = UT_Hook_GetArgValueByName(Context, "BufPtr", CFE_ES_MemPoolBuf_t *);
+    CFE_ES_MemHandle_t   Handle = UT_Hook_GetArgValueByName(Context, "Handle", CFE_ES_MemHandle_t);
+    size_t               Size   = UT_Hook_GetArgValueByName(Context, "Size", size_t);
+    int32                status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    /* The buffer comes from the CFE_ES_GetPoolBuf() stub, so tests set up and check that one */
+    if (status >= 0)
+    {
+        UT_Stub_SetReturnValue(FuncKey, CFE_ES_GetPoolBuf(BufPtr, Handle, Size));
+    }
+}
+
 /*------------------------------------------------------------
  *
  * Default handler for CFE_ES_RegisterCDSEx coverage stub function
@@ -25,6 +25,7 @@
 #include "cfe_es_core_internal.h"
 #include "utgenstub.h"
 
+void UT_DefaultHandler_CFE_ES_GetPoolBufForCaller(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_ES_RegisterCDSEx(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
@@ -58,6 +59,43 @@ int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices)
     return UT_GenStub_GetReturnValue(CFE_ES_DeleteCDS, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_GetPoolBufForCaller()
+ * ----------------------------------------------------
+ */
+int32 CFE_ES_GetPoolBufForCaller(CFE_ES_MemPoolBuf_t *BufPtr, CFE_ES_MemHandle_t Handle, size_t Size,
+                                 cpuaddr CallerAddr)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_GetPoolBufForCaller, int32);
+
+    UT_GenStub_AddParam(CFE_ES_GetPoolBufForCaller, CFE_ES_MemPoolBuf_t *, BufPtr);
+    UT_GenStub_AddParam(CFE_ES_GetPoolBufForCaller, CFE_ES_MemHandle_t, Handle);
+    UT_GenStub_AddParam(CFE_ES_GetPoolBufForCaller, size_t, Size);
+    UT_GenStub_AddParam(CFE_ES_GetPoolBufForCaller, cpuaddr, CallerAddr);
+
+    UT_GenStub_Execute(CFE_ES_GetPoolBufForCaller, Basic, UT_DefaultHandler_CFE_ES_GetPoolBufForCaller);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_GetPoolBufForCaller, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_RegisterBackgroundJob()
+ * ----------------------------------------------------
+ */
+int32 CFE_ES_RegisterBackgroundJob(uint32 *JobNumPtr, const CFE_ES_BackgroundJobConfig_t *Config)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_RegisterBackgroundJob, int32);
+
+    UT_GenStub_AddParam(CFE_ES_RegisterBackgroundJob, uint32 *, JobNumPtr);
+    UT_GenStub_AddParam(CFE_ES_RegisterBackgroundJob, const CFE_ES_BackgroundJobConfig_t *, Config);
+
+    UT_GenStub_Execute(CFE_ES_RegisterBackgroundJob, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_RegisterBackgroundJob, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_RegisterCDSEx()
@@ -86,3 +124,15 @@ void CFE_ES_TaskMain(void)
 {
     UT_GenStub_Execute(CFE_ES_TaskMain, Basic, NULL);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_WakeBackgroundJob()
+ * ----------------------------------------------------
+ */
+void CFE_ES_WakeBackgroundJob(uint32 JobNum)
+{
+    UT_GenStub_AddParam(CFE_ES_WakeBackgroundJob, uint32, JobNum);
+
+    UT_GenStub_Execute(CFE_ES_WakeBackgroundJob, Basic, NULL);
+}
@@ -109,4 +109,8 @@ const char *UT_OSP_MESSAGES[] = {
     [UT_OSP_FORMAT_VOLATILE]            = "%s: Formatting Volatile(RAM) Volume.\n",
     [UT_OSP_RELOAD_NO_FILE]             = "%s: Cannot Reload Application %s, File %s does not exist.\n",
     [UT_OSP_EXTERNAL_APP_EXIT]          = "%s: Application %s called CFE_ES_ExitApp\n",
+    [UT_OSP_GEOMETRIC_SIZES]            = "%s: Cannot fit sizes %lu-%lu with %u%% waste in %u block sizes\n",
+    [UT_OSP_STARTUP_CACHED]             = "%s: Using ES App Startup file kept from last start: %s\n",
+    [UT_OSP_STARTUP_TOO_LARGE_TO_KEEP]  = "%s: Startup file too large to keep for next reset\n",
+    [UT_OSP_STARTUP_UNKNOWN_DEPENDENCY] = "%s: **WARNING** Dependency '%.*s' of %s matches no earlier entry\n",
 };
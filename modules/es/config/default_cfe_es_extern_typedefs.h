@@ -499,4 +499,233 @@ typedef struct CFE_ES_MemPoolStats
                                                                           \brief Contains stats on each block size */
 } CFE_ES_MemPoolStats_t;
 
+/**
+ * \brief Block diagnostics
+ *
+ * Sub-Structure that is used to provide the usage history of a specific
+ * block size/bucket within a memory pool.
+ */
+typedef struct CFE_ES_BlockDiag
+{
+    CFE_ES_MemOffset_t BlockSize; /**< \brief Number of bytes in each of these blocks */
+    uint32             NumLive;   /**< \brief Number of Memory Blocks of this size currently held by callers */
+    uint32             PeakLive;  /**< \brief Highest number of Memory Blocks of this size held at once */
+} CFE_ES_BlockDiag_t;
+
+/**
+ * \brief Memory Pool Diagnostics
+ *
+ * Structure that is used to provide the allocation history and
+ * fragmentation of a memory pool.  Used by the Memory Pool Diagnostics
+ * telemetry message and the memory pool statistics file.
+ *
+ * The counters and block diagnostics are only maintained for pools created
+ * with the #CFE_ES_POOL_DIAGNOSTICS flag, as indicated by DiagEnabled; for
+ * other pools they are zero.  The free space and fragmentation are always
+ * reported.  Times are in PSP timebase ticks.
+ *
+ * \sa #CFE_ES_SEND_MEM_POOL_STATS_CC, #CFE_ES_WRITE_MEM_POOL_STATS_CC
+ */
+typedef struct CFE_ES_MemPoolDiag
+{
+    uint32 AllocFailCount;                                         /**< \cfetlmmnemonic \ES_ALLOCFAILCNT
+                                                                        \brief Number of failed buffer requests */
+    uint32 LockCount;                                              /**< \cfetlmmnemonic \ES_LOCKCNT
+                                                                        \brief Number of times the pool mutex was held */
+    uint32 LockTicks;                                              /**< \cfetlmmnemonic \ES_LOCKTICKS
+                                                                        \brief Total time the pool mutex was held (wraps) */
+    uint32 MaxLockTicks;                                           /**< \cfetlmmnemonic \ES_MAXLOCKTICKS
+                                                                        \brief Longest time the pool mutex was held at once */
+    uint32 MaxGetTicks;                                            /**< \cfetlmmnemonic \ES_MAXGETTICKS
+                                                                        \brief Longest time taken by a buffer request */
+    CFE_ES_MemOffset_t TotalFreeBytes;                             /**< \cfetlmmnemonic \ES_TOTALFREE
+                                                                        \brief Number of free bytes, including blocks on the free lists */
+    CFE_ES_MemOffset_t LargestFreeBytes;                           /**< \cfetlmmnemonic \ES_LARGESTFREE
+                                                                        \brief Size of the largest free block or area */
+    uint16 FragmentationPerMille;                                  /**< \cfetlmmnemonic \ES_FRAGMENTATION
+                                                                        \brief Free space outside the largest free area, in tenths of a percent */
+    uint8 DiagEnabled;                                             /**< \cfetlmmnemonic \ES_DIAGENABLED
+                                                                        \brief Whether the pool maintains the diagnostic counters */
+    uint8              Spare;                                      /**< \brief Spare byte to ensure structure size is multiple of 4 bytes */
+    CFE_ES_BlockDiag_t BlockDiag[CFE_MISSION_ES_POOL_MAX_BUCKETS]; /**< \cfetlmmnemonic \ES_BLKDIAG
+                                                                        \brief Contains history of each block size */
+} CFE_ES_MemPoolDiag_t;
+
+/**
+ * \brief Memory Pool Statistics File Record
+ *
+ * Structure that is used to provide information about a memory pool in
+ * the file written by the Write Memory Pool Statistics command
+ * (#CFE_ES_WRITE_MEM_POOL_STATS_CC).  The file holds one record for each
+ * memory pool in use.
+ *
+ * @note There is not currently a telemetry message directly containing this
+ * data structure, but it does define the format of the data file generated
+ * by the Write Memory Pool Statistics command.  Therefore it should be
+ * considered part of the overall telemetry interface.
+ */
+typedef struct CFE_ES_MemPoolDumpRec
+{
+    CFE_ES_MemHandle_t    PoolHandle; /**< \brief Handle of memory pool */
+    CFE_ES_AppId_t        OwnerAppId; /**< \brief Application that created the memory pool */
+    CFE_ES_MemPoolStats_t PoolStats;  /**< \brief For more info, see #CFE_ES_MemPoolStats_t */
+    CFE_ES_MemPoolDiag_t  PoolDiag;   /**< \brief For more info, see #CFE_ES_MemPoolDiag_t */
+} CFE_ES_MemPoolDumpRec_t;
+
+/**
+ * \brief Memory Pool Allocation Site File Record
+ *
+ * Structure that is used to provide information about the live memory pool
+ * blocks allocated from one site, in the file written by the Write Memory Pool
+ * Allocation Sites command (#CFE_ES_WRITE_POOL_ALLOC_SITES_CC).  A site is the
+ * combination of a pool, an allocating application and a calling address.
+ *
+ * @note There is not currently a telemetry message directly containing this
+ * data structure, but it does define the format of the data file generated
+ * by the Write Memory Pool Allocation Sites command.  Therefore it should be
+ * considered part of the overall telemetry interface.
+ */
+typedef struct CFE_ES_PoolAllocSiteRec
+{
+    CFE_ES_MemHandle_t  PoolHandle;    /**< \brief Handle of memory pool the blocks were allocated from */
+    CFE_ES_AppId_t      AppId;         /**< \brief Application that allocated the blocks */
+    CFE_ES_MemAddress_t CallerAddress; /**< \brief Application code address that allocated the blocks */
+    uint32              NumBlocks;     /**< \brief Number of live blocks allocated from this site */
+    uint32              MaxAgeMsec;    /**< \brief Age of the oldest of these blocks, in milliseconds */
+    CFE_ES_MemOffset_t  TotalBytes;    /**< \brief Total requested size of these blocks */
+} CFE_ES_PoolAllocSiteRec_t;
+
+/**
+ * \brief Performance Marker Duration Statistics
+ *
+ * Sub-Structure that is used to provide the durations measured between
+ * matching entry and exit events of one performance marker, across all tasks.
+ *
+ * Bucket 0 of the histogram counts durations under 2 microseconds; bucket N
+ * counts durations from 2^N up to 2^(N+1) microseconds, and the last bucket
+ * also counts all longer durations.
+ *
+ * \sa #CFE_ES_RESET_PERF_STATS_CC
+ */
+typedef struct CFE_ES_PerfMarkerStats
+{
+    uint32 MarkerId;                                          /**< \cfetlmmnemonic \ES_PERFSTATID
+                                                                   \brief Performance marker these statistics apply to */
+    uint32 Count;                                             /**< \cfetlmmnemonic \ES_PERFSTATCNT
+                                                                   \brief Number of durations measured */
+    uint32 MinUsec;                                           /**< \cfetlmmnemonic \ES_PERFSTATMIN
+                                                                   \brief Shortest duration, in microseconds */
+    uint32 MaxUsec;                                           /**< \cfetlmmnemonic \ES_PERFSTATMAX
+                                                                   \brief Longest duration, in microseconds */
+    uint32 MeanUsec;                                          /**< \cfetlmmnemonic \ES_PERFSTATMEAN
+                                                                   \brief Mean duration, in microseconds */
+    uint32 Histogram[CFE_MISSION_ES_PERF_STATS_HIST_BUCKETS]; /**< \cfetlmmnemonic \ES_PERFSTATHIST
+                                                                   \brief Number of durations in each power of two microsecond bucket */
+} CFE_ES_PerfMarkerStats_t;
+
+/**
+ * @brief Label definitions associated with CFE_ES_StartupPhase_Enum_t
+ */
+enum CFE_ES_StartupPhase
+{
+    /**
+     * @brief A step of CFE_ES_Main, named after the function called
+     */
+    CFE_ES_StartupPhase_MAIN_STEP = 1,
+
+    /**
+     * @brief The system state was reached, named after the state (no duration)
+     */
+    CFE_ES_StartupPhase_SYSTEM_STATE = 2,
+
+    /**
+     * @brief A core module early init function, or the start of a core app up to its startup sync
+     */
+    CFE_ES_StartupPhase_CORE_INIT = 3,
+
+    /**
+     * @brief The load of the module of an app or library
+     */
+    CFE_ES_StartupPhase_MODULE_LOAD = 4,
+
+    /**
+     * @brief The init function of a library
+     */
+    CFE_ES_StartupPhase_LIB_INIT = 5,
+
+    /**
+     * @brief A task entry point was called, named after the task (no duration)
+     */
+    CFE_ES_StartupPhase_TASK_START = 6,
+
+    /**
+     * @brief An app waited in CFE_ES_WaitForSystemState() or CFE_ES_WaitForStartupSync()
+     */
+    CFE_ES_StartupPhase_STARTUP_SYNC = 7,
+
+    /**
+     * @brief An app called CFE_ES_RunLoop() for the first time (no duration)
+     */
+    CFE_ES_StartupPhase_RUN_LOOP = 8
+};
+
+/**
+ * @brief Phase of startup a startup timeline record applies to
+ *
+ * @sa enum CFE_ES_StartupPhase
+ */
+typedef uint8 CFE_ES_StartupPhase_Enum_t;
+
+/**
+ * \brief Startup Timeline Record
+ *
+ * Structure that is used to provide one record of the startup timeline, in
+ * the Startup Timing telemetry message and in the file written once startup
+ * is complete or by the Write Startup Timing command
+ * (#CFE_ES_WRITE_STARTUP_TIMING_CC).  Times are in microseconds from the
+ * start of CFE_ES_Main, taken from the PSP clock.
+ */
+typedef struct CFE_ES_StartupTimingRec
+{
+    char Name[CFE_MISSION_MAX_API_LEN]; /**< \cfetlmmnemonic \ES_STARTUPNAME
+                                             \brief Name of the step, state, core module, app, library or task */
+    uint32 StartUsec;                   /**< \cfetlmmnemonic \ES_STARTUPSTART
+                                             \brief Time the phase started */
+    uint32 DurationUsec;                /**< \cfetlmmnemonic \ES_STARTUPDURATION
+                                             \brief Time the phase took, zero for points in time */
+    CFE_ES_StartupPhase_Enum_t Phase;   /**< \cfetlmmnemonic \ES_STARTUPPHASE
+                                             \brief Phase of startup, see #CFE_ES_StartupPhase_Enum_t */
+    uint8 Spare[3];                     /**< \brief Spare bytes to ensure structure size is multiple of 4 bytes */
+} CFE_ES_StartupTimingRec_t;
+
+/**
+ * \brief Background Job Statistics
+ *
+ * Sub-Structure that is used to provide the run statistics of one job of the
+ * ES background task.  Run times are measured with the PSP clock around each
+ * call of the job, so they are elapsed (wall clock) times.  They include any
+ * time the background task was preempted by higher priority tasks, and are not
+ * the CPU time used by the job.
+ */
+typedef struct CFE_ES_BackgroundJobStats
+{
+    char Name[CFE_MISSION_MAX_API_LEN]; /**< \cfetlmmnemonic \ES_BGJOBNAME
+                                             \brief Name the job was registered with */
+    uint32 RunCount;                    /**< \cfetlmmnemonic \ES_BGJOBRUNS
+                                             \brief Number of times the job was called */
+    uint32 TotalRunMsec;                /**< \cfetlmmnemonic \ES_BGJOBTOTALMS
+                                             \brief Total elapsed time of the job calls, in milliseconds */
+    uint32 MaxRunUsec;                  /**< \cfetlmmnemonic \ES_BGJOBMAXUS
+                                             \brief Longest elapsed time of a single call, in microseconds */
+    uint32 LastRunUsec;                 /**< \cfetlmmnemonic \ES_BGJOBLASTUS
+                                             \brief Elapsed time of the most recent call, in microseconds */
+    uint32 DeadlineMisses;              /**< \cfetlmmnemonic \ES_BGJOBMISSES
+                                             \brief Number of times the job ran later than its deadline */
+    uint8 Priority;                     /**< \cfetlmmnemonic \ES_BGJOBPRIO
+                                             \brief Priority of the job, lower values run first */
+    uint8 IsActive;                     /**< \cfetlmmnemonic \ES_BGJOBACTIVE
+                                             \brief Whether the job reported work in progress when last called */
+    uint8 Spare[2];                     /**< \brief Spare bytes to ensure structure size is multiple of 4 bytes */
+} CFE_ES_BackgroundJobStats_t;
+
 #endif /* CFE_ES_EXTERN_TYPEDEFS_H */
@@ -36,30 +36,34 @@
 
 enum CFE_ES_FunctionCode_
 {
-    CFE_ES_FunctionCode_NOOP                  = 0,
-    CFE_ES_FunctionCode_RESET_COUNTERS        = 1,
-    CFE_ES_FunctionCode_RESTART               = 2,
-    CFE_ES_FunctionCode_START_APP             = 4,
-    CFE_ES_FunctionCode_STOP_APP              = 5,
-    CFE_ES_FunctionCode_RESTART_APP           = 6,
-    CFE_ES_FunctionCode_RELOAD_APP            = 7,
-    CFE_ES_FunctionCode_QUERY_ONE             = 8,
-    CFE_ES_FunctionCode_QUERY_ALL             = 9,
-    CFE_ES_FunctionCode_CLEAR_SYS_LOG         = 10,
-    CFE_ES_FunctionCode_WRITE_SYS_LOG         = 11,
-    CFE_ES_FunctionCode_CLEAR_ER_LOG          = 12,
-    CFE_ES_FunctionCode_WRITE_ER_LOG          = 13,
-    CFE_ES_FunctionCode_START_PERF_DATA       = 14,
-    CFE_ES_FunctionCode_STOP_PERF_DATA        = 15,
-    CFE_ES_FunctionCode_SET_PERF_FILTER_MASK  = 16,
-    CFE_ES_FunctionCode_SET_PERF_TRIGGER_MASK = 17,
-    CFE_ES_FunctionCode_OVER_WRITE_SYS_LOG    = 18,
-    CFE_ES_FunctionCode_RESET_PR_COUNT        = 19,
-    CFE_ES_FunctionCode_SET_MAX_PR_COUNT      = 20,
-    CFE_ES_FunctionCode_DELETE_CDS            = 21,
-    CFE_ES_FunctionCode_SEND_MEM_POOL_STATS   = 22,
-    CFE_ES_FunctionCode_DUMP_CDS_REGISTRY     = 23,
-    CFE_ES_FunctionCode_QUERY_ALL_TASKS       = 24,
+    CFE_ES_FunctionCode_NOOP                   = 0,
+    CFE_ES_FunctionCode_RESET_COUNTERS         = 1,
+    CFE_ES_FunctionCode_RESTART                = 2,
+    CFE_ES_FunctionCode_START_APP              = 4,
+    CFE_ES_FunctionCode_STOP_APP               = 5,
+    CFE_ES_FunctionCode_RESTART_APP            = 6,
+    CFE_ES_FunctionCode_RELOAD_APP             = 7,
+    CFE_ES_FunctionCode_QUERY_ONE              = 8,
+    CFE_ES_FunctionCode_QUERY_ALL              = 9,
+    CFE_ES_FunctionCode_CLEAR_SYS_LOG          = 10,
+    CFE_ES_FunctionCode_WRITE_SYS_LOG          = 11,
+    CFE_ES_FunctionCode_CLEAR_ER_LOG           = 12,
+    CFE_ES_FunctionCode_WRITE_ER_LOG           = 13,
+    CFE_ES_FunctionCode_START_PERF_DATA        = 14,
+    CFE_ES_FunctionCode_STOP_PERF_DATA         = 15,
+    CFE_ES_FunctionCode_SET_PERF_FILTER_MASK   = 16,
+    CFE_ES_FunctionCode_SET_PERF_TRIGGER_MASK  = 17,
+    CFE_ES_FunctionCode_OVER_WRITE_SYS_LOG     = 18,
+    CFE_ES_FunctionCode_RESET_PR_COUNT         = 19,
+    CFE_ES_FunctionCode_SET_MAX_PR_COUNT       = 20,
+    CFE_ES_FunctionCode_DELETE_CDS             = 21,
+    CFE_ES_FunctionCode_SEND_MEM_POOL_STATS    = 22,
+    CFE_ES_FunctionCode_DUMP_CDS_REGISTRY      = 23,
+    CFE_ES_FunctionCode_QUERY_ALL_TASKS        = 24,
+    CFE_ES_FunctionCode_WRITE_MEM_POOL_STATS   = 25,
+    CFE_ES_FunctionCode_WRITE_POOL_ALLOC_SITES = 26,
+    CFE_ES_FunctionCode_RESET_PERF_STATS       = 27,
+    CFE_ES_FunctionCode_WRITE_STARTUP_TIMING   = 28,
 };
 
 #endif
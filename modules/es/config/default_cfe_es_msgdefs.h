@@ -151,7 +151,8 @@ enum CFE_ES_PerfMode
 {
     CFE_ES_PerfTrigger_START = 0,
     CFE_ES_PerfTrigger_CENTER,
-    CFE_ES_PerfTrigger_END
+    CFE_ES_PerfTrigger_END,
+    CFE_ES_PerfTrigger_STREAM
 };
 
 typedef uint32 CFE_ES_PerfMode_Enum_t;
@@ -165,7 +166,7 @@ typedef uint32 CFE_ES_PerfMode_Enum_t;
 typedef struct CFE_ES_StartPerfCmd_Payload
 {
     CFE_ES_PerfMode_Enum_t
-        TriggerMode; /**< \brief Desired trigger position (Start, Center, End). Values defined by #CFE_ES_PerfMode. */
+        TriggerMode; /**< \brief Desired trigger position (Start, Center, End) or Stream. Values defined by #CFE_ES_PerfMode. */
 } CFE_ES_StartPerfCmd_Payload_t;
 
 /**
@@ -255,6 +256,60 @@ typedef struct CFE_ES_PoolStatsTlm_Payload
     CFE_ES_MemPoolStats_t PoolStats; /**< \brief For more info, see #CFE_ES_MemPoolStats_t */
 } CFE_ES_PoolStatsTlm_Payload_t;
 
+/**
+**  \cfeestlm Memory Pool Diagnostics Packet
+**/
+typedef struct CFE_ES_PoolDiagTlm_Payload
+{
+    CFE_ES_MemHandle_t PoolHandle; /**< \cfetlmmnemonic \ES_POOLHANDLE
+                                        \brief Handle of memory pool whose diagnostics are being telemetered */
+    CFE_ES_MemPoolDiag_t PoolDiag; /**< \brief For more info, see #CFE_ES_MemPoolDiag_t */
+} CFE_ES_PoolDiagTlm_Payload_t;
+
+/**
+**  \cfeestlm Performance Marker Statistics Packet
+**/
+typedef struct CFE_ES_PerfStatsTlm_Payload
+{
+    uint32 NumMarkers;                                                       /**< \cfetlmmnemonic \ES_PERFSTATNUM
+                                                                                  \brief Number of valid entries in MarkerStats */
+    uint32 UnmatchedCount;                                                   /**< \cfetlmmnemonic \ES_PERFSTATUNMATCHED
+                                                                                  \brief Number of exit events with no matching entry event */
+    uint32 OverflowCount;                                                    /**< \cfetlmmnemonic \ES_PERFSTATOVERFLOW
+                                                                                  \brief Number of entry events not timed because too many markers were open */
+    CFE_ES_PerfMarkerStats_t MarkerStats[CFE_MISSION_ES_PERF_STATS_PER_PKT]; /**< \brief For more info, see #CFE_ES_PerfMarkerStats_t */
+} CFE_ES_PerfStatsTlm_Payload_t;
+
+/**
+**  \cfeestlm Startup Timing Packet
+**/
+typedef struct CFE_ES_StartupTimingTlm_Payload
+{
+    uint32 NumRecords;                                                        /**< \cfetlmmnemonic \ES_STARTUPNUM
+                                                                                   \brief Records in the timeline */
+    uint32 DroppedRecords;                                                    /**< \cfetlmmnemonic \ES_STARTUPDROPPED
+                                                                                   \brief Records lost, log full */
+    uint32 FirstRecord;                                                       /**< \cfetlmmnemonic \ES_STARTUPFIRST
+                                                                                   \brief Index of Records[0] */
+    uint32 NumInPacket;                                                       /**< \cfetlmmnemonic \ES_STARTUPNUMINPKT
+                                                                                   \brief Valid entries in Records */
+    CFE_ES_StartupTimingRec_t Records[CFE_MISSION_ES_STARTUP_TIMING_PER_PKT]; /**< \brief Timeline records */
+} CFE_ES_StartupTimingTlm_Payload_t;
+
+/**
+**  \cfeestlm Background Jobs Packet
+**/
+typedef struct CFE_ES_BackgroundJobsTlm_Payload
+{
+    uint32 NumJobs;                                                           /**< \cfetlmmnemonic \ES_BGJOBSNUM
+                                                                                   \brief Jobs registered */
+    uint32 FirstJob;                                                          /**< \cfetlmmnemonic \ES_BGJOBSFIRST
+                                                                                   \brief Job number of Jobs[0] */
+    uint32 NumInPacket;                                                       /**< \cfetlmmnemonic \ES_BGJOBSNUMINPKT
+                                                                                   \brief Valid entries in Jobs */
+    CFE_ES_BackgroundJobStats_t Jobs[CFE_MISSION_ES_BACKGROUND_JOBS_PER_PKT]; /**< \brief Job statistics */
+} CFE_ES_BackgroundJobsTlm_Payload_t;
+
 /*************************************************************************/
 
 /**
@@ -355,6 +410,10 @@ typedef struct CFE_ES_HousekeepingTlm_Payload
                                             \brief Number of free blocks remaining in the OS heap */
     CFE_ES_MemOffset_t HeapMaxBlockSize; /**< \cfetlmmnemonic \ES_HEAPMAXBLK
                                             \brief Number of bytes in the largest free block */
+    uint32 PerfStreamEntries;            /**< \cfetlmmnemonic \ES_PERFSTRMENTRIES
+                                            \brief Number of Performance Analyzer Log Entries Written to Stream Files */
+    uint32 PerfStreamDropped;            /**< \cfetlmmnemonic \ES_PERFSTRMDROPS
+                                            \brief Number of Performance Analyzer Log Entries Dropped While Streaming */
 } CFE_ES_HousekeepingTlm_Payload_t;
 
 #endif
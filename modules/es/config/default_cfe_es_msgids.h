@@ -34,8 +34,12 @@
 /*
 ** CFE ES Telemetry Message Id's
 */
-#define CFE_ES_HK_TLM_MID       CFE_PLATFORM_ES_TLM_MIDVAL(HK_TLM)
-#define CFE_ES_APP_TLM_MID      CFE_PLATFORM_ES_TLM_MIDVAL(APP_TLM)
-#define CFE_ES_MEMSTATS_TLM_MID CFE_PLATFORM_ES_TLM_MIDVAL(MEMSTATS_TLM)
+#define CFE_ES_HK_TLM_MID            CFE_PLATFORM_ES_TLM_MIDVAL(HK_TLM)
+#define CFE_ES_APP_TLM_MID           CFE_PLATFORM_ES_TLM_MIDVAL(APP_TLM)
+#define CFE_ES_MEMSTATS_TLM_MID      CFE_PLATFORM_ES_TLM_MIDVAL(MEMSTATS_TLM)
+#define CFE_ES_MEMPOOLDIAG_TLM_MID   CFE_PLATFORM_ES_TLM_MIDVAL(MEMPOOLDIAG_TLM)
+#define CFE_ES_PERFSTATS_TLM_MID     CFE_PLATFORM_ES_TLM_MIDVAL(PERFSTATS_TLM)
+#define CFE_ES_STARTUPTIMING_TLM_MID CFE_PLATFORM_ES_TLM_MIDVAL(STARTUPTIMING_TLM)
+#define CFE_ES_BGJOBS_TLM_MID        CFE_PLATFORM_ES_TLM_MIDVAL(BGJOBS_TLM)
 
 #endif
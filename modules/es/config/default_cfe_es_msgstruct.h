@@ -68,6 +68,11 @@ typedef struct CFE_ES_ResetPRCountCmd
     CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
 } CFE_ES_ResetPRCountCmd_t;
 
+typedef struct CFE_ES_ResetPerfStatsCmd
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+} CFE_ES_ResetPerfStatsCmd_t;
+
 typedef struct CFE_ES_SendHkCmd
 {
     CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
@@ -120,6 +125,24 @@ typedef struct CFE_ES_WriteERLogCmd
     CFE_ES_FileNameCmd_Payload_t Payload;       /**< \brief Command payload */
 } CFE_ES_WriteERLogCmd_t;
 
+typedef struct CFE_ES_WriteMemPoolStatsCmd
+{
+    CFE_MSG_CommandHeader_t      CommandHeader; /**< \brief Command header */
+    CFE_ES_FileNameCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_ES_WriteMemPoolStatsCmd_t;
+
+typedef struct CFE_ES_WritePoolAllocSitesCmd
+{
+    CFE_MSG_CommandHeader_t      CommandHeader; /**< \brief Command header */
+    CFE_ES_FileNameCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_ES_WritePoolAllocSitesCmd_t;
+
+typedef struct CFE_ES_WriteStartupTimingCmd
+{
+    CFE_MSG_CommandHeader_t      CommandHeader; /**< \brief Command header */
+    CFE_ES_FileNameCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_ES_WriteStartupTimingCmd_t;
+
 /**
  * \brief Overwrite/Discard System Log Configuration Command Payload
  */
@@ -266,6 +289,42 @@ typedef struct CFE_ES_MemStatsTlm
     CFE_ES_PoolStatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
 } CFE_ES_MemStatsTlm_t;
 
+/**
+**  \cfeestlm Memory Pool Diagnostics Packet
+**/
+typedef struct CFE_ES_MemPoolDiagTlm
+{
+    CFE_MSG_TelemetryHeader_t    TelemetryHeader; /**< \brief Telemetry header */
+    CFE_ES_PoolDiagTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} CFE_ES_MemPoolDiagTlm_t;
+
+/**
+**  \cfeestlm Performance Marker Statistics Packet
+**/
+typedef struct CFE_ES_PerfStatsTlm
+{
+    CFE_MSG_TelemetryHeader_t     TelemetryHeader; /**< \brief Telemetry header */
+    CFE_ES_PerfStatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} CFE_ES_PerfStatsTlm_t;
+
+/**
+**  \cfeestlm Startup Timing Packet
+**/
+typedef struct CFE_ES_StartupTimingTlm
+{
+    CFE_MSG_TelemetryHeader_t         TelemetryHeader; /**< \brief Telemetry header */
+    CFE_ES_StartupTimingTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} CFE_ES_StartupTimingTlm_t;
+
+/**
+**  \cfeestlm Background Jobs Packet
+**/
+typedef struct CFE_ES_BackgroundJobsTlm
+{
+    CFE_MSG_TelemetryHeader_t          TelemetryHeader; /**< \brief Telemetry header */
+    CFE_ES_BackgroundJobsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} CFE_ES_BackgroundJobsTlm_t;
+
 /**
 **  \cfeestlm Executive Services Housekeeping Packet
 **/
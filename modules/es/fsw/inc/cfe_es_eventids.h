@@ -1057,6 +1057,187 @@
  *  a write already being in progress.
  */
 #define CFE_ES_ERLOG_PENDING_ERR_EID 93
+
+/**
+ * \brief ES Write Memory Pool Statistics Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_MEM_POOL_STATS_CC ES Write Memory Pool Statistics Command \endlink success.
+ */
+#define CFE_ES_POOL_STATS_FILE_EID 94
+
+/**
+ * \brief ES Write Memory Pool Statistics Command File Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_MEM_POOL_STATS_CC ES Write Memory Pool Statistics Command \endlink failure
+ *  to parse the file name or create the file.
+ */
+#define CFE_ES_POOL_STATS_FILE_ERR_EID 95
+
+/**
+ * \brief ES Write Memory Pool Statistics Command Already In Progress Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_MEM_POOL_STATS_CC ES Write Memory Pool Statistics Command \endlink failure due to
+ *  a write already being in progress.
+ */
+#define CFE_ES_POOL_STATS_PENDING_ERR_EID 96
+
+/**
+ * \brief ES Write Memory Pool Allocation Sites Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_POOL_ALLOC_SITES_CC ES Write Memory Pool Allocation Sites Command \endlink success.
+ */
+#define CFE_ES_POOL_ALLOC_SITES_FILE_EID 97
+
+/**
+ * \brief ES Write Memory Pool Allocation Sites Command File Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_POOL_ALLOC_SITES_CC ES Write Memory Pool Allocation Sites Command \endlink failure
+ *  because allocation tracking is not enabled, or failure to parse the file name or create the file.
+ */
+#define CFE_ES_POOL_ALLOC_SITES_FILE_ERR_EID 98
+
+/**
+ * \brief ES Write Memory Pool Allocation Sites Command Already In Progress Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_POOL_ALLOC_SITES_CC ES Write Memory Pool Allocation Sites Command \endlink failure
+ *  due to a write already being in progress.
+ */
+#define CFE_ES_POOL_ALLOC_SITES_PENDING_ERR_EID 99
+
+/**
+ * \brief ES Memory Pool Block Outstanding Too Long Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  With #CFE_PLATFORM_ES_POOL_ALLOC_TRACKING enabled, a memory pool block has been allocated
+ *  for longer than #CFE_PLATFORM_ES_POOL_LEAK_AGE_MSEC and may have been leaked.  Each block
+ *  is reported once.
+ */
+#define CFE_ES_POOL_LEAK_EID 100
+
+/**
+ * \brief ES Performance Stream File Complete Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  While the performance log is running in STREAM mode, the current stream file reached
+ *  #CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES entries and was closed.  Streaming continues
+ *  with the next file in the rotation.
+ */
+#define CFE_ES_PERF_STREAM_FILE_EID 101
+
+/**
+ * \brief ES Performance Stream File Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  While the performance log is running in STREAM mode, a stream file could not be created
+ *  or written.  Streaming is stopped and the performance log is left idle.
+ */
+#define CFE_ES_PERF_STREAM_ERR_EID 102
+
+/**
+ * \brief ES Performance Stream Stopped Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_STOP_PERF_DATA_CC ES Stop Performance Analyzer Data Collection Command \endlink
+ *  success in STREAM mode, once the remaining entries have been written and the last stream
+ *  file has been closed.  Reports the total number of entries written and dropped.
+ */
+#define CFE_ES_PERF_STREAM_STOPPED_EID 103
+
+/**
+ * \brief ES Reset Performance Marker Statistics Command Success Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_RESET_PERF_STATS_CC ES Reset Performance Marker Statistics Command \endlink success.
+ */
+#define CFE_ES_PERF_STATS_RESET_EID 104
+
+/**
+ * \brief ES Reset Performance Marker Statistics Command Not Available Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_RESET_PERF_STATS_CC ES Reset Performance Marker Statistics Command \endlink
+ *  failure because #CFE_PLATFORM_ES_PERF_MARKER_STATS is not enabled in this build.
+ */
+#define CFE_ES_PERF_STATS_ERR_EID 105
+
+/**
+ * \brief ES Write Startup Timeline Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  The startup timeline file was written, either automatically once the system became
+ *  operational or by the \link #CFE_ES_WRITE_STARTUP_TIMING_CC ES Write Startup Timing Command \endlink.
+ */
+#define CFE_ES_STARTUP_TIMING_FILE_EID 106
+
+/**
+ * \brief ES Write Startup Timeline File Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Failure to parse the file name, or to create or write the startup timeline file,
+ *  either automatically once the system became operational or for the
+ *  \link #CFE_ES_WRITE_STARTUP_TIMING_CC ES Write Startup Timing Command \endlink.
+ */
+#define CFE_ES_STARTUP_TIMING_FILE_ERR_EID 107
+
+/**
+ * \brief ES Write Startup Timeline Already In Progress Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_STARTUP_TIMING_CC ES Write Startup Timing Command \endlink failure
+ *  due to a write already being in progress.
+ */
+#define CFE_ES_STARTUP_TIMING_PENDING_ERR_EID 108
 /**\}*/
 
 #endif /* CFE_ES_EVENTS_H */
@@ -589,6 +589,12 @@
 **  \par Description
 **       This command causes the Performance Analyzer to begin collecting data using the specified trigger mode.
 **
+**       In STREAM mode there is no trigger.  The log is recorded continuously and full
+**       chunks of entries are appended to a rotating set of files by a background job
+**       until a #CFE_ES_STOP_PERF_DATA_CC command is received.  Entries are dropped,
+**       and counted in \ES_PERFSTRMDROPS, if the file writer falls behind.  See
+**       #CFE_PLATFORM_ES_PERF_STREAM_FILE_BASENAME for the file names.
+**
 **  \cfecmdmnemonic \ES_STARTLADATA
 **
 **  \par Command Structure
@@ -603,7 +609,7 @@
 **         either WAITING FOR TRIGGER or, if conditions are appropriate fast enough,
 **         TRIGGERED.
 **       - \b \c \ES_PERFMODE - Performance Analyzer Mode will change to the commanded trigger mode (TRIGGER START,
-**         TRIGGER CENTER, or TRIGGER END).
+**         TRIGGER CENTER, TRIGGER END, or STREAM).
 **       - \b \c \ES_PERFTRIGCNT - Performance Trigger Count will go to zero
 **       - \b \c \ES_PERFDATASTART - Data Start Index will go to zero
 **       - \b \c \ES_PERFDATAEND - Data End Index will go to zero
@@ -614,6 +620,7 @@
 **  \par Error Conditions
 **       This command may fail for the following reason(s):
 **       - A previous #CFE_ES_STOP_PERF_DATA_CC command has not completely finished.
+**       - Stream files from a previous STREAM mode run are still being written.
 **       - An invalid trigger mode is requested.
 **
 **       Evidence of failure may be found in the following telemetry:
@@ -655,6 +662,9 @@
 **       - The file specified in the command (or the default specified
 **         by the #CFE_PLATFORM_ES_DEFAULT_PERF_DUMP_FILENAME configuration parameter) will be
 **         updated with the latest information.
+**       - In STREAM mode, no dump file is written.  Instead the remaining entries are
+**         appended to the current stream file and the #CFE_ES_PERF_STREAM_STOPPED_EID
+**         event is generated once it has been closed.
 **
 **  \par Error Conditions
 **       This command may fail for the following reason(s):
@@ -930,6 +940,9 @@
 **         generated.
 **       - The \link #CFE_ES_MemStatsTlm_t Memory Pool Statistics Telemetry Packet \endlink
 **         is produced
+**       - If the pool was created with #CFE_ES_POOL_DIAGNOSTICS, the
+**         \link #CFE_ES_MemPoolDiagTlm_t Memory Pool Diagnostics Telemetry Packet \endlink
+**         is also produced
 **
 **  \par Error Conditions
 **       This command may fail for the following reason(s):
@@ -945,7 +958,7 @@
 **       Extreme care should be taken to ensure the memory handle value
 **       used in the command is correct.
 **
-**  \sa
+**  \sa #CFE_ES_WRITE_MEM_POOL_STATS_CC
 */
 #define CFE_ES_SEND_MEM_POOL_STATS_CC CFE_ES_CCVAL(SEND_MEM_POOL_STATS)
 
@@ -1033,6 +1046,198 @@
 */
 #define CFE_ES_QUERY_ALL_TASKS_CC CFE_ES_CCVAL(QUERY_ALL_TASKS)
 
+/** \cfeescmd Write Statistics of All Memory Pools to a File
+**
+**  \par Description
+**       This command writes the statistics and diagnostics of every memory pool
+**       known to Executive Services to the specified file, as one
+**       #CFE_ES_MemPoolDumpRec_t record per pool.  The file is written as a
+**       background task.
+**
+**  \cfecmdmnemonic \ES_WRITEPOOLSTATS2FILE
+**
+**  \par Command Structure
+**       #CFE_ES_WriteMemPoolStatsCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment.  NOTE: the command counter is incremented when the
+**         request is accepted, before writing the file.
+**       - The #CFE_ES_POOL_STATS_FILE_EID debug event message will be
+**         generated.
+**       - The file specified in the command (or the default specified
+**         by the #CFE_PLATFORM_ES_DEFAULT_POOL_STATS_FILE configuration parameter) will be
+**         updated with the latest information.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - A previous request to write the memory pool statistics has not yet completed
+**       - The file name specified could not be parsed
+**       - An Error occurs while trying to write to the file
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new
+**       file in the file system (or overwrite an existing one) and could,
+**       if performed repeatedly without sufficient file management by the
+**       operator, fill the file system.
+**
+**  \sa #CFE_ES_SEND_MEM_POOL_STATS_CC
+*/
+#define CFE_ES_WRITE_MEM_POOL_STATS_CC CFE_ES_CCVAL(WRITE_MEM_POOL_STATS)
+
+/** \cfeescmd Write Live Memory Pool Blocks by Allocation Site to a File
+**
+**  \par Description
+**       This command writes the memory pool blocks that are currently
+**       allocated, grouped by pool, allocating application and calling
+**       address, to the specified file as #CFE_ES_PoolAllocSiteRec_t records.
+**       The file is written as a background task.
+**
+**       This is only available when the #CFE_PLATFORM_ES_POOL_ALLOC_TRACKING
+**       debug option is enabled.
+**
+**  \cfecmdmnemonic \ES_WRITEALLOCSITES2FILE
+**
+**  \par Command Structure
+**       #CFE_ES_WritePoolAllocSitesCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment.  NOTE: the command counter is incremented when the
+**         request is accepted, before writing the file.
+**       - The #CFE_ES_POOL_ALLOC_SITES_FILE_EID debug event message will be
+**         generated.
+**       - The file specified in the command (or the default specified
+**         by the #CFE_PLATFORM_ES_DEFAULT_POOL_ALLOC_SITES_FILE configuration parameter) will be
+**         updated with the latest information.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - Allocation tracking is not enabled in this build
+**       - A previous request to write the allocation sites has not yet completed
+**       - The file name specified could not be parsed
+**       - An Error occurs while trying to write to the file
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new
+**       file in the file system (or overwrite an existing one) and could,
+**       if performed repeatedly without sufficient file management by the
+**       operator, fill the file system.
+**
+**  \sa #CFE_ES_WRITE_MEM_POOL_STATS_CC
+*/
+#define CFE_ES_WRITE_POOL_ALLOC_SITES_CC CFE_ES_CCVAL(WRITE_POOL_ALLOC_SITES)
+
+/** \cfeescmd Reset Performance Marker Statistics
+**
+**  \par Description
+**       This command clears the duration statistics of all performance
+**       markers, along with the unmatched and overflow counts.  Markers that
+**       are open when the command is processed are still timed when they exit.
+**
+**       This is only available when the #CFE_PLATFORM_ES_PERF_MARKER_STATS
+**       option is enabled.
+**
+**  \cfecmdmnemonic \ES_RESETPERFSTATS
+**
+**  \par Command Structure
+**       #CFE_ES_ResetPerfStatsCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment
+**       - \b \c \ES_PERFSTATNUM - will go to zero
+**       - The #CFE_ES_PERF_STATS_RESET_EID informational event message will be
+**         generated.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - The command packet length is incorrect
+**       - Performance marker statistics are not enabled in this build
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  The statistics gathered
+**       so far are lost.
+**
+**  \sa #CFE_ES_START_PERF_DATA_CC
+*/
+#define CFE_ES_RESET_PERF_STATS_CC CFE_ES_CCVAL(RESET_PERF_STATS)
+
+/** \cfeescmd Write the Startup Timeline to a File
+**
+**  \par Description
+**       This command writes the startup timeline recorded by ES to the
+**       specified file as #CFE_ES_StartupTimingRec_t records.  The timeline
+**       holds the duration of each step of CFE_ES_Main, each core module
+**       initialization, each module load and library initialization, the
+**       time each task entered its entry point, the time each app spent
+**       waiting for startup sync and the time each app first entered
+**       CFE_ES_RunLoop().  The file is written as a background task.
+**
+**       The timeline is closed, and the file with the default name written,
+**       automatically at the first housekeeping request after the system
+**       reaches the OPERATIONAL state.  Until then this command writes the
+**       records gathered so far.
+**
+**  \cfecmdmnemonic \ES_WRITESTARTUPTIMING2FILE
+**
+**  \par Command Structure
+**       #CFE_ES_WriteStartupTimingCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment.  NOTE: the command counter is incremented when the
+**         request is accepted, before writing the file.
+**       - The #CFE_ES_STARTUP_TIMING_FILE_EID debug event message will be
+**         generated.
+**       - The file specified in the command (or the default specified
+**         by the #CFE_PLATFORM_ES_DEFAULT_STARTUP_TIMING_FILE configuration parameter) will be
+**         updated with the latest information.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - A previous request to write the startup timeline has not yet completed
+**       - The file name specified could not be parsed
+**       - An Error occurs while trying to write to the file
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new
+**       file in the file system (or overwrite an existing one) and could,
+**       if performed repeatedly without sufficient file management by the
+**       operator, fill the file system.
+**
+**  \sa #CFE_ES_WRITE_SYS_LOG_CC
+*/
+#define CFE_ES_WRITE_STARTUP_TIMING_CC CFE_ES_CCVAL(WRITE_STARTUP_TIMING)
+
 /** \} */
 
 #endif
@@ -70,6 +70,86 @@
 #define CFE_MISSION_ES_PERF_MAX_IDS         CFE_MISSION_ES_CFGVAL(PERF_MAX_IDS)
 #define DEFAULT_CFE_MISSION_ES_PERF_MAX_IDS 128
 
+/**
+**  \cfeescfg Number of Performance Markers in a Statistics message
+**
+**  \par Description:
+**       Defines the number of performance markers whose duration statistics
+**       are reported in each Performance Marker Statistics telemetry message.
+**       Markers with statistics are reported in turn, this many at a time.
+**
+**      This affects the layout of telemetry messages but does not affect run
+**      time behavior or internal allocation.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Note this affects the size of messages, so it must not cause any message
+**       to exceed the max length.
+**
+*/
+#define CFE_MISSION_ES_PERF_STATS_PER_PKT         CFE_MISSION_ES_CFGVAL(PERF_STATS_PER_PKT)
+#define DEFAULT_CFE_MISSION_ES_PERF_STATS_PER_PKT 8
+
+/**
+**  \cfeescfg Number of Records in a Startup Timing message
+**
+**  \par Description:
+**       Defines the number of startup timeline records reported in each
+**       Startup Timing telemetry message.  The records are reported in turn,
+**       this many at a time, once startup is complete.
+**
+**      This affects the layout of telemetry messages but does not affect run
+**      time behavior or internal allocation.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Note this affects the size of messages, so it must not cause any message
+**       to exceed the max length.
+**
+*/
+#define CFE_MISSION_ES_STARTUP_TIMING_PER_PKT         CFE_MISSION_ES_CFGVAL(STARTUP_TIMING_PER_PKT)
+#define DEFAULT_CFE_MISSION_ES_STARTUP_TIMING_PER_PKT 8
+
+/**
+**  \cfeescfg Number of Jobs in a Background Jobs message
+**
+**  \par Description:
+**       Defines the number of ES background jobs whose run statistics are
+**       reported in each Background Jobs telemetry message.  If more jobs are
+**       registered, they are reported in turn, this many at a time.
+**
+**      This affects the layout of telemetry messages but does not affect run
+**      time behavior or internal allocation.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Note this affects the size of messages, so it must not cause any message
+**       to exceed the max length.
+**
+*/
+#define CFE_MISSION_ES_BACKGROUND_JOBS_PER_PKT         CFE_MISSION_ES_CFGVAL(BACKGROUND_JOBS_PER_PKT)
+#define DEFAULT_CFE_MISSION_ES_BACKGROUND_JOBS_PER_PKT 8
+
+/**
+**  \cfeescfg Number of Performance Marker Duration Histogram Buckets
+**
+**  \par Description:
+**       Defines the number of buckets in the duration histogram of each
+**       performance marker.  Bucket 0 counts durations under 2 microseconds,
+**       bucket N counts durations from 2^N up to 2^(N+1) microseconds, and the
+**       last bucket also counts all longer durations.
+**
+**      This affects the layout of telemetry messages and the size of the
+**      statistics kept for each marker.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Must be between 2 and 32.
+**
+*/
+#define CFE_MISSION_ES_PERF_STATS_HIST_BUCKETS         CFE_MISSION_ES_CFGVAL(PERF_STATS_HIST_BUCKETS)
+#define DEFAULT_CFE_MISSION_ES_PERF_STATS_HIST_BUCKETS 20
+
 /** \cfeescfg Maximum number of block sizes in pool structures
 **
 **  \par Description:
@@ -119,8 +199,8 @@
 **      Table Image data integrity values.
 **
 **  \par Limits
-**      Currently only CFE_ES_CrcType_16_ARC is supported (see brief in CFE_ES_CrcType_Enum
-**      definition in cfe_es_api_typedefs.h)
+**      Currently CFE_ES_CrcType_16_ARC and CFE_ES_CrcType_32_C are supported (see brief in
+**      CFE_ES_CrcType_Enum definition in cfe_es_api_typedefs.h)
 */
 #define CFE_MISSION_ES_DEFAULT_CRC         CFE_MISSION_ES_CFGVAL(DEFAULT_CRC)
 #define DEFAULT_CFE_MISSION_ES_DEFAULT_CRC CFE_ES_CrcType_16_ARC
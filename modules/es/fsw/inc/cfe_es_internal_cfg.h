@@ -213,6 +213,44 @@
 #define CFE_PLATFORM_ES_APP_SCAN_RATE         CFE_PLATFORM_ES_CFGVAL(APP_SCAN_RATE)
 #define DEFAULT_CFE_PLATFORM_ES_APP_SCAN_RATE 1000
 
+/**
+**  \cfeescfg Define Max Number of ES Background Jobs
+**
+**  \par Description:
+**       The maximum number of jobs that can be registered with the ES background
+**       task.  ES registers up to six jobs of its own and FS registers one; the
+**       rest are available to other core modules.
+**
+**  \par Limits
+**       The cFE does not place an upper limit on this parameter, but it cannot
+**       be less than 8.
+*/
+#define CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS         CFE_PLATFORM_ES_CFGVAL(MAX_BACKGROUND_JOBS)
+#define DEFAULT_CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS 16
+
+/**
+**  \cfeescfg Define ES Background Task Time Budget
+**
+**  \par Description:
+**       The time, in microseconds, that the ES background task may spend running
+**       jobs each time it wakes up.  Jobs are run in priority order; once the
+**       budget is used up, the remaining jobs that are due wait until the next
+**       time the task wakes, unless they are past their deadline.  Jobs without
+**       a deadline wait for at most one second.  This keeps a long running job,
+**       such as a file write, from delaying the higher priority jobs, such as
+**       the application table scan, for too long.
+**
+**       The time counted is the elapsed (wall clock) time of each job call, so
+**       it includes any time the task was preempted by higher priority tasks.
+**
+**       A value of 0 removes the limit.
+**
+**  \par Limits
+**       The cFE does not place a limit on this parameter.
+*/
+#define CFE_PLATFORM_ES_BACKGROUND_TIME_BUDGET         CFE_PLATFORM_ES_CFGVAL(BACKGROUND_TIME_BUDGET)
+#define DEFAULT_CFE_PLATFORM_ES_BACKGROUND_TIME_BUDGET 50000
+
 /**
 **  \cfeescfg Define ES Application Kill Timeout
 **
@@ -395,6 +433,47 @@
 #define CFE_PLATFORM_ES_VOLATILE_STARTUP_FILE         CFE_PLATFORM_ES_CFGVAL(VOLATILE_STARTUP_FILE)
 #define DEFAULT_CFE_PLATFORM_ES_VOLATILE_STARTUP_FILE "/ram/cfe_es_startup.scr"
 
+/**
+**  \cfeescfg ES Startup Script Cache Size
+**
+**  \par Description:
+**       The maximum size, in bytes, of the startup script kept in the ES reset
+**       area.  Each time the applications are started from a startup script file,
+**       the valid lines of the script are kept there with whitespace and comments
+**       removed.  On a processor reset, if the script file that would be used has
+**       the same name, size and modification time, the applications are started
+**       from this copy instead of reading the file again.  A script that does not
+**       fit is not kept, and is read from the file on every reset.
+**
+**  \par Limits
+**       The cFE does not place a limit on the size of this parameter, but it
+**       cannot be less than 128 bytes (one startup script line).  Note that this
+**       space is taken from the ES reset area.
+*/
+#define CFE_PLATFORM_ES_STARTUP_SCRIPT_CACHE_SIZE         CFE_PLATFORM_ES_CFGVAL(STARTUP_SCRIPT_CACHE_SIZE)
+#define DEFAULT_CFE_PLATFORM_ES_STARTUP_SCRIPT_CACHE_SIZE 8192
+
+/**
+**  \cfeescfg ES Startup Module Loaders
+**
+**  \par Description:
+**       The number of modules from the startup script that are loaded at the
+**       same time.  The modules are loaded in stages: a module is loaded once
+**       the libraries before it in the script are loaded, or once the modules
+**       named in the optional dependency field of its entry are loaded.  All the
+**       modules of a stage are loaded at once by the ES startup task and by up
+**       to this number minus one loader tasks, which run at the priority of the
+**       ES task.  The libraries and applications are then created in the order
+**       of the script, as before.  A value of 1 loads all the modules in the ES
+**       startup task.
+**
+**  \par Limits
+**       The cFE does not place an upper limit on this parameter, but it cannot
+**       be less than 1.  The number of OSAL tasks must allow the loader tasks.
+*/
+#define CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS         CFE_PLATFORM_ES_CFGVAL(STARTUP_LOAD_WORKERS)
+#define DEFAULT_CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS 4
+
 /**
 **  \cfeescfg Default Application Information Filename
 **
@@ -490,6 +569,71 @@
 #define CFE_PLATFORM_ES_DEFAULT_CDS_REG_DUMP_FILE         CFE_PLATFORM_ES_CFGVAL(DEFAULT_CDS_REG_DUMP_FILE)
 #define DEFAULT_CFE_PLATFORM_ES_DEFAULT_CDS_REG_DUMP_FILE "/ram/cfe_cds_reg.log"
 
+/**
+**  \cfeescfg Default Memory Pool Statistics Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the
+**       statistics and diagnostics of all memory pools. This filename is used
+**       only when no filename is specified in the command to write the memory
+**       pool statistics.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_POOL_STATS_FILE         CFE_PLATFORM_ES_CFGVAL(DEFAULT_POOL_STATS_FILE)
+#define DEFAULT_CFE_PLATFORM_ES_DEFAULT_POOL_STATS_FILE "/ram/cfe_es_poolstats.dat"
+
+/**
+**  \cfeescfg Default Memory Pool Allocation Sites Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the
+**       live memory pool blocks, grouped by allocation site. This filename is
+**       used only when no filename is specified in the command to write the
+**       allocation sites.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_POOL_ALLOC_SITES_FILE         CFE_PLATFORM_ES_CFGVAL(DEFAULT_POOL_ALLOC_SITES_FILE)
+#define DEFAULT_CFE_PLATFORM_ES_DEFAULT_POOL_ALLOC_SITES_FILE "/ram/cfe_es_allocsites.dat"
+
+/**
+**  \cfeescfg Default Startup Timing Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the
+**       startup timeline.  The timeline is written to this file once startup
+**       is complete, and when no filename is specified in the command to write
+**       the startup timing.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_STARTUP_TIMING_FILE         CFE_PLATFORM_ES_CFGVAL(DEFAULT_STARTUP_TIMING_FILE)
+#define DEFAULT_CFE_PLATFORM_ES_DEFAULT_STARTUP_TIMING_FILE "/ram/cfe_es_startup_timing.dat"
+
+/**
+**  \cfeescfg Maximum Number of Startup Timeline Records
+**
+**  \par Description:
+**       The number of records kept in the startup timeline.  A record is kept
+**       for each step of CFE_ES_Main, each core module initialization, and each
+**       module load, library initialization, task start, startup sync wait and
+**       first CFE_ES_RunLoop call of the apps and libraries started.  Records
+**       beyond this number are counted as dropped.
+**
+**  \par Limits
+**       The cFE does not place an upper limit on this parameter, but it cannot
+**       be less than 32.
+*/
+#define CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS         CFE_PLATFORM_ES_CFGVAL(STARTUP_TIMING_MAX_RECORDS)
+#define DEFAULT_CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS 256
+
 /**
 **  \cfeescfg Define Default System Log Mode following Power On Reset
 **
@@ -673,6 +817,102 @@
 #define CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS         CFE_PLATFORM_ES_CFGVAL(PERF_ENTRIES_BTWN_DLYS)
 #define DEFAULT_CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS 50
 
+/**
+**  \cfeescfg Performance Analyzer Streaming Chunk Size
+**
+**  \par Description:
+**       When the performance log is started in streaming mode, the log buffer is
+**       divided into chunks of this many entries.  Each chunk is handed to the
+**       background writer and appended to the current stream file as soon as it
+**       is full, which frees it for new entries.
+**
+**  \par Limits
+**       Must be at least 1, and #CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE must be an
+**       exact multiple of this value with room for at least two chunks.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES         CFE_PLATFORM_ES_CFGVAL(PERF_STREAM_CHUNK_ENTRIES)
+#define DEFAULT_CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES 500
+
+/**
+**  \cfeescfg Performance Analyzer Streaming Entries Per File
+**
+**  \par Description:
+**       In streaming mode, the current stream file is closed and the next file
+**       is started once at least this many entries have been written to it.
+**       Files are switched at chunk boundaries, so a file may hold up to one
+**       chunk more than this.
+**
+**  \par Limits
+**       Must be at least #CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES         CFE_PLATFORM_ES_CFGVAL(PERF_STREAM_FILE_ENTRIES)
+#define DEFAULT_CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES 100000
+
+/**
+**  \cfeescfg Performance Analyzer Streaming File Count
+**
+**  \par Description:
+**       Number of stream files to rotate through.  When the last file is full,
+**       streaming continues with the first file again, replacing its contents,
+**       so the oldest data is lost rather than filling the file system.
+**
+**  \par Limits
+**       Must be between 1 and 100.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES         CFE_PLATFORM_ES_CFGVAL(PERF_STREAM_MAX_FILES)
+#define DEFAULT_CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES 8
+
+/**
+**  \cfeescfg Performance Analyzer Streaming File Base Name
+**
+**  \par Description:
+**       Stream files are named by appending a two digit rotation index and a
+**       ".dat" extension to this path, e.g. "/ram/cfe_es_perfstream_00.dat".
+**       Each stream file has the same format as a performance data dump file.
+**
+**  \par Limits
+**       The length of the string plus the suffix, including the NULL terminator,
+**       cannot exceed the #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_FILE_BASENAME         CFE_PLATFORM_ES_CFGVAL(PERF_STREAM_FILE_BASENAME)
+#define DEFAULT_CFE_PLATFORM_ES_PERF_STREAM_FILE_BASENAME "/ram/cfe_es_perfstream"
+
+/**
+**  \cfeescfg Performance Marker Duration Statistics
+**
+**  \par Description:
+**       When enabled, every performance marker entry is matched with the
+**       following exit of the same marker in the same task, and the duration
+**       between them is added to statistics kept for that marker: count,
+**       minimum, maximum, mean and a histogram of durations in power of two
+**       microsecond buckets.  The statistics are sent in the Performance
+**       Marker Statistics telemetry packet with housekeeping and can be
+**       cleared by command.
+**
+**       Statistics are kept whether or not the performance log is running and
+**       regardless of the filter mask, which adds a task lookup to every
+**       CFE_ES_PerfLogEntry() and CFE_ES_PerfLogExit() call.
+**
+**  \par Limits
+**       Must be defined as 0 (disabled) or 1 (enabled).
+*/
+#define CFE_PLATFORM_ES_PERF_MARKER_STATS         CFE_PLATFORM_ES_CFGVAL(PERF_MARKER_STATS)
+#define DEFAULT_CFE_PLATFORM_ES_PERF_MARKER_STATS 0
+
+/**
+**  \cfeescfg Performance Marker Statistics Nesting Depth
+**
+**  \par Description:
+**       The number of performance markers that may be open (entered but not
+**       yet exited) at once in one task when #CFE_PLATFORM_ES_PERF_MARKER_STATS
+**       is enabled.  Entries beyond this depth are not timed.
+**
+**  \par Limits
+**       Must be between 1 and 255.
+*/
+#define CFE_PLATFORM_ES_PERF_MARKER_STATS_DEPTH         CFE_PLATFORM_ES_CFGVAL(PERF_MARKER_STATS_DEPTH)
+#define DEFAULT_CFE_PLATFORM_ES_PERF_MARKER_STATS_DEPTH 8
+
 /**
 **  \cfeescfg Define Default Stack Size for an Application
 **
@@ -704,6 +944,60 @@
 #define CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES         CFE_PLATFORM_ES_CFGVAL(CDS_MAX_NUM_ENTRIES)
 #define DEFAULT_CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES 512
 
+/**
+**  \cfeescfg Define Size of the Deferred CDS Write Staging Area
+**
+**  \par Description:
+**       Size, in bytes, of the RAM area that holds the snapshots posted with
+**       CFE_ES_CopyToCDSDeferred() until the ES background task writes them to
+**       the CDS.  Each CDS block that is updated this way reserves a buffer the
+**       size of the block the first time a snapshot is posted for it.  Once the
+**       area is used up, CFE_ES_CopyToCDSDeferred() writes the snapshot to the CDS
+**       immediately, the same as CFE_ES_CopyToCDS().
+**
+**  \par Limits
+**       There is a lower limit of 4.  There are no restrictions on the upper limit
+**       however, this memory is statically allocated as part of the ES global data.
+*/
+#define CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_BYTES         CFE_PLATFORM_ES_CFGVAL(CDS_DEFERRED_WRITE_BYTES)
+#define DEFAULT_CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_BYTES 8192
+
+/**
+**  \cfeescfg Define Deferred CDS Write Rate
+**
+**  \par Description:
+**       The minimum time, in milliseconds, between successive writes of the
+**       snapshots posted with CFE_ES_CopyToCDSDeferred().  All snapshots posted
+**       for a block within this time are coalesced into a single CDS write.
+**       This bounds how stale the CDS content can be after a processor reset,
+**       unless the application calls CFE_ES_FlushCDS().
+**
+**  \par Limits
+**       There is a lower limit of 10 and an upper limit of 60000 (one minute).
+*/
+#define CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_RATE         CFE_PLATFORM_ES_CFGVAL(CDS_DEFERRED_WRITE_RATE)
+#define DEFAULT_CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_RATE 1000
+
+/**
+**  \cfeescfg Enable Hardware CRC Instructions
+**
+**  \par Description:
+**       When enabled, the CRC-32C algorithm (#CFE_ES_CrcType_32_C) uses the
+**       CRC instructions of the processor where they are available: SSE4.2
+**       on x86-64, detected at run time, and the ARMv8 CRC32 extension on
+**       little endian AArch64 when the code is compiled for it.  Otherwise,
+**       and on all other processors, the portable table driven version is
+**       used.  Both give identical results.
+**
+**       This may be disabled on toolchains that do not support per-function
+**       target attributes or the corresponding intrinsics headers.
+**
+**  \par Limits
+**       Must be defined as 0 (disabled) or 1 (enabled).
+*/
+#define CFE_PLATFORM_ES_CRC_HW_ACCEL         CFE_PLATFORM_ES_CFGVAL(CRC_HW_ACCEL)
+#define DEFAULT_CFE_PLATFORM_ES_CRC_HW_ACCEL 1
+
 /**
 **  \cfeescfg Define Number of Processor Resets Before a Power On Reset
 **
@@ -755,6 +1049,93 @@
 #define CFE_PLATFORM_ES_MAX_MEMORY_POOLS         CFE_PLATFORM_ES_CFGVAL(MAX_MEMORY_POOLS)
 #define DEFAULT_CFE_PLATFORM_ES_MAX_MEMORY_POOLS 10
 
+/** \cfeescfg Number of task caches per memory pool
+**
+**  \par Description:
+**      Memory pools created with the #CFE_ES_POOL_TASK_CACHE flag keep a small
+**      cache of free blocks for each task that allocates from them, so most
+**      get and put calls do not need to take the pool mutex.  This is the
+**      number of tasks per pool that can have such a cache.  Additional tasks
+**      still use the pool normally, taking the mutex on every call.
+**
+**      A cache held by a task that no longer exists is handed to the next task
+**      that needs one.
+**
+**  \par Limits:
+**       Must be at least 1.  Each cache adds #CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH
+**       block offsets per block size to every memory pool record, whether or
+**       not the pool uses caches.
+*/
+#define CFE_PLATFORM_ES_POOL_TASK_CACHES         CFE_PLATFORM_ES_CFGVAL(POOL_TASK_CACHES)
+#define DEFAULT_CFE_PLATFORM_ES_POOL_TASK_CACHES 4
+
+/** \cfeescfg Depth of memory pool task caches
+**
+**  \par Description:
+**      The maximum number of free blocks of each size that a task cache holds.
+**      When a task cache runs empty, it is refilled with up to half this many
+**      blocks under the pool mutex, and when it is full half of the blocks
+**      are returned to the pool.
+**
+**      Blocks held in a task cache are reported as free by
+**      CFE_ES_GetMemPoolStats(), but can only be allocated by that task.
+**
+**  \par Limits:
+**       Must be at least 2.
+*/
+#define CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH         CFE_PLATFORM_ES_CFGVAL(POOL_TASK_CACHE_DEPTH)
+#define DEFAULT_CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH 8
+
+/** \cfeescfg Memory pool allocation tracking
+**
+**  \par Description:
+**      Debug option.  When enabled, every block allocated from any memory pool,
+**      including the SB and TBL pools, is recorded in a table along with the
+**      allocating application and the return address of the CFE_ES_GetPoolBuf()
+**      call.  For SB message buffers and TBL table buffers, the address is that
+**      of the application call into SB or TBL, not the call inside the service.
+**      The live blocks can be written to a file grouped by allocation site, and
+**      blocks that stay allocated for too long are reported by event.
+**
+**      This adds a table lookup under a global mutex to every get and put
+**      call, so it is intended for test builds that are hunting for leaks.
+**
+**  \par Limits:
+**       Must be defined as 0 (disabled) or 1 (enabled).
+*/
+#define CFE_PLATFORM_ES_POOL_ALLOC_TRACKING         CFE_PLATFORM_ES_CFGVAL(POOL_ALLOC_TRACKING)
+#define DEFAULT_CFE_PLATFORM_ES_POOL_ALLOC_TRACKING 0
+
+/** \cfeescfg Number of tracked memory pool blocks
+**
+**  \par Description:
+**      The number of live blocks, across all memory pools, that can be recorded
+**      when #CFE_PLATFORM_ES_POOL_ALLOC_TRACKING is enabled.  Blocks allocated
+**      while the table is full are not tracked, and are counted in the
+**      allocation sites file completion event.
+**
+**  \par Limits:
+**       Must be at least 1.  Not used when tracking is disabled.
+*/
+#define CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES         CFE_PLATFORM_ES_CFGVAL(POOL_ALLOC_TRACK_ENTRIES)
+#define DEFAULT_CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES 1024
+
+/** \cfeescfg Memory pool leak report age
+**
+**  \par Description:
+**      When #CFE_PLATFORM_ES_POOL_ALLOC_TRACKING is enabled, the ES background
+**      task periodically scans the tracked blocks, and reports each block that
+**      has been allocated for at least this long, once.
+**
+**      Units are in milliseconds.
+**
+**  \par Limits:
+**       Must be defined as an integer value that is greater than or equal to
+**       zero.  Zero disables the scan.
+*/
+#define CFE_PLATFORM_ES_POOL_LEAK_AGE_MSEC         CFE_PLATFORM_ES_CFGVAL(POOL_LEAK_AGE_MSEC)
+#define DEFAULT_CFE_PLATFORM_ES_POOL_LEAK_AGE_MSEC 300000
+
 /**
 **  \cfeescfg Define Default ES Memory Pool Block Sizes
 **
@@ -893,4 +1274,25 @@
 #define CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC         CFE_PLATFORM_ES_CFGVAL(STARTUP_SCRIPT_TIMEOUT_MSEC)
 #define DEFAULT_CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC 1000
 
+/** \cfeescfg Task context cache
+**
+**  \par Description:
+**      When enabled, CFE_ES_GetAppID() and CFE_ES_GetTaskID() remember the
+**      result for the calling task in thread-local storage.  Later calls from
+**      the same task return the cached IDs without taking the ES shared data
+**      lock, until any app or task is deleted.
+**
+**      The build checks whether the toolchain accepts the __thread storage
+**      class and only uses the cache where it does, so this setting has no
+**      effect on targets without thread-local storage.  Set this to 0 where
+**      the compiler accepts __thread but the OS does not provide per-task
+**      storage for it; every call then resolves the context under the
+**      shared data lock.
+**
+**  \par Limits:
+**       Must be defined as 0 (disabled) or 1 (enabled).
+*/
+#define CFE_PLATFORM_ES_TASK_CONTEXT_CACHE         CFE_PLATFORM_ES_CFGVAL(TASK_CONTEXT_CACHE)
+#define DEFAULT_CFE_PLATFORM_ES_TASK_CONTEXT_CACHE 1
+
 #endif
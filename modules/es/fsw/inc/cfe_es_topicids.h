@@ -48,11 +48,19 @@
 **  \par Limits
 **      Not Applicable
 */
-#define CFE_MISSION_ES_HK_TLM_TOPICID               CFE_MISSION_ES_TIDVAL(HK_TLM)
-#define DEFAULT_CFE_MISSION_ES_HK_TLM_TOPICID       0
-#define CFE_MISSION_ES_APP_TLM_TOPICID              CFE_MISSION_ES_TIDVAL(APP_TLM)
-#define DEFAULT_CFE_MISSION_ES_APP_TLM_TOPICID      11
-#define CFE_MISSION_ES_MEMSTATS_TLM_TOPICID         CFE_MISSION_ES_TIDVAL(MEMSTATS_TLM)
-#define DEFAULT_CFE_MISSION_ES_MEMSTATS_TLM_TOPICID 16
+#define CFE_MISSION_ES_HK_TLM_TOPICID                    CFE_MISSION_ES_TIDVAL(HK_TLM)
+#define DEFAULT_CFE_MISSION_ES_HK_TLM_TOPICID            0
+#define CFE_MISSION_ES_APP_TLM_TOPICID                   CFE_MISSION_ES_TIDVAL(APP_TLM)
+#define DEFAULT_CFE_MISSION_ES_APP_TLM_TOPICID           11
+#define CFE_MISSION_ES_MEMPOOLDIAG_TLM_TOPICID           CFE_MISSION_ES_TIDVAL(MEMPOOLDIAG_TLM)
+#define DEFAULT_CFE_MISSION_ES_MEMPOOLDIAG_TLM_TOPICID   15
+#define CFE_MISSION_ES_MEMSTATS_TLM_TOPICID              CFE_MISSION_ES_TIDVAL(MEMSTATS_TLM)
+#define DEFAULT_CFE_MISSION_ES_MEMSTATS_TLM_TOPICID      16
+#define CFE_MISSION_ES_PERFSTATS_TLM_TOPICID             CFE_MISSION_ES_TIDVAL(PERFSTATS_TLM)
+#define DEFAULT_CFE_MISSION_ES_PERFSTATS_TLM_TOPICID     17
+#define CFE_MISSION_ES_STARTUPTIMING_TLM_TOPICID         CFE_MISSION_ES_TIDVAL(STARTUPTIMING_TLM)
+#define DEFAULT_CFE_MISSION_ES_STARTUPTIMING_TLM_TOPICID 18
+#define CFE_MISSION_ES_BGJOBS_TLM_TOPICID                CFE_MISSION_ES_TIDVAL(BGJOBS_TLM)
+#define DEFAULT_CFE_MISSION_ES_BGJOBS_TLM_TOPICID        19
 
 #endif
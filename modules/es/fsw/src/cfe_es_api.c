@@ -406,8 +406,11 @@ void CFE_ES_ExitApp(uint32 ExitStatus)
  *-----------------------------------------------------------------*/
 bool CFE_ES_RunLoop(uint32 *RunStatus)
 {
-    bool                ReturnCode;
-    CFE_ES_AppRecord_t *AppRecPtr;
+    bool                         ReturnCode;
+    bool                         NeedsUpdate;
+    uint32                       ControlRequest;
+    CFE_ES_AppRecord_t *         AppRecPtr;
+    CFE_ES_SharedDataReadState_t ReadState;
 
     /*
      * call CFE_ES_IncrementTaskCounter() so this is
@@ -436,6 +439,47 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
         return false;
     }
 
+    /*
+     * Once the app is running, every call only needs to check the control
+     * request.  Do that as a lock-free read, so the per-cycle call of every
+     * app does not advance SharedDataSeq and make concurrent lock-free
+     * lookups retry.  The lock is only taken when the app record has to be
+     * updated, or to report an error.
+     */
+    NeedsUpdate    = true;
+    ControlRequest = CFE_ES_RunStatus_UNDEFINED;
+
+    memset(&ReadState, 0, sizeof(ReadState));
+    do
+    {
+        CFE_ES_ReadSharedDataBegin(&ReadState, __func__, __LINE__);
+
+        AppRecPtr = CFE_ES_GetAppRecordByContext();
+        if (AppRecPtr != NULL)
+        {
+            NeedsUpdate    = (AppRecPtr->AppState < CFE_ES_AppState_RUNNING || !AppRecPtr->RunLoopEntered);
+            ControlRequest = AppRecPtr->ControlReq.AppControlRequest;
+        }
+        else
+        {
+            NeedsUpdate = true;
+        }
+    } while (CFE_ES_ReadSharedDataRetry(&ReadState, __func__, __LINE__));
+
+    if (!NeedsUpdate)
+    {
+        if (ControlRequest == CFE_ES_RunStatus_APP_RUN)
+        {
+            return true;
+        }
+
+        if (RunStatus != NULL)
+        {
+            *RunStatus = ControlRequest;
+        }
+        return false;
+    }
+
     CFE_ES_LockSharedData(__func__, __LINE__);
 
     /*
@@ -452,6 +496,15 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
             AppRecPtr->AppState = CFE_ES_AppState_RUNNING;
         }
 
+        /*
+         * Add the first call to the startup timeline
+         */
+        if (!AppRecPtr->RunLoopEntered)
+        {
+            AppRecPtr->RunLoopEntered = true;
+            CFE_ES_StartupTimingMark(CFE_ES_StartupPhase_RUN_LOOP, AppRecPtr->AppName);
+        }
+
         /*
          * Check if the control request is also set to "RUN"
          * Anything else should also return false, so the loop will exit.
@@ -500,6 +553,8 @@ CFE_Status_t CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMill
     uint32              RequiredAppState;
     uint32              WaitTime;
     uint32              WaitRemaining;
+    uint32              WaitStart;
+    char                AppName[OS_MAX_API_NAME];
 
     /*
      * Calling app is assumed to have completed its own initialization up to the point
@@ -554,6 +609,13 @@ CFE_Status_t CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMill
         {
             AppRecPtr->AppState = RequiredAppState;
         }
+
+        strncpy(AppName, AppRecPtr->AppName, sizeof(AppName) - 1);
+        AppName[sizeof(AppName) - 1] = '\0';
+    }
+    else
+    {
+        AppName[0] = '\0';
     }
     CFE_ES_UnlockSharedData(__func__, __LINE__);
 
@@ -563,6 +625,7 @@ CFE_Status_t CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMill
      * This is only dependent on the main (startup) task updating the global variable
      * to be at least the state requested.
      */
+    WaitStart     = CFE_ES_StartupTimingNow();
     WaitRemaining = TimeOutMilliseconds;
     while (CFE_ES_Global.SystemState < MinSystemState)
     {
@@ -586,6 +649,8 @@ CFE_Status_t CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMill
         WaitRemaining -= WaitTime;
     }
 
+    CFE_ES_StartupTimingRecord(CFE_ES_StartupPhase_STARTUP_SYNC, AppName, WaitStart);
+
     return Status;
 }
 
@@ -608,33 +673,36 @@ void CFE_ES_WaitForStartupSync(uint32 TimeOutMilliseconds)
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_ES_GetAppIDByName(CFE_ES_AppId_t *AppIdPtr, const char *AppName)
 {
-    CFE_ES_AppRecord_t *AppRecPtr;
-    int32               Result;
+    CFE_ES_AppRecord_t *         AppRecPtr;
+    CFE_ES_SharedDataReadState_t ReadState;
+    int32                        Result;
 
     if (AppName == NULL || AppIdPtr == NULL)
     {
         return CFE_ES_BAD_ARGUMENT;
     }
 
-    CFE_ES_LockSharedData(__func__, __LINE__);
-
-    AppRecPtr = CFE_ES_LocateAppRecordByName(AppName);
-    if (AppRecPtr == NULL)
+    memset(&ReadState, 0, sizeof(ReadState));
+    do
     {
-        /*
-         * ensure the output value is set to a safe value,
-         * in case the caller does not check the return code.
-         */
-        Result    = CFE_ES_ERR_NAME_NOT_FOUND;
-        *AppIdPtr = CFE_ES_APPID_UNDEFINED;
-    }
-    else
-    {
-        Result    = CFE_SUCCESS;
-        *AppIdPtr = CFE_ES_AppRecordGetID(AppRecPtr);
-    }
+        CFE_ES_ReadSharedDataBegin(&ReadState, __func__, __LINE__);
 
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
+        AppRecPtr = CFE_ES_LocateAppRecordByName(AppName);
+        if (AppRecPtr == NULL)
+        {
+            /*
+             * ensure the output value is set to a safe value,
+             * in case the caller does not check the return code.
+             */
+            Result    = CFE_ES_ERR_NAME_NOT_FOUND;
+            *AppIdPtr = CFE_ES_APPID_UNDEFINED;
+        }
+        else
+        {
+            Result    = CFE_SUCCESS;
+            *AppIdPtr = CFE_ES_AppRecordGetID(AppRecPtr);
+        }
+    } while (CFE_ES_ReadSharedDataRetry(&ReadState, __func__, __LINE__));
 
     return Result;
 }
@@ -647,33 +715,36 @@ CFE_Status_t CFE_ES_GetAppIDByName(CFE_ES_AppId_t *AppIdPtr, const char *AppName
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_ES_GetLibIDByName(CFE_ES_LibId_t *LibIdPtr, const char *LibName)
 {
-    CFE_ES_LibRecord_t *LibRecPtr;
-    int32               Result;
+    CFE_ES_LibRecord_t *         LibRecPtr;
+    CFE_ES_SharedDataReadState_t ReadState;
+    int32                        Result;
 
     if (LibName == NULL || LibIdPtr == NULL)
     {
         return CFE_ES_BAD_ARGUMENT;
     }
 
-    CFE_ES_LockSharedData(__func__, __LINE__);
-
-    LibRecPtr = CFE_ES_LocateLibRecordByName(LibName);
-    if (LibRecPtr == NULL)
+    memset(&ReadState, 0, sizeof(ReadState));
+    do
     {
-        /*
-         * ensure the output value is set to a safe value,
-         * in case the caller does not check the return code.
-         */
-        Result    = CFE_ES_ERR_NAME_NOT_FOUND;
-        *LibIdPtr = CFE_ES_LIBID_UNDEFINED;
-    }
-    else
-    {
-        Result    = CFE_SUCCESS;
-        *LibIdPtr = CFE_ES_LibRecordGetID(LibRecPtr);
-    }
+        CFE_ES_ReadSharedDataBegin(&ReadState, __func__, __LINE__);
 
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
+        LibRecPtr = CFE_ES_LocateLibRecordByName(LibName);
+        if (LibRecPtr == NULL)
+        {
+            /*
+             * ensure the output value is set to a safe value,
+             * in case the caller does not check the return code.
+             */
+            Result    = CFE_ES_ERR_NAME_NOT_FOUND;
+            *LibIdPtr = CFE_ES_LIBID_UNDEFINED;
+        }
+        else
+        {
+            Result    = CFE_SUCCESS;
+            *LibIdPtr = CFE_ES_LibRecordGetID(LibRecPtr);
+        }
+    } while (CFE_ES_ReadSharedDataRetry(&ReadState, __func__, __LINE__));
 
     return Result;
 }
@@ -727,6 +798,12 @@ CFE_Status_t CFE_ES_GetAppID(CFE_ES_AppId_t *AppIdPtr)
         return CFE_ES_BAD_ARGUMENT;
     }
 
+    /* Common case: this task has already resolved its context */
+    if (CFE_ES_GetTaskContextCache(AppIdPtr, NULL))
+    {
+        return CFE_SUCCESS;
+    }
+
     CFE_ES_LockSharedData(__func__, __LINE__);
 
     AppRecPtr = CFE_ES_GetAppRecordByContext();
@@ -735,6 +812,7 @@ CFE_Status_t CFE_ES_GetAppID(CFE_ES_AppId_t *AppIdPtr)
     {
         *AppIdPtr = CFE_ES_AppRecordGetID(AppRecPtr);
         Result    = CFE_SUCCESS;
+        CFE_ES_UpdateTaskContextCache();
     }
     else
     {
@@ -763,6 +841,12 @@ CFE_Status_t CFE_ES_GetTaskID(CFE_ES_TaskId_t *TaskIdPtr)
         return CFE_ES_BAD_ARGUMENT;
     }
 
+    /* Common case: this task has already resolved its context */
+    if (CFE_ES_GetTaskContextCache(NULL, TaskIdPtr))
+    {
+        return CFE_SUCCESS;
+    }
+
     CFE_ES_LockSharedData(__func__, __LINE__);
     TaskRecPtr = CFE_ES_GetTaskRecordByContext();
     if (TaskRecPtr == NULL)
@@ -774,6 +858,7 @@ CFE_Status_t CFE_ES_GetTaskID(CFE_ES_TaskId_t *TaskIdPtr)
     {
         *TaskIdPtr = CFE_ES_TaskRecordGetID(TaskRecPtr);
         Result     = CFE_SUCCESS;
+        CFE_ES_UpdateTaskContextCache();
     }
     CFE_ES_UnlockSharedData(__func__, __LINE__);
     return Result;
@@ -787,8 +872,9 @@ CFE_Status_t CFE_ES_GetTaskID(CFE_ES_TaskId_t *TaskIdPtr)
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_ES_GetAppName(char *AppName, CFE_ES_AppId_t AppId, size_t BufferLength)
 {
-    int32               Result;
-    CFE_ES_AppRecord_t *AppRecPtr;
+    int32                        Result;
+    CFE_ES_AppRecord_t *         AppRecPtr;
+    CFE_ES_SharedDataReadState_t ReadState;
 
     if (BufferLength == 0 || AppName == NULL)
     {
@@ -800,25 +886,27 @@ CFE_Status_t CFE_ES_GetAppName(char *AppName, CFE_ES_AppId_t AppId, size_t Buffe
     */
     AppRecPtr = CFE_ES_LocateAppRecordByID(AppId);
 
-    CFE_ES_LockSharedData(__func__, __LINE__);
-
-    /*
-     * confirm that the app record is a match,
-     * which must be done while locked.
-     */
-    if (CFE_ES_AppRecordIsMatch(AppRecPtr, AppId))
-    {
-        strncpy(AppName, CFE_ES_AppRecordGetName(AppRecPtr), BufferLength - 1);
-        AppName[BufferLength - 1] = '\0';
-        Result                    = CFE_SUCCESS;
-    }
-    else
+    memset(&ReadState, 0, sizeof(ReadState));
+    do
     {
-        AppName[0] = 0;
-        Result     = CFE_ES_ERR_RESOURCEID_NOT_VALID;
-    }
+        CFE_ES_ReadSharedDataBegin(&ReadState, __func__, __LINE__);
 
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
+        /*
+         * confirm that the app record is a match,
+         * which must be re-checked if the read is retried.
+         */
+        if (CFE_ES_AppRecordIsMatch(AppRecPtr, AppId))
+        {
+            CFE_ES_ReadSharedName(AppName, BufferLength, CFE_ES_AppRecordGetName(AppRecPtr),
+                                  sizeof(AppRecPtr->AppName));
+            Result = CFE_SUCCESS;
+        }
+        else
+        {
+            AppName[0] = 0;
+            Result     = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+        }
+    } while (CFE_ES_ReadSharedDataRetry(&ReadState, __func__, __LINE__));
 
     return Result;
 }
@@ -831,8 +919,9 @@ CFE_Status_t CFE_ES_GetAppName(char *AppName, CFE_ES_AppId_t AppId, size_t Buffe
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_ES_GetLibName(char *LibName, CFE_ES_LibId_t LibId, size_t BufferLength)
 {
-    int32               Result;
-    CFE_ES_LibRecord_t *LibRecPtr;
+    int32                        Result;
+    CFE_ES_LibRecord_t *         LibRecPtr;
+    CFE_ES_SharedDataReadState_t ReadState;
 
     if (BufferLength == 0 || LibName == NULL)
     {
@@ -844,25 +933,27 @@ CFE_Status_t CFE_ES_GetLibName(char *LibName, CFE_ES_LibId_t LibId, size_t Buffe
     */
     LibRecPtr = CFE_ES_LocateLibRecordByID(LibId);
 
-    CFE_ES_LockSharedData(__func__, __LINE__);
-
-    /*
-     * confirm that the Lib record is a match,
-     * which must be done while locked.
-     */
-    if (CFE_ES_LibRecordIsMatch(LibRecPtr, LibId))
+    memset(&ReadState, 0, sizeof(ReadState));
+    do
     {
-        strncpy(LibName, CFE_ES_LibRecordGetName(LibRecPtr), BufferLength - 1);
-        LibName[BufferLength - 1] = '\0';
-        Result                    = CFE_SUCCESS;
-    }
-    else
-    {
-        LibName[0] = 0;
-        Result     = CFE_ES_ERR_RESOURCEID_NOT_VALID;
-    }
+        CFE_ES_ReadSharedDataBegin(&ReadState, __func__, __LINE__);
 
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
+        /*
+         * confirm that the Lib record is a match,
+         * which must be re-checked if the read is retried.
+         */
+        if (CFE_ES_LibRecordIsMatch(LibRecPtr, LibId))
+        {
+            CFE_ES_ReadSharedName(LibName, BufferLength, CFE_ES_LibRecordGetName(LibRecPtr),
+                                  sizeof(LibRecPtr->LibName));
+            Result = CFE_SUCCESS;
+        }
+        else
+        {
+            LibName[0] = 0;
+            Result     = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+        }
+    } while (CFE_ES_ReadSharedDataRetry(&ReadState, __func__, __LINE__));
 
     return Result;
 }
@@ -922,11 +1013,12 @@ CFE_Status_t CFE_ES_GetTaskName(char *TaskName, CFE_ES_TaskId_t TaskId, size_t B
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_ES_GetAppInfo(CFE_ES_AppInfo_t *AppInfo, CFE_ES_AppId_t AppId)
 {
-    CFE_ES_AppRecord_t * AppRecPtr;
-    CFE_ES_TaskRecord_t *TaskRecPtr;
-    int32                Status;
-    osal_id_t            ModuleId;
-    uint32               i;
+    CFE_ES_AppRecord_t *         AppRecPtr;
+    CFE_ES_TaskRecord_t *        TaskRecPtr;
+    CFE_ES_SharedDataReadState_t ReadState;
+    int32                        Status;
+    osal_id_t                    ModuleId;
+    uint32                       i;
 
     if (AppInfo == NULL)
     {
@@ -934,75 +1026,81 @@ CFE_Status_t CFE_ES_GetAppInfo(CFE_ES_AppInfo_t *AppInfo, CFE_ES_AppId_t AppId)
         return CFE_ES_BAD_ARGUMENT;
     }
 
-    memset(AppInfo, 0, sizeof(*AppInfo));
-    ModuleId = OS_OBJECT_ID_UNDEFINED;
-
     AppRecPtr = CFE_ES_LocateAppRecordByID(AppId);
 
-    CFE_ES_LockSharedData(__func__, __LINE__);
-
-    if (!CFE_ES_AppRecordIsMatch(AppRecPtr, AppId))
+    memset(&ReadState, 0, sizeof(ReadState));
+    do
     {
-        /*
-         * Log a message if called with an invalid ID.
-         */
-        CFE_ES_WriteToSysLog("%s: App ID not active: %lu\n", __func__, CFE_RESOURCEID_TO_ULONG(AppId));
+        CFE_ES_ReadSharedDataBegin(&ReadState, __func__, __LINE__);
 
-        Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
-    }
-    else
-    {
-        AppInfo->ResourceId = CFE_RESOURCEID_UNWRAP(AppId); /* make into a generic resource ID */
-        AppInfo->Type       = AppRecPtr->Type;
+        /* start over on every attempt, a retried read may have been partially filled in */
+        memset(AppInfo, 0, sizeof(*AppInfo));
+        ModuleId = OS_OBJECT_ID_UNDEFINED;
 
-        strncpy(AppInfo->Name, CFE_ES_AppRecordGetName(AppRecPtr), sizeof(AppInfo->Name) - 1);
+        if (!CFE_ES_AppRecordIsMatch(AppRecPtr, AppId))
+        {
+            Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+        }
+        else
+        {
+            AppInfo->ResourceId = CFE_RESOURCEID_UNWRAP(AppId); /* make into a generic resource ID */
+            AppInfo->Type       = AppRecPtr->Type;
 
-        CFE_ES_CopyModuleBasicInfo(&AppRecPtr->StartParams.BasicInfo, AppInfo);
-        CFE_ES_CopyModuleStatusInfo(&AppRecPtr->LoadStatus, AppInfo);
+            CFE_ES_ReadSharedName(AppInfo->Name, sizeof(AppInfo->Name), CFE_ES_AppRecordGetName(AppRecPtr),
+                                  sizeof(AppRecPtr->AppName));
 
-        AppInfo->ExceptionAction = AppRecPtr->StartParams.ExceptionAction;
-        AppInfo->MainTaskId      = AppRecPtr->MainTaskId;
+            CFE_ES_CopyModuleBasicInfo(&AppRecPtr->StartParams.BasicInfo, AppInfo);
+            CFE_ES_CopyModuleStatusInfo(&AppRecPtr->LoadStatus, AppInfo);
 
-        ModuleId = AppRecPtr->LoadStatus.ModuleId;
+            AppInfo->ExceptionAction = AppRecPtr->StartParams.ExceptionAction;
+            AppInfo->MainTaskId      = AppRecPtr->MainTaskId;
 
-        /*
-        ** Calculate the number of child tasks
-        */
-        AppInfo->NumOfChildTasks = 0;
-        TaskRecPtr               = CFE_ES_Global.TaskTable;
-        for (i = 0; i < OS_MAX_TASKS; i++)
-        {
-            if (CFE_ES_TaskRecordIsUsed(TaskRecPtr) && CFE_RESOURCEID_TEST_EQUAL(TaskRecPtr->AppId, AppId))
+            ModuleId = AppRecPtr->LoadStatus.ModuleId;
+
+            /*
+            ** Calculate the number of child tasks
+            */
+            AppInfo->NumOfChildTasks = 0;
+            TaskRecPtr               = CFE_ES_Global.TaskTable;
+            for (i = 0; i < OS_MAX_TASKS; i++)
             {
-                if (CFE_RESOURCEID_TEST_EQUAL(CFE_ES_TaskRecordGetID(TaskRecPtr), AppInfo->MainTaskId))
+                if (CFE_ES_TaskRecordIsUsed(TaskRecPtr) && CFE_RESOURCEID_TEST_EQUAL(TaskRecPtr->AppId, AppId))
                 {
-                    /* This is the main task - capture its name and execution count */
-                    AppInfo->ExecutionCounter = TaskRecPtr->ExecutionCounter;
-                    strncpy(AppInfo->MainTaskName, TaskRecPtr->TaskName, sizeof(AppInfo->MainTaskName) - 1);
-                    AppInfo->MainTaskName[sizeof(AppInfo->MainTaskName) - 1] = '\0';
+                    if (CFE_RESOURCEID_TEST_EQUAL(CFE_ES_TaskRecordGetID(TaskRecPtr), AppInfo->MainTaskId))
+                    {
+                        /* This is the main task - capture its name and execution count */
+                        AppInfo->ExecutionCounter = CFE_Atomic_Load(&TaskRecPtr->ExecutionCounter);
+                        CFE_ES_ReadSharedName(AppInfo->MainTaskName, sizeof(AppInfo->MainTaskName),
+                                              TaskRecPtr->TaskName, sizeof(TaskRecPtr->TaskName));
 
-                    AppInfo->StackSize = CFE_ES_MEMOFFSET_C(TaskRecPtr->StartParams.StackSize);
-                    AppInfo->Priority  = TaskRecPtr->StartParams.Priority;
-                }
-                else
-                {
-                    /* This is a child task, no extra info, just increment count */
-                    ++AppInfo->NumOfChildTasks;
+                        AppInfo->StackSize = CFE_ES_MEMOFFSET_C(TaskRecPtr->StartParams.StackSize);
+                        AppInfo->Priority  = TaskRecPtr->StartParams.Priority;
+                    }
+                    else
+                    {
+                        /* This is a child task, no extra info, just increment count */
+                        ++AppInfo->NumOfChildTasks;
+                    }
                 }
+                ++TaskRecPtr;
             }
-            ++TaskRecPtr;
+
+            Status = CFE_SUCCESS;
         }
+    } while (CFE_ES_ReadSharedDataRetry(&ReadState, __func__, __LINE__));
 
-        Status = CFE_SUCCESS;
+    if (Status != CFE_SUCCESS)
+    {
+        /*
+         * Log a message if called with an invalid ID.
+         */
+        CFE_ES_WriteToSysLog("%s: App ID not active: %lu\n", __func__, CFE_RESOURCEID_TO_ULONG(AppId));
     }
-
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
-
-    /*
-    ** Get the address information from the OSAL
-    */
-    if (Status == CFE_SUCCESS)
+    else
     {
+        /*
+        ** Get the address information from the OSAL
+        */
         CFE_ES_CopyModuleAddressInfo(ModuleId, AppInfo);
     }
 
@@ -1017,9 +1115,10 @@ CFE_Status_t CFE_ES_GetAppInfo(CFE_ES_AppInfo_t *AppInfo, CFE_ES_AppId_t AppId)
  *-----------------------------------------------------------------*/
 int32 CFE_ES_GetLibInfo(CFE_ES_AppInfo_t *LibInfo, CFE_ES_LibId_t LibId)
 {
-    int32               Status;
-    CFE_ES_LibRecord_t *LibRecPtr;
-    osal_id_t           ModuleId;
+    int32                        Status;
+    CFE_ES_LibRecord_t *         LibRecPtr;
+    CFE_ES_SharedDataReadState_t ReadState;
+    osal_id_t                    ModuleId;
 
     if (LibInfo == NULL)
     {
@@ -1027,44 +1126,50 @@ int32 CFE_ES_GetLibInfo(CFE_ES_AppInfo_t *LibInfo, CFE_ES_LibId_t LibId)
         return CFE_ES_BAD_ARGUMENT;
     }
 
-    memset(LibInfo, 0, sizeof(*LibInfo));
-    ModuleId = OS_OBJECT_ID_UNDEFINED;
-
     LibRecPtr = CFE_ES_LocateLibRecordByID(LibId);
 
-    CFE_ES_LockSharedData(__func__, __LINE__);
-
-    if (!CFE_ES_LibRecordIsMatch(LibRecPtr, LibId))
+    memset(&ReadState, 0, sizeof(ReadState));
+    do
     {
-        /*
-         * Log a message if called with an invalid ID.
-         */
-        CFE_ES_SysLogWrite_Unsync("%s: Lib ID not active: %lu\n", __func__, CFE_RESOURCEID_TO_ULONG(LibId));
+        CFE_ES_ReadSharedDataBegin(&ReadState, __func__, __LINE__);
 
-        Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
-    }
-    else
-    {
-        LibInfo->ResourceId = CFE_RESOURCEID_UNWRAP(LibId); /* make into generic ID */
-        LibInfo->Type       = CFE_ES_AppType_LIBRARY;
+        /* start over on every attempt, a retried read may have been partially filled in */
+        memset(LibInfo, 0, sizeof(*LibInfo));
+        ModuleId = OS_OBJECT_ID_UNDEFINED;
 
-        strncpy(LibInfo->Name, CFE_ES_LibRecordGetName(LibRecPtr), sizeof(LibInfo->Name) - 1);
+        if (!CFE_ES_LibRecordIsMatch(LibRecPtr, LibId))
+        {
+            Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+        }
+        else
+        {
+            LibInfo->ResourceId = CFE_RESOURCEID_UNWRAP(LibId); /* make into generic ID */
+            LibInfo->Type       = CFE_ES_AppType_LIBRARY;
 
-        CFE_ES_CopyModuleBasicInfo(&LibRecPtr->LoadParams, LibInfo);
-        CFE_ES_CopyModuleStatusInfo(&LibRecPtr->LoadStatus, LibInfo);
+            CFE_ES_ReadSharedName(LibInfo->Name, sizeof(LibInfo->Name), CFE_ES_LibRecordGetName(LibRecPtr),
+                                  sizeof(LibRecPtr->LibName));
 
-        ModuleId = LibRecPtr->LoadStatus.ModuleId;
+            CFE_ES_CopyModuleBasicInfo(&LibRecPtr->LoadParams, LibInfo);
+            CFE_ES_CopyModuleStatusInfo(&LibRecPtr->LoadStatus, LibInfo);
 
-        Status = CFE_SUCCESS;
-    }
+            ModuleId = LibRecPtr->LoadStatus.ModuleId;
 
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
+            Status = CFE_SUCCESS;
+        }
+    } while (CFE_ES_ReadSharedDataRetry(&ReadState, __func__, __LINE__));
 
-    /*
-     ** Get the address information from the OSAL
-     */
-    if (Status == CFE_SUCCESS)
+    if (Status != CFE_SUCCESS)
     {
+        /*
+         * Log a message if called with an invalid ID.
+         */
+        CFE_ES_WriteToSysLog("%s: Lib ID not active: %lu\n", __func__, CFE_RESOURCEID_TO_ULONG(LibId));
+    }
+    else
+    {
+        /*
+         ** Get the address information from the OSAL
+         */
         CFE_ES_CopyModuleAddressInfo(ModuleId, LibInfo);
     }
 
@@ -1110,9 +1215,11 @@ int32 CFE_ES_GetModuleInfo(CFE_ES_AppInfo_t *ModuleInfo, CFE_ResourceId_t Resour
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_ES_GetTaskInfo(CFE_ES_TaskInfo_t *TaskInfo, CFE_ES_TaskId_t TaskId)
 {
-    CFE_ES_TaskRecord_t *TaskRecPtr;
-    CFE_ES_AppRecord_t * AppRecPtr;
-    int32                Status;
+    CFE_ES_TaskRecord_t *        TaskRecPtr;
+    CFE_ES_AppRecord_t *         AppRecPtr;
+    CFE_ES_SharedDataReadState_t ReadState;
+    int32                        Status;
+    bool                         TaskIsActive;
 
     if (TaskInfo == NULL)
     {
@@ -1120,57 +1227,65 @@ CFE_Status_t CFE_ES_GetTaskInfo(CFE_ES_TaskInfo_t *TaskInfo, CFE_ES_TaskId_t Tas
         return CFE_ES_BAD_ARGUMENT;
     }
 
-    memset(TaskInfo, 0, sizeof(*TaskInfo));
-
     TaskRecPtr = CFE_ES_LocateTaskRecordByID(TaskId);
 
-    CFE_ES_LockSharedData(__func__, __LINE__);
-
-    if (!CFE_ES_TaskRecordIsMatch(TaskRecPtr, TaskId))
-    {
-        /* task ID is bad */
-        Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
-        CFE_ES_SysLogWrite_Unsync("%s: Task ID Not Active: %lu\n", __func__, CFE_RESOURCEID_TO_ULONG(TaskId));
-    }
-    else
+    memset(&ReadState, 0, sizeof(ReadState));
+    do
     {
-        /*
-        ** Get the Application ID and Task Name
-        */
-        TaskInfo->AppId = TaskRecPtr->AppId;
-        strncpy(TaskInfo->TaskName, CFE_ES_TaskRecordGetName(TaskRecPtr), sizeof(TaskInfo->TaskName) - 1);
-        TaskInfo->TaskName[sizeof(TaskInfo->TaskName) - 1] = '\0';
+        CFE_ES_ReadSharedDataBegin(&ReadState, __func__, __LINE__);
 
-        /*
-        ** Store away the Task ID ( for the QueryAllTasks Cmd )
-        */
-        TaskInfo->TaskId = CFE_ES_TaskRecordGetID(TaskRecPtr);
+        /* start over on every attempt, a retried read may have been partially filled in */
+        memset(TaskInfo, 0, sizeof(*TaskInfo));
 
-        /*
-        ** Get the other stats for the task
-        */
-        TaskInfo->ExecutionCounter = TaskRecPtr->ExecutionCounter;
-        TaskInfo->StackSize        = CFE_ES_MEMOFFSET_C(TaskRecPtr->StartParams.StackSize);
-        TaskInfo->Priority         = TaskRecPtr->StartParams.Priority;
-
-        /*
-        ** Get the Application Details
-        */
-        AppRecPtr = CFE_ES_LocateAppRecordByID(TaskRecPtr->AppId);
-        if (CFE_ES_AppRecordIsMatch(AppRecPtr, TaskRecPtr->AppId))
+        TaskIsActive = CFE_ES_TaskRecordIsMatch(TaskRecPtr, TaskId);
+        if (!TaskIsActive)
         {
-            strncpy(TaskInfo->AppName, CFE_ES_AppRecordGetName(AppRecPtr), sizeof(TaskInfo->AppName) - 1);
-            TaskInfo->AppName[sizeof(TaskInfo->AppName) - 1] = '\0';
-            Status                                           = CFE_SUCCESS;
+            /* task ID is bad */
+            Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
         }
         else
         {
-            /* task ID was OK but parent app ID is bad */
-            Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+            /*
+            ** Get the Application ID and Task Name
+            */
+            TaskInfo->AppId = TaskRecPtr->AppId;
+            CFE_ES_ReadSharedName(TaskInfo->TaskName, sizeof(TaskInfo->TaskName), CFE_ES_TaskRecordGetName(TaskRecPtr),
+                                  sizeof(TaskRecPtr->TaskName));
+
+            /*
+            ** Store away the Task ID ( for the QueryAllTasks Cmd )
+            */
+            TaskInfo->TaskId = CFE_ES_TaskRecordGetID(TaskRecPtr);
+
+            /*
+            ** Get the other stats for the task
+            */
+            TaskInfo->ExecutionCounter = CFE_Atomic_Load(&TaskRecPtr->ExecutionCounter);
+            TaskInfo->StackSize        = CFE_ES_MEMOFFSET_C(TaskRecPtr->StartParams.StackSize);
+            TaskInfo->Priority         = TaskRecPtr->StartParams.Priority;
+
+            /*
+            ** Get the Application Details
+            */
+            AppRecPtr = CFE_ES_LocateAppRecordByID(TaskInfo->AppId);
+            if (CFE_ES_AppRecordIsMatch(AppRecPtr, TaskInfo->AppId))
+            {
+                CFE_ES_ReadSharedName(TaskInfo->AppName, sizeof(TaskInfo->AppName),
+                                      CFE_ES_AppRecordGetName(AppRecPtr), sizeof(AppRecPtr->AppName));
+                Status = CFE_SUCCESS;
+            }
+            else
+            {
+                /* task ID was OK but parent app ID is bad */
+                Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+            }
         }
-    }
+    } while (CFE_ES_ReadSharedDataRetry(&ReadState, __func__, __LINE__));
 
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
+    if (!TaskIsActive)
+    {
+        CFE_ES_WriteToSysLog("%s: Task ID Not Active: %lu\n", __func__, CFE_RESOURCEID_TO_ULONG(TaskId));
+    }
 
     return Status;
 }
@@ -1296,7 +1411,7 @@ void CFE_ES_IncrementTaskCounter(void)
     TaskRecPtr = CFE_ES_LocateTaskRecordByID(TaskID);
     if (TaskRecPtr != NULL)
     {
-        TaskRecPtr->ExecutionCounter++;
+        CFE_Atomic_FetchAdd(&TaskRecPtr->ExecutionCounter, 1);
     }
 }
 
@@ -1536,6 +1651,28 @@ uint32 CFE_ES_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputC
  *
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_ES_RegisterCDS(CFE_ES_CDSHandle_t *CDSHandlePtr, size_t BlockSize, const char *Name)
+{
+    return CFE_ES_RegisterAppCDS(CDSHandlePtr, BlockSize, Name, false);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_RegisterCDSDoubleBuffered(CFE_ES_CDSHandle_t *CDSHandlePtr, size_t BlockSize, const char *Name)
+{
+    return CFE_ES_RegisterAppCDS(CDSHandlePtr, BlockSize, Name, true);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_RegisterAppCDS(CFE_ES_CDSHandle_t *CDSHandlePtr, size_t BlockSize, const char *Name, bool DoubleBuffered)
 {
     int32          Status;
     size_t         NameLen;
@@ -1586,7 +1723,7 @@ CFE_Status_t CFE_ES_RegisterCDS(CFE_ES_CDSHandle_t *CDSHandlePtr, size_t BlockSi
             CFE_ES_FormCDSName(CDSName, Name, ThisAppId);
 
             /* Create CDS and designate it as NOT being a Critical Table */
-            Status = CFE_ES_RegisterCDSEx(CDSHandlePtr, BlockSize, CDSName, false);
+            Status = CFE_ES_RegisterCDSBlock(CDSHandlePtr, BlockSize, CDSName, false, DoubleBuffered);
 
             /* If size is unacceptable, log it */
             if (Status == CFE_ES_CDS_INVALID_SIZE)
@@ -1707,6 +1844,49 @@ CFE_Status_t CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, const void *DataToCopy)
     return CFE_ES_CDSBlockWrite(Handle, DataToCopy);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, const void *DataToCopy, size_t Offset, size_t Size)
+{
+    if (DataToCopy == NULL)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    return CFE_ES_CDSBlockWriteRange(Handle, DataToCopy, Offset, Size);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_CopyToCDSDeferred(CFE_ES_CDSHandle_t Handle, const void *DataToCopy)
+{
+    if (DataToCopy == NULL)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    return CFE_ES_CDSBlockWriteDeferred(Handle, DataToCopy);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_FlushCDS(CFE_ES_CDSHandle_t Handle)
+{
+    return CFE_ES_CDSBlockFlush(Handle);
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -1885,8 +2065,9 @@ CFE_Status_t CFE_ES_GetGenCount(CFE_ES_CounterId_t CounterId, uint32 *Count)
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_ES_GetGenCounterIDByName(CFE_ES_CounterId_t *CounterIdPtr, const char *CounterName)
 {
-    CFE_ES_GenCounterRecord_t *CounterRecPtr;
-    int32                      Result;
+    CFE_ES_GenCounterRecord_t *  CounterRecPtr;
+    CFE_ES_SharedDataReadState_t ReadState;
+    int32                        Result;
 
     if (CounterName == NULL || CounterIdPtr == NULL)
     {
@@ -1896,25 +2077,27 @@ CFE_Status_t CFE_ES_GetGenCounterIDByName(CFE_ES_CounterId_t *CounterIdPtr, cons
     /*
     ** Search the ES Generic Counter table for a counter with a matching name.
     */
-    CFE_ES_LockSharedData(__func__, __LINE__);
-
-    CounterRecPtr = CFE_ES_LocateCounterRecordByName(CounterName);
-    if (CounterRecPtr == NULL)
+    memset(&ReadState, 0, sizeof(ReadState));
+    do
     {
-        /*
-         * ensure the output value is set to a safe value,
-         * in case the caller does not check the return code.
-         */
-        Result        = CFE_ES_ERR_NAME_NOT_FOUND;
-        *CounterIdPtr = CFE_ES_COUNTERID_UNDEFINED;
-    }
-    else
-    {
-        Result        = CFE_SUCCESS;
-        *CounterIdPtr = CFE_ES_CounterRecordGetID(CounterRecPtr);
-    }
+        CFE_ES_ReadSharedDataBegin(&ReadState, __func__, __LINE__);
 
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
+        CounterRecPtr = CFE_ES_LocateCounterRecordByName(CounterName);
+        if (CounterRecPtr == NULL)
+        {
+            /*
+             * ensure the output value is set to a safe value,
+             * in case the caller does not check the return code.
+             */
+            Result        = CFE_ES_ERR_NAME_NOT_FOUND;
+            *CounterIdPtr = CFE_ES_COUNTERID_UNDEFINED;
+        }
+        else
+        {
+            Result        = CFE_SUCCESS;
+            *CounterIdPtr = CFE_ES_CounterRecordGetID(CounterRecPtr);
+        }
+    } while (CFE_ES_ReadSharedDataRetry(&ReadState, __func__, __LINE__));
 
     return Result;
 }
@@ -1927,8 +2110,9 @@ CFE_Status_t CFE_ES_GetGenCounterIDByName(CFE_ES_CounterId_t *CounterIdPtr, cons
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_ES_GetGenCounterName(char *CounterName, CFE_ES_CounterId_t CounterId, size_t BufferLength)
 {
-    CFE_ES_GenCounterRecord_t *CountRecPtr;
-    CFE_Status_t               Status;
+    CFE_ES_GenCounterRecord_t *  CountRecPtr;
+    CFE_ES_SharedDataReadState_t ReadState;
+    CFE_Status_t                 Status;
 
     if (BufferLength == 0 || CounterName == NULL)
     {
@@ -1937,21 +2121,23 @@ CFE_Status_t CFE_ES_GetGenCounterName(char *CounterName, CFE_ES_CounterId_t Coun
 
     CountRecPtr = CFE_ES_LocateCounterRecordByID(CounterId);
 
-    CFE_ES_LockSharedData(__func__, __LINE__);
-
-    if (CFE_ES_CounterRecordIsMatch(CountRecPtr, CounterId))
+    memset(&ReadState, 0, sizeof(ReadState));
+    do
     {
-        strncpy(CounterName, CFE_ES_CounterRecordGetName(CountRecPtr), BufferLength - 1);
-        CounterName[BufferLength - 1] = 0;
-        Status                        = CFE_SUCCESS;
-    }
-    else
-    {
-        CounterName[0] = 0;
-        Status         = CFE_ES_ERR_RESOURCEID_NOT_VALID;
-    }
+        CFE_ES_ReadSharedDataBegin(&ReadState, __func__, __LINE__);
 
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
+        if (CFE_ES_CounterRecordIsMatch(CountRecPtr, CounterId))
+        {
+            CFE_ES_ReadSharedName(CounterName, BufferLength, CFE_ES_CounterRecordGetName(CountRecPtr),
+                                  sizeof(CountRecPtr->CounterName));
+            Status = CFE_SUCCESS;
+        }
+        else
+        {
+            CounterName[0] = 0;
+            Status         = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+        }
+    } while (CFE_ES_ReadSharedDataRetry(&ReadState, __func__, __LINE__));
 
     return Status;
 }
@@ -2031,11 +2217,11 @@ CFE_Status_t CFE_ES_CounterID_ToIndex(CFE_ES_CounterId_t CounterId, uint32 *Idx)
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in header file for argument/return detail
+ * Local helper routine, not invoked outside of this unit
+ * Takes the shared data mutex without changing the sequence
  *
  *-----------------------------------------------------------------*/
-void CFE_ES_LockSharedData(const char *FunctionName, int32 LineNumber)
+static void CFE_ES_TakeSharedDataMutex(const char *FunctionName, int32 LineNumber)
 {
     int32 OsStatus;
 
@@ -2046,18 +2232,18 @@ void CFE_ES_LockSharedData(const char *FunctionName, int32 LineNumber)
          * NOTE: this is going to write into a buffer that itself
          * is _supposed_ to be protected by this same mutex.
          */
-        CFE_ES_SysLogWrite_Unsync("%s: SharedData Mutex Take Err Stat=%ld,Func=%s,Line=%d\n", __func__, (long)OsStatus,
-                                  FunctionName, (int)LineNumber);
+        CFE_ES_SysLogWrite_Unsync("%s: SharedData Mutex Take Err Stat=%ld,Func=%s,Line=%d\n", "CFE_ES_LockSharedData",
+                                  (long)OsStatus, FunctionName, (int)LineNumber);
     }
 }
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in header file for argument/return detail
+ * Local helper routine, not invoked outside of this unit
+ * Releases the shared data mutex without changing the sequence
  *
  *-----------------------------------------------------------------*/
-void CFE_ES_UnlockSharedData(const char *FunctionName, int32 LineNumber)
+static void CFE_ES_GiveSharedDataMutex(const char *FunctionName, int32 LineNumber)
 {
     int32 OsStatus;
 
@@ -2068,9 +2254,125 @@ void CFE_ES_UnlockSharedData(const char *FunctionName, int32 LineNumber)
          * NOTE: this is going to write into a buffer that itself
          * is _supposed_ to be protected by this same mutex.
          */
-        CFE_ES_SysLogWrite_Unsync("%s: SharedData Mutex Give Err Stat=%ld,Func=%s,Line=%d\n", __func__, (long)OsStatus,
-                                  FunctionName, (int)LineNumber);
+        CFE_ES_SysLogWrite_Unsync("%s: SharedData Mutex Give Err Stat=%ld,Func=%s,Line=%d\n", "CFE_ES_UnlockSharedData",
+                                  (long)OsStatus, FunctionName, (int)LineNumber);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_LockSharedData(const char *FunctionName, int32 LineNumber)
+{
+    CFE_ES_TakeSharedDataMutex(FunctionName, LineNumber);
+
+    /* Only the outermost lock marks the start of a write, lock-free readers will retry */
+    if (CFE_ES_Global.SharedDataLockDepth == 0)
+    {
+        CFE_Atomic_FetchAdd(&CFE_ES_Global.SharedDataSeq, 1);
+    }
+    ++CFE_ES_Global.SharedDataLockDepth;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_UnlockSharedData(const char *FunctionName, int32 LineNumber)
+{
+    if (CFE_ES_Global.SharedDataLockDepth > 0)
+    {
+        --CFE_ES_Global.SharedDataLockDepth;
+        if (CFE_ES_Global.SharedDataLockDepth == 0)
+        {
+            CFE_Atomic_FetchAdd(&CFE_ES_Global.SharedDataSeq, 1);
+        }
     }
+
+    CFE_ES_GiveSharedDataMutex(FunctionName, LineNumber);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_ReadSharedDataBegin(CFE_ES_SharedDataReadState_t *State, const char *FunctionName, int32 LineNumber)
+{
+    State->IsLocked = false;
+
+    if (State->Attempts < CFE_ES_SHARED_DATA_READ_ATTEMPTS)
+    {
+        State->Sequence = CFE_Atomic_Load(&CFE_ES_Global.SharedDataSeq);
+
+        /* an even value means no writer currently holds the mutex */
+        if ((State->Sequence & 1) == 0)
+        {
+            return;
+        }
+    }
+
+    /*
+     * Either a writer is active or this reader keeps getting interrupted.
+     * Wait for the mutex rather than spin, the writer may be lower priority.
+     * This does not change the data, so it must not advance the sequence
+     * and make other lock-free readers retry.
+     */
+    CFE_ES_TakeSharedDataMutex(FunctionName, LineNumber);
+    State->IsLocked = true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_ReadSharedDataRetry(CFE_ES_SharedDataReadState_t *State, const char *FunctionName, int32 LineNumber)
+{
+    if (State->IsLocked)
+    {
+        CFE_ES_GiveSharedDataMutex(FunctionName, LineNumber);
+        return false;
+    }
+
+    /* the data reads must complete before the sequence is checked again */
+    CFE_Atomic_ReadFence();
+    ++State->Attempts;
+
+    return (CFE_Atomic_Load(&CFE_ES_Global.SharedDataSeq) != State->Sequence);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_ReadSharedName(char *Dest, size_t DestSize, const char *Src, size_t SrcSize)
+{
+    size_t Len;
+
+    if (DestSize == 0)
+    {
+        return;
+    }
+
+    /* never read beyond the source array, a writer may have removed its terminator */
+    Len = 0;
+    while (Len < (DestSize - 1) && Len < SrcSize && Src[Len] != 0)
+    {
+        Dest[Len] = Src[Len];
+        ++Len;
+    }
+
+    Dest[Len] = 0;
 }
 
 /*----------------------------------------------------------------
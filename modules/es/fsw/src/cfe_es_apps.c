@@ -45,11 +45,6 @@
 #include <string.h> /* memset() */
 #include <fcntl.h>
 
-/*
-** Defines
-*/
-#define ES_START_BUFF_SIZE 128
-
 /*
 **
 **  Global Variables
@@ -113,18 +108,17 @@ CFE_ES_AppRecord_t *CFE_ES_LockUserAppRecord(CFE_ES_AppId_t AppID, const char *L
  *-----------------------------------------------------------------*/
 void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
 {
-    char        ES_AppLoadBuffer[ES_START_BUFF_SIZE]; /* A buffer of for a line in a file */
-    char        ScriptFileName[OS_MAX_PATH_LEN];
-    const char *TokenList[CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE];
-    uint32      NumTokens;
-    uint32      NumLines;
-    size_t      BuffLen; /* Length of the current buffer */
-    osal_id_t   AppFile = OS_OBJECT_ID_UNDEFINED;
-    int32       Status;
-    int32       OsStatus;
-    char        c           = 0;
-    bool        LineTooLong = false;
-    bool        FileOpened  = false;
+    CFE_ES_StartupScriptParser_t Parser;
+    CFE_ES_StartupScriptCache_t *CachePtr;
+    char                         ReadBuffer[CFE_ES_STARTSCRIPT_READ_CHUNK_SIZE];
+    char                         ScriptFileName[OS_MAX_PATH_LEN];
+    osal_id_t                    AppFile = OS_OBJECT_ID_UNDEFINED;
+    int32                        Status;
+    int32                        OsStatus;
+    bool                         FileOpened = false;
+    bool                         UseCache   = false;
+
+    CachePtr = &CFE_ES_Global.ResetDataPtr->StartupScript;
 
     /*
     ** Get the ES startup script filename.
@@ -140,15 +134,22 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
 
         if (Status == CFE_SUCCESS)
         {
-            OsStatus = OS_OpenCreate(&AppFile, ScriptFileName, OS_FILE_FLAG_NONE, OS_READ_ONLY);
-            if (OsStatus == OS_SUCCESS)
+            if (CFE_ES_StartupScriptCacheIsCurrent(CachePtr, ScriptFileName))
             {
-                FileOpened = true;
+                UseCache = true;
             }
             else
             {
-                CFE_ES_WriteToSysLog("%s: Cannot Open Volatile Startup file: %s, Trying Nonvolatile.\n", __func__,
-                                     ScriptFileName);
+                OsStatus = OS_OpenCreate(&AppFile, ScriptFileName, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+                if (OsStatus == OS_SUCCESS)
+                {
+                    FileOpened = true;
+                }
+                else
+                {
+                    CFE_ES_WriteToSysLog("%s: Cannot Open Volatile Startup file: %s, Trying Nonvolatile.\n",
+                                         __func__, ScriptFileName);
+                }
             }
         }
         else
@@ -163,7 +164,7 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
     ** This if block covers two cases: A Power on reset, and a Processor reset when
     ** the startup file on the volatile file system could not be opened.
     */
-    if (FileOpened == false)
+    if (FileOpened == false && UseCache == false)
     {
         /*
         ** Try to Open the file passed in to the cFE start.
@@ -173,15 +174,22 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
 
         if (Status == CFE_SUCCESS)
         {
-            OsStatus = OS_OpenCreate(&AppFile, ScriptFileName, OS_FILE_FLAG_NONE, OS_READ_ONLY);
-            if (OsStatus == OS_SUCCESS)
+            if (ResetType == CFE_PSP_RST_TYPE_PROCESSOR && CFE_ES_StartupScriptCacheIsCurrent(CachePtr, ScriptFileName))
             {
-                FileOpened = true;
+                UseCache = true;
             }
             else
             {
-                CFE_ES_WriteToSysLog("%s: Error, Can't Open ES App Startup file: %s, EC = %ld\n", __func__,
-                                     ScriptFileName, (long)OsStatus);
+                OsStatus = OS_OpenCreate(&AppFile, ScriptFileName, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+                if (OsStatus == OS_SUCCESS)
+                {
+                    FileOpened = true;
+                }
+                else
+                {
+                    CFE_ES_WriteToSysLog("%s: Error, Can't Open ES App Startup file: %s, EC = %ld\n", __func__,
+                                         ScriptFileName, (long)OsStatus);
+                }
             }
         }
         else
@@ -192,131 +200,675 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
         }
     }
 
-    /*
-    ** If the file is opened in either the Nonvolatile or the Volatile disk, process it.
-    */
-    if (FileOpened == true)
+    if (UseCache == true)
+    {
+        /*
+        ** The file did not change since it was parsed on the last start,
+        ** so the lines kept in the reset area are used instead.
+        */
+        CFE_ES_WriteToSysLog("%s: Using ES App Startup file kept from last start: %s\n", __func__, ScriptFileName);
+
+        CFE_ES_StartupScriptInit(&Parser, NULL);
+        CFE_ES_ParseStartupScript(&Parser, CachePtr->Data, CachePtr->Length);
+        CFE_ES_StartupLoadRun();
+    }
+    else if (FileOpened == true)
     {
+        /*
+        ** The file is opened in either the Nonvolatile or the Volatile disk, process it.
+        */
         CFE_ES_WriteToSysLog("%s: Opened ES App Startup file: %s\n", __func__, ScriptFileName);
 
-        memset(ES_AppLoadBuffer, 0x0, ES_START_BUFF_SIZE);
-        BuffLen      = 0;
-        NumTokens    = 0;
-        NumLines     = 0;
-        TokenList[0] = ES_AppLoadBuffer;
+        CFE_ES_StartupScriptInit(&Parser, CachePtr);
 
         /*
-        ** Parse the lines from the file. If it has an error
-        ** or reaches EOF, then abort the loop.
+        ** Parse the file a chunk at a time. If it has an error,
+        ** reaches EOF or the end of script mark, then abort the loop.
         */
-        while (1)
+        do
         {
-            OsStatus = OS_read(AppFile, &c, 1);
+            OsStatus = OS_read(AppFile, ReadBuffer, sizeof(ReadBuffer));
             if (OsStatus < OS_SUCCESS)
             {
                 CFE_ES_WriteToSysLog("%s: Error Reading Startup file. EC = %ld\n", __func__, (long)OsStatus);
-                break;
             }
-            else if (OsStatus == 0)
+            else
+            {
+                CFE_ES_ParseStartupScript(&Parser, ReadBuffer, OsStatus);
+            }
+        } while (OsStatus > 0 && !Parser.EndOfScript);
+
+        /*
+        ** Only a script that was read completely is kept for the next processor reset
+        */
+        if (OsStatus >= OS_SUCCESS && Parser.CachePtr != NULL)
+        {
+            CFE_ES_StartupScriptCacheCommit(Parser.CachePtr, ScriptFileName);
+        }
+
+        /*
+        ** close the file
+        */
+        OS_close(AppFile);
+
+        /*
+        ** Start the entries parsed before the end of the file or an error
+        */
+        CFE_ES_StartupLoadRun();
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupScriptInit(CFE_ES_StartupScriptParser_t *Parser, CFE_ES_StartupScriptCache_t *CachePtr)
+{
+    memset(Parser, 0, sizeof(*Parser));
+    Parser->TokenList[0] = Parser->LineBuffer;
+    Parser->CachePtr     = CachePtr;
+
+    if (CachePtr != NULL)
+    {
+        /* The cache is not used again until the whole script is parsed */
+        CachePtr->Signature = 0;
+        CachePtr->Length    = 0;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_ParseStartupScript(CFE_ES_StartupScriptParser_t *Parser, const char *Data, size_t DataSize)
+{
+    CFE_ES_StartupScriptCache_t *CachePtr;
+    size_t                       i;
+    size_t                       j;
+    char                         c;
+
+    for (i = 0; i < DataSize && !Parser->EndOfScript; ++i)
+    {
+        c = Data[i];
+        if (c == '!')
+        {
+            /*
+            ** stop when EOF character '!' is reached
+            */
+            Parser->EndOfScript = true;
+        }
+        else if (c <= ' ')
+        {
+            /*
+            ** Skip all white space in the file
+            */
+            ;
+        }
+        else if (c == ',')
+        {
+            /*
+            ** replace the field delimiter with a null
+            ** This is used to separate the tokens
+            */
+            if (Parser->BuffLen < CFE_ES_STARTSCRIPT_LINE_BUFFER_SIZE)
+            {
+                Parser->LineBuffer[Parser->BuffLen] = 0;
+            }
+            else
+            {
+                Parser->LineTooLong = true;
+            }
+            Parser->BuffLen++;
+
+            ++Parser->NumTokens;
+            if (Parser->NumTokens < CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE && !Parser->LineTooLong)
             {
                 /*
-                ** EOF Reached
+                 * NOTE: pointer never dereferenced unless "LineTooLong" is false.
+                 */
+                Parser->TokenList[Parser->NumTokens] = &Parser->LineBuffer[Parser->BuffLen];
+            }
+            else
+            {
+                Parser->LineTooLong = true;
+            }
+        }
+        else if (c != ';')
+        {
+            /*
+            ** Regular data gets copied in
+            */
+            if (Parser->BuffLen < CFE_ES_STARTSCRIPT_LINE_BUFFER_SIZE)
+            {
+                Parser->LineBuffer[Parser->BuffLen] = c;
+            }
+            else
+            {
+                Parser->LineTooLong = true;
+            }
+            Parser->BuffLen++;
+        }
+        else
+        {
+            ++Parser->NumLines;
+
+            if (Parser->LineTooLong == true)
+            {
+                /*
+                ** The line was not formed correctly
                 */
-                break;
+                CFE_ES_WriteToSysLog("%s: **WARNING** File Line %u is malformed: %u bytes, %u tokens.\n", __func__,
+                                     (unsigned int)Parser->NumLines, (unsigned int)Parser->BuffLen,
+                                     (unsigned int)Parser->NumTokens);
+                Parser->LineTooLong = false;
             }
-            else if (c != '!')
+            else
             {
-                if (c <= ' ')
+                /*
+                ** Send the line to the file parser
+                ** Ensure termination of the last token and send it along
+                */
+                Parser->LineBuffer[Parser->BuffLen] = 0;
+                CFE_ES_StartupLoadAddEntry(Parser->TokenList, 1 + Parser->NumTokens);
+
+                /*
+                ** Keep the line, with its delimiters restored, for the next processor reset
+                */
+                CachePtr = Parser->CachePtr;
+                if (CachePtr != NULL && CachePtr->Length + Parser->BuffLen + 1 > sizeof(CachePtr->Data))
                 {
-                    /*
-                    ** Skip all white space in the file
-                    */
-                    ;
+                    CFE_ES_WriteToSysLog("%s: Startup file too large to keep for next reset\n", __func__);
+                    Parser->CachePtr = NULL;
                 }
-                else if (c == ',')
+                else if (CachePtr != NULL)
                 {
-                    /*
-                    ** replace the field delimiter with a null
-                    ** This is used to separate the tokens
-                    */
-                    if (BuffLen < ES_START_BUFF_SIZE)
-                    {
-                        ES_AppLoadBuffer[BuffLen] = 0;
-                    }
-                    else
-                    {
-                        LineTooLong = true;
-                    }
-                    BuffLen++;
-
-                    ++NumTokens;
-                    if (NumTokens < CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE && !LineTooLong)
-                    {
-                        /*
-                         * NOTE: pointer never dereferenced unless "LineTooLong" is false.
-                         */
-                        TokenList[NumTokens] = &ES_AppLoadBuffer[BuffLen];
-                    }
-                    else
+                    for (j = 0; j < Parser->BuffLen; ++j)
                     {
-                        LineTooLong = true;
+                        if (Parser->LineBuffer[j] == 0)
+                        {
+                            CachePtr->Data[CachePtr->Length] = ',';
+                        }
+                        else
+                        {
+                            CachePtr->Data[CachePtr->Length] = Parser->LineBuffer[j];
+                        }
+                        ++CachePtr->Length;
                     }
+                    CachePtr->Data[CachePtr->Length] = ';';
+                    ++CachePtr->Length;
                 }
-                else if (c != ';')
+            }
+            Parser->BuffLen   = 0;
+            Parser->NumTokens = 0;
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupScriptCacheCommit(CFE_ES_StartupScriptCache_t *CachePtr, const char *ScriptFileName)
+{
+    os_fstat_t FileStats;
+
+    memset(&FileStats, 0, sizeof(FileStats));
+
+    /*
+    ** The size and time of the file are kept to tell if it is changed before the next reset
+    */
+    if (OS_stat(ScriptFileName, &FileStats) == OS_SUCCESS)
+    {
+        strncpy(CachePtr->FileName, ScriptFileName, sizeof(CachePtr->FileName) - 1);
+        CachePtr->FileName[sizeof(CachePtr->FileName) - 1] = 0;
+
+        CachePtr->FileSize     = OS_FILESTAT_SIZE(FileStats);
+        CachePtr->FileTimeMsec = OS_TimeGetTotalMilliseconds(OS_FILESTAT_TIME(FileStats));
+        CachePtr->Crc          = CFE_ES_CalculateCRC(CachePtr->Data, CachePtr->Length, 0, CFE_MISSION_ES_DEFAULT_CRC);
+        CachePtr->Signature    = CFE_ES_STARTSCRIPT_CACHE_SIGNATURE;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_StartupScriptCacheIsCurrent(const CFE_ES_StartupScriptCache_t *CachePtr, const char *ScriptFileName)
+{
+    os_fstat_t FileStats;
+    bool       IsCurrent;
+
+    IsCurrent = false;
+    memset(&FileStats, 0, sizeof(FileStats));
+
+    /*
+    ** The reset area is not cleared on a power on reset, so the content is checked as well
+    */
+    if (CachePtr->Signature == CFE_ES_STARTSCRIPT_CACHE_SIGNATURE && CachePtr->Length <= sizeof(CachePtr->Data) &&
+        CachePtr->Crc == CFE_ES_CalculateCRC(CachePtr->Data, CachePtr->Length, 0, CFE_MISSION_ES_DEFAULT_CRC) &&
+        strncmp(CachePtr->FileName, ScriptFileName, sizeof(CachePtr->FileName)) == 0 &&
+        OS_stat(ScriptFileName, &FileStats) == OS_SUCCESS)
+    {
+        IsCurrent = (CachePtr->FileSize == OS_FILESTAT_SIZE(FileStats) &&
+                     CachePtr->FileTimeMsec == OS_TimeGetTotalMilliseconds(OS_FILESTAT_TIME(FileStats)));
+    }
+
+    return IsCurrent;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupLoadAddEntry(const char **TokenList, uint32 NumTokens)
+{
+    CFE_ES_StartupLoadGlobal_t *     StartupLoad = &CFE_ES_Global.StartupLoad;
+    CFE_ES_StartupLoadEntry_t *      EntryPtr;
+    const CFE_ES_StartupLoadEntry_t *OtherPtr;
+    const char *                     NamePtr;
+    const char *                     EndPtr;
+    size_t                           Offset;
+    size_t                           TokenLen;
+    size_t                           NameLen;
+    uint32                           i;
+    uint32                           j;
+    bool                             IsFound;
+
+    if (StartupLoad->NumEntries >= CFE_ES_STARTUP_LOAD_MAX_ENTRIES)
+    {
+        CFE_ES_StartupLoadRun();
+    }
+
+    EntryPtr = &StartupLoad->Entries[StartupLoad->NumEntries];
+    memset(EntryPtr, 0, sizeof(*EntryPtr));
+    EntryPtr->State    = CFE_ES_StartupLoadState_DONE;
+    EntryPtr->ModuleId = OS_OBJECT_ID_UNDEFINED;
+
+    /*
+     * Keep a copy of the tokens, as the line buffer of the parser is reused
+     */
+    Offset = 0;
+    for (i = 0; i < NumTokens && i < CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE; ++i)
+    {
+        TokenLen = strlen(TokenList[i]);
+        if (Offset + TokenLen >= sizeof(EntryPtr->LineBuffer))
+        {
+            break;
+        }
+
+        memcpy(&EntryPtr->LineBuffer[Offset], TokenList[i], TokenLen + 1);
+        EntryPtr->TokenList[i] = &EntryPtr->LineBuffer[Offset];
+        Offset += TokenLen + 1;
+    }
+    EntryPtr->NumTokens = i;
+
+    /*
+     * Only complete app and library entries have a module to load ahead,
+     * with the same flags as CFE_ES_LoadModule() uses.  Any problem with
+     * the others is reported when they are started.
+     */
+    if (EntryPtr->NumTokens >= 8 &&
+        CFE_FS_ParseInputFileName(EntryPtr->FileName, EntryPtr->TokenList[1], sizeof(EntryPtr->FileName),
+                                  CFE_FS_FileCategory_DYNAMIC_MODULE) == CFE_SUCCESS &&
+        EntryPtr->FileName[0] != 0)
+    {
+        if (strcmp(EntryPtr->TokenList[0], "CFE_APP") == 0)
+        {
+            EntryPtr->LoadFlags = OS_MODULE_FLAG_LOCAL_SYMBOLS;
+            EntryPtr->State     = CFE_ES_StartupLoadState_PENDING;
+        }
+        else if (strcmp(EntryPtr->TokenList[0], "CFE_LIB") == 0)
+        {
+            EntryPtr->LoadFlags = OS_MODULE_FLAG_GLOBAL_SYMBOLS;
+            EntryPtr->State     = CFE_ES_StartupLoadState_PENDING;
+        }
+    }
+
+    /*
+     * The module is loaded in the stage after the modules it depends on.  Without a
+     * dependency field, it depends on all the libraries before it in the script.
+     * Only modules before it in the script can be named, so there is no cycle.
+     */
+    if (EntryPtr->NumTokens > CFE_ES_STARTSCRIPT_DEPENDENCY_TOKEN)
+    {
+        NamePtr = EntryPtr->TokenList[CFE_ES_STARTSCRIPT_DEPENDENCY_TOKEN];
+        if (strcmp(NamePtr, CFE_ES_STARTSCRIPT_DEPENDENCY_NONE) == 0)
+        {
+            NamePtr = NULL;
+        }
+
+        while (NamePtr != NULL)
+        {
+            EndPtr = strchr(NamePtr, CFE_ES_STARTSCRIPT_DEPENDENCY_SEPARATOR);
+            if (EndPtr != NULL)
+            {
+                NameLen = (size_t)(EndPtr - NamePtr);
+            }
+            else
+            {
+                NameLen = strlen(NamePtr);
+            }
+
+            IsFound = false;
+            for (j = 0; j < StartupLoad->NumEntries; ++j)
+            {
+                OtherPtr = &StartupLoad->Entries[j];
+                if (OtherPtr->NumTokens >= 8 && strlen(OtherPtr->TokenList[3]) == NameLen &&
+                    strncmp(NamePtr, OtherPtr->TokenList[3], NameLen) == 0)
                 {
-                    /*
-                    ** Regular data gets copied in
-                    */
-                    if (BuffLen < ES_START_BUFF_SIZE)
-                    {
-                        ES_AppLoadBuffer[BuffLen] = c;
-                    }
-                    else
+                    IsFound = true;
+                    if (OtherPtr->Stage >= EntryPtr->Stage)
                     {
-                        LineTooLong = true;
+                        EntryPtr->Stage = OtherPtr->Stage + 1;
                     }
-                    BuffLen++;
                 }
-                else
-                {
-                    ++NumLines;
+            }
 
-                    if (LineTooLong == true)
-                    {
-                        /*
-                        ** The line was not formed correctly
-                        */
-                        CFE_ES_WriteToSysLog("%s: **WARNING** File Line %u is malformed: %u bytes, %u tokens.\n",
-                                             __func__, (unsigned int)NumLines, (unsigned int)BuffLen,
-                                             (unsigned int)NumTokens);
-                        LineTooLong = false;
-                    }
-                    else
-                    {
-                        /*
-                        ** Send the line to the file parser
-                        ** Ensure termination of the last token and send it along
-                        */
-                        ES_AppLoadBuffer[BuffLen] = 0;
-                        CFE_ES_ParseFileEntry(TokenList, 1 + NumTokens);
-                    }
-                    BuffLen   = 0;
-                    NumTokens = 0;
-                }
+            /*
+             * A misspelled or later name would otherwise let the module load too early
+             */
+            if (!IsFound && NameLen != 0)
+            {
+                CFE_ES_WriteToSysLog("%s: **WARNING** Dependency '%.*s' of %s matches no earlier entry\n", __func__,
+                                     (int)NameLen, NamePtr, EntryPtr->TokenList[3]);
+            }
+
+            if (EndPtr != NULL)
+            {
+                NamePtr = EndPtr + 1;
             }
             else
             {
-                /*
-                ** break when EOF character '!' is reached
-                */
+                NamePtr = NULL;
+            }
+        }
+    }
+    else if (EntryPtr->NumTokens >= 8)
+    {
+        for (j = 0; j < StartupLoad->NumEntries; ++j)
+        {
+            OtherPtr = &StartupLoad->Entries[j];
+            if (OtherPtr->NumTokens >= 8 && OtherPtr->Stage >= EntryPtr->Stage &&
+                strcmp(OtherPtr->TokenList[0], "CFE_LIB") == 0)
+            {
+                EntryPtr->Stage = OtherPtr->Stage + 1;
+            }
+        }
+    }
+
+    ++StartupLoad->NumEntries;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupLoadRun(void)
+{
+    CFE_ES_StartupLoadGlobal_t *StartupLoad = &CFE_ES_Global.StartupLoad;
+    CFE_ES_StartupLoadEntry_t * EntryPtr;
+    char                        LoaderName[OS_MAX_API_NAME];
+    osal_id_t                   LoaderId;
+    uint32                      MaxStage;
+    uint32                      StageEntries;
+    uint32                      NumLoaders;
+    uint32                      i;
+    int32                       OsStatus;
+
+    MaxStage = 0;
+    for (i = 0; i < StartupLoad->NumEntries; ++i)
+    {
+        if (StartupLoad->Entries[i].Stage > MaxStage)
+        {
+            MaxStage = StartupLoad->Entries[i].Stage;
+        }
+    }
+
+    /*
+     * The loader tasks are only used if the entry states can be protected
+     */
+    StartupLoad->LoadMutex  = OS_OBJECT_ID_UNDEFINED;
+    StartupLoad->LoaderDone = OS_OBJECT_ID_UNDEFINED;
+    if (CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS > 1 && StartupLoad->NumEntries > 1)
+    {
+        OsStatus = OS_MutSemCreate(&StartupLoad->LoadMutex, "ES_LOAD_MUT", 0);
+        if (OsStatus == OS_SUCCESS)
+        {
+            OsStatus = OS_CountSemCreate(&StartupLoad->LoaderDone, "ES_LOAD_SEM", 0, 0);
+            if (OsStatus != OS_SUCCESS)
+            {
+                OS_MutSemDelete(StartupLoad->LoadMutex);
+            }
+        }
+
+        if (OsStatus != OS_SUCCESS)
+        {
+            StartupLoad->LoadMutex  = OS_OBJECT_ID_UNDEFINED;
+            StartupLoad->LoaderDone = OS_OBJECT_ID_UNDEFINED;
+            CFE_ES_WriteToSysLog("%s: Cannot create loader sync objects, EC = %ld\n", __func__, (long)OsStatus);
+        }
+    }
+
+    for (StartupLoad->CurrentStage = 0; StartupLoad->CurrentStage <= MaxStage; ++StartupLoad->CurrentStage)
+    {
+        StageEntries = 0;
+        for (i = 0; i < StartupLoad->NumEntries; ++i)
+        {
+            EntryPtr = &StartupLoad->Entries[i];
+            if (EntryPtr->Stage == StartupLoad->CurrentStage && EntryPtr->State == CFE_ES_StartupLoadState_PENDING)
+            {
+                ++StageEntries;
+            }
+        }
+
+        /*
+         * The ES startup task loads modules too, so one loader task less is needed
+         */
+        NumLoaders = 0;
+        while (OS_ObjectIdDefined(StartupLoad->LoaderDone) && NumLoaders + 1 < StageEntries &&
+               NumLoaders + 1 < CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS)
+        {
+            /* Tasks of the previous stage may not be deleted yet, so the names include the stage */
+            snprintf(LoaderName, sizeof(LoaderName), "ES_LOADER%u.%u", (unsigned int)StartupLoad->CurrentStage,
+                     (unsigned int)NumLoaders);
+            OsStatus = OS_TaskCreate(&LoaderId, LoaderName, CFE_ES_StartupLoaderTask, OSAL_TASK_STACK_ALLOCATE,
+                                     CFE_PLATFORM_ES_START_TASK_STACK_SIZE, CFE_PLATFORM_ES_START_TASK_PRIORITY, 0);
+            if (OsStatus != OS_SUCCESS)
+            {
+                CFE_ES_WriteToSysLog("%s: Cannot create loader task %s, EC = %ld\n", __func__, LoaderName,
+                                     (long)OsStatus);
                 break;
             }
+
+            ++NumLoaders;
         }
+
+        CFE_ES_StartupLoadModules();
+
         /*
-        ** close the file
-        */
-        OS_close(AppFile);
+         * The next stage depends on all the modules of this one
+         */
+        while (NumLoaders > 0)
+        {
+            OS_CountSemTake(StartupLoad->LoaderDone);
+            --NumLoaders;
+        }
+    }
+
+    if (OS_ObjectIdDefined(StartupLoad->LoaderDone))
+    {
+        OS_CountSemDelete(StartupLoad->LoaderDone);
+        StartupLoad->LoaderDone = OS_OBJECT_ID_UNDEFINED;
     }
+    if (OS_ObjectIdDefined(StartupLoad->LoadMutex))
+    {
+        OS_MutSemDelete(StartupLoad->LoadMutex);
+        StartupLoad->LoadMutex = OS_OBJECT_ID_UNDEFINED;
+    }
+
+    /*
+     * Create the apps and libraries in the order of the script, with the modules loaded above
+     */
+    StartupLoad->IsLoaded = true;
+    for (i = 0; i < StartupLoad->NumEntries; ++i)
+    {
+        EntryPtr = &StartupLoad->Entries[i];
+        CFE_ES_ParseFileEntry(EntryPtr->TokenList, EntryPtr->NumTokens);
+    }
+    StartupLoad->IsLoaded = false;
+
+    /*
+     * Modules not taken, such as those of entries that were rejected, are not used
+     */
+    for (i = 0; i < StartupLoad->NumEntries; ++i)
+    {
+        EntryPtr = &StartupLoad->Entries[i];
+        if (EntryPtr->State == CFE_ES_StartupLoadState_LOADED)
+        {
+            OsStatus = OS_ModuleUnload(EntryPtr->ModuleId);
+            if (OsStatus != OS_SUCCESS)
+            {
+                CFE_ES_WriteToSysLog("%s: Failed to unload: %s. EC = %ld\n", __func__, EntryPtr->TokenList[3],
+                                     (long)OsStatus);
+            }
+            EntryPtr->State = CFE_ES_StartupLoadState_DONE;
+        }
+    }
+
+    StartupLoad->NumEntries = 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupLoadModules(void)
+{
+    CFE_ES_StartupLoadGlobal_t *StartupLoad = &CFE_ES_Global.StartupLoad;
+    CFE_ES_StartupLoadEntry_t * EntryPtr;
+    osal_id_t                   ModuleId;
+    int32                       OsStatus;
+    bool                        IsLocked;
+    uint32                      i;
+    uint32                      LoadStart;
+
+    IsLocked = OS_ObjectIdDefined(StartupLoad->LoadMutex);
+
+    do
+    {
+        /*
+         * Claim the next module of the stage, so no other loader loads it
+         */
+        if (IsLocked)
+        {
+            OS_MutSemTake(StartupLoad->LoadMutex);
+        }
+
+        EntryPtr = NULL;
+        for (i = 0; i < StartupLoad->NumEntries; ++i)
+        {
+            if (StartupLoad->Entries[i].Stage == StartupLoad->CurrentStage &&
+                StartupLoad->Entries[i].State == CFE_ES_StartupLoadState_PENDING)
+            {
+                EntryPtr        = &StartupLoad->Entries[i];
+                EntryPtr->State = CFE_ES_StartupLoadState_LOADING;
+                break;
+            }
+        }
+
+        if (IsLocked)
+        {
+            OS_MutSemGive(StartupLoad->LoadMutex);
+        }
+
+        if (EntryPtr != NULL)
+        {
+            /*
+             * A failure is not reported here, the module is loaded again
+             * when its app or library is created, and reported then.
+             */
+            ModuleId  = OS_OBJECT_ID_UNDEFINED;
+            LoadStart = CFE_ES_StartupTimingNow();
+            OsStatus  = OS_ModuleLoad(&ModuleId, EntryPtr->TokenList[3], EntryPtr->FileName, EntryPtr->LoadFlags);
+            CFE_ES_StartupTimingRecord(CFE_ES_StartupPhase_MODULE_LOAD, EntryPtr->TokenList[3], LoadStart);
+
+            if (IsLocked)
+            {
+                OS_MutSemTake(StartupLoad->LoadMutex);
+            }
+
+            if (OsStatus == OS_SUCCESS)
+            {
+                EntryPtr->ModuleId = ModuleId;
+                EntryPtr->State    = CFE_ES_StartupLoadState_LOADED;
+            }
+            else
+            {
+                EntryPtr->State = CFE_ES_StartupLoadState_DONE;
+            }
+
+            if (IsLocked)
+            {
+                OS_MutSemGive(StartupLoad->LoadMutex);
+            }
+        }
+    } while (EntryPtr != NULL);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupLoaderTask(void)
+{
+    CFE_ES_StartupLoadModules();
+    OS_CountSemGive(CFE_ES_Global.StartupLoad.LoaderDone);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+osal_id_t CFE_ES_StartupLoadTakeModule(const char *ModuleName, const char *FileName)
+{
+    CFE_ES_StartupLoadGlobal_t *StartupLoad = &CFE_ES_Global.StartupLoad;
+    CFE_ES_StartupLoadEntry_t * EntryPtr;
+    osal_id_t                   ModuleId;
+    uint32                      i;
+
+    ModuleId = OS_OBJECT_ID_UNDEFINED;
+
+    for (i = 0; StartupLoad->IsLoaded && i < StartupLoad->NumEntries; ++i)
+    {
+        EntryPtr = &StartupLoad->Entries[i];
+        if (EntryPtr->State == CFE_ES_StartupLoadState_LOADED && strcmp(EntryPtr->TokenList[3], ModuleName) == 0 &&
+            strcmp(EntryPtr->FileName, FileName) == 0)
+        {
+            ModuleId        = EntryPtr->ModuleId;
+            EntryPtr->State = CFE_ES_StartupLoadState_DONE;
+            break;
+        }
+    }
+
+    return ModuleId;
 }
 
 /*----------------------------------------------------------------
@@ -444,6 +996,7 @@ int32 CFE_ES_LoadModule(CFE_ResourceId_t ParentResourceId, const char *ModuleNam
     int32     ReturnCode;
     int32     OsStatus;
     uint32    LoadFlags;
+    uint32    LoadStart;
 
     LoadFlags         = 0;
     InitSymbolAddress = 0;
@@ -478,9 +1031,20 @@ int32 CFE_ES_LoadModule(CFE_ResourceId_t ParentResourceId, const char *ModuleNam
         }
 
         /*
-         * Load the module via OSAL.
+         * Use the module if it was loaded along with the others in the startup script,
+         * otherwise load the module via OSAL.
          */
-        OsStatus = OS_ModuleLoad(&ModuleId, ModuleName, LoadParams->FileName, LoadFlags);
+        ModuleId = CFE_ES_StartupLoadTakeModule(ModuleName, LoadParams->FileName);
+        if (OS_ObjectIdDefined(ModuleId))
+        {
+            OsStatus = OS_SUCCESS;
+        }
+        else
+        {
+            LoadStart = CFE_ES_StartupTimingNow();
+            OsStatus  = OS_ModuleLoad(&ModuleId, ModuleName, LoadParams->FileName, LoadFlags);
+            CFE_ES_StartupTimingRecord(CFE_ES_StartupPhase_MODULE_LOAD, ModuleName, LoadStart);
+        }
 
         if (OsStatus != OS_SUCCESS)
         {
@@ -593,6 +1157,8 @@ int32 CFE_ES_GetTaskFunction(CFE_ES_TaskEntryFuncPtr_t *FuncPtr)
 void CFE_ES_TaskEntryPoint(void)
 {
     CFE_ES_TaskEntryFuncPtr_t RealEntryFunc;
+    CFE_ES_TaskRecord_t *     TaskRecPtr;
+    char                      TaskName[OS_MAX_API_NAME];
 
     /* When CFE_ES_GetTaskFunction returns CFE_SUCCESS, RealEntryFunc != NULL
      * is implicit and therefore does not need to be checked here. This is 
@@ -611,8 +1177,28 @@ void CFE_ES_TaskEntryPoint(void)
          */
         CFE_ES_LockSharedData(__func__, __LINE__);
         CFE_PSP_SetDefaultExceptionEnvironment();
+
+        /*
+         * Resolve the app/task context of this task once, so the
+         * CFE_ES_GetAppID()/CFE_ES_GetTaskID() calls made by the task
+         * do not need to take the shared data lock.
+         */
+        CFE_ES_UpdateTaskContextCache();
+
+        TaskRecPtr = CFE_ES_GetTaskRecordByContext();
+        if (TaskRecPtr != NULL)
+        {
+            strncpy(TaskName, TaskRecPtr->TaskName, sizeof(TaskName) - 1);
+            TaskName[sizeof(TaskName) - 1] = '\0';
+        }
+        else
+        {
+            TaskName[0] = '\0';
+        }
         CFE_ES_UnlockSharedData(__func__, __LINE__);
 
+        CFE_ES_StartupTimingMark(CFE_ES_StartupPhase_TASK_START, TaskName);
+
         /*
          * Call the actual task entry function
          */
@@ -884,6 +1470,7 @@ int32 CFE_ES_LoadLibrary(CFE_ES_LibId_t *LibraryIdPtr, const char *LibName, cons
     CFE_ES_LibRecord_t *         LibSlotPtr;
     int32                        Status;
     CFE_ResourceId_t             PendingResourceId;
+    uint32                       InitStart;
 
     /*
      * The LibName must not be NULL
@@ -985,7 +1572,9 @@ int32 CFE_ES_LoadLibrary(CFE_ES_LibId_t *LibraryIdPtr, const char *LibName, cons
         FunctionPointer = (CFE_ES_LibraryEntryFuncPtr_t)LibSlotPtr->LoadStatus.InitSymbolAddress;
         if (FunctionPointer != NULL)
         {
-            Status = (*FunctionPointer)(CFE_ES_LIBID_C(PendingResourceId));
+            InitStart = CFE_ES_StartupTimingNow();
+            Status    = (*FunctionPointer)(CFE_ES_LIBID_C(PendingResourceId));
+            CFE_ES_StartupTimingRecord(CFE_ES_StartupPhase_LIB_INIT, LibName, InitStart);
             if (Status != CFE_SUCCESS)
             {
                 CFE_ES_WriteToSysLog("%s: Load Shared Library Init Error = 0x%08x\n", __func__, (unsigned int)Status);
@@ -1765,11 +2354,11 @@ int32 CFE_ES_CleanupTaskResources(CFE_ES_TaskId_t TaskId)
  *-----------------------------------------------------------------*/
 void CFE_ES_CopyModuleBasicInfo(const CFE_ES_ModuleLoadParams_t *ParamsPtr, CFE_ES_AppInfo_t *AppInfoPtr)
 {
-    strncpy(AppInfoPtr->EntryPoint, ParamsPtr->InitSymbolName, sizeof(AppInfoPtr->EntryPoint) - 1);
-    AppInfoPtr->EntryPoint[sizeof(AppInfoPtr->EntryPoint) - 1] = '\0';
-
-    strncpy(AppInfoPtr->FileName, ParamsPtr->FileName, sizeof(AppInfoPtr->FileName) - 1);
-    AppInfoPtr->FileName[sizeof(AppInfoPtr->FileName) - 1] = '\0';
+    /* this is called within lock-free reads of the app and library tables */
+    CFE_ES_ReadSharedName(AppInfoPtr->EntryPoint, sizeof(AppInfoPtr->EntryPoint), ParamsPtr->InitSymbolName,
+                          sizeof(ParamsPtr->InitSymbolName));
+    CFE_ES_ReadSharedName(AppInfoPtr->FileName, sizeof(AppInfoPtr->FileName), ParamsPtr->FileName,
+                          sizeof(ParamsPtr->FileName));
 }
 
 /*----------------------------------------------------------------
@@ -39,11 +39,33 @@
 
 #include "cfe_es_api_typedefs.h"
 #include "cfe_fs_api_typedefs.h"
+#include "cfe_es_resetdata_typedef.h"
+#include "cfe_core_atomic.h"
 
 /*
 ** Macro Definitions
 */
-#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE 8
+#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE 9
+#define CFE_ES_STARTSCRIPT_LINE_BUFFER_SIZE    128
+#define CFE_ES_STARTSCRIPT_READ_CHUNK_SIZE     512
+
+/*
+** Index of the optional dependency field in a startup script entry, the
+** separator between the module names in it, and the value for no dependency
+*/
+#define CFE_ES_STARTSCRIPT_DEPENDENCY_TOKEN     8
+#define CFE_ES_STARTSCRIPT_DEPENDENCY_SEPARATOR '|'
+#define CFE_ES_STARTSCRIPT_DEPENDENCY_NONE      "NONE"
+
+/*
+** Number of startup script entries whose modules are loaded together
+*/
+#define CFE_ES_STARTUP_LOAD_MAX_ENTRIES (CFE_PLATFORM_ES_MAX_APPLICATIONS + CFE_PLATFORM_ES_MAX_LIBRARIES)
+
+/*
+** Value of the startup script cache signature once the cache content is complete
+*/
+#define CFE_ES_STARTSCRIPT_CACHE_SIGNATURE 0x53435254
 
 /*
 ** Type Definitions
@@ -135,6 +157,7 @@ typedef struct
     CFE_ES_ModuleLoadStatus_t LoadStatus;               /* Runtime module information */
     CFE_ES_ControlReq_t       ControlReq;               /* The Control Request Record for External cFE Apps */
     CFE_ES_TaskId_t           MainTaskId;               /* The Application's Main Task ID */
+    bool                      RunLoopEntered;           /* Whether the app has called CFE_ES_RunLoop() */
 } CFE_ES_AppRecord_t;
 
 /*
@@ -148,7 +171,7 @@ typedef struct
     CFE_ES_AppId_t            AppId;                     /* The parent Application's App ID */
     CFE_ES_TaskStartParams_t  StartParams;               /* The start parameters for the task */
     CFE_ES_TaskEntryFuncPtr_t EntryFunc;                 /* Task entry function */
-    uint32                    ExecutionCounter;          /* The execution counter for the task */
+    CFE_Atomic_Uint32_t       ExecutionCounter;          /* The execution counter, updated without the lock */
 } CFE_ES_TaskRecord_t;
 
 /*
@@ -174,6 +197,68 @@ typedef struct
     uint8  LastScanCommandCount;
 } CFE_ES_AppTableScanState_t;
 
+/*
+** CFE_ES_StartupScriptParser_t is the state of the startup script parser.
+** It is kept across calls, so the script can be given in chunks that do not
+** follow line boundaries.
+*/
+typedef struct
+{
+    char        LineBuffer[CFE_ES_STARTSCRIPT_LINE_BUFFER_SIZE + 1]; /* Current line, with room for the terminator */
+    const char *TokenList[CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE];
+    size_t      BuffLen;
+    uint32      NumTokens;
+    uint32      NumLines;
+    bool        LineTooLong;
+    bool        EndOfScript; /* The end of script mark was reached */
+
+    CFE_ES_StartupScriptCache_t *CachePtr; /* Where the valid lines are kept, or NULL */
+} CFE_ES_StartupScriptParser_t;
+
+/*
+** CFE_ES_StartupLoadState_t is the state of the module of a startup script entry
+*/
+typedef enum
+{
+    CFE_ES_StartupLoadState_PENDING, /* Waiting for its stage to be loaded */
+    CFE_ES_StartupLoadState_LOADING, /* Being loaded by one of the loaders */
+    CFE_ES_StartupLoadState_LOADED,  /* Loaded, and not yet taken by its app or library */
+    CFE_ES_StartupLoadState_DONE     /* Taken by its app or library, or nothing to load */
+} CFE_ES_StartupLoadState_t;
+
+/*
+** CFE_ES_StartupLoadEntry_t is an entry of the startup script, kept until
+** its app or library is created.
+*/
+typedef struct
+{
+    char        LineBuffer[CFE_ES_STARTSCRIPT_LINE_BUFFER_SIZE + 1]; /* Tokens of the entry */
+    const char *TokenList[CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE];
+    uint32      NumTokens;
+
+    char                      FileName[OS_MAX_PATH_LEN]; /* Module to load, or empty */
+    uint32                    LoadFlags;
+    uint32                    Stage; /* The modules of a stage are loaded together */
+    CFE_ES_StartupLoadState_t State;
+    osal_id_t                 ModuleId;
+} CFE_ES_StartupLoadEntry_t;
+
+/*
+** CFE_ES_StartupLoadGlobal_t holds the startup script entries whose
+** modules are loaded together, before their apps and libraries are created
+** in the order of the script.
+*/
+typedef struct
+{
+    osal_id_t LoadMutex;    /* Protects the entry states while loader tasks run */
+    osal_id_t LoaderDone;   /* Given by each loader task when it is done */
+    uint32    CurrentStage; /* Stage being loaded */
+    uint32    NumEntries;   /* Entries in the table */
+    bool      IsLoaded;     /* Modules can be taken by CFE_ES_LoadModule() */
+
+    CFE_ES_StartupLoadEntry_t Entries[CFE_ES_STARTUP_LOAD_MAX_ENTRIES];
+} CFE_ES_StartupLoadGlobal_t;
+
 /*****************************************************************************/
 /*
 ** Function prototypes
@@ -185,6 +270,80 @@ typedef struct
  */
 void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Initializes the startup script parser.
+ *
+ * If CachePtr is not NULL, the cache is marked incomplete and the valid lines
+ * of the script are kept in it as they are parsed.
+ */
+void CFE_ES_StartupScriptInit(CFE_ES_StartupScriptParser_t *Parser, CFE_ES_StartupScriptCache_t *CachePtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Parses the next chunk of the startup script.
+ *
+ * Each complete line is passed to CFE_ES_StartupLoadAddEntry().  Parsing stops
+ * once the end of script mark is reached, and the rest of the chunk is ignored.
+ */
+void CFE_ES_ParseStartupScript(CFE_ES_StartupScriptParser_t *Parser, const char *Data, size_t DataSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Marks the startup script cache complete, as parsed from the given file.
+ */
+void CFE_ES_StartupScriptCacheCommit(CFE_ES_StartupScriptCache_t *CachePtr, const char *ScriptFileName);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Checks if the startup script cache is complete and was parsed from the given
+ * file, with the same size and modification time as the file has now.
+ */
+bool CFE_ES_StartupScriptCacheIsCurrent(const CFE_ES_StartupScriptCache_t *CachePtr, const char *ScriptFileName);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Adds an entry of the startup script to the startup load table.
+ *
+ * The load stage of the entry is found from its dependency field, or from the
+ * libraries before it when it has none.  A name in the dependency field that
+ * matches no earlier entry is reported to the system log and otherwise ignored.
+ * If the table is full, the entries already in it are started first.
+ */
+void CFE_ES_StartupLoadAddEntry(const char **TokenList, uint32 NumTokens);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Starts the entries of the startup load table.
+ *
+ * The modules of each stage are loaded concurrently, then the entries are
+ * passed to CFE_ES_ParseFileEntry() in the order of the script.  Modules that
+ * are not taken are unloaded and the table is emptied.
+ */
+void CFE_ES_StartupLoadRun(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Loads the modules of the current stage that are not yet claimed by a loader.
+ *
+ * This is run by the ES startup task as well as by each loader task.
+ */
+void CFE_ES_StartupLoadModules(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Entry point of the startup module loader tasks.
+ */
+void CFE_ES_StartupLoaderTask(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Takes the module that was loaded for the startup script entry of the given name and file.
+ *
+ * \return The module ID, or OS_OBJECT_ID_UNDEFINED if it was not loaded by the startup load
+ */
+osal_id_t CFE_ES_StartupLoadTakeModule(const char *ModuleName, const char *FileName);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * This function parses the startup file line for an individual cFE application.
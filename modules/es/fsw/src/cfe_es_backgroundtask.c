@@ -34,7 +34,6 @@
 #include <string.h>
 
 #include "cfe_es_module_all.h"
-#include "cfe_fs_core_internal.h"
 
 #define CFE_ES_BACKGROUND_SEM_NAME         "ES_BG_SEM"
 #define CFE_ES_BACKGROUND_CHILD_NAME       "ES_BG_TASK"
@@ -43,79 +42,317 @@
 #define CFE_ES_BACKGROUND_CHILD_PRIORITY   CFE_PLATFORM_ES_PERF_CHILD_PRIORITY
 #define CFE_ES_BACKGROUND_CHILD_FLAGS      0
 #define CFE_ES_BACKGROUND_MAX_IDLE_DELAY   30000 /* 30 seconds */
+#define CFE_ES_BACKGROUND_YIELD_DELAY      10    /* delay before calling jobs held back by the time budget */
+#define CFE_ES_BACKGROUND_MAX_HOLD_TIME    1000  /* longest a job without a deadline is held back by the budget */
 
 typedef struct
 {
-    bool (*RunFunc)(uint32 ElapsedTime, void *Arg);
-    void * JobArg;
-    uint32 ActivePeriod; /**< max wait/delay time between calls when job is active */
-    uint32 IdlePeriod;   /**< max wait/delay time between calls when job is idle */
+    CFE_ES_BackgroundJobConfig_t Config;
+    uint32 *                     JobNumPtr; /**< where to keep the job number, if ES needs to wake the job */
 } CFE_ES_BackgroundJobEntry_t;
 
-/** @brief function that returns true. Used for purposes of improving coverage
- * in testing of function CFE_ES_BackgroundTask (located in this file)
- */
-bool CFE_ES_ActiveJob(uint32 ElapsedTime, void *Arg)
-{
-    return true;
-}
-
 /*
- * List of "background jobs"
- *
- * This is just a list of functions to periodically call from the context of the background task,
- * and can be added/extended as needed.
+ * List of the "background jobs" of ES
  *
- * Each Job function returns a boolean, and should return "true" if it is active, or "false" if it is idle.
+ * These are registered with the background task when it is initialized, in addition
+ * to the jobs that other core modules register with CFE_ES_RegisterBackgroundJob().
  *
- * This uses "cooperative multitasking" -- the function should do some limited work, then return to the
- * background task.  It will be called again after a delay period to do more work.
+ * The app table scan has the highest priority so that app restarts and deletes are
+ * handled promptly even while a long file write is in progress.  Jobs that only have
+ * work to do after a command or request use an idle period of 0, and are woken when
+ * the work is posted.
  */
 const CFE_ES_BackgroundJobEntry_t CFE_ES_BACKGROUND_JOB_TABLE[] = {
     {/* ES app table background scan */
-     .RunFunc      = CFE_ES_RunAppTableScan,
-     .JobArg       = &CFE_ES_Global.BackgroundAppScanState,
-     .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE / 4,
-     .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE},
-    {/* Performance Log Data Dump to file */
-     .RunFunc      = CFE_ES_RunPerfLogDump,
-     .JobArg       = &CFE_ES_Global.BackgroundPerfDumpState,
-     .ActivePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
-     .IdlePeriod   = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY * 1000},
+     .Config    = {.Name         = "ES_APP_SCAN",
+                   .RunFunc      = CFE_ES_RunAppTableScan,
+                   .JobArg       = &CFE_ES_Global.BackgroundAppScanState,
+                   .Priority     = 10,
+                   .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE / 4,
+                   .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE,
+                   .Deadline     = CFE_PLATFORM_ES_APP_SCAN_RATE / 4},
+     .JobNumPtr = &CFE_ES_Global.BackgroundTask.AppScanJobNum},
     {/* Check for exceptions stored in the PSP */
-     .RunFunc      = CFE_ES_RunExceptionScan,
-     .JobArg       = NULL,
-     .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE,
-     .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE},
-    {/* Call FS to handle background file writes */
-     .RunFunc      = CFE_FS_RunBackgroundFileDump,
-     .JobArg       = NULL,
-     .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE,
-     .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE},
-    {/* Empty Job (for coverage purposes) */
-     /* Setting RunFunc to NULL triggers JobPtr->RunFunc != NULL to be false */
-     .RunFunc      = NULL,
-     .JobArg       = NULL,
-     .ActivePeriod = 0,
-     .IdlePeriod   = 0},
-    {/* Active Job with 0 active period (for coverage purposes)*/
-     .RunFunc      = CFE_ES_ActiveJob,
-     .JobArg       = NULL,
-     /* Setting ActivePeriod to 0 triggers JobPtr->ActivePeriod != 0 to be
-      * false */
-     .ActivePeriod = 0,
-     .IdlePeriod   = 0},
-    {/* Active Job with non-zero active period (for coverage purposes)*/
-     .RunFunc      = CFE_ES_ActiveJob,
-     .JobArg       = NULL,
-     /* We set the ActivePeriod to this so we can trigger set the expression
-      * NextDelay > JobPtr->ActivePeriod to be false, since the previous 
-      * setting for NextDelay was CFE_PLATFORM_ES_APP_SCAN_RATE */
-     .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE - 1,
-     .IdlePeriod   = 0}};
+     .Config    = {.Name         = "ES_EXCEPTION_SCAN",
+                   .RunFunc      = CFE_ES_RunExceptionScan,
+                   .JobArg       = NULL,
+                   .Priority     = 20,
+                   .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE,
+                   .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE,
+                   .Deadline     = CFE_PLATFORM_ES_APP_SCAN_RATE},
+     .JobNumPtr = NULL},
+    {/* Write CDS snapshots posted by applications with CFE_ES_CopyToCDSDeferred() */
+     .Config    = {.Name         = "ES_CDS_WRITE",
+                   .RunFunc      = CFE_ES_RunCDSDeferredWrite,
+                   .JobArg       = &CFE_ES_Global.CDSVars,
+                   .Priority     = 30,
+                   .ActivePeriod = CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_RATE / 4,
+                   .IdlePeriod   = 0,
+                   .Deadline     = CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_RATE},
+     .JobNumPtr = &CFE_ES_Global.BackgroundTask.CDSWriteJobNum},
+    {/* Performance Log streaming to rotating files */
+     .Config    = {.Name         = "ES_PERF_STREAM",
+                   .RunFunc      = CFE_ES_RunPerfLogStream,
+                   .JobArg       = &CFE_ES_Global.BackgroundPerfStreamState,
+                   .Priority     = 60,
+                   .ActivePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
+                   .IdlePeriod   = 0,
+                   .Deadline     = 0},
+     .JobNumPtr = &CFE_ES_Global.BackgroundTask.PerfStreamJobNum},
+    {/* Performance Log Data Dump to file */
+     .Config    = {.Name         = "ES_PERF_DUMP",
+                   .RunFunc      = CFE_ES_RunPerfLogDump,
+                   .JobArg       = &CFE_ES_Global.BackgroundPerfDumpState,
+                   .Priority     = 70,
+                   .ActivePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
+                   .IdlePeriod   = 0,
+                   .Deadline     = 0},
+     .JobNumPtr = &CFE_ES_Global.BackgroundTask.PerfDumpJobNum},
+#ifdef CFE_ES_POOL_ALLOC_TRACKING_ENABLED
+    {/* Report memory pool blocks that have been allocated for too long */
+     .Config    = {.Name         = "ES_POOL_LEAK_SCAN",
+                   .RunFunc      = CFE_ES_RunPoolLeakScan,
+                   .JobArg       = &CFE_ES_Global.PoolAllocTrack,
+                   .Priority     = 90,
+                   .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE,
+                   .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE,
+                   .Deadline     = 0},
+     .JobNumPtr = NULL},
+#endif
+};
 
 #define CFE_ES_BACKGROUND_NUM_JOBS (sizeof(CFE_ES_BACKGROUND_JOB_TABLE) / sizeof(CFE_ES_BACKGROUND_JOB_TABLE[0]))
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Adds time to a timer, saturating at the largest value a uint32 can hold.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_BackgroundAddTime(uint32 Timer, uint32 ElapsedTime)
+{
+    if (Timer > (0xFFFFFFFF - ElapsedTime))
+    {
+        return 0xFFFFFFFF;
+    }
+
+    return Timer + ElapsedTime;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Advances the timers of one job by the time elapsed since the previous pass,
+ * and marks the job as due when its period expired or it was woken.
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_BackgroundAdvanceJob(CFE_ES_BackgroundJobRecord_t *JobPtr, uint32 ElapsedTime)
+{
+    uint32 WakeRequested;
+
+    JobPtr->SinceLastRun = CFE_ES_BackgroundAddTime(JobPtr->SinceLastRun, ElapsedTime);
+
+    if (JobPtr->IsDue)
+    {
+        JobPtr->OverdueTime = CFE_ES_BackgroundAddTime(JobPtr->OverdueTime, ElapsedTime);
+    }
+    else if (JobPtr->DueTimer != 0)
+    {
+        if (JobPtr->DueTimer > ElapsedTime)
+        {
+            JobPtr->DueTimer -= ElapsedTime;
+        }
+        else
+        {
+            JobPtr->OverdueTime = ElapsedTime - JobPtr->DueTimer;
+            JobPtr->DueTimer    = 0;
+            JobPtr->IsDue       = true;
+        }
+    }
+
+    WakeRequested = 1;
+    if (CFE_Atomic_CompareExchange(&JobPtr->WakeRequested, &WakeRequested, 0) && !JobPtr->IsDue)
+    {
+        JobPtr->OverdueTime = 0;
+        JobPtr->DueTimer    = 0;
+        JobPtr->IsDue       = true;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Calls one job, updates its statistics and schedules the next call.
+ * Returns the time spent in the job, in microseconds.  This is the elapsed
+ * (wall clock) time of the call, which includes any time the background task
+ * was preempted by higher priority tasks, not the CPU time of the job.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_BackgroundCallJob(CFE_ES_BackgroundJobRecord_t *JobPtr)
+{
+    OS_time_t StartTime;
+    OS_time_t EndTime;
+    int64     RunUsec;
+    uint32    RunTime;
+    bool      IsActive;
+
+    CFE_PSP_GetTime(&StartTime);
+
+    /*
+     * call the background job -
+     * if it returns "true" that means it is active,
+     * if it returns "false" that means it is idle
+     */
+    IsActive = JobPtr->Config.RunFunc(JobPtr->SinceLastRun, JobPtr->Config.JobArg);
+
+    CFE_PSP_GetTime(&EndTime);
+
+    RunUsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime));
+    if (RunUsec < 0)
+    {
+        RunTime = 0;
+    }
+    else if (RunUsec > 0xFFFFFFFF)
+    {
+        RunTime = 0xFFFFFFFF;
+    }
+    else
+    {
+        RunTime = (uint32)RunUsec;
+    }
+
+    if (JobPtr->Config.Deadline != 0 && JobPtr->OverdueTime > JobPtr->Config.Deadline)
+    {
+        ++JobPtr->Stats.DeadlineMisses;
+    }
+
+    ++JobPtr->Stats.RunCount;
+    JobPtr->Stats.LastRunUsec = RunTime;
+    if (JobPtr->Stats.MaxRunUsec < RunTime)
+    {
+        JobPtr->Stats.MaxRunUsec = RunTime;
+    }
+
+    /* Count whole milliseconds only, keeping the rest for the next call */
+    JobPtr->RunUsecPart = CFE_ES_BackgroundAddTime(JobPtr->RunUsecPart, RunTime);
+    JobPtr->Stats.TotalRunMsec += JobPtr->RunUsecPart / 1000;
+    JobPtr->RunUsecPart %= 1000;
+
+    JobPtr->Stats.IsActive = IsActive;
+    JobPtr->IsDue          = false;
+    JobPtr->OverdueTime    = 0;
+    JobPtr->SinceLastRun   = 0;
+
+    /* next delay is based on the job wait time for its new state */
+    if (IsActive)
+    {
+        JobPtr->DueTimer = JobPtr->Config.ActivePeriod;
+    }
+    else
+    {
+        JobPtr->DueTimer = JobPtr->Config.IdlePeriod;
+    }
+
+    return RunTime;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_BackgroundRunJobs(uint32 ElapsedTime)
+{
+    CFE_ES_BackgroundTaskState_t *BgPtr;
+    CFE_ES_BackgroundJobRecord_t *JobPtr;
+    uint32                        DueList[CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS];
+    uint32                        NumDue;
+    uint32                        NumJobs;
+    uint32                        NumJobsRunning;
+    uint32                        NextDelay;
+    uint32                        PassTime;
+    uint32                        HoldLimit;
+    uint32                        JobNum;
+    uint32                        i;
+
+    BgPtr   = &CFE_ES_Global.BackgroundTask;
+    NumJobs = CFE_Atomic_Load(&BgPtr->NumJobs);
+    NumDue  = 0;
+
+    /* Advance the timers of all jobs, and list the jobs that are due in priority order */
+    for (JobNum = 0; JobNum < NumJobs; ++JobNum)
+    {
+        JobPtr = &BgPtr->Jobs[JobNum];
+        CFE_ES_BackgroundAdvanceJob(JobPtr, ElapsedTime);
+
+        if (JobPtr->IsDue)
+        {
+            i = NumDue;
+            while (i > 0 && BgPtr->Jobs[DueList[i - 1]].Config.Priority > JobPtr->Config.Priority)
+            {
+                DueList[i] = DueList[i - 1];
+                --i;
+            }
+            DueList[i] = JobNum;
+            ++NumDue;
+        }
+    }
+
+    NextDelay = CFE_ES_BACKGROUND_MAX_IDLE_DELAY; /* default; will be adjusted based on the jobs */
+    PassTime  = 0;
+
+    for (i = 0; i < NumDue; ++i)
+    {
+        JobPtr = &BgPtr->Jobs[DueList[i]];
+
+        /*
+         * A job without a deadline is still only held back for a limited time, otherwise
+         * higher priority jobs that use up the budget on every pass could starve it
+         */
+        HoldLimit = JobPtr->Config.Deadline;
+        if (HoldLimit == 0)
+        {
+            HoldLimit = CFE_ES_BACKGROUND_MAX_HOLD_TIME;
+        }
+
+        if (CFE_PLATFORM_ES_BACKGROUND_TIME_BUDGET != 0 && PassTime >= CFE_PLATFORM_ES_BACKGROUND_TIME_BUDGET &&
+            JobPtr->OverdueTime < HoldLimit)
+        {
+            /* Out of time for this pass, the job stays due and is called after a short break */
+            NextDelay = CFE_ES_BACKGROUND_YIELD_DELAY;
+        }
+        else
+        {
+            PassTime = CFE_ES_BackgroundAddTime(PassTime, CFE_ES_BackgroundCallJob(JobPtr));
+        }
+    }
+
+    NumJobsRunning = 0;
+    for (JobNum = 0; JobNum < NumJobs; ++JobNum)
+    {
+        JobPtr = &BgPtr->Jobs[JobNum];
+
+        if (JobPtr->Stats.IsActive)
+        {
+            ++NumJobsRunning;
+        }
+
+        if (!JobPtr->IsDue && JobPtr->DueTimer != 0 && NextDelay > JobPtr->DueTimer)
+        {
+            /* next delay is based on the job that is due first */
+            NextDelay = JobPtr->DueTimer;
+        }
+    }
+
+    BgPtr->NumJobsRunning = NumJobsRunning;
+
+    return NextDelay;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -124,14 +361,11 @@ const CFE_ES_BackgroundJobEntry_t CFE_ES_BACKGROUND_JOB_TABLE[] = {
  *-----------------------------------------------------------------*/
 void CFE_ES_BackgroundTask(void)
 {
-    int32                              OsStatus;
-    uint32                             JobTotal;
-    uint32                             NumJobsRunning;
-    uint32                             NextDelay;
-    uint32                             ElapsedTime;
-    OS_time_t                          CurrTime;
-    OS_time_t                          LastTime;
-    const CFE_ES_BackgroundJobEntry_t *JobPtr;
+    int32     OsStatus;
+    uint32    NextDelay;
+    uint32    ElapsedTime;
+    OS_time_t CurrTime;
+    OS_time_t LastTime;
 
     memset(&LastTime, 0, sizeof(LastTime));
     memset(&CurrTime, 0, sizeof(CurrTime));
@@ -148,38 +382,7 @@ void CFE_ES_BackgroundTask(void)
         ElapsedTime = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(CurrTime, LastTime));
         LastTime    = CurrTime;
 
-        NextDelay      = CFE_ES_BACKGROUND_MAX_IDLE_DELAY; /* default; will be adjusted based on active jobs */
-        JobPtr         = CFE_ES_BACKGROUND_JOB_TABLE;
-        JobTotal       = CFE_ES_BACKGROUND_NUM_JOBS;
-        NumJobsRunning = 0;
-
-        while (JobTotal > 0)
-        {
-            /*
-             * call the background job -
-             * if it returns "true" that means it is active,
-             * if it returns "false" that means it is idle
-             */
-            if (JobPtr->RunFunc != NULL && JobPtr->RunFunc(ElapsedTime, JobPtr->JobArg))
-            {
-                ++NumJobsRunning;
-
-                if (JobPtr->ActivePeriod != 0 && NextDelay > JobPtr->ActivePeriod)
-                {
-                    /* next delay is based on this active job wait time */
-                    NextDelay = JobPtr->ActivePeriod;
-                }
-            }
-            else if (JobPtr->IdlePeriod != 0 && NextDelay > JobPtr->IdlePeriod)
-            {
-                /* next delay is based on this idle job wait time */
-                NextDelay = JobPtr->IdlePeriod;
-            }
-            --JobTotal;
-            ++JobPtr;
-        }
-
-        CFE_ES_Global.BackgroundTask.NumJobsRunning = NumJobsRunning;
+        NextDelay = CFE_ES_BackgroundRunJobs(ElapsedTime);
 
         OsStatus = OS_BinSemTimedWait(CFE_ES_Global.BackgroundTask.WorkSem, NextDelay);
         if (OsStatus != OS_SUCCESS && OsStatus != OS_SEM_TIMEOUT)
@@ -191,6 +394,139 @@ void CFE_ES_BackgroundTask(void)
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per internal API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_RegisterBackgroundJob(uint32 *JobNumPtr, const CFE_ES_BackgroundJobConfig_t *Config)
+{
+    CFE_ES_BackgroundTaskState_t *BgPtr;
+    CFE_ES_BackgroundJobRecord_t *JobPtr;
+    uint32                        NumJobs;
+    uint32                        JobNum;
+    int32                         Status;
+
+    if (JobNumPtr == NULL || Config == NULL || Config->Name == NULL || Config->RunFunc == NULL)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    BgPtr = &CFE_ES_Global.BackgroundTask;
+
+    /* The name must fit in the statistics record, including the terminator */
+    if (Config->Name[0] == 0 || memchr(Config->Name, 0, sizeof(BgPtr->Jobs[0].Stats.Name)) == NULL)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+
+    NumJobs = CFE_Atomic_Load(&BgPtr->NumJobs);
+    Status  = CFE_SUCCESS;
+
+    for (JobNum = 0; JobNum < NumJobs; ++JobNum)
+    {
+        if (strcmp(BgPtr->Jobs[JobNum].Stats.Name, Config->Name) == 0)
+        {
+            Status = CFE_ES_ERR_DUPLICATE_NAME;
+            break;
+        }
+    }
+
+    if (Status == CFE_SUCCESS && NumJobs >= CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS)
+    {
+        Status = CFE_ES_NO_RESOURCE_IDS_AVAILABLE;
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        JobPtr = &BgPtr->Jobs[NumJobs];
+        memset(JobPtr, 0, sizeof(*JobPtr));
+
+        JobPtr->Config = *Config;
+        strncpy(JobPtr->Stats.Name, Config->Name, sizeof(JobPtr->Stats.Name) - 1);
+        JobPtr->Stats.Priority = Config->Priority;
+
+        /* A new job is called on the next pass, to find out whether it has work to do */
+        JobPtr->IsDue = true;
+
+        /* The record must be complete before the background task can see it */
+        CFE_Atomic_Store(&BgPtr->NumJobs, NumJobs + 1);
+
+        *JobNumPtr = NumJobs;
+    }
+
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    if (Status == CFE_SUCCESS)
+    {
+        OS_BinSemGive(BgPtr->WorkSem);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per internal API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_WakeBackgroundJob(uint32 JobNum)
+{
+    CFE_ES_BackgroundTaskState_t *BgPtr = &CFE_ES_Global.BackgroundTask;
+
+    if (JobNum < CFE_Atomic_Load(&BgPtr->NumJobs))
+    {
+        CFE_Atomic_Store(&BgPtr->Jobs[JobNum].WakeRequested, 1);
+        OS_BinSemGive(BgPtr->WorkSem);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_GetBackgroundJobStats(CFE_ES_BackgroundJobsTlm_Payload_t *Payload)
+{
+    CFE_ES_BackgroundTaskState_t *BgPtr = &CFE_ES_Global.BackgroundTask;
+    uint32                        NumJobs;
+    uint32                        JobNum;
+
+    NumJobs = CFE_Atomic_Load(&BgPtr->NumJobs);
+    if (NumJobs == 0)
+    {
+        return false;
+    }
+
+    memset(Payload, 0, sizeof(*Payload));
+
+    /* Report the jobs in turn, resuming after the last one reported */
+    JobNum = BgPtr->NextTlmJob;
+    if (JobNum >= NumJobs)
+    {
+        JobNum = 0;
+    }
+
+    Payload->NumJobs  = NumJobs;
+    Payload->FirstJob = JobNum;
+
+    while (Payload->NumInPacket < CFE_MISSION_ES_BACKGROUND_JOBS_PER_PKT && JobNum < NumJobs)
+    {
+        Payload->Jobs[Payload->NumInPacket] = BgPtr->Jobs[JobNum].Stats;
+        ++Payload->NumInPacket;
+        ++JobNum;
+    }
+
+    BgPtr->NextTlmJob = JobNum;
+
+    return true;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -199,8 +535,11 @@ void CFE_ES_BackgroundTask(void)
  *-----------------------------------------------------------------*/
 int32 CFE_ES_BackgroundInit(void)
 {
-    int32 status;
-    int32 OsStatus;
+    int32                              status;
+    int32                              OsStatus;
+    uint32                             JobNum;
+    uint32                             i;
+    const CFE_ES_BackgroundJobEntry_t *JobPtr;
 
     OsStatus = OS_BinSemCreate(&CFE_ES_Global.BackgroundTask.WorkSem, CFE_ES_BACKGROUND_SEM_NAME, 0, 0);
     if (OsStatus != OS_SUCCESS)
@@ -209,6 +548,26 @@ int32 CFE_ES_BackgroundInit(void)
         return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
     }
 
+    /* Register the jobs of ES, other core modules have registered theirs during early init */
+    JobPtr = CFE_ES_BACKGROUND_JOB_TABLE;
+    for (i = 0; i < CFE_ES_BACKGROUND_NUM_JOBS; ++i)
+    {
+        status = CFE_ES_RegisterBackgroundJob(&JobNum, &JobPtr->Config);
+        if (status != CFE_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: Failed to register background job %s: %08lx\n", __func__, JobPtr->Config.Name,
+                                 (unsigned long)status);
+            return status;
+        }
+
+        if (JobPtr->JobNumPtr != NULL)
+        {
+            *JobPtr->JobNumPtr = JobNum;
+        }
+
+        ++JobPtr;
+    }
+
     /* Spawn a task to write the performance data to a file */
     status = CFE_ES_CreateChildTask(&CFE_ES_Global.BackgroundTask.TaskID, CFE_ES_BACKGROUND_CHILD_NAME,
                                     CFE_ES_BackgroundTask, CFE_ES_BACKGROUND_CHILD_STACK_PTR,
@@ -247,9 +606,20 @@ void CFE_ES_BackgroundCleanup(void)
  *-----------------------------------------------------------------*/
 void CFE_ES_BackgroundWakeup(void)
 {
+    CFE_ES_BackgroundTaskState_t *BgPtr = &CFE_ES_Global.BackgroundTask;
+    uint32                        NumJobs;
+    uint32                        JobNum;
+
+    /* The caller does not say which job the work is for, so all of them check for it */
+    NumJobs = CFE_Atomic_Load(&BgPtr->NumJobs);
+    for (JobNum = 0; JobNum < NumJobs; ++JobNum)
+    {
+        CFE_Atomic_Store(&BgPtr->Jobs[JobNum].WakeRequested, 1);
+    }
+
     /* wake up the background task by giving the sem.
      * This is "informational" and not strictly required,
      * but it will make the task immediately wake up and check for new
      * work if it was idle. */
-    OS_BinSemGive(CFE_ES_Global.BackgroundTask.WorkSem);
+    OS_BinSemGive(BgPtr->WorkSem);
 }
@@ -175,6 +175,113 @@ bool CFE_ES_CheckCDSHandleSlotUsed(CFE_ResourceId_t CheckId)
     return (CDSRegRecPtr == NULL || CFE_ES_CDSBlockRecordIsUsed(CDSRegRecPtr));
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_CDSBlockRecordSetUsed(CFE_ES_CDS_RegRec_t *CDSBlockRecPtr, CFE_ResourceId_t PendingId)
+{
+    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
+
+    CDSBlockRecPtr->BlockID = CFE_ES_CDSHANDLE_C(PendingId);
+    if (CFE_ResourceId_NameIndexAdd(CDS->NameIndex, CFE_ES_CDS_NAMEINDEX_SLOTS, CDSBlockRecPtr->Name,
+                                    CDSBlockRecPtr - CDS->Registry) != CFE_SUCCESS)
+    {
+        /* name lookups that miss in the index will also scan the registry */
+        CDS->NameIndexIncomplete = true;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_CDSBlockRecordSetFree(CFE_ES_CDS_RegRec_t *CDSBlockRecPtr)
+{
+    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
+
+    CFE_ResourceId_NameIndexRemove(CDS->NameIndex, CFE_ES_CDS_NAMEINDEX_SLOTS, CDSBlockRecPtr->Name,
+                                   CDSBlockRecPtr - CDS->Registry);
+    CDSBlockRecPtr->BlockID = CFE_ES_CDS_BAD_HANDLE;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_ES_CDS_BlockState_t *CFE_ES_CDSBlockRecordGetState(const CFE_ES_CDS_RegRec_t *CDSBlockRecPtr)
+{
+    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
+
+    return &CDS->BlockState[CDSBlockRecPtr - CDS->Registry];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+size_t CFE_ES_CDSBlockRecordGetUserSize(const CFE_ES_CDS_RegRec_t *CDSBlockRecPtr)
+{
+    size_t UserSize;
+
+    if (CDSBlockRecPtr->DoubleBuffered)
+    {
+        UserSize = (CDSBlockRecPtr->BlockSize / 2) - sizeof(CFE_ES_CDS_SequencedHeader_t);
+    }
+    else
+    {
+        UserSize = CDSBlockRecPtr->BlockSize - sizeof(CFE_ES_CDS_BlockHeader_t);
+    }
+
+    return UserSize;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper routine, not invoked outside of this unit
+ * Rebuilds the registry name index from the local registry copy
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_RebuildCDSNameIndex(void)
+{
+    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
+    uint32                 Idx;
+
+    CFE_ResourceId_NameIndexClear(CDS->NameIndex, CFE_ES_CDS_NAMEINDEX_SLOTS);
+    CDS->NameIndexIncomplete = false;
+    for (Idx = 0; Idx < CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES; ++Idx)
+    {
+        if (CFE_ES_CDSBlockRecordIsUsed(&CDS->Registry[Idx]) &&
+            CFE_ResourceId_NameIndexAdd(CDS->NameIndex, CFE_ES_CDS_NAMEINDEX_SLOTS, CDS->Registry[Idx].Name, Idx) !=
+                CFE_SUCCESS)
+        {
+            CDS->NameIndexIncomplete = true;
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper routine, not invoked outside of this unit
+ * Confirms a name index candidate against the CDS registry
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_CDSBlockRecordNameMatch(uint32 TableIdx, const char *Name, void *Arg)
+{
+    CFE_ES_CDS_RegRec_t *CDSRegRecPtr = &CFE_ES_Global.CDSVars.Registry[TableIdx];
+
+    /* Perform a case sensitive name comparison */
+    return CFE_ES_CDSBlockRecordIsUsed(CDSRegRecPtr) && strcmp(Name, CDSRegRecPtr->Name) == 0;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -305,16 +412,29 @@ int32 CFE_ES_CDS_CachePreload(CFE_ES_CDS_AccessCache_t *Cache, const void *Sourc
  *-----------------------------------------------------------------*/
 int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize, const char *Name, bool CriticalTbl)
 {
-    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
-    int32                  Status;
-    int32                  RegUpdateStatus;
-    CFE_ES_CDS_RegRec_t *  RegRecPtr;
-    size_t                 BlockOffset;
-    size_t                 OldBlockSize;
-    size_t                 NewBlockSize;
-    CFE_ResourceId_t       PendingBlockId;
-    bool                   IsNewEntry;
-    bool                   IsNewOffset;
+    return CFE_ES_RegisterCDSBlock(HandlePtr, UserBlockSize, Name, CriticalTbl, false);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_RegisterCDSBlock(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize, const char *Name, bool CriticalTbl,
+                              bool DoubleBuffered)
+{
+    CFE_ES_CDS_Instance_t *  CDS = &CFE_ES_Global.CDSVars;
+    int32                    Status;
+    int32                    RegUpdateStatus;
+    CFE_ES_CDS_RegRec_t *    RegRecPtr;
+    CFE_ES_CDS_BlockState_t *BlockStatePtr;
+    size_t                   BlockOffset;
+    size_t                   OldBlockSize;
+    size_t                   NewBlockSize;
+    CFE_ResourceId_t         PendingBlockId;
+    bool                     IsNewEntry;
+    bool                     IsNewOffset;
 
     Status          = CFE_SUCCESS;
     RegUpdateStatus = CFE_SUCCESS;
@@ -366,8 +486,17 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
     if (RegRecPtr != NULL)
     {
         /* Account for the extra header which will be added */
-        NewBlockSize = UserBlockSize;
-        NewBlockSize += sizeof(CFE_ES_CDS_BlockHeader_t);
+        if (DoubleBuffered)
+        {
+            NewBlockSize = UserBlockSize;
+            NewBlockSize += sizeof(CFE_ES_CDS_SequencedHeader_t);
+            NewBlockSize *= 2;
+        }
+        else
+        {
+            NewBlockSize = UserBlockSize;
+            NewBlockSize += sizeof(CFE_ES_CDS_BlockHeader_t);
+        }
 
         /* If a reallocation is needed, the old block may need to be freed first */
         /** 
@@ -391,9 +520,14 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
          * which would mean that RegRecPtr was NULL and therefore we cannot be
          * in this conditional block in the first place.
          */
-        if (RegRecPtr->BlockOffset != 0 && NewBlockSize != RegRecPtr->BlockSize)
+        if (RegRecPtr->BlockOffset != 0 &&
+            (NewBlockSize != RegRecPtr->BlockSize || DoubleBuffered != RegRecPtr->DoubleBuffered))
         {
-            /* If the new size is different, the old CDS must be deleted first  */
+            /*
+             * If the new size or mode is different, the old CDS must be deleted first.
+             * The mode is compared too, as the raw sizes of a single and a double
+             * buffered block can be the same while their layouts are not.
+             */
             Status = CFE_ES_GenPoolPutBlock(&CDS->Pool, &OldBlockSize, RegRecPtr->BlockOffset);
 
             /*
@@ -402,6 +536,9 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
              */
             if (Status == CFE_SUCCESS)
             {
+                /* A snapshot posted for the old block does not fit the new one */
+                CFE_ES_CDSDeferredDiscard_Unsync(RegRecPtr);
+
                 RegRecPtr->BlockOffset = 0;
                 RegRecPtr->BlockSize   = 0;
             }
@@ -414,10 +551,11 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
             Status = CFE_ES_GenPoolGetBlock(&CDS->Pool, &BlockOffset, NewBlockSize);
             if (Status == CFE_SUCCESS)
             {
-                /* Save the size of the CDS */
-                RegRecPtr->BlockOffset = BlockOffset;
-                RegRecPtr->BlockSize   = NewBlockSize;
-                IsNewOffset            = true;
+                /* Save the size and mode of the CDS */
+                RegRecPtr->BlockOffset    = BlockOffset;
+                RegRecPtr->BlockSize      = NewBlockSize;
+                RegRecPtr->DoubleBuffered = DoubleBuffered;
+                IsNewOffset               = true;
             }
         }
 
@@ -432,6 +570,18 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
             CFE_ES_CDSBlockRecordSetUsed(RegRecPtr, PendingBlockId);
         }
 
+        if (Status == CFE_SUCCESS)
+        {
+            /*
+             * A newly allocated block has no valid copy yet, otherwise the newest
+             * valid copy is found on first access.
+             */
+            BlockStatePtr              = CFE_ES_CDSBlockRecordGetState(RegRecPtr);
+            BlockStatePtr->IsCopyKnown = IsNewOffset;
+            BlockStatePtr->CurrentCopy = 1;
+            BlockStatePtr->Sequence    = 0;
+        }
+
         if (Status == CFE_SUCCESS && IsNewOffset)
         {
             /* If we succeeded at creating a CDS, save updated registry in the CDS */
@@ -622,6 +772,8 @@ int32 CFE_ES_InitCDSRegistry(void)
     if (Status == CFE_SUCCESS)
     {
         memset(CDS->Registry, 0, sizeof(CDS->Registry));
+        CFE_ResourceId_NameIndexClear(CDS->NameIndex, CFE_ES_CDS_NAMEINDEX_SLOTS);
+        CDS->NameIndexIncomplete = false;
 
         Status = CFE_ES_UpdateCDSRegistry();
     }
@@ -739,34 +891,17 @@ int32 CFE_ES_UnlockCDS(void)
 CFE_ES_CDS_RegRec_t *CFE_ES_LocateCDSBlockRecordByName(const char *CDSName)
 {
     CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
-    CFE_ES_CDS_RegRec_t *  CDSRegRecPtr;
-    uint32                 NumReg;
+    uint32                 TableIdx;
 
-    CDSRegRecPtr = CDS->Registry;
-    NumReg       = CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES;
-    while (true)
+    if (!CFE_ResourceId_NameIndexFind(CDS->NameIndex, CFE_ES_CDS_NAMEINDEX_SLOTS, CDSName,
+                                      CFE_ES_CDSBlockRecordNameMatch, NULL, &TableIdx) &&
+        (!CDS->NameIndexIncomplete || !CFE_ResourceId_NameIndexScan(CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES, CDSName,
+                                                                    CFE_ES_CDSBlockRecordNameMatch, NULL, &TableIdx)))
     {
-        if (NumReg == 0)
-        {
-            CDSRegRecPtr = NULL; /* not found */
-            break;
-        }
-
-        if (CFE_ES_CDSBlockRecordIsUsed(CDSRegRecPtr))
-        {
-            /* Perform a case sensitive name comparison */
-            if (strcmp(CDSName, CDSRegRecPtr->Name) == 0)
-            {
-                /* If the names match, then stop */
-                break;
-            }
-        }
-
-        ++CDSRegRecPtr;
-        --NumReg;
+        return NULL; /* not found */
     }
 
-    return CDSRegRecPtr;
+    return &CDS->Registry[TableIdx];
 }
 
 /*----------------------------------------------------------------
@@ -804,6 +939,9 @@ int32 CFE_ES_RebuildCDS(void)
 
     if (PspStatus == CFE_PSP_SUCCESS)
     {
+        /* The registry content was replaced wholesale, so index it again */
+        CFE_ES_RebuildCDSNameIndex();
+
         /* Scan the memory pool and identify the created but currently unused memory blocks */
         Status = CFE_ES_RebuildCDSPool(CDS->DataSize, CDS_POOL_OFFSET);
     }
@@ -884,7 +1022,8 @@ int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices)
                 }
                 else
                 {
-                    /* Remove entry from the CDS Registry */
+                    /* Remove entry from the CDS Registry, along with any snapshot still pending for it */
+                    CFE_ES_CDSDeferredDiscard_Unsync(RegRecPtr);
                     CFE_ES_CDSBlockRecordSetFree(RegRecPtr);
 
                     Status = CFE_ES_UpdateCDSRegistry();
@@ -39,6 +39,7 @@
 */
 #include "common_types.h"
 #include "cfe_es_generic_pool.h"
+#include "cfe_resourceid_nameindex.h"
 
 /*
 ** Macro Definitions
@@ -57,6 +58,9 @@
 #define CFE_ES_CDS_SIGNATURE_END   "_CDSEnd_" /**< \brief Fixed signature at end of CDS */
 /** \} */
 
+/** \brief Number of slots in the name index of the local registry copy */
+#define CFE_ES_CDS_NAMEINDEX_SLOTS CFE_RESOURCEID_NAMEINDEX_SLOTS(CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES)
+
 /*
  * Space in CDS should be aligned to a multiple of uint32
  * These helper macros round up to a whole number of words
@@ -107,7 +111,8 @@ typedef struct
     size_t             BlockOffset; /**< Start offset of the block in CDS memory */
     size_t             BlockSize;   /**< Size, in bytes, of the CDS memory block */
     char               Name[CFE_MISSION_ES_CDS_MAX_FULL_NAME_LEN];
-    bool               Table; /**< \brief Flag that indicates whether CDS contains a Critical Table */
+    bool               Table;          /**< \brief Flag that indicates whether CDS contains a Critical Table */
+    bool               DoubleBuffered; /**< \brief Flag that indicates whether the block holds two copies */
 } CFE_ES_CDS_RegRec_t;
 
 typedef struct CFE_ES_CDSBlockHeader
@@ -115,6 +120,18 @@ typedef struct CFE_ES_CDSBlockHeader
     uint32 Crc; /**< CRC of content */
 } CFE_ES_CDS_BlockHeader_t;
 
+/*
+ * Header of each of the two copies within a double buffered block.
+ *
+ * The CRC covers the content of the copy followed by the sequence number,
+ * so a header that was only partly written does not validate.
+ */
+typedef struct CFE_ES_CDSSequencedHeader
+{
+    uint32 Crc;      /**< CRC of content and sequence number */
+    uint32 Sequence; /**< Incremented on each write of the block, the valid copy with the newest wins */
+} CFE_ES_CDS_SequencedHeader_t;
+
 /*
  * A generic buffer to hold the various objects that need
  * to be cached in RAM from the CDS non-volatile storage.
@@ -126,6 +143,7 @@ typedef union CFE_ES_CDS_AccessCacheData
     uint32                   Zero[4];                       /**< Used when clearing CDS content */
     CFE_ES_GenPoolBD_t       Desc;                          /**< A generic block descriptor */
     CFE_ES_CDS_BlockHeader_t BlockHeader;                   /**< A user block header */
+    CFE_ES_CDS_SequencedHeader_t SeqHeader;                 /**< A header of a double buffered block copy */
     CFE_ES_CDS_RegRec_t      RegEntry;                      /**< A registry entry */
 } CFE_ES_CDS_AccessCacheData_t;
 
@@ -137,6 +155,41 @@ typedef struct CFE_ES_CDS_AccessCache
     int32                        AccessStatus; /**< The PSP status of the last read/write from CDS memory */
 } CFE_ES_CDS_AccessCache_t;
 
+/**
+ * The runtime state of each block within the CDS that is not kept in the registry
+ *
+ * Entries are indexed the same as the registry, and are set each time the
+ * block is registered.  For a double buffered block, the copy holding the
+ * newest valid content is found on first access and then tracked here, so
+ * that writes always go to the other copy.
+ */
+typedef struct CFE_ES_CDS_BlockState
+{
+    bool   IsCopyKnown; /**< Whether CurrentCopy and Sequence are valid */
+    uint8  CurrentCopy; /**< The copy holding the newest valid content (0 or 1) */
+    uint32 Sequence;    /**< The sequence number of CurrentCopy */
+} CFE_ES_CDS_BlockState_t;
+
+/**
+ * The state of the deferred write for each block within the CDS
+ *
+ * Entries are indexed the same as the registry.  The staging buffer for
+ * the block is reserved within the deferred write area the first time
+ * a snapshot is posted for it, and is kept for reuse after that.  When
+ * the area runs out while no snapshot is pending, all of the staging
+ * buffers are released and reserved again as needed.  A pending snapshot
+ * is dropped when its block is reallocated or deleted, and is only used
+ * while its size still matches the user size of the block.
+ */
+typedef struct CFE_ES_CDS_DeferredWrite
+{
+    CFE_ES_CDSHandle_t BlockID;      /**< The block that the pending snapshot belongs to */
+    size_t             BufferOffset; /**< Offset of the staging buffer within the deferred write area */
+    size_t             BufferSize;   /**< Size of the staging buffer, zero if none is reserved yet */
+    size_t             DataSize;     /**< Size of the pending snapshot, the user size of the block when posted */
+    bool               IsPending;    /**< Whether the staging buffer holds a snapshot not yet written */
+} CFE_ES_CDS_DeferredWrite_t;
+
 /**
  * Instance data associated with a CDS
  *
@@ -163,6 +216,22 @@ typedef struct
     size_t              DataSize;       /**< \brief Size of actual user data pool */
     CFE_ResourceId_t    LastCDSBlockId; /**< \brief Last issued CDS block ID */
     CFE_ES_CDS_RegRec_t Registry[CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES]; /**< \brief CDS Registry (Local Copy) */
+
+    /** \brief Name index of the local registry copy, rebuilt whenever the registry is read back from the CDS */
+    CFE_ResourceId_NameIndexSlot_t NameIndex[CFE_ES_CDS_NAMEINDEX_SLOTS];
+    bool                           NameIndexIncomplete; /**< \brief Set if a registry entry could not be indexed */
+
+    CFE_ES_CDS_BlockState_t BlockState[CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES]; /**< \brief Runtime block state */
+
+    /*
+     * Snapshots posted by CFE_ES_CopyToCDSDeferred() that are waiting
+     * to be written to the CDS by the ES background task.
+     */
+    CFE_ES_CDS_DeferredWrite_t DeferredWrite[CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES];
+    uint32                     DeferredPendingCount; /**< \brief Number of blocks with a pending snapshot */
+    uint32                     DeferredWriteTimer;   /**< \brief Milliseconds since the last deferred write */
+    size_t                     DeferredMemUsed;      /**< \brief Bytes of the deferred write area reserved */
+    uint8                      DeferredMem[CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_BYTES]; /**< \brief Staging buffers */
 } CFE_ES_CDS_Instance_t;
 
 /*
@@ -341,13 +410,13 @@ static inline CFE_ES_CDSHandle_t CFE_ES_CDSBlockRecordGetID(const CFE_ES_CDS_Reg
  * @note This internal helper function must only be used on record pointers
  * that are known to refer to an actual table location (i.e. non-null).
  *
+ * The name must already be stored in the record, as it is entered into
+ * the registry name index here.
+ *
  * @param[in]   CDSBlockRecPtr   pointer to Pool table entry
  * @param[in]   PendingId        the Pool ID of this entry
  */
-static inline void CFE_ES_CDSBlockRecordSetUsed(CFE_ES_CDS_RegRec_t *CDSBlockRecPtr, CFE_ResourceId_t PendingId)
-{
-    CDSBlockRecPtr->BlockID = CFE_ES_CDSHANDLE_C(PendingId);
-}
+void CFE_ES_CDSBlockRecordSetUsed(CFE_ES_CDS_RegRec_t *CDSBlockRecPtr, CFE_ResourceId_t PendingId);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -361,10 +430,7 @@ static inline void CFE_ES_CDSBlockRecordSetUsed(CFE_ES_CDS_RegRec_t *CDSBlockRec
  *
  * @param[in]   CDSBlockRecPtr   pointer to Pool table entry
  */
-static inline void CFE_ES_CDSBlockRecordSetFree(CFE_ES_CDS_RegRec_t *CDSBlockRecPtr)
-{
-    CDSBlockRecPtr->BlockID = CFE_ES_CDS_BAD_HANDLE;
-}
+void CFE_ES_CDSBlockRecordSetFree(CFE_ES_CDS_RegRec_t *CDSBlockRecPtr);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -406,7 +472,8 @@ static inline bool CFE_ES_CDSBlockRecordIsMatch(const CFE_ES_CDS_RegRec_t *CDSBl
  *
  * @note CDS entries include an extra header in addition to the data,
  * which contains error checking information.  Therefore the usable data
- * size is less than the raw block size.
+ * size is less than the raw block size.  A double buffered block holds
+ * two copies of the data, each with its own header.
  *
  * @note This internal helper function must only be used on record pointers
  * that are known to refer to an actual table location (i.e. non-null).
@@ -414,10 +481,19 @@ static inline bool CFE_ES_CDSBlockRecordIsMatch(const CFE_ES_CDS_RegRec_t *CDSBl
  * @param[in]   CDSBlockRecPtr   pointer to registry table entry
  * @returns     Usable size of the CDS
  */
-static inline size_t CFE_ES_CDSBlockRecordGetUserSize(const CFE_ES_CDS_RegRec_t *CDSBlockRecPtr)
-{
-    return (CDSBlockRecPtr->BlockSize - sizeof(CFE_ES_CDS_BlockHeader_t));
-}
+size_t CFE_ES_CDSBlockRecordGetUserSize(const CFE_ES_CDS_RegRec_t *CDSBlockRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Gets the runtime state of a given registry record
+ *
+ * @note This internal helper function must only be used on record pointers
+ * that are known to refer to an actual table location (i.e. non-null).
+ *
+ * @param[in]   CDSBlockRecPtr   pointer to registry table entry
+ * @returns     Pointer to the runtime state of the entry
+ */
+CFE_ES_CDS_BlockState_t *CFE_ES_CDSBlockRecordGetState(const CFE_ES_CDS_RegRec_t *CDSBlockRecPtr);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -529,6 +605,52 @@ int32 CFE_ES_UpdateCDSRegistry(void);
 ******************************************************************************/
 void CFE_ES_FormCDSName(char *FullCDSName, const char *CDSName, CFE_ES_AppId_t ThisAppId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Allocates a block of memory in the Critical Data Store
+**
+** \par Description
+**        Same as #CFE_ES_RegisterCDSEx, with the option to create a double buffered block.
+**        A double buffered block holds two copies of the data, each with a header that has
+**        a sequence number, and writes alternate between them.  Its raw size is therefore
+**        twice the user size plus twice the header size.
+**
+** \par Assumptions, External Events, and Notes:
+**        Whether the block is double buffered is kept in the registry along with its raw
+**        size.  Registering an existing block with the other mode gives a new block, even
+**        if the raw sizes of the two happen to be the same.
+**
+** \param[in, out]   HandlePtr   Pointer Application's variable that will contain the CDS Memory Block Handle.
+**
+** \param[in]   UserBlockSize   The number of bytes needed in the CDS.
+**
+** \param[in]   Name        Pointer to character string containing the processor specific name of the CDS.
+**
+** \param[in]   CriticalTbl   Indicates whether the CDS is to be used as a Critical Table or not
+**
+** \param[in]   DoubleBuffered   Indicates whether the CDS holds two alternating copies of the data
+**
+** \return See return codes for #CFE_ES_RegisterCDS
+**
+******************************************************************************/
+int32 CFE_ES_RegisterCDSBlock(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize, const char *Name, bool CriticalTbl,
+                              bool DoubleBuffered);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Allocates a block of memory in the Critical Data Store for the calling application
+**
+** \par Description
+**        Implements #CFE_ES_RegisterCDS and #CFE_ES_RegisterCDSDoubleBuffered.  The name is
+**        checked and made processor specific, and the block is registered as not being a
+**        Critical Table.
+**
+** \return See return codes for #CFE_ES_RegisterCDS
+**
+******************************************************************************/
+int32 CFE_ES_RegisterAppCDS(CFE_ES_CDSHandle_t *CDSHandlePtr, size_t BlockSize, const char *Name,
+                            bool DoubleBuffered);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Returns the Registry Record for the specified CDS Name
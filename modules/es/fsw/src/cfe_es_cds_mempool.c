@@ -150,16 +150,312 @@ int32 CFE_ES_RebuildCDSPool(size_t CDSPoolSize, size_t StartOffset)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
+int32 CFE_ES_CDSBlockWrite_Unsync(CFE_ES_CDS_RegRec_t *CDSRegRecPtr, const void *DataToWrite, char *LogMessage,
+                                  size_t LogMessageSize)
 {
     CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
-    char                   LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
     int32                  Status;
     int32                  PspStatus;
     size_t                 BlockSize;
     size_t                 UserDataSize;
     size_t                 UserDataOffset;
-    CFE_ES_CDS_RegRec_t *  CDSRegRecPtr;
+
+    /*
+     * Getting the buffer size via this function retrieves it from the
+     * internal descriptor, and validates the descriptor as part of the operation.
+     * This should always agree with the size in the registry for this block.
+     */
+    Status = CFE_ES_GenPoolGetBlockSize(&CDS->Pool, &BlockSize, CDSRegRecPtr->BlockOffset);
+    if (Status != CFE_SUCCESS)
+    {
+        snprintf(LogMessage, LogMessageSize, "Invalid Handle or Block Descriptor.\n");
+    }
+    else if (BlockSize <= sizeof(CFE_ES_CDS_BlockHeader_t) || BlockSize != CDSRegRecPtr->BlockSize)
+    {
+        snprintf(LogMessage, LogMessageSize, "Block size %lu invalid, expected %lu\n", (unsigned long)BlockSize,
+                 (unsigned long)CDSRegRecPtr->BlockSize);
+        Status = CFE_ES_CDS_INVALID_SIZE;
+    }
+    else if (CDSRegRecPtr->DoubleBuffered)
+    {
+        Status = CFE_ES_CDSBlockWriteCopy_Unsync(CDSRegRecPtr, DataToWrite, LogMessage, LogMessageSize);
+    }
+    else
+    {
+        UserDataSize = CDSRegRecPtr->BlockSize;
+        UserDataSize -= sizeof(CFE_ES_CDS_BlockHeader_t);
+        UserDataOffset = CDSRegRecPtr->BlockOffset;
+        UserDataOffset += sizeof(CFE_ES_CDS_BlockHeader_t);
+
+        CDS->Cache.Data.BlockHeader.Crc = CFE_ES_CalculateCRC(DataToWrite, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
+        CDS->Cache.Offset               = CDSRegRecPtr->BlockOffset;
+        CDS->Cache.Size                 = sizeof(CFE_ES_CDS_BlockHeader_t);
+
+        /* Write the new block descriptor for the data coming from the Application */
+        Status = CFE_ES_CDS_CacheFlush(&CDS->Cache);
+        if (Status != CFE_SUCCESS)
+        {
+            snprintf(LogMessage, LogMessageSize, "Err writing header data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                     (unsigned int)CDS->Cache.AccessStatus, (unsigned long)CDSRegRecPtr->BlockOffset);
+        }
+        else
+        {
+            PspStatus = CFE_PSP_WriteToCDS(DataToWrite, UserDataOffset, UserDataSize);
+            if (PspStatus != CFE_PSP_SUCCESS)
+            {
+                snprintf(LogMessage, LogMessageSize, "Err writing user data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                         (unsigned int)PspStatus, (unsigned long)UserDataOffset);
+
+                Status = CFE_ES_CDS_ACCESS_ERROR;
+            }
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDSBlockCheckCopy_Unsync(CFE_ES_CDS_RegRec_t *CDSRegRecPtr, uint8 Copy,
+                                      const CFE_ES_CDS_SequencedHeader_t *HeaderPtr, void *DataRead)
+{
+    uint8  ChunkData[CFE_ES_CDS_RANGE_CHUNK_SIZE];
+    int32  Status;
+    int32  PspStatus;
+    uint32 CrcOfCDSData;
+    size_t CopySize;
+    size_t UserDataSize;
+    size_t UserDataOffset;
+    size_t ChunkOffset;
+    size_t ChunkSize;
+
+    CopySize       = CDSRegRecPtr->BlockSize / 2;
+    UserDataSize   = CopySize - sizeof(CFE_ES_CDS_SequencedHeader_t);
+    UserDataOffset = CDSRegRecPtr->BlockOffset;
+    UserDataOffset += Copy * CopySize;
+    UserDataOffset += sizeof(CFE_ES_CDS_SequencedHeader_t);
+
+    if (DataRead != NULL)
+    {
+        PspStatus    = CFE_PSP_ReadFromCDS(DataRead, UserDataOffset, UserDataSize);
+        CrcOfCDSData = CFE_ES_CalculateCRC(DataRead, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
+    }
+    else
+    {
+        /* Only the CRC is needed, so the content is read in chunks */
+        PspStatus    = CFE_PSP_SUCCESS;
+        CrcOfCDSData = 0;
+        for (ChunkOffset = 0; ChunkOffset < UserDataSize && PspStatus == CFE_PSP_SUCCESS; ChunkOffset += ChunkSize)
+        {
+            ChunkSize = UserDataSize - ChunkOffset;
+            if (ChunkSize > sizeof(ChunkData))
+            {
+                ChunkSize = sizeof(ChunkData);
+            }
+
+            PspStatus    = CFE_PSP_ReadFromCDS(ChunkData, UserDataOffset + ChunkOffset, ChunkSize);
+            CrcOfCDSData = CFE_ES_CalculateCRC(ChunkData, ChunkSize, CrcOfCDSData, CFE_MISSION_ES_DEFAULT_CRC);
+        }
+    }
+
+    if (PspStatus != CFE_PSP_SUCCESS)
+    {
+        Status = CFE_ES_CDS_ACCESS_ERROR;
+    }
+    else
+    {
+        CrcOfCDSData = CFE_ES_CalculateCRC(&HeaderPtr->Sequence, sizeof(HeaderPtr->Sequence), CrcOfCDSData,
+                                           CFE_MISSION_ES_DEFAULT_CRC);
+
+        /* Sequence number zero is never written, so a copy that was never written does not pass */
+        if (HeaderPtr->Sequence == 0 || CrcOfCDSData != HeaderPtr->Crc)
+        {
+            Status = CFE_ES_CDS_BLOCK_CRC_ERR;
+        }
+        else
+        {
+            Status = CFE_SUCCESS;
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDSBlockFindCopy_Unsync(CFE_ES_CDS_RegRec_t *CDSRegRecPtr, void *DataRead)
+{
+    CFE_ES_CDS_Instance_t *      CDS = &CFE_ES_Global.CDSVars;
+    CFE_ES_CDS_BlockState_t *    BlockStatePtr;
+    CFE_ES_CDS_SequencedHeader_t Header[2];
+    int32                        Status;
+    size_t                       CopySize;
+    uint8                        Copy;
+    uint8                        NewerCopy;
+    uint8                        i;
+
+    memset(Header, 0, sizeof(Header));
+
+    BlockStatePtr = CFE_ES_CDSBlockRecordGetState(CDSRegRecPtr);
+    CopySize      = CDSRegRecPtr->BlockSize / 2;
+    Status        = CFE_SUCCESS;
+
+    for (Copy = 0; Copy < 2 && Status == CFE_SUCCESS; ++Copy)
+    {
+        Status = CFE_ES_CDS_CacheFetch(&CDS->Cache, CDSRegRecPtr->BlockOffset + (Copy * CopySize),
+                                       sizeof(CFE_ES_CDS_SequencedHeader_t));
+
+        Header[Copy] = CDS->Cache.Data.SeqHeader;
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        /* Compared as a signed difference, so the sequence number can roll over */
+        NewerCopy = 0;
+        if ((int32)(Header[1].Sequence - Header[0].Sequence) > 0)
+        {
+            NewerCopy = 1;
+        }
+
+        /* The older copy is only checked if the newer one does not pass */
+        Copy   = NewerCopy;
+        Status = CFE_ES_CDS_BLOCK_CRC_ERR;
+        for (i = 0; i < 2 && Status == CFE_ES_CDS_BLOCK_CRC_ERR; ++i)
+        {
+            Copy   = NewerCopy ^ i;
+            Status = CFE_ES_CDSBlockCheckCopy_Unsync(CDSRegRecPtr, Copy, &Header[Copy], DataRead);
+        }
+
+        if (Status == CFE_SUCCESS)
+        {
+            BlockStatePtr->IsCopyKnown = true;
+            BlockStatePtr->CurrentCopy = Copy;
+            BlockStatePtr->Sequence    = Header[Copy].Sequence;
+        }
+        else if (Status == CFE_ES_CDS_BLOCK_CRC_ERR)
+        {
+            /* Neither copy passes, the next write goes to the older one and becomes the newest */
+            BlockStatePtr->IsCopyKnown = true;
+            BlockStatePtr->CurrentCopy = NewerCopy;
+            BlockStatePtr->Sequence    = Header[NewerCopy].Sequence;
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDSBlockWriteCopy_Unsync(CFE_ES_CDS_RegRec_t *CDSRegRecPtr, const void *DataToWrite, char *LogMessage,
+                                      size_t LogMessageSize)
+{
+    CFE_ES_CDS_Instance_t *  CDS = &CFE_ES_Global.CDSVars;
+    CFE_ES_CDS_BlockState_t *BlockStatePtr;
+    int32                    Status;
+    int32                    PspStatus;
+    uint32                   Crc;
+    uint32                   NextSequence;
+    uint8                    NextCopy;
+    size_t                   CopySize;
+    size_t                   CopyOffset;
+    size_t                   UserDataSize;
+
+    BlockStatePtr = CFE_ES_CDSBlockRecordGetState(CDSRegRecPtr);
+    Status        = CFE_SUCCESS;
+
+    /* The copy holding the newest valid data must be known, as it is the one not to overwrite */
+    if (!BlockStatePtr->IsCopyKnown)
+    {
+        Status = CFE_ES_CDSBlockFindCopy_Unsync(CDSRegRecPtr, NULL);
+        if (Status == CFE_ES_CDS_BLOCK_CRC_ERR)
+        {
+            /* not an error here, there is no valid data to preserve */
+            Status = CFE_SUCCESS;
+        }
+        else if (Status != CFE_SUCCESS)
+        {
+            snprintf(LogMessage, LogMessageSize, "Err reading copy headers from CDS @Offset=0x%08lx\n",
+                     (unsigned long)CDSRegRecPtr->BlockOffset);
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        NextCopy     = BlockStatePtr->CurrentCopy ^ 1;
+        NextSequence = BlockStatePtr->Sequence + 1;
+        if (NextSequence == 0)
+        {
+            /* zero marks a copy that was never written */
+            NextSequence = 1;
+        }
+
+        CopySize     = CDSRegRecPtr->BlockSize / 2;
+        CopyOffset   = CDSRegRecPtr->BlockOffset + (NextCopy * CopySize);
+        UserDataSize = CopySize - sizeof(CFE_ES_CDS_SequencedHeader_t);
+
+        /*
+         * The content is written before the header, so the copy does not pass its
+         * check until it is completely written.  Until then, the other copy is restored.
+         */
+        PspStatus = CFE_PSP_WriteToCDS(DataToWrite, CopyOffset + sizeof(CFE_ES_CDS_SequencedHeader_t), UserDataSize);
+        if (PspStatus != CFE_PSP_SUCCESS)
+        {
+            snprintf(LogMessage, LogMessageSize, "Err writing user data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                     (unsigned int)PspStatus, (unsigned long)(CopyOffset + sizeof(CFE_ES_CDS_SequencedHeader_t)));
+
+            Status = CFE_ES_CDS_ACCESS_ERROR;
+        }
+        else
+        {
+            Crc = CFE_ES_CalculateCRC(DataToWrite, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
+            Crc = CFE_ES_CalculateCRC(&NextSequence, sizeof(NextSequence), Crc, CFE_MISSION_ES_DEFAULT_CRC);
+
+            CDS->Cache.Data.SeqHeader.Crc      = Crc;
+            CDS->Cache.Data.SeqHeader.Sequence = NextSequence;
+            CDS->Cache.Offset                  = CopyOffset;
+            CDS->Cache.Size                    = sizeof(CFE_ES_CDS_SequencedHeader_t);
+
+            Status = CFE_ES_CDS_CacheFlush(&CDS->Cache);
+            if (Status != CFE_SUCCESS)
+            {
+                snprintf(LogMessage, LogMessageSize,
+                         "Err writing header data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                         (unsigned int)CDS->Cache.AccessStatus, (unsigned long)CopyOffset);
+            }
+            else
+            {
+                BlockStatePtr->CurrentCopy = NextCopy;
+                BlockStatePtr->Sequence    = NextSequence;
+            }
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
+{
+    char                 LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
+    int32                Status;
+    CFE_ES_CDS_RegRec_t *CDSRegRecPtr;
 
     /* Ensure the log message is an empty string in case it is never written to */
     LogMessage[0] = 0;
@@ -172,6 +468,334 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
      */
     CFE_ES_LockCDS();
 
+    if (CFE_ES_CDSBlockRecordIsMatch(CDSRegRecPtr, Handle))
+    {
+        /* A snapshot of this block still waiting to be written is superseded by this data */
+        CFE_ES_CDSDeferredDiscard_Unsync(CDSRegRecPtr);
+
+        Status = CFE_ES_CDSBlockWrite_Unsync(CDSRegRecPtr, DataToWrite, LogMessage, sizeof(LogMessage));
+    }
+    else
+    {
+        Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    CFE_ES_UnlockCDS();
+
+    /* Do the actual syslog if something went wrong */
+    if (LogMessage[0] != 0)
+    {
+        CFE_ES_WriteToSysLog("%s: %s", __func__, LogMessage);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_CDSDeferredDiscard_Unsync(CFE_ES_CDS_RegRec_t *CDSRegRecPtr)
+{
+    CFE_ES_CDS_Instance_t *     CDS = &CFE_ES_Global.CDSVars;
+    CFE_ES_CDS_DeferredWrite_t *DeferredPtr;
+
+    DeferredPtr = &CDS->DeferredWrite[CDSRegRecPtr - CDS->Registry];
+
+    if (DeferredPtr->IsPending)
+    {
+        DeferredPtr->IsPending = false;
+        --CDS->DeferredPendingCount;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_CDSDeferredReclaim_Unsync(void)
+{
+    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
+    uint32                 i;
+
+    for (i = 0; i < CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES; ++i)
+    {
+        CDS->DeferredWrite[i].BufferOffset = 0;
+        CDS->DeferredWrite[i].BufferSize   = 0;
+    }
+
+    CDS->DeferredMemUsed = 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDSDeferredFlush_Unsync(CFE_ES_CDS_RegRec_t *CDSRegRecPtr, char *LogMessage, size_t LogMessageSize)
+{
+    CFE_ES_CDS_Instance_t *     CDS = &CFE_ES_Global.CDSVars;
+    CFE_ES_CDS_DeferredWrite_t *DeferredPtr;
+    int32                       Status;
+
+    DeferredPtr = &CDS->DeferredWrite[CDSRegRecPtr - CDS->Registry];
+    Status      = CFE_SUCCESS;
+
+    if (DeferredPtr->IsPending)
+    {
+        CFE_ES_CDSDeferredDiscard_Unsync(CDSRegRecPtr);
+
+        /* The snapshot is dropped if its block was deleted or resized after it was posted */
+        if (CFE_ES_CDSBlockRecordIsMatch(CDSRegRecPtr, DeferredPtr->BlockID) &&
+            DeferredPtr->DataSize == CFE_ES_CDSBlockRecordGetUserSize(CDSRegRecPtr))
+        {
+            Status = CFE_ES_CDSBlockWrite_Unsync(CDSRegRecPtr, &CDS->DeferredMem[DeferredPtr->BufferOffset],
+                                                 LogMessage, LogMessageSize);
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDSBlockWriteDeferred(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
+{
+    CFE_ES_CDS_Instance_t *     CDS = &CFE_ES_Global.CDSVars;
+    char                        LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
+    int32                       Status;
+    size_t                      UserDataSize;
+    bool                        NeedsWakeup;
+    CFE_ES_CDS_DeferredWrite_t *DeferredPtr;
+    CFE_ES_CDS_RegRec_t *       CDSRegRecPtr;
+
+    /* Ensure the log message is an empty string in case it is never written to */
+    LogMessage[0] = 0;
+
+    NeedsWakeup  = false;
+    CDSRegRecPtr = CFE_ES_LocateCDSBlockRecordByID(Handle);
+
+    CFE_ES_LockCDS();
+
+    if (CFE_ES_CDSBlockRecordIsMatch(CDSRegRecPtr, Handle))
+    {
+        DeferredPtr = &CDS->DeferredWrite[CDSRegRecPtr - CDS->Registry];
+
+        UserDataSize = 0;
+        if (CDSRegRecPtr->BlockSize > sizeof(CFE_ES_CDS_BlockHeader_t))
+        {
+            UserDataSize = CFE_ES_CDSBlockRecordGetUserSize(CDSRegRecPtr);
+        }
+
+        /*
+         * Reserve a staging buffer the first time a snapshot is posted for this entry,
+         * or if the entry was since reused by a larger block.  Staging space is kept
+         * for the next snapshot of this registry entry, but once it runs out it is all
+         * reclaimed if no other snapshot is pending, as nothing refers to it then.
+         */
+        if (DeferredPtr->BufferSize < UserDataSize &&
+            UserDataSize > (sizeof(CDS->DeferredMem) - CDS->DeferredMemUsed) &&
+            CDS->DeferredPendingCount == (DeferredPtr->IsPending ? 1 : 0))
+        {
+            CFE_ES_CDSDeferredDiscard_Unsync(CDSRegRecPtr);
+            CFE_ES_CDSDeferredReclaim_Unsync();
+        }
+
+        if (DeferredPtr->BufferSize < UserDataSize &&
+            UserDataSize <= (sizeof(CDS->DeferredMem) - CDS->DeferredMemUsed))
+        {
+            DeferredPtr->BufferOffset = CDS->DeferredMemUsed;
+            DeferredPtr->BufferSize   = UserDataSize;
+            CDS->DeferredMemUsed += UserDataSize;
+        }
+
+        if (UserDataSize == 0 || DeferredPtr->BufferSize < UserDataSize)
+        {
+            /* No staging buffer is available, so write the data to the CDS now */
+            CFE_ES_CDSDeferredDiscard_Unsync(CDSRegRecPtr);
+
+            Status = CFE_ES_CDSBlockWrite_Unsync(CDSRegRecPtr, DataToWrite, LogMessage, sizeof(LogMessage));
+        }
+        else
+        {
+            /* A snapshot already pending for this block is simply replaced */
+            memcpy(&CDS->DeferredMem[DeferredPtr->BufferOffset], DataToWrite, UserDataSize);
+            DeferredPtr->BlockID  = Handle;
+            DeferredPtr->DataSize = UserDataSize;
+
+            if (!DeferredPtr->IsPending)
+            {
+                DeferredPtr->IsPending = true;
+                NeedsWakeup            = (CDS->DeferredPendingCount == 0);
+                ++CDS->DeferredPendingCount;
+            }
+
+            Status = CFE_SUCCESS;
+        }
+    }
+    else
+    {
+        Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    CFE_ES_UnlockCDS();
+
+    /* Do the actual syslog if something went wrong */
+    if (LogMessage[0] != 0)
+    {
+        CFE_ES_WriteToSysLog("%s: %s", __func__, LogMessage);
+    }
+
+    /* The background job is idle until woken, it needs to pick up the write */
+    if (NeedsWakeup)
+    {
+        CFE_ES_WakeBackgroundJob(CFE_ES_Global.BackgroundTask.CDSWriteJobNum);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDSBlockFlush(CFE_ES_CDSHandle_t Handle)
+{
+    char                 LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
+    int32                Status;
+    CFE_ES_CDS_RegRec_t *CDSRegRecPtr;
+
+    /* Ensure the log message is an empty string in case it is never written to */
+    LogMessage[0] = 0;
+
+    CDSRegRecPtr = CFE_ES_LocateCDSBlockRecordByID(Handle);
+
+    CFE_ES_LockCDS();
+
+    if (CFE_ES_CDSBlockRecordIsMatch(CDSRegRecPtr, Handle))
+    {
+        Status = CFE_ES_CDSDeferredFlush_Unsync(CDSRegRecPtr, LogMessage, sizeof(LogMessage));
+    }
+    else
+    {
+        Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    CFE_ES_UnlockCDS();
+
+    /* Do the actual syslog if something went wrong */
+    if (LogMessage[0] != 0)
+    {
+        CFE_ES_WriteToSysLog("%s: %s", __func__, LogMessage);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_RunCDSDeferredWrite(uint32 ElapsedTime, void *Arg)
+{
+    CFE_ES_CDS_Instance_t *CDS = Arg;
+    char                   LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
+    uint32                 i;
+    bool                   IsPending;
+
+    /* Time only needs to be counted up to the rate, this also prevents rollover */
+    if (CDS->DeferredWriteTimer < CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_RATE)
+    {
+        CDS->DeferredWriteTimer += ElapsedTime;
+    }
+
+    /* Snapshots are posted by applications, so the pending state is only read under the lock */
+    CFE_ES_LockCDS();
+    IsPending = (CDS->DeferredPendingCount != 0);
+    CFE_ES_UnlockCDS();
+
+    if (IsPending && CDS->DeferredWriteTimer >= CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_RATE)
+    {
+        CDS->DeferredWriteTimer = 0;
+
+        for (i = 0; i < CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES && IsPending; ++i)
+        {
+            LogMessage[0] = 0;
+
+            /* Lock per block, so applications are not held off for the entire scan */
+            CFE_ES_LockCDS();
+            CFE_ES_CDSDeferredFlush_Unsync(&CDS->Registry[i], LogMessage, sizeof(LogMessage));
+            IsPending = (CDS->DeferredPendingCount != 0);
+            CFE_ES_UnlockCDS();
+
+            if (LogMessage[0] != 0)
+            {
+                CFE_ES_WriteToSysLog("%s: %s", __func__, LogMessage);
+            }
+        }
+    }
+
+    return IsPending;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDSBlockWriteRange(CFE_ES_CDSHandle_t Handle, const void *DataToWrite, size_t RangeOffset,
+                                size_t RangeSize)
+{
+    CFE_ES_CDS_Instance_t *     CDS = &CFE_ES_Global.CDSVars;
+    CFE_ES_ComputeCRC_Params_t *CrcParams;
+    char                        LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
+    uint8                       ChunkData[CFE_ES_CDS_RANGE_CHUNK_SIZE];
+    const uint8 *               NewData;
+    int32                       Status;
+    int32                       PspStatus;
+    size_t                      BlockSize;
+    size_t                      UserDataSize;
+    size_t                      RangeDataOffset;
+    size_t                      ChunkOffset;
+    size_t                      ChunkSize;
+    size_t                      DirtyStart;
+    size_t                      DirtyEnd;
+    size_t                      i;
+    uint32                      DeltaCrc;
+    CFE_ES_CDS_RegRec_t *       CDSRegRecPtr;
+
+    /* Ensure the log message is an empty string in case it is never written to */
+    LogMessage[0] = 0;
+
+    NewData         = DataToWrite;
+    CrcParams       = CFE_ES_ComputeCRC_GetParams(CFE_MISSION_ES_DEFAULT_CRC);
+    UserDataSize    = 0;
+    RangeDataOffset = 0;
+    DeltaCrc        = 0;
+    DirtyStart      = RangeSize;
+    DirtyEnd        = 0;
+    CDSRegRecPtr    = CFE_ES_LocateCDSBlockRecordByID(Handle);
+
+    /*
+     * A CDS block ID must be accessed by only one thread at a time.
+     * Checking the validity of the block requires access to the registry.
+     */
+    CFE_ES_LockCDS();
+
     if (CFE_ES_CDSBlockRecordIsMatch(CDSRegRecPtr, Handle))
     {
         /*
@@ -190,17 +814,98 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
                      (unsigned long)CDSRegRecPtr->BlockSize);
             Status = CFE_ES_CDS_INVALID_SIZE;
         }
+        else if (CDSRegRecPtr->DoubleBuffered)
+        {
+            /* The other copy would need the rest of the block as well */
+            Status = CFE_ES_NOT_IMPLEMENTED;
+        }
         else
         {
             UserDataSize = CDSRegRecPtr->BlockSize;
             UserDataSize -= sizeof(CFE_ES_CDS_BlockHeader_t);
-            UserDataOffset = CDSRegRecPtr->BlockOffset;
-            UserDataOffset += sizeof(CFE_ES_CDS_BlockHeader_t);
 
-            CDS->Cache.Data.BlockHeader.Crc =
-                CFE_ES_CalculateCRC(DataToWrite, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
-            CDS->Cache.Offset = CDSRegRecPtr->BlockOffset;
-            CDS->Cache.Size   = sizeof(CFE_ES_CDS_BlockHeader_t);
+            if (RangeOffset > UserDataSize || RangeSize > (UserDataSize - RangeOffset))
+            {
+                Status = CFE_ES_BAD_ARGUMENT;
+            }
+            else
+            {
+                /* A snapshot still waiting to be written goes first, the range applies on top of it */
+                Status = CFE_ES_CDSDeferredFlush_Unsync(CDSRegRecPtr, LogMessage, sizeof(LogMessage));
+                if (Status == CFE_SUCCESS)
+                {
+                    /* Read the header, which holds the CRC over the current content */
+                    Status = CFE_ES_CDS_CacheFetch(&CDS->Cache, CDSRegRecPtr->BlockOffset,
+                                                   sizeof(CFE_ES_CDS_BlockHeader_t));
+                    if (Status != CFE_SUCCESS)
+                    {
+                        snprintf(LogMessage, sizeof(LogMessage),
+                                 "Err reading header data from CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                                 (unsigned int)CDS->Cache.AccessStatus, (unsigned long)CDSRegRecPtr->BlockOffset);
+                    }
+                }
+            }
+        }
+
+        if (Status == CFE_SUCCESS)
+        {
+            RangeDataOffset = CDSRegRecPtr->BlockOffset;
+            RangeDataOffset += sizeof(CFE_ES_CDS_BlockHeader_t);
+            RangeDataOffset += RangeOffset;
+
+            /*
+             * Compute the CRC of the difference between the current and the new
+             * content, which is all that is needed to update the block CRC.  This
+             * also finds the part of the range that actually changed.
+             */
+            for (ChunkOffset = 0; ChunkOffset < RangeSize; ChunkOffset += ChunkSize)
+            {
+                ChunkSize = RangeSize - ChunkOffset;
+                if (ChunkSize > sizeof(ChunkData))
+                {
+                    ChunkSize = sizeof(ChunkData);
+                }
+
+                PspStatus = CFE_PSP_ReadFromCDS(ChunkData, RangeDataOffset + ChunkOffset, ChunkSize);
+                if (PspStatus != CFE_PSP_SUCCESS)
+                {
+                    snprintf(LogMessage, sizeof(LogMessage),
+                             "Err reading user data from CDS (Stat=0x%08x) @Offset=0x%08lx\n", (unsigned int)PspStatus,
+                             (unsigned long)(RangeDataOffset + ChunkOffset));
+
+                    Status = CFE_ES_CDS_ACCESS_ERROR;
+                    break;
+                }
+
+                if (memcmp(ChunkData, &NewData[ChunkOffset], ChunkSize) == 0)
+                {
+                    /* unchanged content contributes zeros to the difference */
+                    DeltaCrc = CFE_ES_ComputeCRC_ShiftZeros(CrcParams, DeltaCrc, ChunkSize);
+                }
+                else
+                {
+                    for (i = 0; i < ChunkSize; ++i)
+                    {
+                        ChunkData[i] ^= NewData[ChunkOffset + i];
+                    }
+
+                    DeltaCrc = CFE_ES_ComputeCRC_Raw(CrcParams, ChunkData, ChunkSize, DeltaCrc);
+
+                    if (DirtyStart > ChunkOffset)
+                    {
+                        DirtyStart = ChunkOffset;
+                    }
+                    DirtyEnd = ChunkOffset + ChunkSize;
+                }
+            }
+        }
+
+        /* Nothing is written if the content of the range did not change */
+        if (Status == CFE_SUCCESS && DirtyStart < DirtyEnd)
+        {
+            /* Carry the difference through the rest of the block, and apply it to the block CRC */
+            DeltaCrc = CFE_ES_ComputeCRC_ShiftZeros(CrcParams, DeltaCrc, UserDataSize - RangeOffset - RangeSize);
+            CDS->Cache.Data.BlockHeader.Crc ^= DeltaCrc;
 
             /* Write the new block descriptor for the data coming from the Application */
             Status = CFE_ES_CDS_CacheFlush(&CDS->Cache);
@@ -212,12 +917,13 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
             }
             else
             {
-                PspStatus = CFE_PSP_WriteToCDS(DataToWrite, UserDataOffset, UserDataSize);
+                PspStatus = CFE_PSP_WriteToCDS(&NewData[DirtyStart], RangeDataOffset + DirtyStart,
+                                               DirtyEnd - DirtyStart);
                 if (PspStatus != CFE_PSP_SUCCESS)
                 {
                     snprintf(LogMessage, sizeof(LogMessage),
                              "Err writing user data to CDS (Stat=0x%08x) @Offset=0x%08lx\n", (unsigned int)PspStatus,
-                             (unsigned long)UserDataOffset);
+                             (unsigned long)(RangeDataOffset + DirtyStart));
 
                     Status = CFE_ES_CDS_ACCESS_ERROR;
                 }
@@ -248,14 +954,15 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
  *-----------------------------------------------------------------*/
 int32 CFE_ES_CDSBlockRead(void *DataRead, CFE_ES_CDSHandle_t Handle)
 {
-    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
-    int32                  Status;
-    int32                  PspStatus;
-    uint32                 CrcOfCDSData;
-    size_t                 BlockSize;
-    size_t                 UserDataSize;
-    size_t                 UserDataOffset;
-    CFE_ES_CDS_RegRec_t *  CDSRegRecPtr;
+    CFE_ES_CDS_Instance_t *     CDS = &CFE_ES_Global.CDSVars;
+    int32                       Status;
+    int32                       PspStatus;
+    uint32                      CrcOfCDSData;
+    size_t                      BlockSize;
+    size_t                      UserDataSize;
+    size_t                      UserDataOffset;
+    CFE_ES_CDS_DeferredWrite_t *DeferredPtr;
+    CFE_ES_CDS_RegRec_t *       CDSRegRecPtr;
 
     CDSRegRecPtr = CFE_ES_LocateCDSBlockRecordByID(Handle);
 
@@ -267,52 +974,68 @@ int32 CFE_ES_CDSBlockRead(void *DataRead, CFE_ES_CDSHandle_t Handle)
 
     if (CFE_ES_CDSBlockRecordIsMatch(CDSRegRecPtr, Handle))
     {
-        /*
-         * Getting the buffer size via this function retrieves it from the
-         * internal descriptor, and validates the descriptor as part of the operation.
-         * This should always agree with the size in the registry for this block.
-         */
-        Status = CFE_ES_GenPoolGetBlockSize(&CDS->Pool, &BlockSize, CDSRegRecPtr->BlockOffset);
-        if (Status == CFE_SUCCESS)
+        DeferredPtr = &CDS->DeferredWrite[CDSRegRecPtr - CDS->Registry];
+
+        if (DeferredPtr->IsPending && CFE_ES_CDSBlockRecordIsMatch(CDSRegRecPtr, DeferredPtr->BlockID) &&
+            DeferredPtr->DataSize == CFE_ES_CDSBlockRecordGetUserSize(CDSRegRecPtr))
         {
-            if (BlockSize <= sizeof(CFE_ES_CDS_BlockHeader_t) || BlockSize != CDSRegRecPtr->BlockSize)
-            {
-                Status = CFE_ES_CDS_INVALID_SIZE;
-            }
-            else
+            /* The latest data for this block is a snapshot that is not yet written to the CDS */
+            memcpy(DataRead, &CDS->DeferredMem[DeferredPtr->BufferOffset], DeferredPtr->DataSize);
+            Status = CFE_SUCCESS;
+        }
+        else
+        {
+            /*
+             * Getting the buffer size via this function retrieves it from the
+             * internal descriptor, and validates the descriptor as part of the operation.
+             * This should always agree with the size in the registry for this block.
+             */
+            Status = CFE_ES_GenPoolGetBlockSize(&CDS->Pool, &BlockSize, CDSRegRecPtr->BlockOffset);
+            if (Status == CFE_SUCCESS)
             {
-                UserDataSize = CDSRegRecPtr->BlockSize;
-                UserDataSize -= sizeof(CFE_ES_CDS_BlockHeader_t);
-                UserDataOffset = CDSRegRecPtr->BlockOffset;
-                UserDataOffset += sizeof(CFE_ES_CDS_BlockHeader_t);
+                if (BlockSize <= sizeof(CFE_ES_CDS_BlockHeader_t) || BlockSize != CDSRegRecPtr->BlockSize)
+                {
+                    Status = CFE_ES_CDS_INVALID_SIZE;
+                }
+                else if (CDSRegRecPtr->DoubleBuffered)
+                {
+                    Status = CFE_ES_CDSBlockFindCopy_Unsync(CDSRegRecPtr, DataRead);
+                }
+                else
+                {
+                    UserDataSize = CDSRegRecPtr->BlockSize;
+                    UserDataSize -= sizeof(CFE_ES_CDS_BlockHeader_t);
+                    UserDataOffset = CDSRegRecPtr->BlockOffset;
+                    UserDataOffset += sizeof(CFE_ES_CDS_BlockHeader_t);
 
-                /* Read the header */
-                Status =
-                    CFE_ES_CDS_CacheFetch(&CDS->Cache, CDSRegRecPtr->BlockOffset, sizeof(CFE_ES_CDS_BlockHeader_t));
+                    /* Read the header */
+                    Status = CFE_ES_CDS_CacheFetch(&CDS->Cache, CDSRegRecPtr->BlockOffset,
+                                                   sizeof(CFE_ES_CDS_BlockHeader_t));
 
-                if (Status == CFE_SUCCESS)
-                {
-                    /* Read the data block */
-                    PspStatus = CFE_PSP_ReadFromCDS(DataRead, UserDataOffset, UserDataSize);
-                    if (PspStatus == CFE_PSP_SUCCESS)
+                    if (Status == CFE_SUCCESS)
                     {
-                        /* Compute the CRC for the data read from the CDS and determine if the data is still valid */
-                        CrcOfCDSData = CFE_ES_CalculateCRC(DataRead, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
-
-                        /* If the CRCs do not match, report an error */
-                        if (CrcOfCDSData != CDS->Cache.Data.BlockHeader.Crc)
+                        /* Read the data block */
+                        PspStatus = CFE_PSP_ReadFromCDS(DataRead, UserDataOffset, UserDataSize);
+                        if (PspStatus == CFE_PSP_SUCCESS)
                         {
-                            Status = CFE_ES_CDS_BLOCK_CRC_ERR;
+                            /* Compute the CRC for the data read from the CDS to determine if it is still valid */
+                            CrcOfCDSData = CFE_ES_CalculateCRC(DataRead, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
+
+                            /* If the CRCs do not match, report an error */
+                            if (CrcOfCDSData != CDS->Cache.Data.BlockHeader.Crc)
+                            {
+                                Status = CFE_ES_CDS_BLOCK_CRC_ERR;
+                            }
+                            else
+                            {
+                                Status = CFE_SUCCESS;
+                            }
                         }
                         else
                         {
-                            Status = CFE_SUCCESS;
+                            Status = CFE_ES_CDS_ACCESS_ERROR;
                         }
                     }
-                    else
-                    {
-                        Status = CFE_ES_CDS_ACCESS_ERROR;
-                    }
                 }
             }
         }
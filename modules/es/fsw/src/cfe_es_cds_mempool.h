@@ -44,6 +44,12 @@
 */
 #define CFE_ES_CDS_NUM_BLOCK_SIZES 17
 
+/**
+ * Size of the buffer used to read back the previous content of a range
+ * of a CDS block, so the block CRC can be updated incrementally
+ */
+#define CFE_ES_CDS_RANGE_CHUNK_SIZE 64
+
 /*****************************************************************************/
 /*
 ** Function prototypes
@@ -82,9 +88,130 @@ int32 CFE_ES_RebuildCDSPool(size_t CDSPoolSize, size_t StartOffset);
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Writes a block of data to CDS
+ *
+ * Any snapshot of the block posted by CFE_ES_CDSBlockWriteDeferred() that is
+ * not yet written is discarded, as it is older than this data.
  */
 int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Writes a block of data to CDS, for a block already validated by the caller
+ *
+ * The caller must hold the CDS lock.  If the write fails, a description of the
+ * failure is put into LogMessage for the caller to report.
+ */
+int32 CFE_ES_CDSBlockWrite_Unsync(CFE_ES_CDS_RegRec_t *CDSRegRecPtr, const void *DataToWrite, char *LogMessage,
+                                  size_t LogMessageSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Checks one copy of a double buffered block in CDS
+ *
+ * Computes the CRC over the content of the copy and the sequence number in
+ * its header, and compares it with the CRC in the header.  If DataRead is not
+ * NULL, the content is also read into it.  The caller must hold the CDS lock.
+ *
+ * \returns #CFE_SUCCESS if the copy is valid, #CFE_ES_CDS_BLOCK_CRC_ERR if not,
+ *          or #CFE_ES_CDS_ACCESS_ERROR if it could not be read
+ */
+int32 CFE_ES_CDSBlockCheckCopy_Unsync(CFE_ES_CDS_RegRec_t *CDSRegRecPtr, uint8 Copy,
+                                      const CFE_ES_CDS_SequencedHeader_t *HeaderPtr, void *DataRead);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Finds the copy of a double buffered block holding the newest valid data
+ *
+ * The copies are checked newest first, by sequence number, and the result is
+ * saved in the runtime state of the block.  If DataRead is not NULL, the content
+ * of the copy found is read into it.  The caller must hold the CDS lock.
+ *
+ * \returns #CFE_SUCCESS if a valid copy was found, #CFE_ES_CDS_BLOCK_CRC_ERR if
+ *          neither copy is valid, or #CFE_ES_CDS_ACCESS_ERROR if the CDS could not be read
+ */
+int32 CFE_ES_CDSBlockFindCopy_Unsync(CFE_ES_CDS_RegRec_t *CDSRegRecPtr, void *DataRead);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Writes a block of data to the older copy of a double buffered block in CDS
+ *
+ * The content is written first and the header last, so the copy does not become
+ * the newest until it is completely written.  The caller must hold the CDS lock.
+ */
+int32 CFE_ES_CDSBlockWriteCopy_Unsync(CFE_ES_CDS_RegRec_t *CDSRegRecPtr, const void *DataToWrite, char *LogMessage,
+                                      size_t LogMessageSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Posts a snapshot of a block of data, to be written to CDS later
+ *
+ * The data is copied to a staging buffer for the block, replacing any snapshot
+ * already pending for it, and is written to CDS by the ES background task.  If
+ * no staging buffer can be reserved for the block, the data is written to CDS
+ * before returning, the same as CFE_ES_CDSBlockWrite().
+ */
+int32 CFE_ES_CDSBlockWriteDeferred(CFE_ES_CDSHandle_t Handle, const void *DataToWrite);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Writes the pending snapshot of a block to CDS, if there is one
+ */
+int32 CFE_ES_CDSBlockFlush(CFE_ES_CDSHandle_t Handle);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Writes the pending snapshot for a registry entry to CDS, if there is one
+ *
+ * The caller must hold the CDS lock.  The snapshot is no longer pending after
+ * this call, even if the write fails.  A snapshot of a block that was deleted
+ * or resized after it was posted is discarded without being written.
+ */
+int32 CFE_ES_CDSDeferredFlush_Unsync(CFE_ES_CDS_RegRec_t *CDSRegRecPtr, char *LogMessage, size_t LogMessageSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Discards the pending snapshot for a registry entry, if there is one
+ *
+ * The caller must hold the CDS lock.
+ */
+void CFE_ES_CDSDeferredDiscard_Unsync(CFE_ES_CDS_RegRec_t *CDSRegRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Releases the staging buffers of all registry entries
+ *
+ * The caller must hold the CDS lock, and no snapshot may be pending.  The
+ * whole deferred write area is then free to be reserved again.
+ */
+void CFE_ES_CDSDeferredReclaim_Unsync(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Background job that writes the pending snapshots to CDS
+ *
+ * Runs in the context of the ES background task.  The pending snapshots are
+ * written at most once every #CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_RATE milliseconds,
+ * so that frequent updates of a block result in a single CDS write.
+ *
+ * \param[in] ElapsedTime  Milliseconds since the last call
+ * \param[in] Arg          Pointer to the CDS instance
+ *
+ * \returns true if snapshots are still pending, false if idle
+ */
+bool CFE_ES_RunCDSDeferredWrite(uint32 ElapsedTime, void *Arg);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Writes a range of data within a block in CDS
+ *
+ * Only the bytes in the range that differ from the current content are
+ * written, along with the block header.  The block CRC is updated from the
+ * previous and new content of the range, rather than computed over the
+ * whole block.
+ */
+int32 CFE_ES_CDSBlockWriteRange(CFE_ES_CDSHandle_t Handle, const void *DataToWrite, size_t RangeOffset,
+                                size_t RangeSize);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Reads a block of data from CDS
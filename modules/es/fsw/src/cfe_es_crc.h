@@ -21,7 +21,7 @@
  *  Implemention of the CRC algorithm(s) for CFE ES
  *
  *  Notes:
- *    Historically only CRC-16/ARC is defined, but this can be expanded.
+ *    Historically only CRC-16/ARC is defined, CRC-32C has since been added.
  *
  */
 
@@ -38,6 +38,13 @@ typedef uint32 (*const CFE_ES_ComputeCRC_Algo_t)(const void *DataPtr, size_t Dat
 
 typedef const struct CFE_ES_ComputeCRC_Params
 {
+    /**
+     * Initial register value and value XOR'ed into the result
+     *
+     * These are applied by the Algorithm itself, so that the result of one call
+     * can be passed as the input CRC of the next.  They are recorded here so the
+     * raw register value can be derived, see CFE_ES_ComputeCRC_Raw().
+     */
     uint32 InitialValue;
     uint32 FinalXOR;
 
@@ -46,8 +53,46 @@ typedef const struct CFE_ES_ComputeCRC_Params
      */
     CFE_ES_ComputeCRC_Algo_t Algorithm;
 
+    /**
+     * Bit-reflected generator polynomial and width of the CRC, in bits
+     *
+     * Used to advance a CRC over a run of zero bytes without processing them.
+     * A width of 0 indicates the algorithm does not support this.
+     */
+    uint32 ReflectedPoly;
+    uint32 Width;
+
 } CFE_ES_ComputeCRC_Params_t;
 
 CFE_ES_ComputeCRC_Params_t *CFE_ES_ComputeCRC_GetParams(CFE_ES_CrcType_Enum_t CrcType);
 
+/**
+ * Computes CRC-32C using only the portable table driven algorithm
+ *
+ * The CFE_ES_CrcType_32_C algorithm uses the processor CRC instructions
+ * where they are available, and otherwise calls this.  This is exposed so the
+ * two can be checked against each other.
+ */
+uint32 CFE_ES_ComputeCRC_Algo_32_C_Portable(const void *DataPtr, size_t DataLength, uint32 InputCRC);
+
+/**
+ * Computes the raw CRC register value over a buffer
+ *
+ * This is the CRC without the initial value and final XOR of the algorithm,
+ * starting from the given register value.  Starting from 0, it is linear in
+ * the data: the raw CRC of (A XOR B) is the raw CRC of A XOR the raw CRC of B,
+ * for A and B of the same length.  This allows the CRC of a block to be
+ * updated from the changed bytes only.
+ */
+uint32 CFE_ES_ComputeCRC_Raw(CFE_ES_ComputeCRC_Params_t *Params, const void *DataPtr, size_t DataLength,
+                             uint32 Register);
+
+/**
+ * Advances a raw CRC register value over a run of zero bytes
+ *
+ * Gives the same result as CFE_ES_ComputeCRC_Raw() over NumBytes zero bytes,
+ * but in time proportional to the logarithm of NumBytes.
+ */
+uint32 CFE_ES_ComputeCRC_ShiftZeros(CFE_ES_ComputeCRC_Params_t *Params, uint32 Register, size_t NumBytes);
+
 #endif /* CFE_ES_CRC_H */
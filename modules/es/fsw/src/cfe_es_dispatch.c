@@ -249,6 +249,34 @@ void CFE_ES_ProcessGroundCmd(const CFE_SB_Buffer_t *SBBufPtr)
             }
             break;
 
+        case CFE_ES_WRITE_MEM_POOL_STATS_CC:
+            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_WriteMemPoolStatsCmd_t)))
+            {
+                CFE_ES_WriteMemPoolStatsCmd((const CFE_ES_WriteMemPoolStatsCmd_t *)SBBufPtr);
+            }
+            break;
+
+        case CFE_ES_WRITE_POOL_ALLOC_SITES_CC:
+            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_WritePoolAllocSitesCmd_t)))
+            {
+                CFE_ES_WritePoolAllocSitesCmd((const CFE_ES_WritePoolAllocSitesCmd_t *)SBBufPtr);
+            }
+            break;
+
+        case CFE_ES_RESET_PERF_STATS_CC:
+            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_ResetPerfStatsCmd_t)))
+            {
+                CFE_ES_ResetPerfStatsCmd((const CFE_ES_ResetPerfStatsCmd_t *)SBBufPtr);
+            }
+            break;
+
+        case CFE_ES_WRITE_STARTUP_TIMING_CC:
+            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_WriteStartupTimingCmd_t)))
+            {
+                CFE_ES_WriteStartupTimingCmd((const CFE_ES_WriteStartupTimingCmd_t *)SBBufPtr);
+            }
+            break;
+
         default:
             CFE_EVS_SendEvent(CFE_ES_CC1_ERR_EID, CFE_EVS_EventType_ERROR,
                               "Invalid ground command code: ID = 0x%X, CC = %d", (unsigned int)CFE_ES_CMD_MID,
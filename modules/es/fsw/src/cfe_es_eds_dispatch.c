@@ -38,30 +38,34 @@ static const EdsDispatchTable_EdsComponent_CFE_ES_Application_CFE_SB_Telecommand
 {
     .CMD =
     {
-        .NoopCmd_indication               = CFE_ES_NoopCmd,
-        .ResetCountersCmd_indication      = CFE_ES_ResetCountersCmd,
-        .RestartCmd_indication            = CFE_ES_RestartCmd,
-        .StartAppCmd_indication           = CFE_ES_StartAppCmd,
-        .StopAppCmd_indication            = CFE_ES_StopAppCmd,
-        .RestartAppCmd_indication         = CFE_ES_RestartAppCmd,
-        .ReloadAppCmd_indication          = CFE_ES_ReloadAppCmd,
-        .QueryOneCmd_indication           = CFE_ES_QueryOneCmd,
-        .QueryAllCmd_indication           = CFE_ES_QueryAllCmd,
-        .QueryAllTasksCmd_indication      = CFE_ES_QueryAllTasksCmd,
-        .ClearSysLogCmd_indication        = CFE_ES_ClearSysLogCmd,
-        .WriteSysLogCmd_indication        = CFE_ES_WriteSysLogCmd,
-        .OverWriteSysLogCmd_indication    = CFE_ES_OverWriteSysLogCmd,
-        .ClearERLogCmd_indication         = CFE_ES_ClearERLogCmd,
-        .WriteERLogCmd_indication         = CFE_ES_WriteERLogCmd,
-        .StartPerfDataCmd_indication      = CFE_ES_StartPerfDataCmd,
-        .StopPerfDataCmd_indication       = CFE_ES_StopPerfDataCmd,
-        .SetPerfFilterMaskCmd_indication  = CFE_ES_SetPerfFilterMaskCmd,
-        .SetPerfTriggerMaskCmd_indication = CFE_ES_SetPerfTriggerMaskCmd,
-        .ResetPRCountCmd_indication       = CFE_ES_ResetPRCountCmd,
-        .SetMaxPRCountCmd_indication      = CFE_ES_SetMaxPRCountCmd,
-        .DeleteCDSCmd_indication          = CFE_ES_DeleteCDSCmd,
-        .SendMemPoolStatsCmd_indication   = CFE_ES_SendMemPoolStatsCmd,
-        .DumpCDSRegistryCmd_indication    = CFE_ES_DumpCDSRegistryCmd,
+        .NoopCmd_indication                = CFE_ES_NoopCmd,
+        .ResetCountersCmd_indication       = CFE_ES_ResetCountersCmd,
+        .RestartCmd_indication             = CFE_ES_RestartCmd,
+        .StartAppCmd_indication            = CFE_ES_StartAppCmd,
+        .StopAppCmd_indication             = CFE_ES_StopAppCmd,
+        .RestartAppCmd_indication          = CFE_ES_RestartAppCmd,
+        .ReloadAppCmd_indication           = CFE_ES_ReloadAppCmd,
+        .QueryOneCmd_indication            = CFE_ES_QueryOneCmd,
+        .QueryAllCmd_indication            = CFE_ES_QueryAllCmd,
+        .QueryAllTasksCmd_indication       = CFE_ES_QueryAllTasksCmd,
+        .ClearSysLogCmd_indication         = CFE_ES_ClearSysLogCmd,
+        .WriteSysLogCmd_indication         = CFE_ES_WriteSysLogCmd,
+        .OverWriteSysLogCmd_indication     = CFE_ES_OverWriteSysLogCmd,
+        .ClearERLogCmd_indication          = CFE_ES_ClearERLogCmd,
+        .WriteERLogCmd_indication          = CFE_ES_WriteERLogCmd,
+        .StartPerfDataCmd_indication       = CFE_ES_StartPerfDataCmd,
+        .StopPerfDataCmd_indication        = CFE_ES_StopPerfDataCmd,
+        .SetPerfFilterMaskCmd_indication   = CFE_ES_SetPerfFilterMaskCmd,
+        .SetPerfTriggerMaskCmd_indication  = CFE_ES_SetPerfTriggerMaskCmd,
+        .ResetPRCountCmd_indication        = CFE_ES_ResetPRCountCmd,
+        .SetMaxPRCountCmd_indication       = CFE_ES_SetMaxPRCountCmd,
+        .DeleteCDSCmd_indication           = CFE_ES_DeleteCDSCmd,
+        .SendMemPoolStatsCmd_indication    = CFE_ES_SendMemPoolStatsCmd,
+        .DumpCDSRegistryCmd_indication     = CFE_ES_DumpCDSRegistryCmd,
+        .WriteMemPoolStatsCmd_indication   = CFE_ES_WriteMemPoolStatsCmd,
+        .WritePoolAllocSitesCmd_indication = CFE_ES_WritePoolAllocSitesCmd,
+        .ResetPerfStatsCmd_indication      = CFE_ES_ResetPerfStatsCmd,
+        .WriteStartupTimingCmd_indication  = CFE_ES_WriteStartupTimingCmd,
     },
     .SEND_HK =
     {
@@ -43,6 +43,27 @@
 ** Functions
 */
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Get the power-of-two size class of a requested block size
+ *
+ *-----------------------------------------------------------------*/
+static inline uint32 CFE_ES_GenPoolSizeClass(size_t ReqSize)
+{
+    unsigned long long Value;
+
+    if (ReqSize <= 1)
+    {
+        return 0;
+    }
+
+    /* the number of significant bits in (ReqSize - 1) */
+    Value = ReqSize - 1;
+    return (8 * sizeof(Value)) - __builtin_clzll(Value);
+}
+
 /*----------------------------------------------------------------
  *
  * Internal helper routine only, not part of API.
@@ -54,13 +75,15 @@ uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSi
 {
     uint16 Index;
 
-    for (Index = 0; Index < PoolRecPtr->NumBuckets; ++Index)
+    /*
+     * Start from the first bucket that could hold a request of this
+     * size class, rather than the smallest bucket.  At most the buckets
+     * within one power-of-two range need to be checked from there.
+     */
+    Index = PoolRecPtr->SizeClassStart[CFE_ES_GenPoolSizeClass(ReqSize)];
+    while (Index < PoolRecPtr->NumBuckets && ReqSize > PoolRecPtr->Buckets[Index].BlockSize)
     {
-        if (ReqSize <= PoolRecPtr->Buckets[Index].BlockSize)
-        {
-            /* it fits - stop here */
-            break;
-        }
+        ++Index;
     }
 
     /*
@@ -94,57 +117,383 @@ CFE_ES_GenPoolBucket_t *CFE_ES_GenPoolGetBucketState(CFE_ES_GenPoolRecord_t *Poo
  *
  * Internal helper routine only, not part of API.
  *
- * Find and re-allocate a previously returned block
+ * Add a block to the free list of a buddy pool bucket
  *
  *-----------------------------------------------------------------*/
-int32 CFE_ES_GenPoolRecyclePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t NewSize,
-                                     size_t *BlockOffsetPtr)
+static int32 CFE_ES_GenPoolBuddyInsert(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 Index, size_t BlockStart)
 {
     CFE_ES_GenPoolBucket_t *BucketPtr;
-    size_t                  DescOffset;
+    CFE_ES_GenPoolBD_t *    BdPtr;
     size_t                  BlockOffset;
-    size_t                  NextOffset;
+    size_t                  HeadDescOffset;
+    int32                   Status;
+
+    BucketPtr   = &PoolRecPtr->Buckets[Index];
+    BlockOffset = BlockStart + PoolRecPtr->BuddyHeaderSize;
+
+    Status = PoolRecPtr->Retrieve(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        BdPtr->CheckBits  = CFE_ES_CHECK_PATTERN;
+        BdPtr->Allocated  = CFE_ES_MEMORY_BUDDY_FREE + (PoolRecPtr->NumBuckets - Index);
+        BdPtr->ActualSize = 0;
+        BdPtr->NextOffset = BucketPtr->FirstOffset;
+
+        Status = PoolRecPtr->Commit(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, BdPtr);
+    }
+
+    /* link the old head of the list back to the new block */
+    if (Status == CFE_SUCCESS && BucketPtr->FirstOffset != 0)
+    {
+        HeadDescOffset = BucketPtr->FirstOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, HeadDescOffset, &BdPtr);
+        if (Status == CFE_SUCCESS)
+        {
+            BdPtr->ActualSize = BlockOffset;
+            Status            = PoolRecPtr->Commit(PoolRecPtr, HeadDescOffset, BdPtr);
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        BucketPtr->FirstOffset = BlockOffset;
+        ++BucketPtr->ReleaseCount;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Remove a block from the free list of a buddy pool bucket, given
+ * the links from its descriptor
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_GenPoolBuddyUnlink(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 Index, size_t PrevOffset,
+                                       size_t NextOffset)
+{
+    CFE_ES_GenPoolBucket_t *BucketPtr;
     CFE_ES_GenPoolBD_t *    BdPtr;
-    uint16                  RecycleBucketId;
     int32                   Status;
 
-    BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
-    if (BucketPtr == NULL || BucketPtr->RecycleCount == BucketPtr->ReleaseCount || BucketPtr->FirstOffset == 0)
+    BucketPtr = &PoolRecPtr->Buckets[Index];
+    Status    = CFE_SUCCESS;
+
+    if (PrevOffset == 0)
     {
-        /* no buffers in pool to recycle */
+        BucketPtr->FirstOffset = NextOffset;
+    }
+    else
+    {
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, PrevOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+        if (Status == CFE_SUCCESS)
+        {
+            BdPtr->NextOffset = NextOffset;
+            Status            = PoolRecPtr->Commit(PoolRecPtr, PrevOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, BdPtr);
+        }
+    }
+
+    if (Status == CFE_SUCCESS && NextOffset != 0)
+    {
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, NextOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+        if (Status == CFE_SUCCESS)
+        {
+            BdPtr->ActualSize = PrevOffset;
+            Status            = PoolRecPtr->Commit(PoolRecPtr, NextOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, BdPtr);
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        ++BucketPtr->RecycleCount;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Take the first block off the free list of a buddy pool bucket
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_GenPoolBuddyTake(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 Index, size_t *BlockStartPtr)
+{
+    CFE_ES_GenPoolBD_t *BdPtr;
+    size_t              BlockOffset;
+    int32               Status;
+
+    BlockOffset = PoolRecPtr->Buckets[Index].FirstOffset;
+    if (BlockOffset == 0)
+    {
+        /* no free blocks of this size */
         return CFE_ES_BUFFER_NOT_IN_POOL;
     }
 
-    BlockOffset = BucketPtr->FirstOffset;
-    DescOffset  = BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
-    Status      = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
+    Status = PoolRecPtr->Retrieve(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
     if (Status == CFE_SUCCESS)
     {
-        RecycleBucketId = BdPtr->Allocated - CFE_ES_MEMORY_DEALLOCATED;
-        if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN || RecycleBucketId != BucketId)
+        if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN ||
+            BdPtr->Allocated != (CFE_ES_MEMORY_BUDDY_FREE + (PoolRecPtr->NumBuckets - Index)))
         {
             /* sanity check failed - possible pool corruption? */
             Status = CFE_ES_BUFFER_NOT_IN_POOL;
         }
         else
         {
-            /*
-             * Get it off the top on the list
-             */
-            NextOffset = BdPtr->NextOffset;
+            Status = CFE_ES_GenPoolBuddyUnlink(PoolRecPtr, Index, 0, BdPtr->NextOffset);
+        }
+    }
 
-            BdPtr->Allocated  = CFE_ES_MEMORY_ALLOCATED + BucketId; /* Flag memory block as allocated */
-            BdPtr->ActualSize = NewSize;
-            BdPtr->NextOffset = 0;
+    if (Status == CFE_SUCCESS)
+    {
+        *BlockStartPtr = BlockOffset - PoolRecPtr->BuddyHeaderSize;
+    }
 
-            Status = PoolRecPtr->Commit(PoolRecPtr, DescOffset, BdPtr);
-            if (Status == CFE_SUCCESS)
-            {
-                *BlockOffsetPtr        = BlockOffset;
-                BucketPtr->FirstOffset = NextOffset;
-                ++BucketPtr->RecycleCount;
-            }
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Write the descriptor of a block in a buddy pool that is handed out
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_GenPoolBuddyMarkAllocated(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t BlockStart,
+                                              size_t NewSize, size_t *BlockOffsetPtr)
+{
+    CFE_ES_GenPoolBD_t *BdPtr;
+    size_t              BlockOffset;
+    int32               Status;
+
+    BlockOffset = BlockStart + PoolRecPtr->BuddyHeaderSize;
+
+    Status = PoolRecPtr->Retrieve(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        BdPtr->CheckBits  = CFE_ES_CHECK_PATTERN;
+        BdPtr->Allocated  = CFE_ES_MEMORY_ALLOCATED + BucketId; /* Flag memory block as allocated */
+        BdPtr->ActualSize = NewSize;
+        BdPtr->NextOffset = 0;
+
+        Status = PoolRecPtr->Commit(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, BdPtr);
+        if (Status == CFE_SUCCESS)
+        {
+            *BlockOffsetPtr = BlockOffset;
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Check if a block of the given size can be carved at the end of a buddy pool
+ *
+ *-----------------------------------------------------------------*/
+static inline bool CFE_ES_GenPoolBuddyCanCarve(const CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t BlockSize)
+{
+    /* it must start at a multiple of its own size */
+    return (((PoolRecPtr->TailPosition - PoolRecPtr->BuddyBaseOffset) & (BlockSize - 1)) == 0 &&
+            BlockSize <= (PoolRecPtr->PoolMaxOffset - PoolRecPtr->TailPosition));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Split a larger free block, or carve a new one from the end of the
+ * pool, to make a block for the given bucket of a buddy pool
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_GenPoolBuddyCreate(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t NewSize,
+                                       size_t *BlockOffsetPtr)
+{
+    uint16 Index;
+    uint16 SplitIndex;
+    size_t BlockStart;
+    size_t BlockSize;
+    int32  Status;
+
+    Index = PoolRecPtr->NumBuckets - BucketId;
+    if (Index >= PoolRecPtr->NumBuckets)
+    {
+        /* no buffers in pool to create */
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    /* Find the smallest free block that is big enough */
+    SplitIndex = Index;
+    while (SplitIndex < PoolRecPtr->NumBuckets && PoolRecPtr->Buckets[SplitIndex].FirstOffset == 0)
+    {
+        ++SplitIndex;
+    }
+
+    if (SplitIndex < PoolRecPtr->NumBuckets)
+    {
+        Status = CFE_ES_GenPoolBuddyTake(PoolRecPtr, SplitIndex, &BlockStart);
+    }
+    else
+    {
+        /* Carve a new block from the end of the pool, as big as possible */
+        SplitIndex = PoolRecPtr->NumBuckets - 1;
+        while (SplitIndex > Index && !CFE_ES_GenPoolBuddyCanCarve(PoolRecPtr, PoolRecPtr->BuddyUnitSize << SplitIndex))
+        {
+            --SplitIndex;
+        }
+
+        BlockSize = PoolRecPtr->BuddyUnitSize << SplitIndex;
+        if (!CFE_ES_GenPoolBuddyCanCarve(PoolRecPtr, BlockSize))
+        {
+            /* can't fit in remaining mem */
+            return CFE_ES_ERR_MEM_BLOCK_SIZE;
+        }
+
+        BlockStart               = PoolRecPtr->TailPosition;
+        PoolRecPtr->TailPosition = BlockStart + BlockSize;
+        ++PoolRecPtr->Buckets[SplitIndex].AllocationCount;
+        Status = CFE_SUCCESS;
+    }
+
+    /* Split it in halves, keeping the lower half, until it is the right size */
+    while (Status == CFE_SUCCESS && SplitIndex > Index)
+    {
+        --SplitIndex;
+        BlockSize = PoolRecPtr->BuddyUnitSize << SplitIndex;
+        Status    = CFE_ES_GenPoolBuddyInsert(PoolRecPtr, SplitIndex, BlockStart + BlockSize);
+        if (Status == CFE_SUCCESS)
+        {
+            --PoolRecPtr->Buckets[SplitIndex + 1].AllocationCount;
+            PoolRecPtr->Buckets[SplitIndex].AllocationCount += 2;
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_ES_GenPoolBuddyMarkAllocated(PoolRecPtr, BucketId, BlockStart, NewSize, BlockOffsetPtr);
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        ++PoolRecPtr->AllocationCount;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Return a block to a buddy pool, merging it with its free buddies
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_GenPoolBuddyRelease(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t BlockOffset)
+{
+    CFE_ES_GenPoolBD_t *BdPtr;
+    uint16              Index;
+    size_t              BlockStart;
+    size_t              BlockSize;
+    size_t              BuddyStart;
+    int32               Status;
+
+    Index      = PoolRecPtr->NumBuckets - BucketId;
+    BlockStart = BlockOffset - PoolRecPtr->BuddyHeaderSize;
+    Status     = CFE_SUCCESS;
+
+    while ((Index + 1) < PoolRecPtr->NumBuckets)
+    {
+        BlockSize  = PoolRecPtr->BuddyUnitSize << Index;
+        BuddyStart = PoolRecPtr->BuddyBaseOffset + ((BlockStart - PoolRecPtr->BuddyBaseOffset) ^ BlockSize);
+        if (BuddyStart + BlockSize > PoolRecPtr->TailPosition)
+        {
+            /* buddy has not been carved yet */
+            break;
+        }
+
+        /*
+         * The buddy position is always the start of a block no bigger than
+         * this one, so its descriptor tells whether it can be merged
+         */
+        Status = PoolRecPtr->Retrieve(
+            PoolRecPtr, BuddyStart + PoolRecPtr->BuddyHeaderSize - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+        if (Status != CFE_SUCCESS || BdPtr->CheckBits != CFE_ES_CHECK_PATTERN ||
+            BdPtr->Allocated != (CFE_ES_MEMORY_BUDDY_FREE + (PoolRecPtr->NumBuckets - Index)))
+        {
+            break;
+        }
+
+        Status = CFE_ES_GenPoolBuddyUnlink(PoolRecPtr, Index, BdPtr->ActualSize, BdPtr->NextOffset);
+        if (Status != CFE_SUCCESS)
+        {
+            break;
+        }
+
+        PoolRecPtr->Buckets[Index].AllocationCount -= 2;
+        ++PoolRecPtr->Buckets[Index + 1].AllocationCount;
+
+        if (BuddyStart < BlockStart)
+        {
+            BlockStart = BuddyStart;
+        }
+        ++Index;
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_ES_GenPoolBuddyInsert(PoolRecPtr, Index, BlockStart);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Find and re-allocate a previously returned block
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolRecyclePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t NewSize,
+                                     size_t *BlockOffsetPtr)
+{
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    size_t                  BlockStart;
+    int32                   Status;
+
+    BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+    if (BucketPtr == NULL || BucketPtr->RecycleCount == BucketPtr->ReleaseCount || BucketPtr->FirstOffset == 0)
+    {
+        /* no buffers in pool to recycle */
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    if (PoolRecPtr->BuddyMode)
+    {
+        /* a free block of exactly this size, without splitting a bigger one */
+        Status = CFE_ES_GenPoolBuddyTake(PoolRecPtr, PoolRecPtr->NumBuckets - BucketId, &BlockStart);
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_ES_GenPoolBuddyMarkAllocated(PoolRecPtr, BucketId, BlockStart, NewSize, BlockOffsetPtr);
         }
+
+        return Status;
+    }
+
+    /*
+     * Get it off the top on the list
+     */
+    Status = CFE_ES_GenPoolPopBlock(PoolRecPtr, &BucketPtr->FirstOffset, BucketId, NewSize, BlockOffsetPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        ++BucketPtr->RecycleCount;
     }
 
     return Status;
@@ -167,6 +516,11 @@ int32 CFE_ES_GenPoolCreatePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 B
     CFE_ES_GenPoolBD_t *    BdPtr;
     int32                   Status;
 
+    if (PoolRecPtr->BuddyMode)
+    {
+        return CFE_ES_GenPoolBuddyCreate(PoolRecPtr, BucketId, NewSize, BlockOffsetPtr);
+    }
+
     BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
     if (BucketPtr == NULL)
     {
@@ -238,6 +592,7 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
     cpuaddr                 AlignMask;
     uint32                  i;
     uint32                  j;
+    size_t                  MinReqSize;
     CFE_ES_GenPoolBucket_t *BucketPtr;
 
     if (NumBlockSizes == 0)
@@ -322,6 +677,198 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
         return CFE_ES_ERR_MEM_BLOCK_SIZE;
     }
 
+    /*
+     * Build the size class lookup.  The smallest request in class N is
+     * 2^(N-1) + 1, and its entry is the first bucket at least that big.
+     */
+    i = 0;
+    for (j = 0; j < CFE_ES_GENERIC_POOL_SIZE_CLASSES; ++j)
+    {
+        if (j == 0)
+        {
+            MinReqSize = 0;
+        }
+        else
+        {
+            MinReqSize = ((size_t)1 << (j - 1)) + 1;
+        }
+
+        while (i < NumBlockSizes && PoolRecPtr->Buckets[i].BlockSize < MinReqSize)
+        {
+            ++i;
+        }
+
+        PoolRecPtr->SizeClassStart[j] = i;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolInitializeBuddy(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartOffset, size_t PoolSize,
+                                    size_t AlignSize, size_t MinBlockSize, size_t MaxBlockSize,
+                                    CFE_ES_PoolRetrieve_Func_t RetrieveFunc, CFE_ES_PoolCommit_Func_t CommitFunc)
+{
+    size_t BlockSizeList[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];
+    size_t AlignMask;
+    size_t HeaderSize;
+    size_t BaseOffset;
+    size_t RegionSize;
+    size_t UnitSize;
+    uint16 NumBlockSizes;
+    uint16 i;
+    int32  Status;
+
+    if (MinBlockSize == 0 || MaxBlockSize < MinBlockSize)
+    {
+        CFE_ES_WriteToSysLog("%s: invalid block size range %lu-%lu\n", __func__, (unsigned long)MinBlockSize,
+                             (unsigned long)MaxBlockSize);
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    /*
+     * An invalid alignment is rejected by CFE_ES_GenPoolInitialize() below,
+     * the values computed from it are not used in that case.
+     */
+    if (AlignSize <= 1)
+    {
+        AlignMask = 0;
+    }
+    else
+    {
+        AlignMask = AlignSize - 1;
+    }
+
+    /* Blocks start aligned and the user data follows the descriptor, also aligned */
+    HeaderSize = (CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE + AlignMask) & ~AlignMask;
+    BaseOffset = (StartOffset + AlignMask) & ~AlignMask;
+    RegionSize = 0;
+    if (BaseOffset < (StartOffset + PoolSize))
+    {
+        RegionSize = StartOffset + PoolSize - BaseOffset;
+    }
+
+    UnitSize = 1;
+    while (UnitSize < (MinBlockSize + HeaderSize) && UnitSize <= RegionSize)
+    {
+        UnitSize <<= 1;
+    }
+
+    if (UnitSize > RegionSize)
+    {
+        CFE_ES_WriteToSysLog("%s: Pool size(%lu) too small for a block of %lu bytes\n", __func__,
+                             (unsigned long)PoolSize, (unsigned long)MinBlockSize);
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    /* Double the size until it holds the largest request or would not fit in the pool */
+    NumBlockSizes = 1;
+    while (((UnitSize << (NumBlockSizes - 1)) - HeaderSize) < MaxBlockSize &&
+           (UnitSize << (NumBlockSizes - 1)) <= (RegionSize / 2))
+    {
+        ++NumBlockSizes;
+    }
+
+    if (NumBlockSizes > CFE_PLATFORM_ES_POOL_MAX_BUCKETS)
+    {
+        UnitSize <<= (NumBlockSizes - CFE_PLATFORM_ES_POOL_MAX_BUCKETS);
+        NumBlockSizes = CFE_PLATFORM_ES_POOL_MAX_BUCKETS;
+    }
+
+    for (i = 0; i < NumBlockSizes; ++i)
+    {
+        BlockSizeList[i] = (UnitSize << i) - HeaderSize;
+    }
+
+    Status = CFE_ES_GenPoolInitialize(PoolRecPtr, StartOffset, PoolSize, AlignSize, NumBlockSizes, BlockSizeList,
+                                      RetrieveFunc, CommitFunc);
+    if (Status == CFE_SUCCESS)
+    {
+        /* Nothing is carved up front; blocks are taken from the end of the pool as needed */
+        PoolRecPtr->BuddyMode       = true;
+        PoolRecPtr->BuddyBaseOffset = BaseOffset;
+        PoolRecPtr->BuddyUnitSize   = UnitSize;
+        PoolRecPtr->BuddyHeaderSize = HeaderSize;
+        PoolRecPtr->TailPosition    = BaseOffset;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolMakeGeometricSizes(size_t *BlockSizeList, uint16 *NumBlockSizesPtr, size_t MinBlockSize,
+                                       size_t MaxBlockSize, uint16 MaxWastePercent)
+{
+    uint16 Count;
+    size_t BlockSize;
+    size_t Growth;
+
+    if (BlockSizeList == NULL || NumBlockSizesPtr == NULL || MinBlockSize == 0 || MaxBlockSize < MinBlockSize ||
+        MaxWastePercent == 0 || MaxWastePercent >= 100)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    Count     = 0;
+    BlockSize = MinBlockSize;
+    while (true)
+    {
+        if (Count >= *NumBlockSizesPtr)
+        {
+            /* series does not fit */
+            return CFE_ES_BAD_ARGUMENT;
+        }
+
+        BlockSizeList[Count] = BlockSize;
+        ++Count;
+
+        if (BlockSize >= MaxBlockSize)
+        {
+            break;
+        }
+
+        /*
+         * A request that did not fit the current size wastes less than
+         * the growth to the next size, so the largest allowed
+         * growth is BlockSize * MaxWaste / (1 - MaxWaste).  The growth is
+         * rounded down, and at least one byte so the series always advances.
+         */
+        if (BlockSize <= (SIZE_MAX / 100))
+        {
+            Growth = (BlockSize * MaxWastePercent) / (100 - MaxWastePercent);
+        }
+        else
+        {
+            Growth = (BlockSize / (100 - MaxWastePercent)) * MaxWastePercent;
+        }
+
+        if (Growth == 0)
+        {
+            Growth = 1;
+        }
+
+        if (Growth >= (MaxBlockSize - BlockSize))
+        {
+            BlockSize = MaxBlockSize;
+        }
+        else
+        {
+            BlockSize += Growth;
+        }
+    }
+
+    *NumBlockSizesPtr = Count;
+
     return CFE_SUCCESS;
 }
 
@@ -471,7 +1018,12 @@ int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSi
             *BlockSizePtr     = BdPtr->ActualSize;
 
             Status = PoolRecPtr->Commit(PoolRecPtr, DescOffset, BdPtr);
-            if (Status == CFE_SUCCESS)
+            if (Status == CFE_SUCCESS && PoolRecPtr->BuddyMode)
+            {
+                /* the block is already marked, in case it is merged into a lower buddy */
+                Status = CFE_ES_GenPoolBuddyRelease(PoolRecPtr, BucketId, BlockOffset);
+            }
+            else if (Status == CFE_SUCCESS)
             {
                 BucketPtr->FirstOffset = BlockOffset;
                 ++BucketPtr->ReleaseCount;
@@ -482,6 +1034,107 @@ int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSi
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolPushBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *StackTopPtr, uint16 BucketId,
+                              size_t BlockOffset)
+{
+    size_t                  DescOffset;
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    CFE_ES_GenPoolBD_t *    BdPtr;
+    int32                   Status;
+
+    if (BlockOffset >= PoolRecPtr->TailPosition || BlockOffset < CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE)
+    {
+        /* outside the bounds of the pool */
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    DescOffset = BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+
+    Status = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+
+        if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN || BucketPtr == NULL ||
+            BdPtr->Allocated != (CFE_ES_MEMORY_ALLOCATED + BucketId) || BdPtr->ActualSize == 0 ||
+            BucketPtr->BlockSize < BdPtr->ActualSize)
+        {
+            /* This does not appear to be a valid data buffer */
+            Status = CFE_ES_POOL_BLOCK_INVALID;
+        }
+        else
+        {
+            BdPtr->Allocated  = CFE_ES_MEMORY_DEALLOCATED + BucketId;
+            BdPtr->NextOffset = *StackTopPtr;
+
+            Status = PoolRecPtr->Commit(PoolRecPtr, DescOffset, BdPtr);
+            if (Status == CFE_SUCCESS)
+            {
+                *StackTopPtr = BlockOffset;
+            }
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolPopBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *StackTopPtr, uint16 BucketId, size_t NewSize,
+                             size_t *BlockOffsetPtr)
+{
+    size_t              DescOffset;
+    size_t              BlockOffset;
+    size_t              NextOffset;
+    CFE_ES_GenPoolBD_t *BdPtr;
+    int32               Status;
+
+    BlockOffset = *StackTopPtr;
+    if (BlockOffset < CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE)
+    {
+        /* stack is empty */
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    DescOffset = BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+    Status     = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN || BdPtr->Allocated != (CFE_ES_MEMORY_DEALLOCATED + BucketId))
+        {
+            /* sanity check failed - possible pool corruption? */
+            Status = CFE_ES_BUFFER_NOT_IN_POOL;
+        }
+        else
+        {
+            NextOffset = BdPtr->NextOffset;
+
+            BdPtr->Allocated  = CFE_ES_MEMORY_ALLOCATED + BucketId; /* Flag memory block as allocated */
+            BdPtr->ActualSize = NewSize;
+            BdPtr->NextOffset = 0;
+
+            Status = PoolRecPtr->Commit(PoolRecPtr, DescOffset, BdPtr);
+            if (Status == CFE_SUCCESS)
+            {
+                *BlockOffsetPtr = BlockOffset;
+                *StackTopPtr    = NextOffset;
+            }
+        }
+    }
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -613,13 +1266,77 @@ bool CFE_ES_GenPoolValidateState(const CFE_ES_GenPoolRecord_t *PoolRecPtr)
 void CFE_ES_GenPoolGetUsage(CFE_ES_GenPoolRecord_t *PoolRecPtr, CFE_ES_MemOffset_t *FreeSizeBuf,
                             CFE_ES_MemOffset_t *TotalSizeBuf)
 {
+    size_t FreeSize;
+    uint16 i;
+
     if (TotalSizeBuf != NULL)
     {
         *TotalSizeBuf = CFE_ES_MEMOFFSET_C(PoolRecPtr->PoolTotalSize);
     }
     if (FreeSizeBuf != NULL)
     {
-        *FreeSizeBuf = CFE_ES_MEMOFFSET_C(PoolRecPtr->PoolMaxOffset - PoolRecPtr->TailPosition);
+        FreeSize = PoolRecPtr->PoolMaxOffset - PoolRecPtr->TailPosition;
+
+        /* Free blocks in a buddy pool can be used for any size */
+        if (PoolRecPtr->BuddyMode)
+        {
+            for (i = 0; i < PoolRecPtr->NumBuckets; ++i)
+            {
+                FreeSize += (PoolRecPtr->BuddyUnitSize << i) *
+                            (PoolRecPtr->Buckets[i].ReleaseCount - PoolRecPtr->Buckets[i].RecycleCount);
+            }
+        }
+
+        *FreeSizeBuf = CFE_ES_MEMOFFSET_C(FreeSize);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_GenPoolGetFreeSpace(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *TotalFreeBuf, size_t *LargestFreeBuf)
+{
+    size_t TotalFree;
+    size_t LargestFree;
+    size_t BlockSize;
+    uint32 NumFree;
+    uint16 i;
+
+    TotalFree   = PoolRecPtr->PoolMaxOffset - PoolRecPtr->TailPosition;
+    LargestFree = TotalFree;
+
+    for (i = 0; i < PoolRecPtr->NumBuckets; ++i)
+    {
+        NumFree = PoolRecPtr->Buckets[i].ReleaseCount - PoolRecPtr->Buckets[i].RecycleCount;
+        if (NumFree != 0)
+        {
+            if (PoolRecPtr->BuddyMode)
+            {
+                BlockSize = PoolRecPtr->BuddyUnitSize << i;
+            }
+            else
+            {
+                BlockSize = PoolRecPtr->Buckets[i].BlockSize;
+            }
+
+            TotalFree += BlockSize * NumFree;
+            if (BlockSize > LargestFree)
+            {
+                LargestFree = BlockSize;
+            }
+        }
+    }
+
+    if (TotalFreeBuf != NULL)
+    {
+        *TotalFreeBuf = TotalFree;
+    }
+    if (LargestFreeBuf != NULL)
+    {
+        *LargestFreeBuf = LargestFree;
     }
 }
 
@@ -45,10 +45,17 @@
 #define CFE_ES_CHECK_PATTERN      ((uint16)0x5a5a)
 #define CFE_ES_MEMORY_ALLOCATED   ((uint16)0xaaaa)
 #define CFE_ES_MEMORY_DEALLOCATED ((uint16)0xdddd)
+#define CFE_ES_MEMORY_BUDDY_FREE  ((uint16)0xeeee) /* free block in a buddy pool, may be merged */
 
 #define CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE \
     sizeof(CFE_ES_GenPoolBD_t) /* amount of space to reserve with every allocation */
 
+/*
+ * Number of power-of-two size classes used to look up buckets.  Class N
+ * holds the request sizes in (2^(N-1), 2^N], and class 0 holds sizes 0 and 1.
+ */
+#define CFE_ES_GENERIC_POOL_SIZE_CLASSES (1 + (8 * sizeof(size_t)))
+
 /*
 ** Type Definitions
 */
@@ -57,7 +64,7 @@ typedef struct CFE_ES_GenPoolBD
 {
     uint16 CheckBits;  /**< Set to a fixed bit pattern after init */
     uint16 Allocated;  /**< Set to a bit pattern depending on allocation state */
-    size_t ActualSize; /**< The actual requested size of the block */
+    size_t ActualSize; /**< The actual requested size of the block, or the previous free block in a buddy pool */
     size_t NextOffset; /**< The offset of the next descriptor in the free stack */
 } CFE_ES_GenPoolBD_t;
 
@@ -114,6 +121,24 @@ struct CFE_ES_GenPoolRecord
 
     uint16                 NumBuckets; /**< Number of entries in the "Buckets" array that are valid */
     CFE_ES_GenPoolBucket_t Buckets[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /**< Bucket States */
+
+    /**
+     * Index of the first bucket that can hold the smallest request of each
+     * size class, so a lookup only has to step through the buckets within
+     * one power-of-two range.
+     */
+    uint16 SizeClassStart[CFE_ES_GENERIC_POOL_SIZE_CLASSES];
+
+    /*
+     * Buddy pools only: the bucket at index N holds blocks of BuddyUnitSize << N
+     * bytes including the header, starting at a multiple of that size from
+     * BuddyBaseOffset.  The free lists are doubly linked so that a block can be
+     * merged with its buddy without searching.
+     */
+    bool   BuddyMode;       /**< Blocks are split and merged as binary buddies */
+    size_t BuddyBaseOffset; /**< Position that block positions are relative to */
+    size_t BuddyUnitSize;   /**< Size of the smallest block, including the header */
+    size_t BuddyHeaderSize; /**< Space from the start of a block to the user data */
 };
 
 /*****************************************************************************/
@@ -143,6 +168,33 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
                                size_t AlignSize, uint16 NumBlockSizes, const size_t *BlockSizeList,
                                CFE_ES_PoolRetrieve_Func_t RetrieveFunc, CFE_ES_PoolCommit_Func_t CommitFunc);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Initialize a generic pool structure as a binary buddy allocator
+ *
+ * Resets the pool to its initial state.  The buckets are the powers of two,
+ * less the block header, from the first one that holds MinBlockSize up to the
+ * first one that holds MaxBlockSize, limited to the pool size.  If that needs
+ * more than CFE_PLATFORM_ES_POOL_MAX_BUCKETS buckets the smallest are dropped.
+ *
+ * Blocks are allocated and released with the same functions as for other
+ * pools.  Buddy pools cannot be restored with CFE_ES_GenPoolRebuild().
+ *
+ * \param[out]  PoolRecPtr    Pointer to pool structure
+ * \param[in]   StartOffset   Initial starting location of pool
+ * \param[in]   PoolSize      Size of pool (beyond start offset)
+ * \param[in]   AlignSize     Required Alignment of blocks
+ * \param[in]   MinBlockSize  Smallest request the blocks should be sized for
+ * \param[in]   MaxBlockSize  Largest request the pool must be able to serve
+ * \param[in]   RetrieveFunc  Function to retrieve buffer descriptors
+ * \param[in]   CommitFunc    Function to commit buffer descriptors
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolInitializeBuddy(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartOffset, size_t PoolSize,
+                                    size_t AlignSize, size_t MinBlockSize, size_t MaxBlockSize,
+                                    CFE_ES_PoolRetrieve_Func_t RetrieveFunc, CFE_ES_PoolCommit_Func_t CommitFunc);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Gets a block from the pool
@@ -158,10 +210,26 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
  */
 int32 CFE_ES_GenPoolGetBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockOffsetPtr, size_t ReqSize);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Find the smallest bucket that can hold a block of the given size
+ *
+ * \note Internal helper routine only, not part of API.
+ *
+ * \param[in] PoolRecPtr  Pointer to pool structure
+ * \param[in] ReqSize     Size of block requested
+ *
+ * \return Bucket ID (nonzero), or 0 if the size is larger than every bucket
+ */
+uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Create a new block of the given size.
  *
+ * In a buddy pool this splits the smallest larger free block, or one
+ * carved from the end of the pool.
+ *
  * \note Internal helper routine only, not part of API.
  *
  * \param[inout] PoolRecPtr      Pointer to pool structure
@@ -206,6 +274,48 @@ int32 CFE_ES_GenPoolRecyclePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16
  */
 int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSizePtr, size_t BlockOffset);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Pushes an allocated block onto a free stack kept outside of the pool
+ *
+ * The block is checked and marked as deallocated in the same way as
+ * CFE_ES_GenPoolPutBlock(), but it is linked into the given stack rather
+ * than the free stack of its bucket, and none of the pool counters change.
+ * To the pool the block is still allocated.
+ *
+ * The pool structure is only read, so this does not need to be serialized
+ * with other pool operations as long as the caller owns both the block and
+ * the stack.  Validation errors are not counted; the caller may pass the
+ * block to CFE_ES_GenPoolPutBlock() to have them counted and reported.
+ *
+ * \param[in]    PoolRecPtr    Pointer to pool structure
+ * \param[inout] StackTopPtr   Offset of the block on top of the stack, 0 if empty
+ * \param[in]    BucketId      Bucket ID the block must belong to
+ * \param[in]    BlockOffset   Offset of data block
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolPushBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *StackTopPtr, uint16 BucketId,
+                              size_t BlockOffset);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Pops a block off a free stack and marks it as allocated
+ *
+ * This is the inverse of CFE_ES_GenPoolPushBlock(), and is also used for the
+ * free stack of each bucket.  None of the pool counters change.
+ *
+ * \param[in]    PoolRecPtr      Pointer to pool structure
+ * \param[inout] StackTopPtr     Offset of the block on top of the stack
+ * \param[in]    BucketId        Bucket ID of the blocks in the stack
+ * \param[in]    NewSize         Requested size to record in the block
+ * \param[out]   BlockOffsetPtr  Location to output the block offset
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolPopBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *StackTopPtr, uint16 BucketId, size_t NewSize,
+                             size_t *BlockOffsetPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Rebuild list of free blocks in pool
@@ -272,6 +382,21 @@ bool CFE_ES_GenPoolValidateState(const CFE_ES_GenPoolRecord_t *PoolRecPtr);
 void CFE_ES_GenPoolGetUsage(CFE_ES_GenPoolRecord_t *PoolRecPtr, CFE_ES_MemOffset_t *FreeSizeBuf,
                             CFE_ES_MemOffset_t *TotalSizeBuf);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Query the free space of the pool structure
+ *
+ * Obtain the total free space and the largest single free area, which
+ * together indicate how fragmented the free space is.  The free space is
+ * the unallocated area at the end of the pool plus all blocks on the free
+ * lists.  Blocks held elsewhere (e.g. in task caches) count as allocated.
+ *
+ * \param[in]  PoolRecPtr       Pointer to pool structure
+ * \param[out] TotalFreeBuf     Buffer to store total free size, in bytes
+ * \param[out] LargestFreeBuf   Buffer to store largest free area, in bytes
+ */
+void CFE_ES_GenPoolGetFreeSpace(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *TotalFreeBuf, size_t *LargestFreeBuf);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Query counters associated with the pool structure
@@ -301,6 +426,28 @@ void CFE_ES_GenPoolGetCounts(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 *NumBuck
 void CFE_ES_GenPoolGetBucketUsage(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId,
                                   CFE_ES_BlockStats_t *BlockStatsBuf);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Generate a geometric series of block sizes
+ *
+ * Produces block sizes from MinBlockSize up to MaxBlockSize, where each size
+ * is as large as possible while keeping the space wasted by a request placed
+ * in it (because it did not fit in the next smaller size) below MaxWastePercent
+ * of the block.  This bounds the internal fragmentation of any allocation while
+ * using the fewest buckets.
+ *
+ * \param[out]   BlockSizeList     Buffer to store the block sizes, in ascending order
+ * \param[inout] NumBlockSizesPtr  On input, the capacity of BlockSizeList.  On output, the number of sizes stored.
+ * \param[in]    MinBlockSize      Smallest block size
+ * \param[in]    MaxBlockSize      Largest block size
+ * \param[in]    MaxWastePercent   Upper bound of the wasted fraction of a block, 1-99
+ *
+ * \return #CFE_SUCCESS, or #CFE_ES_BAD_ARGUMENT if the inputs are invalid or the
+ *         series does not fit in the buffer
+ */
+int32 CFE_ES_GenPoolMakeGeometricSizes(size_t *BlockSizeList, uint16 *NumBlockSizesPtr, size_t MinBlockSize,
+                                       size_t MaxBlockSize, uint16 MaxWastePercent);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Calculate the pool size required for the specified number of blocks
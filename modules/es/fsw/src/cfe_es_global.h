@@ -41,13 +41,48 @@
 #include "cfe_es_erlog_typedef.h"
 #include "cfe_es_resetdata_typedef.h"
 #include "cfe_es_cds.h"
+#include "cfe_es_start.h"
+#include "cfe_es_core_internal.h"
+#include "cfe_core_atomic.h"
+#include "cfe_resourceid_nameindex.h"
 
 #include <signal.h> /* for sig_atomic_t */
 
+/*
+** Macro Definitions
+*/
+
+/**
+ * @brief Number of lock-free attempts made by a shared data reader
+ *
+ * If a reader is interrupted by a writer this many times, it falls back to
+ * taking the shared data mutex, so readers can never be starved.
+ */
+#define CFE_ES_SHARED_DATA_READ_ATTEMPTS 4
+
+/**
+ * @brief Number of name index slots for each of the ES resource tables
+ */
+#define CFE_ES_APP_NAMEINDEX_SLOTS     CFE_RESOURCEID_NAMEINDEX_SLOTS(CFE_PLATFORM_ES_MAX_APPLICATIONS)
+#define CFE_ES_LIB_NAMEINDEX_SLOTS     CFE_RESOURCEID_NAMEINDEX_SLOTS(CFE_PLATFORM_ES_MAX_LIBRARIES)
+#define CFE_ES_COUNTER_NAMEINDEX_SLOTS CFE_RESOURCEID_NAMEINDEX_SLOTS(CFE_PLATFORM_ES_MAX_GEN_COUNTERS)
+
 /*
 ** Typedefs
 */
 
+/**
+ * @brief State of a reader of the ES global data
+ *
+ * See CFE_ES_ReadSharedDataBegin() and CFE_ES_ReadSharedDataRetry()
+ */
+typedef struct
+{
+    uint32 Sequence; /**< Value of SharedDataSeq when the current attempt began */
+    uint32 Attempts; /**< Number of lock-free attempts made so far */
+    bool   IsLocked; /**< Whether the current attempt holds the shared data mutex */
+} CFE_ES_SharedDataReadState_t;
+
 /*
 ** CFE_ES_GenCounterRecord_t is an internal structure used to keep track of
 ** Generic Counters that are active in the system.
@@ -59,14 +94,40 @@ typedef struct
     char               CounterName[OS_MAX_API_NAME]; /* Counter Name */
 } CFE_ES_GenCounterRecord_t;
 
+/*
+ * State of one job registered with the ES background task
+ *
+ * Other than WakeRequested, this is only updated by the background task
+ * once the job is registered.
+ */
+typedef struct
+{
+    CFE_ES_BackgroundJobConfig_t Config;        /**< Parameters the job was registered with */
+    CFE_Atomic_Uint32_t          WakeRequested; /**< Set when the job is woken, cleared by the background task */
+    bool                         IsDue;         /**< Whether the job is to be called on the next pass */
+    uint32                       DueTimer;      /**< Time until the job is due, 0 if it only runs when woken */
+    uint32                       OverdueTime;   /**< Time since the job became due */
+    uint32                       SinceLastRun;  /**< Time since the job was last called */
+    uint32                       RunUsecPart;   /**< Run time not yet counted in Stats.TotalRunMsec */
+    CFE_ES_BackgroundJobStats_t  Stats;         /**< Statistics reported in telemetry */
+} CFE_ES_BackgroundJobRecord_t;
+
 /*
  * Encapsulates the state of the ES background task
  */
 typedef struct
 {
-    CFE_ES_TaskId_t TaskID;         /**< ES ID of the background task */
-    osal_id_t       WorkSem;        /**< Semaphore that is given whenever background work is pending */
-    uint32          NumJobsRunning; /**< Current Number of active jobs (updated by background task) */
+    CFE_ES_TaskId_t     TaskID;           /**< ES ID of the background task */
+    osal_id_t           WorkSem;          /**< Semaphore that is given whenever background work is pending */
+    uint32              NumJobsRunning;   /**< Current Number of active jobs (updated by background task) */
+    CFE_Atomic_Uint32_t NumJobs;          /**< Number of jobs registered, set after the job record is filled in */
+    uint32              NextTlmJob;       /**< Job reported first in the next Background Jobs packet */
+    uint32              AppScanJobNum;    /**< Job number of the ES app table scan */
+    uint32              PerfDumpJobNum;   /**< Job number of the performance log dump */
+    uint32              PerfStreamJobNum; /**< Job number of the performance log streaming */
+    uint32              CDSWriteJobNum;   /**< Job number of the deferred CDS writes */
+
+    CFE_ES_BackgroundJobRecord_t Jobs[CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS];
 } CFE_ES_BackgroundTaskState_t;
 
 /*
@@ -117,6 +178,26 @@ typedef struct
     */
     CFE_ES_MemStatsTlm_t MemStatsPacket;
 
+    /*
+    ** Memory pool diagnostics telemetry
+    */
+    CFE_ES_MemPoolDiagTlm_t MemPoolDiagPacket;
+
+    /*
+    ** Performance marker statistics telemetry
+    */
+    CFE_ES_PerfStatsTlm_t PerfStatsPacket;
+
+    /*
+    ** Startup timeline telemetry
+    */
+    CFE_ES_StartupTimingTlm_t StartupTimingPacket;
+
+    /*
+    ** Background job statistics telemetry
+    */
+    CFE_ES_BackgroundJobsTlm_t BackgroundJobsPacket;
+
     /*
     ** ES Task operational data (not reported in housekeeping)
     */
@@ -137,8 +218,15 @@ typedef struct
 
     /*
     ** Shared Data Semaphore
+    **
+    ** SharedDataSeq is odd while the mutex is held and is advanced on every
+    ** release, so lookups can read the tables without taking the mutex and
+    ** detect if they overlapped a writer.  SharedDataLockDepth is only
+    ** accessed by the mutex holder.
     */
-    osal_id_t SharedDataMutex;
+    osal_id_t           SharedDataMutex;
+    CFE_Atomic_Uint32_t SharedDataSeq;
+    uint32              SharedDataLockDepth;
 
     /*
     ** Performance Data Mutex
@@ -150,6 +238,17 @@ typedef struct
     */
     volatile sig_atomic_t SystemState;
 
+    /*
+    ** Startup script modules, loaded ahead of their apps and libraries
+    */
+    CFE_ES_StartupLoadGlobal_t StartupLoad;
+
+    /*
+    ** Startup timeline, and the state of startup timeline file writes
+    */
+    CFE_ES_StartupTimingGlobal_t               StartupTiming;
+    CFE_ES_BackgroundStartupTimingDumpGlobal_t BackgroundStartupTimingDumpState;
+
     /*
     ** ES Task Table
     */
@@ -159,23 +258,29 @@ typedef struct
     /*
     ** ES App Table
     */
-    uint32             RegisteredCoreApps;
-    uint32             RegisteredExternalApps;
-    CFE_ResourceId_t   LastAppId;
-    CFE_ES_AppRecord_t AppTable[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+    uint32                         RegisteredCoreApps;
+    uint32                         RegisteredExternalApps;
+    CFE_ResourceId_t               LastAppId;
+    CFE_ES_AppRecord_t             AppTable[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+    CFE_ResourceId_NameIndexSlot_t AppNameIndex[CFE_ES_APP_NAMEINDEX_SLOTS];
+    bool                           AppNameIndexIncomplete; /* set if a record could not be indexed */
 
     /*
     ** ES Shared Library Table
     */
-    uint32             RegisteredLibs;
-    CFE_ResourceId_t   LastLibId;
-    CFE_ES_LibRecord_t LibTable[CFE_PLATFORM_ES_MAX_LIBRARIES];
+    uint32                         RegisteredLibs;
+    CFE_ResourceId_t               LastLibId;
+    CFE_ES_LibRecord_t             LibTable[CFE_PLATFORM_ES_MAX_LIBRARIES];
+    CFE_ResourceId_NameIndexSlot_t LibNameIndex[CFE_ES_LIB_NAMEINDEX_SLOTS];
+    bool                           LibNameIndexIncomplete; /* set if a record could not be indexed */
 
     /*
     ** ES Generic Counters Table
     */
-    CFE_ResourceId_t          LastCounterId;
-    CFE_ES_GenCounterRecord_t CounterTable[CFE_PLATFORM_ES_MAX_GEN_COUNTERS];
+    CFE_ResourceId_t               LastCounterId;
+    CFE_ES_GenCounterRecord_t      CounterTable[CFE_PLATFORM_ES_MAX_GEN_COUNTERS];
+    CFE_ResourceId_NameIndexSlot_t CounterNameIndex[CFE_ES_COUNTER_NAMEINDEX_SLOTS];
+    bool                           CounterNameIndexIncomplete; /* set if a record could not be indexed */
 
     /*
     ** Critical Data Store Management Variables
@@ -200,11 +305,36 @@ typedef struct
     */
     CFE_ES_BackgroundLogDumpGlobal_t BackgroundERLogDumpState;
 
+    /*
+     * Persistent state data associated with memory pool statistics file writes
+     */
+    CFE_ES_BackgroundPoolStatsDumpGlobal_t BackgroundPoolStatsDumpState;
+
+#ifdef CFE_ES_POOL_ALLOC_TRACKING_ENABLED
+    /*
+     * Live memory pool blocks, and the state of allocation site file writes
+     */
+    CFE_ES_PoolAllocTrackState_t            PoolAllocTrack;
+    CFE_ES_BackgroundAllocSitesDumpGlobal_t BackgroundAllocSitesDumpState;
+#endif
+
     /*
      * Persistent state data associated with performance log data file writes
      */
     CFE_ES_PerfDumpGlobal_t BackgroundPerfDumpState;
 
+    /*
+     * State data associated with streaming the performance log to files
+     */
+    CFE_ES_PerfStreamGlobal_t BackgroundPerfStreamState;
+
+#ifdef CFE_ES_PERF_MARKER_STATS_ENABLED
+    /*
+     * Duration statistics of performance markers, and the open markers of each task
+     */
+    CFE_ES_PerfStatsGlobal_t PerfStats;
+#endif
+
     /*
      * Persistent state data associated with background app table scans
      */
@@ -250,4 +380,65 @@ void CFE_ES_LockSharedData(const char *FunctionName, int32 LineNumber);
  */
 void CFE_ES_UnlockSharedData(const char *FunctionName, int32 LineNumber);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Begin a read-only access to the ES global data structures
+ *
+ * Read-only lookups do not need to exclude each other, only writers.  This
+ * starts an attempt to read the global data without taking the shared data
+ * mutex.  The caller must read the data it needs into local storage and then
+ * call CFE_ES_ReadSharedDataRetry(), repeating both steps while it returns
+ * true.  For example:
+ *
+ *     memset(&ReadState, 0, sizeof(ReadState));
+ *     do
+ *     {
+ *         CFE_ES_ReadSharedDataBegin(&ReadState, __func__, __LINE__);
+ *         ... copy data out of the tables ...
+ *     } while (CFE_ES_ReadSharedDataRetry(&ReadState, __func__, __LINE__));
+ *
+ * Data read within the section may be inconsistent until the retry check
+ * passes, so the section must not have side effects, and must not follow
+ * pointers other than to fixed table entries.  Names must be copied with
+ * CFE_ES_ReadSharedName() rather than the C string functions, as a name
+ * being rewritten may briefly have no terminator.  If a writer is active, or
+ * after #CFE_ES_SHARED_DATA_READ_ATTEMPTS interrupted attempts, this takes
+ * the shared data mutex instead and the attempt is always consistent.
+ *
+ * @param State          the reader state, zeroed by the caller before the first attempt
+ * @param FunctionName   the name of the function/caller
+ * @param LineNumber     the line number of the caller
+ */
+void CFE_ES_ReadSharedDataBegin(CFE_ES_SharedDataReadState_t *State, const char *FunctionName, int32 LineNumber);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Complete a read-only access to the ES global data structures
+ *
+ * Ends the attempt started by CFE_ES_ReadSharedDataBegin().
+ *
+ * @param State          the reader state
+ * @param FunctionName   the name of the function/caller
+ * @param LineNumber     the line number of the caller
+ * @returns true if the data was modified during the attempt and must be read again,
+ *          false if the data read is consistent
+ */
+bool CFE_ES_ReadSharedDataRetry(CFE_ES_SharedDataReadState_t *State, const char *FunctionName, int32 LineNumber);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Copy a name out of the ES global data during a read-only access
+ *
+ * Copies the string in Src, reading no more than SrcSize bytes of it even
+ * if it is not terminated.  The output is truncated to fit and is always
+ * terminated.  The result is only meaningful once CFE_ES_ReadSharedDataRetry()
+ * has confirmed the read was consistent.
+ *
+ * @param[out] Dest      buffer to hold the copy
+ * @param[in]  DestSize  size of the output buffer
+ * @param[in]  Src       name stored in the global data
+ * @param[in]  SrcSize   size of the array holding the name
+ */
+void CFE_ES_ReadSharedName(char *Dest, size_t DestSize, const char *Src, size_t SrcSize);
+
 #endif /* CFE_ES_GLOBAL_H */
@@ -54,6 +54,11 @@
                  } *)0)          \
                      ->Align)
 
+/*
+ * Number of blocks moved between a task cache and the pool at once
+ */
+#define CFE_ES_MEMPOOL_CACHE_BATCH (CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH / 2)
+
 /*****************************************************************************/
 /*
 ** Functions
@@ -186,18 +191,22 @@ CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_
 
 /*----------------------------------------------------------------
  *
- * Internal function used to implement CFE_ES_PoolCreateEx with the added
- * parameter of Alignment
+ * Internal helper routine only, not part of API.
+ *
+ * Common implementation of all pool create functions
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CFE_ES_PoolCreateEx_WithAlignment(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
-                                  const size_t *BlockSizes, bool UseMutex, size_t Alignment)
+static CFE_Status_t CFE_ES_MemPoolCreate(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
+                                         const size_t *BlockSizes, uint32 Flags, size_t Alignment)
 {
     int32                   OsStatus;
     int32                   Status;
     CFE_ResourceId_t        PendingID;
     CFE_ES_MemPoolRecord_t *PoolRecPtr;
     size_t                  MinimumSize;
+    size_t                  MinBlockSize;
+    size_t                  MaxBlockSize;
+    uint16                  i;
     char                    MutexName[OS_MAX_API_NAME];
     CFE_Config_ArrayValue_t MemPoolDefSize;
 
@@ -297,13 +306,36 @@ CFE_Status_t CFE_ES_PoolCreateEx_WithAlignment(CFE_ES_MemHandle_t *PoolID, void
      * Most of the work is done by the generic pool implementation.
      * This subsystem works in offsets, not pointers.
      */
-    Status = CFE_ES_GenPoolInitialize(&PoolRecPtr->Pool, 0, Size, Alignment, NumBlockSizes, BlockSizes,
-                                      CFE_ES_MemPoolDirectRetrieve, CFE_ES_MemPoolDirectCommit);
+    if ((Flags & CFE_ES_POOL_BUDDY) != 0)
+    {
+        /* A buddy pool covers the range of the given sizes with powers of two */
+        MinBlockSize = 0;
+        MaxBlockSize = 0;
+        for (i = 0; i < NumBlockSizes; ++i)
+        {
+            if (i == 0 || BlockSizes[i] < MinBlockSize)
+            {
+                MinBlockSize = BlockSizes[i];
+            }
+            if (BlockSizes[i] > MaxBlockSize)
+            {
+                MaxBlockSize = BlockSizes[i];
+            }
+        }
+
+        Status = CFE_ES_GenPoolInitializeBuddy(&PoolRecPtr->Pool, 0, Size, Alignment, MinBlockSize, MaxBlockSize,
+                                               CFE_ES_MemPoolDirectRetrieve, CFE_ES_MemPoolDirectCommit);
+    }
+    else
+    {
+        Status = CFE_ES_GenPoolInitialize(&PoolRecPtr->Pool, 0, Size, Alignment, NumBlockSizes, BlockSizes,
+                                          CFE_ES_MemPoolDirectRetrieve, CFE_ES_MemPoolDirectCommit);
+    }
 
     /*
      * If successful, complete the process.
      */
-    if (Status == CFE_SUCCESS && UseMutex == CFE_ES_USE_MUTEX)
+    if (Status == CFE_SUCCESS && (Flags & (CFE_ES_POOL_USE_MUTEX | CFE_ES_POOL_TASK_CACHE)) != 0)
     {
         /*
         ** Construct a name for the Mutex from the address
@@ -331,6 +363,10 @@ CFE_Status_t CFE_ES_PoolCreateEx_WithAlignment(CFE_ES_MemHandle_t *PoolID, void
          */
         PoolRecPtr->BaseAddr = (cpuaddr)MemPtr;
 
+        /* Task caches depend on the mutex, which was created above */
+        PoolRecPtr->UseTaskCache   = ((Flags & CFE_ES_POOL_TASK_CACHE) != 0);
+        PoolRecPtr->UseDiagnostics = ((Flags & CFE_ES_POOL_DIAGNOSTICS) != 0);
+
         /*
          * Get the calling context.
          * If this is not a valid CFE context, then AppID will be undefined.
@@ -361,6 +397,85 @@ CFE_Status_t CFE_ES_PoolCreateEx_WithAlignment(CFE_ES_MemHandle_t *PoolID, void
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_PoolCreateWithFlags(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
+                                        const size_t *BlockSizes, uint32 Flags)
+{
+    if ((Flags & ~((uint32)(CFE_ES_POOL_USE_MUTEX | CFE_ES_POOL_TASK_CACHE | CFE_ES_POOL_BUDDY |
+                            CFE_ES_POOL_DIAGNOSTICS))) != 0)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    return CFE_ES_MemPoolCreate(PoolID, MemPtr, Size, NumBlockSizes, BlockSizes, Flags, ALIGN_OF(CFE_ES_PoolAlign_t));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal function used to implement CFE_ES_PoolCreateEx with the added
+ * parameter of Alignment
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_PoolCreateEx_WithAlignment(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
+                                  const size_t *BlockSizes, bool UseMutex, size_t Alignment)
+{
+    uint32 Flags;
+
+    if (UseMutex == CFE_ES_USE_MUTEX)
+    {
+        Flags = CFE_ES_POOL_USE_MUTEX;
+    }
+    else
+    {
+        Flags = 0;
+    }
+
+    return CFE_ES_MemPoolCreate(PoolID, MemPtr, Size, NumBlockSizes, BlockSizes, Flags, Alignment);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_PoolGeometricBlockSizes(size_t *BlockSizes, uint16 *NumBlockSizes, size_t MinBlockSize,
+                                            size_t MaxBlockSize, uint16 MaxWastePercent)
+{
+    uint16 Capacity;
+    int32  Status;
+
+    if (NumBlockSizes == NULL)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    /* the result must be usable with CFE_ES_PoolCreateEx() */
+    Capacity = *NumBlockSizes;
+    if (Capacity > CFE_PLATFORM_ES_POOL_MAX_BUCKETS)
+    {
+        Capacity = CFE_PLATFORM_ES_POOL_MAX_BUCKETS;
+    }
+
+    Status = CFE_ES_GenPoolMakeGeometricSizes(BlockSizes, &Capacity, MinBlockSize, MaxBlockSize, MaxWastePercent);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Cannot fit sizes %lu-%lu with %u%% waste in %u block sizes\n", __func__,
+                             (unsigned long)MinBlockSize, (unsigned long)MaxBlockSize, (unsigned int)MaxWastePercent,
+                             (unsigned int)Capacity);
+        return Status;
+    }
+
+    *NumBlockSizes = Capacity;
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -393,6 +508,13 @@ int32 CFE_ES_PoolDelete(CFE_ES_MemHandle_t PoolID)
 
     CFE_ES_UnlockSharedData(__func__, __LINE__);
 
+#ifdef CFE_ES_POOL_ALLOC_TRACKING_ENABLED
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_ES_PoolAllocTrackPurge(PoolID);
+    }
+#endif
+
     /* Release the mutex if it was configured.
      * This is done after releasing the ES lock, to avoid
      * potential conflict with holding two locks. */
@@ -416,126 +538,240 @@ int32 CFE_ES_PoolDelete(CFE_ES_MemHandle_t PoolID)
 
 /*----------------------------------------------------------------
  *
- * Implemented per public API
- * See description in header file for argument/return detail
+ * Internal helper routine only, not part of API.
+ *
+ * Read the low word of the PSP timebase, for measuring short intervals
  *
  *-----------------------------------------------------------------*/
-int32 CFE_ES_GetPoolBuf(CFE_ES_MemPoolBuf_t *BufPtr, CFE_ES_MemHandle_t Handle, size_t Size)
+static uint32 CFE_ES_MemPoolTicks(void)
 {
-    int32                   Status;
-    CFE_ES_AppId_t          AppId;
-    CFE_ES_MemPoolRecord_t *PoolRecPtr;
-    size_t                  DataOffset;
+    uint32 TimerUpper32;
+    uint32 TimerLower32;
 
-    if (BufPtr == NULL)
+    TimerUpper32 = 0;
+    TimerLower32 = 0;
+    CFE_PSP_Get_Timebase(&TimerUpper32, &TimerLower32);
+
+    return TimerLower32;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Raise an atomic high-watermark to at least the given value
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_MemPoolDiagRaise(CFE_Atomic_Uint32_t *MaxPtr, uint32 Value)
+{
+    uint32 Current;
+
+    Current = CFE_Atomic_Load(MaxPtr);
+    while (Value > Current && !CFE_Atomic_CompareExchange(MaxPtr, &Current, Value))
     {
-        return CFE_ES_BAD_ARGUMENT;
+        /* another context raised it first, Current has been updated so check again */
     }
+}
 
-    PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(Handle);
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Take the pool mutex, timing how long it is held if diagnostics are enabled
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_MemPoolLock(CFE_ES_MemPoolRecord_t *PoolRecPtr)
+{
+    OS_MutSemTake(PoolRecPtr->MutexId);
 
-    /* basic sanity check */
-    if (!CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, Handle))
+    if (PoolRecPtr->UseDiagnostics)
     {
-        CFE_ES_GetAppID(&AppId);
-        CFE_ES_WriteToSysLog("%s: Err:Bad handle(0x%08lX) AppId=%lu\n", __func__, CFE_RESOURCEID_TO_ULONG(Handle),
-                             CFE_RESOURCEID_TO_ULONG(AppId));
-        return CFE_ES_ERR_RESOURCEID_NOT_VALID;
+        PoolRecPtr->Diag.LockStartTicks = CFE_ES_MemPoolTicks();
     }
+}
 
-    /*
-     * Real work begins here.
-     * If pool is mutex-protected, take the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Give the pool mutex taken by CFE_ES_MemPoolLock()
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_MemPoolUnlock(CFE_ES_MemPoolRecord_t *PoolRecPtr)
+{
+    uint32 HeldTicks;
+
+    if (PoolRecPtr->UseDiagnostics)
     {
-        OS_MutSemTake(PoolRecPtr->MutexId);
+        HeldTicks = CFE_ES_MemPoolTicks() - PoolRecPtr->Diag.LockStartTicks;
+
+        ++PoolRecPtr->Diag.LockCount;
+        PoolRecPtr->Diag.LockTicks += HeldTicks;
+        if (HeldTicks > PoolRecPtr->Diag.MaxLockTicks)
+        {
+            PoolRecPtr->Diag.MaxLockTicks = HeldTicks;
+        }
     }
 
-    /*
-     * Fundamental work is done as a generic routine.
-     *
-     * If successful, this gets an offset, which can then
-     * be translated into a pointer to return to the caller.
-     */
-    Status = CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, &DataOffset, Size);
+    OS_MutSemGive(PoolRecPtr->MutexId);
+}
 
-    /*
-     * Real work ends here.
-     * If pool is mutex-protected, release the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Record the outcome of a buffer request in the pool diagnostics
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_MemPoolDiagCountGet(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t Size, int32 Status,
+                                       uint32 StartTicks)
+{
+    uint16 BucketId;
+    uint32 NumLive;
+
+    CFE_ES_MemPoolDiagRaise(&PoolRecPtr->Diag.MaxGetTicks, CFE_ES_MemPoolTicks() - StartTicks);
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_Atomic_FetchAdd(&PoolRecPtr->Diag.AllocFailCount, 1);
+    }
+    else
     {
-        OS_MutSemGive(PoolRecPtr->MutexId);
+        /* the bucket list does not change after creation, so no lock is needed to find it */
+        BucketId = CFE_ES_GenPoolFindBucket(&PoolRecPtr->Pool, Size);
+        if (BucketId != 0)
+        {
+            NumLive = CFE_Atomic_FetchAdd(&PoolRecPtr->Diag.NumLive[BucketId - 1], 1) + 1;
+            CFE_ES_MemPoolDiagRaise(&PoolRecPtr->Diag.PeakLive[BucketId - 1], NumLive);
+        }
     }
+}
 
-    /* If not successful, return error now */
-    if (Status != CFE_SUCCESS)
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Record a buffer returned to the pool in the pool diagnostics
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_MemPoolDiagCountPut(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t DataSize)
+{
+    uint16 BucketId;
+
+    /* a block is always in the smallest bucket that fits its requested size */
+    BucketId = CFE_ES_GenPoolFindBucket(&PoolRecPtr->Pool, DataSize);
+    if (BucketId != 0)
     {
-        return Status;
+        CFE_Atomic_FetchSub(&PoolRecPtr->Diag.NumLive[BucketId - 1], 1);
     }
+}
 
-    /* Compute the actual buffer address. */
-    *BufPtr = CFE_ES_MEMPOOLBUF_C(PoolRecPtr->BaseAddr + DataOffset);
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Get the block size of the given bucket
+ *
+ *-----------------------------------------------------------------*/
+static size_t CFE_ES_MemPoolBucketSize(CFE_ES_MemPoolRecord_t *PoolRecPtr, uint16 BucketId)
+{
+    CFE_ES_BlockStats_t BlockStats;
 
-    return (int32)Size;
+    CFE_ES_GenPoolGetBucketUsage(&PoolRecPtr->Pool, BucketId, &BlockStats);
+
+    return CFE_ES_MEMOFFSET_TO_SIZET(BlockStats.BlockSize);
 }
 
 /*----------------------------------------------------------------
  *
- * Implemented per public API
- * See description in header file for argument/return detail
+ * Internal helper routine only, not part of API.
+ *
+ * Find the cache of the given task, does not require the pool mutex
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CFE_ES_GetPoolBufInfo(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
+static CFE_ES_MemPoolTaskCache_t *CFE_ES_MemPoolFindTaskCache(CFE_ES_MemPoolRecord_t *PoolRecPtr,
+                                                              CFE_ES_TaskId_t TaskId)
 {
-    int32                   Status;
-    CFE_ES_MemPoolRecord_t *PoolRecPtr;
-    size_t                  DataOffset;
-    size_t                  DataSize;
+    uint32 i;
 
-    if (BufPtr == NULL)
+    if (CFE_RESOURCEID_TEST_DEFINED(TaskId))
     {
-        return CFE_ES_BAD_ARGUMENT;
+        for (i = 0; i < CFE_PLATFORM_ES_POOL_TASK_CACHES; ++i)
+        {
+            if (CFE_RESOURCEID_TEST_EQUAL(PoolRecPtr->TaskCache[i].OwnerTaskId, TaskId))
+            {
+                return &PoolRecPtr->TaskCache[i];
+            }
+        }
     }
 
-    PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(Handle);
+    return NULL;
+}
 
-    /* basic sanity check */
-    if (!CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, Handle))
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Take a block from a task cache, only called by the owning task
+ *
+ * If the block fails validation it is dropped from the cache, so the next
+ * call moves on to the other blocks, and CFE_ES_POOL_BLOCK_INVALID is
+ * returned.  The caller counts it once it holds the pool mutex.
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_MemPoolCachePop(CFE_ES_MemPoolRecord_t *PoolRecPtr, CFE_ES_MemPoolTaskCache_t *CachePtr,
+                                    uint16 BucketId, size_t Size, size_t *DataOffsetPtr)
+{
+    CFE_ES_MemPoolCacheBucket_t *CacheBucketPtr;
+    size_t                       StackTop;
+    uint32                       Count;
+    int32                        Status;
+
+    CacheBucketPtr = &CachePtr->Buckets[BucketId - 1];
+    Count          = CFE_Atomic_Load(&CacheBucketPtr->Count);
+    if (Count == 0)
     {
-        return CFE_ES_ERR_RESOURCEID_NOT_VALID;
+        return CFE_ES_BUFFER_NOT_IN_POOL;
     }
 
-    /*
-     * Real work begins here.
-     * If pool is mutex-protected, take the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    /* Each cached block is a stack of its own, which also checks and flags its descriptor */
+    StackTop = CacheBucketPtr->Offsets[Count - 1];
+    Status   = CFE_ES_GenPoolPopBlock(&PoolRecPtr->Pool, &StackTop, BucketId, Size, DataOffsetPtr);
+    if (Status != CFE_SUCCESS)
     {
-        OS_MutSemTake(PoolRecPtr->MutexId);
+        Status = CFE_ES_POOL_BLOCK_INVALID;
     }
 
-    DataOffset = (cpuaddr)BufPtr - PoolRecPtr->BaseAddr;
+    CFE_Atomic_Store(&CacheBucketPtr->Count, Count - 1);
 
-    Status = CFE_ES_GenPoolGetBlockSize(&PoolRecPtr->Pool, &DataSize, DataOffset);
+    return Status;
+}
 
-    /*
-     * Real work ends here.
-     * If pool is mutex-protected, release the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
-    {
-        OS_MutSemGive(PoolRecPtr->MutexId);
-    }
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Put a block into a task cache, only called by the owning task
+ * The caller must check that the cache is not full
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_MemPoolCachePush(CFE_ES_MemPoolRecord_t *PoolRecPtr, CFE_ES_MemPoolTaskCache_t *CachePtr,
+                                     uint16 BucketId, size_t DataOffset)
+{
+    CFE_ES_MemPoolCacheBucket_t *CacheBucketPtr;
+    size_t                       StackTop;
+    uint32                       Count;
+    int32                        Status;
+
+    CacheBucketPtr = &CachePtr->Buckets[BucketId - 1];
+    Count          = CFE_Atomic_Load(&CacheBucketPtr->Count);
 
+    StackTop = 0;
+    Status   = CFE_ES_GenPoolPushBlock(&PoolRecPtr->Pool, &StackTop, BucketId, DataOffset);
     if (Status == CFE_SUCCESS)
     {
-        /*
-         * Historically this function returns the size of the buffer
-         * as an int32.  This is not workable for large (64 bit) pools.
-         */
-        Status = (int32)DataSize;
+        CacheBucketPtr->Offsets[Count] = DataOffset;
+        CFE_Atomic_Store(&CacheBucketPtr->Count, Count + 1);
     }
 
     return Status;
@@ -543,95 +779,380 @@ CFE_Status_t CFE_ES_GetPoolBufInfo(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_
 
 /*----------------------------------------------------------------
  *
- * Implemented per public API
- * See description in header file for argument/return detail
+ * Internal helper routine only, not part of API.
+ *
+ * Return up to NumBlocks blocks from a task cache to the pool
+ * Pool mutex must be held by the caller
  *
  *-----------------------------------------------------------------*/
-int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
+static void CFE_ES_MemPoolDrainTaskCache(CFE_ES_MemPoolRecord_t *PoolRecPtr, CFE_ES_MemPoolTaskCache_t *CachePtr,
+                                         uint16 BucketId, uint32 NumBlocks)
 {
-    CFE_ES_MemPoolRecord_t *PoolRecPtr;
-    size_t                  DataSize;
-    size_t                  DataOffset;
-    int32                   Status;
+    size_t BlockSize;
+    size_t DataOffset;
+    size_t DataSize;
+    int32  Status;
 
-    if (BufPtr == NULL)
+    BlockSize = CFE_ES_MemPoolBucketSize(PoolRecPtr, BucketId);
+
+    while (NumBlocks > 0)
     {
-        return CFE_ES_BAD_ARGUMENT;
+        Status = CFE_ES_MemPoolCachePop(PoolRecPtr, CachePtr, BucketId, BlockSize, &DataOffset);
+        if (Status == CFE_SUCCESS)
+        {
+            CFE_ES_GenPoolPutBlock(&PoolRecPtr->Pool, &DataSize, DataOffset);
+        }
+        else if (Status == CFE_ES_POOL_BLOCK_INVALID)
+        {
+            ++PoolRecPtr->Pool.ValidationErrorCount;
+        }
+        else
+        {
+            /* cache is empty */
+            break;
+        }
+
+        --NumBlocks;
     }
+}
 
-    PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(Handle);
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Top up a task cache with blocks from the pool
+ * Pool mutex must be held by the caller
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_MemPoolRefillTaskCache(CFE_ES_MemPoolRecord_t *PoolRecPtr, CFE_ES_MemPoolTaskCache_t *CachePtr,
+                                          uint16 BucketId)
+{
+    CFE_ES_MemPoolCacheBucket_t *CacheBucketPtr;
+    size_t                       BlockSize;
+    size_t                       DataOffset;
+    int32                        Status;
 
-    /* basic sanity check */
-    if (!CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, Handle))
-    {
-        CFE_ES_WriteToSysLog("%s: Err:Invalid Memory Handle (0x%08lX).\n", __func__, CFE_RESOURCEID_TO_ULONG(Handle));
+    CacheBucketPtr = &CachePtr->Buckets[BucketId - 1];
+    BlockSize      = CFE_ES_MemPoolBucketSize(PoolRecPtr, BucketId);
 
-        return CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    if (CFE_Atomic_Load(&CacheBucketPtr->Count) >= CFE_ES_MEMPOOL_CACHE_BATCH)
+    {
+        /* still holds blocks after dropping an invalid one */
+        return;
     }
 
     /*
-     * Real work begins here.
-     * If pool is mutex-protected, take the mutex now.
+     * The first block may be newly created, but the rest are only taken
+     * from blocks that were already returned to the pool.  So a refill
+     * never grows the pool by more than the request being served.
+     *
+     * A block obtained under the mutex always passes the push checks.
      */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    Status = CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, &DataOffset, BlockSize);
+    while (Status == CFE_SUCCESS && CFE_ES_MemPoolCachePush(PoolRecPtr, CachePtr, BucketId, DataOffset) == CFE_SUCCESS)
     {
-        OS_MutSemTake(PoolRecPtr->MutexId);
+        if (CFE_Atomic_Load(&CacheBucketPtr->Count) >= CFE_ES_MEMPOOL_CACHE_BATCH)
+        {
+            break;
+        }
+
+        Status = CFE_ES_GenPoolRecyclePoolBlock(&PoolRecPtr->Pool, BucketId, BlockSize, &DataOffset);
     }
+}
 
-    DataOffset = (cpuaddr)BufPtr - PoolRecPtr->BaseAddr;
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Check if a task still exists, for reassigning the cache it owned
+ *
+ * This may take the ES shared data lock, so it must not be called
+ * with the pool mutex held.
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_MemPoolTaskExists(CFE_ES_TaskId_t TaskId)
+{
+    CFE_ES_TaskRecord_t *        TaskRecPtr;
+    CFE_ES_SharedDataReadState_t ReadState;
+    bool                         Result;
 
-    /*
-     * Fundamental work is done as a generic routine.
-     *
-     * If successful, this gets an offset, which can then
-     * be translated into a pointer to return to the caller.
-     */
-    Status = CFE_ES_GenPoolPutBlock(&PoolRecPtr->Pool, &DataSize, DataOffset);
+    TaskRecPtr = CFE_ES_LocateTaskRecordByID(TaskId);
 
-    /*
-     * Real work ends here.
-     * If pool is mutex-protected, release the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    memset(&ReadState, 0, sizeof(ReadState));
+    do
+    {
+        CFE_ES_ReadSharedDataBegin(&ReadState, __func__, __LINE__);
+        Result = CFE_ES_TaskRecordIsMatch(TaskRecPtr, TaskId);
+    } while (CFE_ES_ReadSharedDataRetry(&ReadState, __func__, __LINE__));
+
+    return Result;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Find a cache whose task has exited, before taking the pool mutex
+ *
+ * Outputs the owner found, which the caller checks again under the mutex
+ * in case the cache was reassigned in the meantime.  Returns
+ * CFE_PLATFORM_ES_POOL_TASK_CACHES if there is no such cache.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_MemPoolFindStaleTaskCache(CFE_ES_MemPoolRecord_t *PoolRecPtr, CFE_ES_TaskId_t *OwnerTaskIdPtr)
+{
+    CFE_ES_TaskId_t OwnerTaskId;
+    uint32          i;
+
+    for (i = 0; i < CFE_PLATFORM_ES_POOL_TASK_CACHES; ++i)
+    {
+        OwnerTaskId = PoolRecPtr->TaskCache[i].OwnerTaskId;
+        if (CFE_RESOURCEID_TEST_DEFINED(OwnerTaskId) && !CFE_ES_MemPoolTaskExists(OwnerTaskId))
+        {
+            *OwnerTaskIdPtr = OwnerTaskId;
+            break;
+        }
+    }
+
+    return i;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Assign a cache to the given task, if one is available
+ * Pool mutex must be held by the caller
+ *
+ * StaleIdx and StaleTaskId are from CFE_ES_MemPoolFindStaleTaskCache(),
+ * called before taking the mutex.
+ *
+ *-----------------------------------------------------------------*/
+static CFE_ES_MemPoolTaskCache_t *CFE_ES_MemPoolClaimTaskCache(CFE_ES_MemPoolRecord_t *PoolRecPtr,
+                                                               CFE_ES_TaskId_t TaskId, uint32 StaleIdx,
+                                                               CFE_ES_TaskId_t StaleTaskId)
+{
+    CFE_ES_MemPoolTaskCache_t *CachePtr;
+    uint32                     i;
+    uint16                     BucketId;
+
+    if (!CFE_RESOURCEID_TEST_DEFINED(TaskId))
+    {
+        /* not called from a CFE task, no cache */
+        return NULL;
+    }
+
+    CachePtr = NULL;
+    for (i = 0; i < CFE_PLATFORM_ES_POOL_TASK_CACHES; ++i)
     {
-        OS_MutSemGive(PoolRecPtr->MutexId);
+        if (!CFE_RESOURCEID_TEST_DEFINED(PoolRecPtr->TaskCache[i].OwnerTaskId))
+        {
+            CachePtr = &PoolRecPtr->TaskCache[i];
+            break;
+        }
     }
 
     /*
-     * If successful then modify return code to be
-     * the size of the original buffer that was put (backward compatible)
-     *
-     * Otherwise if not successful, log the relevant detail
+     * If all caches are in use, take over one whose task has exited,
+     * unless another task already did.  The blocks it still holds go
+     * back to the pool first.
      */
-    if (Status == CFE_SUCCESS)
+    if (CachePtr == NULL && StaleIdx < CFE_PLATFORM_ES_POOL_TASK_CACHES &&
+        CFE_RESOURCEID_TEST_EQUAL(PoolRecPtr->TaskCache[StaleIdx].OwnerTaskId, StaleTaskId))
     {
-        Status = (int32)DataSize;
+        CachePtr = &PoolRecPtr->TaskCache[StaleIdx];
+        for (BucketId = 1; BucketId <= PoolRecPtr->Pool.NumBuckets; ++BucketId)
+        {
+            CFE_ES_MemPoolDrainTaskCache(PoolRecPtr, CachePtr, BucketId, CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH);
+        }
     }
-    else if (Status == CFE_ES_POOL_BLOCK_INVALID)
+
+    if (CachePtr != NULL)
     {
-        CFE_ES_WriteToSysLog("%s: Err:Deallocating invalid or corrupt memory block @ 0x%08lX\n", __func__,
-                             (unsigned long)BufPtr);
+        CachePtr->OwnerTaskId = TaskId;
     }
-    else if (Status == CFE_ES_BUFFER_NOT_IN_POOL)
+
+    return CachePtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Implement CFE_ES_GetPoolBuf() for pools with task caches
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_MemPoolCacheGetBlock(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t *DataOffsetPtr, size_t Size)
+{
+    CFE_ES_MemPoolTaskCache_t *CachePtr;
+    CFE_ES_TaskId_t            TaskId;
+    CFE_ES_TaskId_t            StaleTaskId;
+    uint32                     StaleIdx;
+    uint16                     BucketId;
+    int32                      Status;
+
+    /* If not called from a CFE task this outputs an undefined ID, which has no cache */
+    CFE_ES_GetTaskID(&TaskId);
+
+    CachePtr    = CFE_ES_MemPoolFindTaskCache(PoolRecPtr, TaskId);
+    BucketId    = CFE_ES_GenPoolFindBucket(&PoolRecPtr->Pool, Size);
+    StaleIdx    = CFE_PLATFORM_ES_POOL_TASK_CACHES;
+    StaleTaskId = CFE_ES_TASKID_UNDEFINED;
+    Status      = CFE_ES_BUFFER_NOT_IN_POOL;
+
+    if (CachePtr != NULL && BucketId != 0)
     {
-        CFE_ES_WriteToSysLog("%s: Err:Bad offset(%lu) outside pool boundary\n", __func__, (unsigned long)DataOffset);
+        /* Common case: the calling task already holds a free block of this size */
+        Status = CFE_ES_MemPoolCachePop(PoolRecPtr, CachePtr, BucketId, Size, DataOffsetPtr);
+        if (Status == CFE_SUCCESS)
+        {
+            return CFE_SUCCESS;
+        }
+    }
+    else if (BucketId != 0 && CFE_RESOURCEID_TEST_DEFINED(TaskId))
+    {
+        /* Task records are checked before the pool mutex is taken, see CFE_ES_MemPoolTaskExists() */
+        StaleIdx = CFE_ES_MemPoolFindStaleTaskCache(PoolRecPtr, &StaleTaskId);
+    }
+
+    CFE_ES_MemPoolLock(PoolRecPtr);
+
+    if (Status == CFE_ES_POOL_BLOCK_INVALID)
+    {
+        ++PoolRecPtr->Pool.ValidationErrorCount;
+    }
+
+    if (BucketId != 0)
+    {
+        if (CachePtr == NULL)
+        {
+            CachePtr = CFE_ES_MemPoolClaimTaskCache(PoolRecPtr, TaskId, StaleIdx, StaleTaskId);
+        }
+        if (CachePtr != NULL)
+        {
+            CFE_ES_MemPoolRefillTaskCache(PoolRecPtr, CachePtr, BucketId);
+            Status = CFE_ES_MemPoolCachePop(PoolRecPtr, CachePtr, BucketId, Size, DataOffsetPtr);
+            if (Status == CFE_ES_POOL_BLOCK_INVALID)
+            {
+                ++PoolRecPtr->Pool.ValidationErrorCount;
+            }
+        }
+    }
+
+    if (CachePtr == NULL || Status != CFE_SUCCESS)
+    {
+        /* No cache, or the pool is out of blocks; this reports the error as usual */
+        Status = CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, DataOffsetPtr, Size);
+    }
+
+    CFE_ES_MemPoolUnlock(PoolRecPtr);
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Implement CFE_ES_PutPoolBuf() for pools with task caches
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_MemPoolCachePutBlock(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t *DataSizePtr, size_t DataOffset)
+{
+    CFE_ES_MemPoolTaskCache_t *  CachePtr;
+    CFE_ES_MemPoolCacheBucket_t *CacheBucketPtr;
+    CFE_ES_TaskId_t              TaskId;
+    uint16                       BucketId;
+    uint32                       Count;
+    int32                        Status;
+
+    CFE_ES_GetTaskID(&TaskId);
+
+    CachePtr       = CFE_ES_MemPoolFindTaskCache(PoolRecPtr, TaskId);
+    CacheBucketPtr = NULL;
+    BucketId       = 0;
+    Count          = 0;
+
+    if (CachePtr != NULL && CFE_ES_GenPoolGetBlockSize(&PoolRecPtr->Pool, DataSizePtr, DataOffset) == CFE_SUCCESS)
+    {
+        /* a block is always in the smallest bucket that fits its requested size */
+        BucketId = CFE_ES_GenPoolFindBucket(&PoolRecPtr->Pool, *DataSizePtr);
+    }
+
+    if (BucketId != 0)
+    {
+        CacheBucketPtr = &CachePtr->Buckets[BucketId - 1];
+        Count          = CFE_Atomic_Load(&CacheBucketPtr->Count);
+
+        /* Common case: keep the block in the calling task's cache */
+        if (Count < CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH &&
+            CFE_ES_MemPoolCachePush(PoolRecPtr, CachePtr, BucketId, DataOffset) == CFE_SUCCESS)
+        {
+            return CFE_SUCCESS;
+        }
+    }
+
+    CFE_ES_MemPoolLock(PoolRecPtr);
+
+    if (CacheBucketPtr != NULL && Count >= CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH)
+    {
+        CFE_ES_MemPoolDrainTaskCache(PoolRecPtr, CachePtr, BucketId, CFE_ES_MEMPOOL_CACHE_BATCH);
     }
 
+    /* This also handles and counts any invalid blocks */
+    Status = CFE_ES_GenPoolPutBlock(&PoolRecPtr->Pool, DataSizePtr, DataOffset);
+
+    CFE_ES_MemPoolUnlock(PoolRecPtr);
+
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Count the free blocks of the given bucket held in task caches
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_MemPoolCachedBlocks(CFE_ES_MemPoolRecord_t *PoolRecPtr, uint16 BucketId)
+{
+    uint32 i;
+    uint32 Count;
+
+    Count = 0;
+    for (i = 0; i < CFE_PLATFORM_ES_POOL_TASK_CACHES; ++i)
+    {
+        Count += CFE_Atomic_Load(&PoolRecPtr->TaskCache[i].Buckets[BucketId - 1].Count);
+    }
+
+    return Count;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr, CFE_ES_MemHandle_t Handle)
+int32 CFE_ES_GetPoolBuf(CFE_ES_MemPoolBuf_t *BufPtr, CFE_ES_MemHandle_t Handle, size_t Size)
+{
+    return CFE_ES_GetPoolBufForCaller(BufPtr, Handle, Size, CFE_ES_CALLER_ADDRESS());
+}
+
+/*----------------------------------------------------------------
+ *
+ * CFE core internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GetPoolBufForCaller(CFE_ES_MemPoolBuf_t *BufPtr, CFE_ES_MemHandle_t Handle, size_t Size,
+                                 cpuaddr CallerAddr)
 {
+    int32                   Status;
     CFE_ES_AppId_t          AppId;
     CFE_ES_MemPoolRecord_t *PoolRecPtr;
-    uint16                  NumBuckets;
-    uint16                  Idx;
+    size_t                  DataOffset;
+    uint32                  StartTicks;
 
     if (BufPtr == NULL)
     {
@@ -649,78 +1170,998 @@ CFE_Status_t CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr, CFE_ES_MemHan
         return CFE_ES_ERR_RESOURCEID_NOT_VALID;
     }
 
-    /*
-     * Real work begins here.
-     * If pool is mutex-protected, take the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    StartTicks = 0;
+    if (PoolRecPtr->UseDiagnostics)
     {
-        OS_MutSemTake(PoolRecPtr->MutexId);
+        StartTicks = CFE_ES_MemPoolTicks();
     }
 
-    /*
-     * Obtain the free and total byte count
-     */
-    CFE_ES_GenPoolGetUsage(&PoolRecPtr->Pool, &BufPtr->NumFreeBytes, &BufPtr->PoolSize);
-
-    /*
-     * Obtain the allocation and validation error counts
-     */
-    CFE_ES_GenPoolGetCounts(&PoolRecPtr->Pool, &NumBuckets, &BufPtr->NumBlocksRequested, &BufPtr->CheckErrCtr);
-
-    for (Idx = 0; Idx < CFE_MISSION_ES_POOL_MAX_BUCKETS; ++Idx)
+    if (PoolRecPtr->UseTaskCache)
     {
-        CFE_ES_GenPoolGetBucketUsage(&PoolRecPtr->Pool, NumBuckets, &BufPtr->BlockStats[Idx]);
+        /* Served from the calling task's cache, only takes the mutex when needed */
+        Status = CFE_ES_MemPoolCacheGetBlock(PoolRecPtr, &DataOffset, Size);
+    }
+    else
+    {
+        /*
+         * Real work begins here.
+         * If pool is mutex-protected, take the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            CFE_ES_MemPoolLock(PoolRecPtr);
+        }
 
-        if (NumBuckets > 0)
+        /*
+         * Fundamental work is done as a generic routine.
+         *
+         * If successful, this gets an offset, which can then
+         * be translated into a pointer to return to the caller.
+         */
+        Status = CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, &DataOffset, Size);
+
+        /*
+         * Real work ends here.
+         * If pool is mutex-protected, release the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
         {
-            --NumBuckets;
+            CFE_ES_MemPoolUnlock(PoolRecPtr);
         }
     }
 
-    /*
-     * Real work ends here.
-     * If pool is mutex-protected, release the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    if (PoolRecPtr->UseDiagnostics)
     {
-        OS_MutSemGive(PoolRecPtr->MutexId);
+        CFE_ES_MemPoolDiagCountGet(PoolRecPtr, Size, Status, StartTicks);
     }
 
-    return CFE_SUCCESS;
+    /* If not successful, return error now */
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    CFE_Atomic_FetchAdd(&PoolRecPtr->RequestCount, 1);
+
+    /* Compute the actual buffer address. */
+    *BufPtr = CFE_ES_MEMPOOLBUF_C(PoolRecPtr->BaseAddr + DataOffset);
+
+#ifdef CFE_ES_POOL_ALLOC_TRACKING_ENABLED
+    CFE_ES_PoolAllocTrackAdd(Handle, PoolRecPtr->BaseAddr + DataOffset, Size, CallerAddr);
+#else
+    (void)CallerAddr;
+#endif
+
+    return (int32)Size;
 }
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
+ * Implemented per public API
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-bool CFE_ES_ValidateHandle(CFE_ES_MemHandle_t Handle)
+CFE_Status_t CFE_ES_GetPoolBufInfo(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
 {
+    int32                   Status;
     CFE_ES_MemPoolRecord_t *PoolRecPtr;
-    CFE_ES_MemOffset_t      TotalSize;
+    size_t                  DataOffset;
+    size_t                  DataSize;
 
-    /* Test #1) Handle must be valid */
-    PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(Handle);
-    if (!CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, Handle))
+    if (BufPtr == NULL)
     {
-        return false;
+        return CFE_ES_BAD_ARGUMENT;
     }
 
-    /* Test #2) Check critical internal fields are within reason */
-    if (!CFE_ES_GenPoolValidateState(&PoolRecPtr->Pool))
+    PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(Handle);
+
+    /* basic sanity check */
+    if (!CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, Handle))
     {
-        return false;
+        return CFE_ES_ERR_RESOURCEID_NOT_VALID;
     }
 
-    /* Test #3) Check memory address in PSP (allows both RAM and EEPROM) */
-    CFE_ES_GenPoolGetUsage(&PoolRecPtr->Pool, NULL, &TotalSize);
-    if (CFE_PSP_MemValidateRange(PoolRecPtr->BaseAddr, CFE_ES_MEMOFFSET_TO_SIZET(TotalSize), CFE_PSP_MEM_ANY) !=
-        CFE_PSP_SUCCESS)
+    /*
+     * Real work begins here.
+     * If pool is mutex-protected, take the mutex now.
+     */
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
     {
-        return false;
+        CFE_ES_MemPoolLock(PoolRecPtr);
     }
 
-    return true;
-}
+    DataOffset = (cpuaddr)BufPtr - PoolRecPtr->BaseAddr;
+
+    Status = CFE_ES_GenPoolGetBlockSize(&PoolRecPtr->Pool, &DataSize, DataOffset);
+
+    /*
+     * Real work ends here.
+     * If pool is mutex-protected, release the mutex now.
+     */
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    {
+        CFE_ES_MemPoolUnlock(PoolRecPtr);
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        /*
+         * Historically this function returns the size of the buffer
+         * as an int32.  This is not workable for large (64 bit) pools.
+         */
+        Status = (int32)DataSize;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
+{
+    CFE_ES_MemPoolRecord_t *PoolRecPtr;
+    size_t                  DataSize;
+    size_t                  DataOffset;
+    int32                   Status;
+#ifdef CFE_ES_POOL_ALLOC_TRACKING_ENABLED
+    CFE_ES_PoolAllocTrackEntry_t TrackEntry;
+    bool                         IsTracked;
+#endif
+
+    if (BufPtr == NULL)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(Handle);
+
+    /* basic sanity check */
+    if (!CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, Handle))
+    {
+        CFE_ES_WriteToSysLog("%s: Err:Invalid Memory Handle (0x%08lX).\n", __func__, CFE_RESOURCEID_TO_ULONG(Handle));
+
+        return CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    DataOffset = (cpuaddr)BufPtr - PoolRecPtr->BaseAddr;
+
+#ifdef CFE_ES_POOL_ALLOC_TRACKING_ENABLED
+    /*
+     * Forget the block before returning it, as another task may get it
+     * again and record it right after.
+     */
+    IsTracked = CFE_ES_PoolAllocTrackRemove((cpuaddr)BufPtr, &TrackEntry);
+#endif
+
+    if (PoolRecPtr->UseTaskCache)
+    {
+        /* Kept in the calling task's cache, only takes the mutex when needed */
+        Status = CFE_ES_MemPoolCachePutBlock(PoolRecPtr, &DataSize, DataOffset);
+    }
+    else
+    {
+        /*
+         * Real work begins here.
+         * If pool is mutex-protected, take the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            CFE_ES_MemPoolLock(PoolRecPtr);
+        }
+
+        /*
+         * Fundamental work is done as a generic routine.
+         *
+         * If successful, this gets an offset, which can then
+         * be translated into a pointer to return to the caller.
+         */
+        Status = CFE_ES_GenPoolPutBlock(&PoolRecPtr->Pool, &DataSize, DataOffset);
+
+        /*
+         * Real work ends here.
+         * If pool is mutex-protected, release the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            CFE_ES_MemPoolUnlock(PoolRecPtr);
+        }
+    }
+
+#ifdef CFE_ES_POOL_ALLOC_TRACKING_ENABLED
+    if (Status != CFE_SUCCESS && IsTracked)
+    {
+        /* The block was not returned after all */
+        CFE_ES_PoolAllocTrackRestore(&TrackEntry);
+    }
+#endif
+
+    /*
+     * If successful then modify return code to be
+     * the size of the original buffer that was put (backward compatible)
+     *
+     * Otherwise if not successful, log the relevant detail
+     */
+    if (Status == CFE_SUCCESS)
+    {
+        if (PoolRecPtr->UseDiagnostics)
+        {
+            CFE_ES_MemPoolDiagCountPut(PoolRecPtr, DataSize);
+        }
+
+        Status = (int32)DataSize;
+    }
+    else if (Status == CFE_ES_POOL_BLOCK_INVALID)
+    {
+        CFE_ES_WriteToSysLog("%s: Err:Deallocating invalid or corrupt memory block @ 0x%08lX\n", __func__,
+                             (unsigned long)BufPtr);
+    }
+    else if (Status == CFE_ES_BUFFER_NOT_IN_POOL)
+    {
+        CFE_ES_WriteToSysLog("%s: Err:Bad offset(%lu) outside pool boundary\n", __func__, (unsigned long)DataOffset);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr, CFE_ES_MemHandle_t Handle)
+{
+    CFE_ES_AppId_t          AppId;
+    CFE_ES_MemPoolRecord_t *PoolRecPtr;
+    uint16                  NumBuckets;
+    uint16                  Idx;
+
+    if (BufPtr == NULL)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(Handle);
+
+    /* basic sanity check */
+    if (!CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, Handle))
+    {
+        CFE_ES_GetAppID(&AppId);
+        CFE_ES_WriteToSysLog("%s: Err:Bad handle(0x%08lX) AppId=%lu\n", __func__, CFE_RESOURCEID_TO_ULONG(Handle),
+                             CFE_RESOURCEID_TO_ULONG(AppId));
+        return CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    /*
+     * Real work begins here.
+     * If pool is mutex-protected, take the mutex now.
+     */
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    {
+        CFE_ES_MemPoolLock(PoolRecPtr);
+    }
+
+    /*
+     * Obtain the free and total byte count
+     */
+    CFE_ES_GenPoolGetUsage(&PoolRecPtr->Pool, &BufPtr->NumFreeBytes, &BufPtr->PoolSize);
+
+    /*
+     * Obtain the request and validation error counts
+     * (the generic pool only counts the blocks it created)
+     */
+    CFE_ES_GenPoolGetCounts(&PoolRecPtr->Pool, &NumBuckets, NULL, &BufPtr->CheckErrCtr);
+    BufPtr->NumBlocksRequested = CFE_Atomic_Load(&PoolRecPtr->RequestCount);
+
+    for (Idx = 0; Idx < CFE_MISSION_ES_POOL_MAX_BUCKETS; ++Idx)
+    {
+        CFE_ES_GenPoolGetBucketUsage(&PoolRecPtr->Pool, NumBuckets, &BufPtr->BlockStats[Idx]);
+
+        if (NumBuckets > 0)
+        {
+            if (PoolRecPtr->UseTaskCache)
+            {
+                /* The pool counts blocks held in task caches as allocated, but they are free */
+                BufPtr->BlockStats[Idx].NumFree += CFE_ES_MemPoolCachedBlocks(PoolRecPtr, NumBuckets);
+            }
+
+            --NumBuckets;
+        }
+    }
+
+    /*
+     * Real work ends here.
+     * If pool is mutex-protected, release the mutex now.
+     */
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    {
+        CFE_ES_MemPoolUnlock(PoolRecPtr);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_GetMemPoolDiag(CFE_ES_MemPoolDiag_t *BufPtr, CFE_ES_MemHandle_t Handle)
+{
+    CFE_ES_MemPoolRecord_t *PoolRecPtr;
+    CFE_ES_BlockStats_t     BlockStats;
+    size_t                  TotalFree;
+    size_t                  LargestFree;
+    uint16                  NumBuckets;
+    uint16                  Idx;
+
+    if (BufPtr == NULL)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(Handle);
+
+    /* basic sanity check */
+    if (!CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, Handle))
+    {
+        return CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    memset(BufPtr, 0, sizeof(*BufPtr));
+
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    {
+        CFE_ES_MemPoolLock(PoolRecPtr);
+    }
+
+    CFE_ES_GenPoolGetFreeSpace(&PoolRecPtr->Pool, &TotalFree, &LargestFree);
+    CFE_ES_GenPoolGetCounts(&PoolRecPtr->Pool, &NumBuckets, NULL, NULL);
+
+    BufPtr->TotalFreeBytes   = CFE_ES_MEMOFFSET_C(TotalFree);
+    BufPtr->LargestFreeBytes = CFE_ES_MEMOFFSET_C(LargestFree);
+    if (TotalFree > 0)
+    {
+        BufPtr->FragmentationPerMille = 1000 - (uint16)(((uint64)LargestFree * 1000) / TotalFree);
+    }
+
+    if (PoolRecPtr->UseDiagnostics)
+    {
+        BufPtr->DiagEnabled    = true;
+        BufPtr->AllocFailCount = CFE_Atomic_Load(&PoolRecPtr->Diag.AllocFailCount);
+        BufPtr->MaxGetTicks    = CFE_Atomic_Load(&PoolRecPtr->Diag.MaxGetTicks);
+        BufPtr->LockCount      = PoolRecPtr->Diag.LockCount;
+        BufPtr->LockTicks      = PoolRecPtr->Diag.LockTicks;
+        BufPtr->MaxLockTicks   = PoolRecPtr->Diag.MaxLockTicks;
+    }
+
+    /* Same order as the block stats of CFE_ES_GetMemPoolStats() */
+    for (Idx = 0; Idx < CFE_MISSION_ES_POOL_MAX_BUCKETS && NumBuckets > 0; ++Idx)
+    {
+        CFE_ES_GenPoolGetBucketUsage(&PoolRecPtr->Pool, NumBuckets, &BlockStats);
+        BufPtr->BlockDiag[Idx].BlockSize = BlockStats.BlockSize;
+
+        if (PoolRecPtr->UseDiagnostics)
+        {
+            BufPtr->BlockDiag[Idx].NumLive  = CFE_Atomic_Load(&PoolRecPtr->Diag.NumLive[NumBuckets - 1]);
+            BufPtr->BlockDiag[Idx].PeakLive = CFE_Atomic_Load(&PoolRecPtr->Diag.PeakLive[NumBuckets - 1]);
+        }
+
+        --NumBuckets;
+    }
+
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    {
+        CFE_ES_MemPoolUnlock(PoolRecPtr);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_BackgroundPoolStatsFileDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize)
+{
+    CFE_ES_BackgroundPoolStatsDumpGlobal_t *BgFilePtr;
+    CFE_ES_MemPoolDumpRec_t *               FileBufferPtr;
+    CFE_ES_MemPoolRecord_t *                PoolRecPtr;
+    CFE_ES_MemHandle_t                      PoolId;
+
+    BgFilePtr     = (CFE_ES_BackgroundPoolStatsDumpGlobal_t *)Meta;
+    FileBufferPtr = &BgFilePtr->EntryBuffer;
+    PoolId        = CFE_ES_MEMHANDLE_UNDEFINED;
+
+    /* First wipe the buffer before re-use */
+    memset(FileBufferPtr, 0, sizeof(*FileBufferPtr));
+
+    if (RecordNum < CFE_PLATFORM_ES_MAX_MEMORY_POOLS)
+    {
+        PoolRecPtr = &CFE_ES_Global.MemPoolTable[RecordNum];
+
+        CFE_ES_LockSharedData(__func__, __LINE__);
+
+        if (CFE_ES_MemPoolRecordIsUsed(PoolRecPtr))
+        {
+            PoolId                    = CFE_ES_MemPoolRecordGetID(PoolRecPtr);
+            FileBufferPtr->OwnerAppId = PoolRecPtr->OwnerAppID;
+        }
+
+        CFE_ES_UnlockSharedData(__func__, __LINE__);
+    }
+
+    /*
+     * The pool may have been deleted since, in which case the lookups fail
+     * and the entry is skipped like any unused one.
+     */
+    if (CFE_RESOURCEID_TEST_DEFINED(PoolId) &&
+        CFE_ES_GetMemPoolStats(&FileBufferPtr->PoolStats, PoolId) == CFE_SUCCESS &&
+        CFE_ES_GetMemPoolDiag(&FileBufferPtr->PoolDiag, PoolId) == CFE_SUCCESS)
+    {
+        FileBufferPtr->PoolHandle = PoolId;
+
+        *Buffer  = FileBufferPtr;
+        *BufSize = sizeof(*FileBufferPtr);
+    }
+    else
+    {
+        *Buffer  = NULL;
+        *BufSize = 0;
+    }
+
+    /* Check for EOF (last entry)  */
+    return (RecordNum >= (CFE_PLATFORM_ES_MAX_MEMORY_POOLS - 1));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_BackgroundPoolStatsFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status,
+                                                uint32 RecordNum, size_t BlockSize, size_t Position)
+{
+    CFE_ES_BackgroundPoolStatsDumpGlobal_t *BgFilePtr;
+
+    BgFilePtr = (CFE_ES_BackgroundPoolStatsDumpGlobal_t *)Meta;
+
+    /* Note that this runs in the context of ES background task (file writer background job) */
+    switch (Event)
+    {
+        case CFE_FS_FileWriteEvent_COMPLETE:
+            CFE_EVS_SendEvent(CFE_ES_POOL_STATS_FILE_EID, CFE_EVS_EventType_DEBUG, "%s written:Size=%lu",
+                              BgFilePtr->FileWrite.FileName, (unsigned long)Position);
+            break;
+
+        case CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR:
+        case CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_FILEWRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "File write,byte cnt err,file %s,request=%u,actual=%u", BgFilePtr->FileWrite.FileName,
+                              (int)BlockSize, (int)Status);
+            break;
+
+        case CFE_FS_FileWriteEvent_CREATE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_POOL_STATS_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error creating file %s, RC = %d", BgFilePtr->FileWrite.FileName, (int)Status);
+            break;
+
+        default:
+            /* unhandled event - ignore */
+            break;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_ValidateHandle(CFE_ES_MemHandle_t Handle)
+{
+    CFE_ES_MemPoolRecord_t *PoolRecPtr;
+    CFE_ES_MemOffset_t      TotalSize;
+
+    /* Test #1) Handle must be valid */
+    PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(Handle);
+    if (!CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, Handle))
+    {
+        return false;
+    }
+
+    /* Test #2) Check critical internal fields are within reason */
+    if (!CFE_ES_GenPoolValidateState(&PoolRecPtr->Pool))
+    {
+        return false;
+    }
+
+    /* Test #3) Check memory address in PSP (allows both RAM and EEPROM) */
+    CFE_ES_GenPoolGetUsage(&PoolRecPtr->Pool, NULL, &TotalSize);
+    if (CFE_PSP_MemValidateRange(PoolRecPtr->BaseAddr, CFE_ES_MEMOFFSET_TO_SIZET(TotalSize), CFE_PSP_MEM_ANY) !=
+        CFE_PSP_SUCCESS)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+#ifdef CFE_ES_POOL_ALLOC_TRACKING_ENABLED
+
+/*
+ * Maximum number of leak events sent by one pass of the leak scan, the
+ * rest are reported on the following passes
+ */
+#define CFE_ES_POOL_LEAK_REPORTS_PER_SCAN 4
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Get the first allocation tracking table slot to probe for a block address
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_PoolAllocTrackHome(cpuaddr BlockAddr)
+{
+    /* Fibonacci hashing, the low address bits are mostly alignment */
+    return ((uint32)(BlockAddr >> 3) * 0x9E3779B1) % CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Clear a used allocation tracking table slot, moving back the rest of
+ * the probe sequence so every entry stays reachable from its home slot.
+ * Must be called with the table mutex held.
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_PoolAllocTrackRemoveAt(CFE_ES_PoolAllocTrackState_t *TrackPtr, uint32 Hole)
+{
+    uint32 Next;
+    uint32 Home;
+    uint32 Count;
+
+    Next = (Hole + 1) % CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES;
+    for (Count = 1; Count < CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES && TrackPtr->Entries[Next].BlockAddr != 0;
+         ++Count)
+    {
+        Home = CFE_ES_PoolAllocTrackHome(TrackPtr->Entries[Next].BlockAddr);
+        if (((Next + CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES - Home) % CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES) >=
+            ((Next + CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES - Hole) % CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES))
+        {
+            TrackPtr->Entries[Hole] = TrackPtr->Entries[Next];
+            Hole                    = Next;
+        }
+
+        Next = (Next + 1) % CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES;
+    }
+
+    memset(&TrackPtr->Entries[Hole], 0, sizeof(TrackPtr->Entries[Hole]));
+    --TrackPtr->NumLive;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PoolAllocTrackInit(void)
+{
+    CFE_ES_PoolAllocTrackState_t *TrackPtr;
+    int32                         OsStatus;
+
+    TrackPtr = &CFE_ES_Global.PoolAllocTrack;
+
+    memset(TrackPtr, 0, sizeof(*TrackPtr));
+
+    OsStatus = OS_MutSemCreate(&TrackPtr->MutexId, "ES_ALLOC_MUTEX", 0);
+    if (OsStatus != OS_SUCCESS)
+    {
+        TrackPtr->MutexId = OS_OBJECT_ID_UNDEFINED;
+        CFE_ES_WriteToSysLog("%s: Pool allocation tracking inactive, mutex create error %ld\n", __func__,
+                             (long)OsStatus);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Store an entry in the allocation tracking table, replacing any entry
+ * of the same block.  Must be called with the table mutex held.
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_PoolAllocTrackInsert(CFE_ES_PoolAllocTrackState_t *TrackPtr,
+                                        const CFE_ES_PoolAllocTrackEntry_t *NewEntryPtr)
+{
+    uint32 Pos;
+
+    if (TrackPtr->NumLive >= CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES)
+    {
+        ++TrackPtr->MissedCount;
+        return;
+    }
+
+    /* There is at least one free slot, so this terminates */
+    Pos = CFE_ES_PoolAllocTrackHome(NewEntryPtr->BlockAddr);
+    while (TrackPtr->Entries[Pos].BlockAddr != 0 && TrackPtr->Entries[Pos].BlockAddr != NewEntryPtr->BlockAddr)
+    {
+        Pos = (Pos + 1) % CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES;
+    }
+
+    if (TrackPtr->Entries[Pos].BlockAddr == 0)
+    {
+        ++TrackPtr->NumLive;
+    }
+
+    TrackPtr->Entries[Pos] = *NewEntryPtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PoolAllocTrackAdd(CFE_ES_MemHandle_t PoolId, cpuaddr BlockAddr, size_t Size, cpuaddr CallerAddr)
+{
+    CFE_ES_PoolAllocTrackState_t *TrackPtr;
+    CFE_ES_PoolAllocTrackEntry_t  NewEntry;
+
+    TrackPtr = &CFE_ES_Global.PoolAllocTrack;
+    if (!OS_ObjectIdDefined(TrackPtr->MutexId))
+    {
+        return;
+    }
+
+    memset(&NewEntry, 0, sizeof(NewEntry));
+    NewEntry.BlockAddr  = BlockAddr;
+    NewEntry.CallerAddr = CallerAddr;
+    NewEntry.PoolId     = PoolId;
+    NewEntry.Size       = Size;
+
+    /* Resolved before taking the table mutex, as this may take the ES shared data lock */
+    if (CFE_ES_GetAppID(&NewEntry.AppId) != CFE_SUCCESS)
+    {
+        NewEntry.AppId = CFE_ES_APPID_UNDEFINED;
+    }
+
+    OS_MutSemTake(TrackPtr->MutexId);
+    CFE_ES_PoolAllocTrackInsert(TrackPtr, &NewEntry);
+    OS_MutSemGive(TrackPtr->MutexId);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_PoolAllocTrackRemove(cpuaddr BlockAddr, CFE_ES_PoolAllocTrackEntry_t *EntryBuf)
+{
+    CFE_ES_PoolAllocTrackState_t *TrackPtr;
+    uint32                        Pos;
+    uint32                        Count;
+    bool                          IsFound;
+
+    TrackPtr = &CFE_ES_Global.PoolAllocTrack;
+    if (!OS_ObjectIdDefined(TrackPtr->MutexId))
+    {
+        return false;
+    }
+
+    IsFound = false;
+
+    OS_MutSemTake(TrackPtr->MutexId);
+
+    Pos = CFE_ES_PoolAllocTrackHome(BlockAddr);
+    for (Count = 0; Count < CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES && TrackPtr->Entries[Pos].BlockAddr != 0;
+         ++Count)
+    {
+        if (TrackPtr->Entries[Pos].BlockAddr == BlockAddr)
+        {
+            *EntryBuf = TrackPtr->Entries[Pos];
+            IsFound   = true;
+            CFE_ES_PoolAllocTrackRemoveAt(TrackPtr, Pos);
+            break;
+        }
+
+        Pos = (Pos + 1) % CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES;
+    }
+
+    OS_MutSemGive(TrackPtr->MutexId);
+
+    return IsFound;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PoolAllocTrackRestore(const CFE_ES_PoolAllocTrackEntry_t *EntryPtr)
+{
+    CFE_ES_PoolAllocTrackState_t *TrackPtr;
+
+    TrackPtr = &CFE_ES_Global.PoolAllocTrack;
+    if (!OS_ObjectIdDefined(TrackPtr->MutexId))
+    {
+        return;
+    }
+
+    OS_MutSemTake(TrackPtr->MutexId);
+    CFE_ES_PoolAllocTrackInsert(TrackPtr, EntryPtr);
+    OS_MutSemGive(TrackPtr->MutexId);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PoolAllocTrackPurge(CFE_ES_MemHandle_t PoolId)
+{
+    CFE_ES_PoolAllocTrackState_t *TrackPtr;
+    uint32                        Pos;
+
+    TrackPtr = &CFE_ES_Global.PoolAllocTrack;
+    if (!OS_ObjectIdDefined(TrackPtr->MutexId))
+    {
+        return;
+    }
+
+    OS_MutSemTake(TrackPtr->MutexId);
+
+    /*
+     * Removing an entry may move a later one into the same slot, so the
+     * slot is checked again before moving on.  Entries that move into slots
+     * already passed belong to other pools.
+     */
+    Pos = 0;
+    while (Pos < CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES)
+    {
+        if (TrackPtr->Entries[Pos].BlockAddr != 0 && CFE_RESOURCEID_TEST_EQUAL(TrackPtr->Entries[Pos].PoolId, PoolId))
+        {
+            CFE_ES_PoolAllocTrackRemoveAt(TrackPtr, Pos);
+        }
+        else
+        {
+            ++Pos;
+        }
+    }
+
+    OS_MutSemGive(TrackPtr->MutexId);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_RunPoolLeakScan(uint32 ElapsedTime, void *Arg)
+{
+    CFE_ES_PoolAllocTrackState_t *TrackPtr;
+    CFE_ES_PoolAllocTrackEntry_t *EntryPtr;
+    CFE_ES_PoolAllocTrackEntry_t  Reports[CFE_ES_POOL_LEAK_REPORTS_PER_SCAN];
+    uint32                        NumReports;
+    uint32                        Idx;
+    bool                          MoreToReport;
+
+    TrackPtr = (CFE_ES_PoolAllocTrackState_t *)Arg;
+    if (CFE_PLATFORM_ES_POOL_LEAK_AGE_MSEC == 0 || !OS_ObjectIdDefined(TrackPtr->MutexId))
+    {
+        return false;
+    }
+
+    NumReports   = 0;
+    MoreToReport = false;
+
+    OS_MutSemTake(TrackPtr->MutexId);
+
+    EntryPtr = TrackPtr->Entries;
+    for (Idx = 0; Idx < CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES; ++Idx)
+    {
+        if (EntryPtr->BlockAddr != 0)
+        {
+            if (EntryPtr->AgeMsec < (0xFFFFFFFF - ElapsedTime))
+            {
+                EntryPtr->AgeMsec += ElapsedTime;
+            }
+            else
+            {
+                EntryPtr->AgeMsec = 0xFFFFFFFF;
+            }
+
+            if (!EntryPtr->Reported && EntryPtr->AgeMsec >= CFE_PLATFORM_ES_POOL_LEAK_AGE_MSEC)
+            {
+                if (NumReports < CFE_ES_POOL_LEAK_REPORTS_PER_SCAN)
+                {
+                    Reports[NumReports] = *EntryPtr;
+                    EntryPtr->Reported  = true;
+                    ++NumReports;
+                }
+                else
+                {
+                    MoreToReport = true;
+                }
+            }
+        }
+
+        ++EntryPtr;
+    }
+
+    OS_MutSemGive(TrackPtr->MutexId);
+
+    /* Sent after releasing the table, as sending an event allocates from the SB pool */
+    for (Idx = 0; Idx < NumReports; ++Idx)
+    {
+        CFE_EVS_SendEvent(CFE_ES_POOL_LEAK_EID, CFE_EVS_EventType_ERROR,
+                          "Pool 0x%08lx block @0x%lx (%lu bytes) held %lu ms, AppId %lu caller 0x%lx",
+                          CFE_RESOURCEID_TO_ULONG(Reports[Idx].PoolId), (unsigned long)Reports[Idx].BlockAddr,
+                          (unsigned long)Reports[Idx].Size, (unsigned long)Reports[Idx].AgeMsec,
+                          CFE_RESOURCEID_TO_ULONG(Reports[Idx].AppId), (unsigned long)Reports[Idx].CallerAddr);
+    }
+
+    return MoreToReport;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Group the tracked blocks by pool, application and caller
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_PoolAllocTrackGroupSites(CFE_ES_BackgroundAllocSitesDumpGlobal_t *StatePtr)
+{
+    CFE_ES_PoolAllocTrackState_t *TrackPtr;
+    CFE_ES_PoolAllocTrackEntry_t *EntryPtr;
+    CFE_ES_PoolAllocSiteRec_t *   SitePtr;
+    uint32                        Idx;
+    uint32                        SiteIdx;
+
+    TrackPtr = &CFE_ES_Global.PoolAllocTrack;
+
+    memset(StatePtr->Sites, 0, sizeof(StatePtr->Sites));
+    StatePtr->NumSites    = 0;
+    StatePtr->MissedCount = 0;
+
+    if (!OS_ObjectIdDefined(TrackPtr->MutexId))
+    {
+        return;
+    }
+
+    OS_MutSemTake(TrackPtr->MutexId);
+
+    StatePtr->MissedCount = TrackPtr->MissedCount;
+
+    EntryPtr = TrackPtr->Entries;
+    for (Idx = 0; Idx < CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES; ++Idx)
+    {
+        if (EntryPtr->BlockAddr != 0)
+        {
+            SitePtr = StatePtr->Sites;
+            for (SiteIdx = 0; SiteIdx < StatePtr->NumSites; ++SiteIdx)
+            {
+                if (CFE_RESOURCEID_TEST_EQUAL(SitePtr->PoolHandle, EntryPtr->PoolId) &&
+                    CFE_RESOURCEID_TEST_EQUAL(SitePtr->AppId, EntryPtr->AppId) &&
+                    CFE_ES_MEMADDRESS_TO_PTR(SitePtr->CallerAddress) == (void *)EntryPtr->CallerAddr)
+                {
+                    break;
+                }
+
+                ++SitePtr;
+            }
+
+            /* There are never more sites than tracked blocks, so this always fits */
+            if (SiteIdx == StatePtr->NumSites)
+            {
+                SitePtr->PoolHandle    = EntryPtr->PoolId;
+                SitePtr->AppId         = EntryPtr->AppId;
+                SitePtr->CallerAddress = CFE_ES_MEMADDRESS_C(EntryPtr->CallerAddr);
+                ++StatePtr->NumSites;
+            }
+
+            ++SitePtr->NumBlocks;
+            SitePtr->TotalBytes = CFE_ES_MEMOFFSET_C(CFE_ES_MEMOFFSET_TO_SIZET(SitePtr->TotalBytes) + EntryPtr->Size);
+            if (SitePtr->MaxAgeMsec < EntryPtr->AgeMsec)
+            {
+                SitePtr->MaxAgeMsec = EntryPtr->AgeMsec;
+            }
+        }
+
+        ++EntryPtr;
+    }
+
+    OS_MutSemGive(TrackPtr->MutexId);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_BackgroundAllocSitesFileDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize)
+{
+    CFE_ES_BackgroundAllocSitesDumpGlobal_t *StatePtr;
+
+    StatePtr = (CFE_ES_BackgroundAllocSitesDumpGlobal_t *)Meta;
+
+    /* Take a consistent snapshot of the sites at the start of the file */
+    if (RecordNum == 0)
+    {
+        CFE_ES_PoolAllocTrackGroupSites(StatePtr);
+    }
+
+    if (RecordNum < StatePtr->NumSites)
+    {
+        *Buffer  = &StatePtr->Sites[RecordNum];
+        *BufSize = sizeof(StatePtr->Sites[RecordNum]);
+    }
+    else
+    {
+        *Buffer  = NULL;
+        *BufSize = 0;
+    }
+
+    /* Check for EOF (last entry)  */
+    return ((RecordNum + 1) >= StatePtr->NumSites);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_BackgroundAllocSitesFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status,
+                                                 uint32 RecordNum, size_t BlockSize, size_t Position)
+{
+    CFE_ES_BackgroundAllocSitesDumpGlobal_t *StatePtr;
+
+    StatePtr = (CFE_ES_BackgroundAllocSitesDumpGlobal_t *)Meta;
+
+    /* Note that this runs in the context of ES background task (file writer background job) */
+    switch (Event)
+    {
+        case CFE_FS_FileWriteEvent_COMPLETE:
+            CFE_EVS_SendEvent(CFE_ES_POOL_ALLOC_SITES_FILE_EID, CFE_EVS_EventType_DEBUG,
+                              "%s written:Size=%lu,Sites=%lu,Untracked=%lu", StatePtr->FileWrite.FileName,
+                              (unsigned long)Position, (unsigned long)StatePtr->NumSites,
+                              (unsigned long)StatePtr->MissedCount);
+            break;
+
+        case CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR:
+        case CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_FILEWRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "File write,byte cnt err,file %s,request=%u,actual=%u", StatePtr->FileWrite.FileName,
+                              (int)BlockSize, (int)Status);
+            break;
+
+        case CFE_FS_FileWriteEvent_CREATE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_POOL_ALLOC_SITES_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error creating file %s, RC = %d", StatePtr->FileWrite.FileName, (int)Status);
+            break;
+
+        default:
+            /* unhandled event - ignore */
+            break;
+    }
+}
+
+#endif /* CFE_ES_POOL_ALLOC_TRACKING_ENABLED */
@@ -33,7 +33,65 @@
 */
 #include "common_types.h"
 #include "cfe_resourceid.h"
+#include "cfe_es_api_typedefs.h"
+#include "cfe_fs_api_typedefs.h"
 #include "cfe_es_generic_pool.h"
+#include "cfe_core_atomic.h"
+
+/*
+ * Whether the pool allocation tracker is built in.  Besides the platform
+ * configuration, the unit tests define CFE_ES_FORCE_POOL_ALLOC_TRACKING so
+ * the tracker is covered whatever the configuration.
+ */
+#if CFE_PLATFORM_ES_POOL_ALLOC_TRACKING || defined(CFE_ES_FORCE_POOL_ALLOC_TRACKING)
+#define CFE_ES_POOL_ALLOC_TRACKING_ENABLED
+#endif
+
+/**
+ * Free blocks of one size held in a task cache
+ *
+ * The blocks are kept in an array rather than linked through their
+ * descriptors, so a corrupt descriptor only loses that one block.
+ */
+typedef struct
+{
+    CFE_Atomic_Uint32_t Count;                                         /**< Number of valid entries in Offsets */
+    size_t              Offsets[CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH]; /**< Free blocks, last one is reused first */
+} CFE_ES_MemPoolCacheBucket_t;
+
+/**
+ * Free blocks of a memory pool held for the exclusive use of one task
+ *
+ * Only the owning task changes the contents, so it can take blocks from
+ * and return blocks to its cache without the pool mutex.  Other contexts
+ * only read the counts, and only take over a cache under the pool mutex
+ * once its owner no longer exists.
+ */
+typedef struct
+{
+    CFE_ES_TaskId_t             OwnerTaskId; /**< Task using this cache, or undefined if unused */
+    CFE_ES_MemPoolCacheBucket_t Buckets[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /**< Indexed by pool bucket ID - 1 */
+} CFE_ES_MemPoolTaskCache_t;
+
+/**
+ * Allocation history of a memory pool, kept if diagnostics are enabled
+ *
+ * The block counts, failure count and request latency are updated by
+ * every request, with or without the pool mutex, so they are atomic.
+ * The lock statistics are only updated while holding the pool mutex.
+ */
+typedef struct
+{
+    CFE_Atomic_Uint32_t NumLive[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];  /**< Indexed by pool bucket ID - 1 */
+    CFE_Atomic_Uint32_t PeakLive[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /**< Indexed by pool bucket ID - 1 */
+    CFE_Atomic_Uint32_t AllocFailCount; /**< Number of failed requests */
+    CFE_Atomic_Uint32_t MaxGetTicks;    /**< Longest request, in timebase ticks */
+
+    uint32 LockStartTicks; /**< Timebase when the pool mutex was taken */
+    uint32 LockCount;      /**< Number of times the pool mutex was held */
+    uint32 LockTicks;      /**< Total time the pool mutex was held */
+    uint32 MaxLockTicks;   /**< Longest time the pool mutex was held */
+} CFE_ES_MemPoolDiagState_t;
 
 typedef struct
 {
@@ -69,8 +127,83 @@ typedef struct
      * Optional Mutex for serializing get/put operations
      */
     osal_id_t MutexId;
+
+    /**
+     * Whether get/put operations go through the task caches
+     */
+    bool UseTaskCache;
+
+    /**
+     * Per-task caches of free blocks, if enabled
+     */
+    CFE_ES_MemPoolTaskCache_t TaskCache[CFE_PLATFORM_ES_POOL_TASK_CACHES];
+
+    /**
+     * Number of successful get requests, including those served from task caches
+     */
+    CFE_Atomic_Uint32_t RequestCount;
+
+    /**
+     * Whether the allocation history below is kept
+     */
+    bool UseDiagnostics;
+
+    /**
+     * Allocation history, if enabled
+     */
+    CFE_ES_MemPoolDiagState_t Diag;
 } CFE_ES_MemPoolRecord_t;
 
+/**
+ * State of a request to write the memory pool statistics file
+ */
+typedef struct
+{
+    CFE_FS_FileWriteMetaData_t FileWrite;   /**< FS state data - must be first */
+    CFE_ES_MemPoolDumpRec_t    EntryBuffer; /**< Temp holding area for record to write */
+} CFE_ES_BackgroundPoolStatsDumpGlobal_t;
+
+/**
+ * A live block in the allocation tracking table, see CFE_PLATFORM_ES_POOL_ALLOC_TRACKING
+ */
+typedef struct
+{
+    cpuaddr            BlockAddr;  /**< Address given to the caller, or 0 if the entry is unused */
+    cpuaddr            CallerAddr; /**< Allocation site, see CFE_ES_GetPoolBufForCaller() */
+    CFE_ES_MemHandle_t PoolId;     /**< Pool the block belongs to */
+    CFE_ES_AppId_t     AppId;      /**< Application that allocated the block */
+    size_t             Size;       /**< Requested size of the block */
+    uint32             AgeMsec;    /**< Time the block has been allocated, as counted by the leak scan */
+    bool               Reported;   /**< Whether the leak scan has already reported this block */
+} CFE_ES_PoolAllocTrackEntry_t;
+
+/**
+ * Allocation tracking table
+ *
+ * This is an open addressing hash table keyed by block address, shared by
+ * all pools and protected by its own mutex.
+ */
+typedef struct
+{
+    osal_id_t                    MutexId;     /**< Protects the table, tracking is inactive if undefined */
+    uint32                       NumLive;     /**< Number of entries in use */
+    uint32                       MissedCount; /**< Allocations that were not tracked because the table was full */
+    CFE_ES_PoolAllocTrackEntry_t Entries[CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES];
+} CFE_ES_PoolAllocTrackState_t;
+
+/**
+ * State of a request to write the allocation sites file
+ *
+ * The live blocks are grouped into sites when the first record is requested.
+ */
+typedef struct
+{
+    CFE_FS_FileWriteMetaData_t FileWrite;   /**< FS state data - must be first */
+    uint32                     NumSites;    /**< Number of valid entries in Sites */
+    uint32                     MissedCount; /**< Untracked allocations at the time of the snapshot */
+    CFE_ES_PoolAllocSiteRec_t  Sites[CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES];
+} CFE_ES_BackgroundAllocSitesDumpGlobal_t;
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Obtain an index value correlating to an ES Memory Pool ID
@@ -241,4 +374,107 @@ static inline bool CFE_ES_MemPoolRecordIsMatch(const CFE_ES_MemPoolRecord_t *Poo
  */
 bool CFE_ES_CheckMemPoolSlotUsed(CFE_ResourceId_t CheckId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Background file write data getter for the memory pool statistics file
+ *
+ * Gets the record of a single memory pool to write to a file.  Unused pool
+ * table entries are skipped.
+ */
+bool CFE_ES_BackgroundPoolStatsFileDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Background file write event handler for the memory pool statistics file
+ *
+ * Report events during writing the memory pool statistics to a file
+ */
+void CFE_ES_BackgroundPoolStatsFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status,
+                                                uint32 RecordNum, size_t BlockSize, size_t Position);
+
+#ifdef CFE_ES_POOL_ALLOC_TRACKING_ENABLED
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Start tracking memory pool allocations
+ *
+ * Creates the mutex of the allocation tracking table.  Tracking stays
+ * inactive if this fails, which is reported to the system log.
+ */
+void CFE_ES_PoolAllocTrackInit(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Record a block that was allocated from a pool
+ *
+ * @param[in]   PoolId      the pool the block was allocated from
+ * @param[in]   BlockAddr   the address given to the caller
+ * @param[in]   Size        the requested size
+ * @param[in]   CallerAddr  the allocation site, see CFE_ES_GetPoolBufForCaller()
+ */
+void CFE_ES_PoolAllocTrackAdd(CFE_ES_MemHandle_t PoolId, cpuaddr BlockAddr, size_t Size, cpuaddr CallerAddr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Forget a block that is being returned to its pool
+ *
+ * This must be called before the block is returned, so it cannot remove
+ * the entry of a later allocation of the same block.
+ *
+ * @param[in]   BlockAddr   the address of the block
+ * @param[out]  EntryBuf    the entry that was removed, for CFE_ES_PoolAllocTrackRestore()
+ *
+ * @returns true if the block was tracked
+ */
+bool CFE_ES_PoolAllocTrackRemove(cpuaddr BlockAddr, CFE_ES_PoolAllocTrackEntry_t *EntryBuf);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Track a block again after it could not be returned to its pool
+ *
+ * @param[in]   EntryPtr    the entry output by CFE_ES_PoolAllocTrackRemove()
+ */
+void CFE_ES_PoolAllocTrackRestore(const CFE_ES_PoolAllocTrackEntry_t *EntryPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Forget all blocks of a pool that is being deleted
+ *
+ * @param[in]   PoolId      the pool being deleted
+ */
+void CFE_ES_PoolAllocTrackPurge(CFE_ES_MemHandle_t PoolId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Background job that reports blocks held for too long
+ *
+ * Ages every tracked block by the time elapsed since the last call, and sends
+ * #CFE_ES_POOL_LEAK_EID once for each block older than #CFE_PLATFORM_ES_POOL_LEAK_AGE_MSEC.
+ *
+ * @param[in]   ElapsedTime  milliseconds since the last call
+ * @param[in]   Arg          the allocation tracking table
+ * @returns true if more blocks are waiting to be reported, false otherwise
+ */
+bool CFE_ES_RunPoolLeakScan(uint32 ElapsedTime, void *Arg);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Background file write data getter for the allocation sites file
+ *
+ * Groups the tracked blocks by site on the first record, then gets one site
+ * per record.
+ */
+bool CFE_ES_BackgroundAllocSitesFileDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Background file write event handler for the allocation sites file
+ *
+ * Report events during writing the allocation sites to a file
+ */
+void CFE_ES_BackgroundAllocSitesFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status,
+                                                 uint32 RecordNum, size_t BlockSize, size_t Position);
+
+#endif
+
 #endif /* CFE_ES_MEMPOOL_H */
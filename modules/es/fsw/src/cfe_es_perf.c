@@ -30,6 +30,70 @@
 #include "cfe_es_module_all.h"
 
 #include <string.h>
+#include <stdio.h>
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Distance from sequence number Base forward to sequence number Seq,
+ * modulo the sequence wrap.  Values of half the modulus or more mean
+ * that Seq actually precedes Base.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_PerfSeqDistance(uint32 Seq, uint32 Base)
+{
+    return (Seq + CFE_ES_PERF_SEQ_MODULUS - Base) % CFE_ES_PERF_SEQ_MODULUS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Number of entries (including the trigger entry itself) that are
+ * recorded after the trigger in the given trigger mode
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_PerfTriggerLimit(uint32 Mode)
+{
+    uint32 Limit;
+
+    if (Mode == CFE_ES_PerfTrigger_START)
+    {
+        Limit = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    }
+    else if (Mode == CFE_ES_PerfTrigger_CENTER)
+    {
+        Limit = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2;
+    }
+    else if (Mode == CFE_ES_PerfTrigger_END)
+    {
+        Limit = 1;
+    }
+    else
+    {
+        /* not a valid mode, so never stop */
+        Limit = CFE_ES_PERF_SEQ_MODULUS / 2;
+    }
+
+    return Limit;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Stop a triggered log once the post-trigger entries are complete.
+ * This only moves TRIGGERED to IDLE, so a late writer from a previous
+ * run cannot stop a log that has since been restarted.
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_PerfLogTriggerDone(CFE_ES_PerfData_t *Perf)
+{
+    uint32 Expected = CFE_ES_PERF_TRIGGERED;
+
+    CFE_Atomic_CompareExchange(&Perf->MetaData.State, &Expected, CFE_ES_PERF_IDLE);
+}
 
 /*----------------------------------------------------------------
  *
@@ -63,7 +127,8 @@ void CFE_ES_SetupPerfVariables(uint32 ResetType)
         ** On a processor reset, just IDLE the data
         ** collection so the ground can dump the data
         */
-        Perf->MetaData.State = CFE_ES_PERF_IDLE;
+        CFE_Atomic_Store(&Perf->MetaData.State, CFE_ES_PERF_IDLE);
+        CFE_ES_UpdatePerfMetaData();
     }
     else
     {
@@ -73,7 +138,10 @@ void CFE_ES_SetupPerfVariables(uint32 ResetType)
         Perf->MetaData.TimerLow32Rollover  = CFE_PSP_GetTimerLow32Rollover();
 
         /* set data collection state to waiting for command state */
-        Perf->MetaData.State                 = CFE_ES_PERF_IDLE;
+        CFE_Atomic_Store(&Perf->MetaData.State, CFE_ES_PERF_IDLE);
+        CFE_Atomic_Store(&Perf->WriteSeq, 0);
+        CFE_Atomic_Store(&Perf->TriggerSeq, CFE_ES_PERF_SEQ_NONE);
+
         Perf->MetaData.Mode                  = CFE_ES_PerfTrigger_START;
         Perf->MetaData.TriggerCount          = 0;
         Perf->MetaData.DataStart             = 0;
@@ -88,6 +156,67 @@ void CFE_ES_SetupPerfVariables(uint32 ResetType)
             Perf->MetaData.TriggerMask[i] = CFE_PLATFORM_ES_PERF_TRIGMASK_INIT;
         }
     }
+
+#ifdef CFE_ES_PERF_MARKER_STATS_ENABLED
+    CFE_ES_ResetPerfStats();
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_UpdatePerfMetaData(void)
+{
+    CFE_ES_PerfData_t *Perf;
+    uint32             EndSeq;
+    uint32             TriggerSeq;
+    uint32             TriggerCount;
+    uint32             Limit;
+    uint32             DataCount;
+
+    /*
+    ** Set the pointer to the data area
+    */
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    EndSeq       = CFE_Atomic_Load(&Perf->WriteSeq);
+    TriggerSeq   = CFE_Atomic_Load(&Perf->TriggerSeq);
+    TriggerCount = 0;
+
+    if (TriggerSeq < CFE_ES_PERF_SEQ_MODULUS)
+    {
+        /* slots claimed beyond the trigger limit were discarded, so do not count them */
+        TriggerCount = CFE_ES_PerfSeqDistance(EndSeq, TriggerSeq);
+        Limit        = CFE_ES_PerfTriggerLimit(Perf->MetaData.Mode);
+        if (TriggerCount > Limit)
+        {
+            TriggerCount = Limit;
+            EndSeq       = (TriggerSeq + Limit) % CFE_ES_PERF_SEQ_MODULUS;
+        }
+    }
+
+    /*
+     * The sequence restarts from 0 when the log is started, so until the buffer
+     * is full it is also the number of entries.  A sequence below the previous
+     * count means it has since wrapped, and the buffer is full.
+     */
+    if (EndSeq < Perf->MetaData.DataCount || EndSeq > CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+    {
+        DataCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    }
+    else
+    {
+        DataCount = EndSeq;
+    }
+
+    Perf->MetaData.DataCount    = DataCount;
+    Perf->MetaData.TriggerCount = TriggerCount;
+    Perf->MetaData.DataEnd      = EndSeq % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    Perf->MetaData.DataStart    = (Perf->MetaData.DataEnd + CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - DataCount) %
+                               CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
 }
 
 /*----------------------------------------------------------------
@@ -141,9 +270,12 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void)
  *-----------------------------------------------------------------*/
 int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
 {
-    const CFE_ES_StartPerfCmd_Payload_t *CmdPtr        = &data->Payload;
-    CFE_ES_PerfDumpGlobal_t *            PerfDumpState = &CFE_ES_Global.BackgroundPerfDumpState;
+    const CFE_ES_StartPerfCmd_Payload_t *CmdPtr          = &data->Payload;
+    CFE_ES_PerfDumpGlobal_t *            PerfDumpState   = &CFE_ES_Global.BackgroundPerfDumpState;
+    CFE_ES_PerfStreamGlobal_t *          PerfStreamState = &CFE_ES_Global.BackgroundPerfStreamState;
     CFE_ES_PerfData_t *                  Perf;
+    uint32                               InitialState;
+    uint32                               i;
 
     /*
     ** Set the pointer to the data area
@@ -152,25 +284,61 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
 
     /* Ensure there is no file write in progress before proceeding */
     if (PerfDumpState->CurrentState == CFE_ES_PerfDumpState_IDLE &&
-        PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE)
+        PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE && !PerfStreamState->Active)
     {
         /* Make sure Trigger Mode is valid */
-        if (CmdPtr->TriggerMode <= CFE_ES_PerfTrigger_END)
+        if (CmdPtr->TriggerMode <= CFE_ES_PerfTrigger_STREAM)
         {
             CFE_ES_Global.TaskData.CommandCounter++;
 
-            /* Taking lock here as this might be changing states from one active mode to another.
-             * In that case, need to make sure that the log is not written to while resetting the counters. */
+            if (CmdPtr->TriggerMode == CFE_ES_PerfTrigger_STREAM)
+            {
+                /* There is no trigger when streaming, everything is recorded until stopped */
+                InitialState = CFE_ES_PERF_TRIGGERED;
+
+                CFE_Atomic_Store(&PerfStreamState->ReadSeq, 0);
+                CFE_Atomic_Store(&PerfStreamState->DropCount, 0);
+                for (i = 0; i < CFE_ES_PERF_STREAM_NUM_CHUNKS; ++i)
+                {
+                    CFE_Atomic_Store(&PerfStreamState->ChunkFill[i], 0);
+                }
+                PerfStreamState->FileDesc     = OS_OBJECT_ID_UNDEFINED;
+                PerfStreamState->FileIndex    = 0;
+                PerfStreamState->FileEntries  = 0;
+                PerfStreamState->TotalEntries = 0;
+            }
+            else
+            {
+                InitialState = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+            }
+
+            /* Taking lock here to keep this from overlapping a dump.  Writers do not take
+             * the lock, so idle the log first in case this is changing from one active mode
+             * to another, then reset the counters and re-arm it. */
             OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+            CFE_Atomic_Store(&Perf->MetaData.State, CFE_ES_PERF_IDLE);
             Perf->MetaData.Mode                  = CmdPtr->TriggerMode;
             Perf->MetaData.TriggerCount          = 0;
             Perf->MetaData.DataStart             = 0;
             Perf->MetaData.DataEnd               = 0;
-            Perf->MetaData.DataCount             = 0;
             Perf->MetaData.InvalidMarkerReported = false;
-            Perf->MetaData.State                 = CFE_ES_PERF_WAITING_FOR_TRIGGER; /* this must be done last */
+            Perf->MetaData.DataCount             = 0;
+            CFE_Atomic_Store(&Perf->WriteSeq, 0);
+            CFE_Atomic_Store(&Perf->TriggerSeq, CFE_ES_PERF_SEQ_NONE);
+            CFE_Atomic_Store(&Perf->MetaData.State, InitialState); /* this must be done last */
             OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
 
+            /*
+             * Only hand the log to the stream job once it is running, so the job never
+             * sees an active stream with the log still idle and takes it as stopped.
+             */
+            if (CmdPtr->TriggerMode == CFE_ES_PerfTrigger_STREAM)
+            {
+                PerfStreamState->StopDelay = false;
+                PerfStreamState->Active    = true;
+                CFE_ES_WakeBackgroundJob(CFE_ES_Global.BackgroundTask.PerfStreamJobNum);
+            }
+
             CFE_EVS_SendEvent(CFE_ES_PERF_STARTCMD_EID, CFE_EVS_EventType_DEBUG,
                               "Start collecting performance data cmd received, trigger mode = %d",
                               (int)CmdPtr->TriggerMode);
@@ -180,7 +348,7 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
             CFE_ES_Global.TaskData.CommandErrorCounter++;
             CFE_EVS_SendEvent(CFE_ES_PERF_STARTCMD_TRIG_ERR_EID, CFE_EVS_EventType_ERROR,
                               "Cannot start collecting performance data, trigger mode (%d) out of range (%d to %d)",
-                              (int)CmdPtr->TriggerMode, (int)CFE_ES_PerfTrigger_START, (int)CFE_ES_PerfTrigger_END);
+                              (int)CmdPtr->TriggerMode, (int)CFE_ES_PerfTrigger_START, (int)CFE_ES_PerfTrigger_STREAM);
         }
     }
     else
@@ -201,8 +369,9 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
  *-----------------------------------------------------------------*/
 int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
 {
-    const CFE_ES_StopPerfCmd_Payload_t *CmdPtr        = &data->Payload;
-    CFE_ES_PerfDumpGlobal_t *           PerfDumpState = &CFE_ES_Global.BackgroundPerfDumpState;
+    const CFE_ES_StopPerfCmd_Payload_t *CmdPtr          = &data->Payload;
+    CFE_ES_PerfDumpGlobal_t *           PerfDumpState   = &CFE_ES_Global.BackgroundPerfDumpState;
+    CFE_ES_PerfStreamGlobal_t *         PerfStreamState = &CFE_ES_Global.BackgroundPerfStreamState;
     CFE_ES_PerfData_t *                 Perf;
     int32                               Status;
 
@@ -211,13 +380,26 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
     */
     Perf = &CFE_ES_Global.ResetDataPtr->Perf;
 
+    if (PerfStreamState->Active)
+    {
+        /* Streaming - there is no dump file, the background job
+         * writes out the remaining entries and closes the last stream file */
+        CFE_Atomic_Store(&Perf->MetaData.State, CFE_ES_PERF_IDLE);
+        CFE_ES_WakeBackgroundJob(CFE_ES_Global.BackgroundTask.PerfStreamJobNum);
+
+        CFE_ES_Global.TaskData.CommandCounter++;
+
+        CFE_EVS_SendEvent(CFE_ES_PERF_STOPCMD_EID, CFE_EVS_EventType_DEBUG,
+                          "Perf Stop Cmd Rcvd, flushing stream files");
+    }
     /* Ensure there is no file write in progress before proceeding */
     /* note - also need to check the PendingState here, in case this command
      * was sent twice in succession and the background task has not awakened yet */
-    if (PerfDumpState->CurrentState == CFE_ES_PerfDumpState_IDLE &&
-        PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE)
+    else if (PerfDumpState->CurrentState == CFE_ES_PerfDumpState_IDLE &&
+             PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE)
     {
-        Perf->MetaData.State = CFE_ES_PERF_IDLE;
+        CFE_Atomic_Store(&Perf->MetaData.State, CFE_ES_PERF_IDLE);
+        CFE_ES_UpdatePerfMetaData();
 
         /* Copy out the string, using default if unspecified */
         Status = CFE_FS_ParseInputFileNameEx(PerfDumpState->DataFileName, CmdPtr->DataFileName,
@@ -229,7 +411,7 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
         if (Status == CFE_SUCCESS)
         {
             PerfDumpState->PendingState = CFE_ES_PerfDumpState_INIT;
-            CFE_ES_BackgroundWakeup();
+            CFE_ES_WakeBackgroundJob(CFE_ES_Global.BackgroundTask.PerfDumpJobNum);
 
             CFE_ES_Global.TaskData.CommandCounter++;
 
@@ -340,6 +522,9 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
 
                 case CFE_ES_PerfDumpState_LOCK_DATA:
                     OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+
+                    /* any writes that were in progress at stop time are now done */
+                    CFE_ES_UpdatePerfMetaData();
                     break;
 
                 case CFE_ES_PerfDumpState_WRITE_FS_HDR:
@@ -479,6 +664,238 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
     return (State->CurrentState != CFE_ES_PerfDumpState_IDLE);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * (Re-)write the file header and metadata at the start of the current
+ * stream file.  Each stream file has the same layout as a perf log dump,
+ * with the entries stored in order from the start of the file.
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_PerfStreamWriteHeaders(CFE_ES_PerfStreamGlobal_t *Stream)
+{
+    CFE_FS_Header_t       FileHdr;
+    CFE_ES_PerfMetaData_t MetaData;
+    int32                 Status;
+
+    /* copied bytewise, as the State member is an atomic type */
+    memcpy(&MetaData, &CFE_ES_Global.ResetDataPtr->Perf.MetaData, sizeof(MetaData));
+    MetaData.TriggerCount = 0;
+    MetaData.DataStart    = 0;
+    MetaData.DataEnd      = Stream->FileEntries;
+    MetaData.DataCount    = Stream->FileEntries;
+
+    CFE_FS_InitHeader(&FileHdr, CFE_ES_PERF_LOG_DESC, CFE_FS_SubType_ES_PERFDATA);
+    FileHdr.Length = sizeof(CFE_ES_PerfMetaData_t) + (Stream->FileEntries * sizeof(CFE_ES_PerfDataEntry_t));
+
+    /* note this always writes at the start of the file */
+    Status = CFE_FS_WriteHeader(Stream->FileDesc, &FileHdr);
+    if (Status == sizeof(CFE_FS_Header_t))
+    {
+        Status = OS_write(Stream->FileDesc, &MetaData, sizeof(MetaData));
+        if (Status == sizeof(MetaData))
+        {
+            return true;
+        }
+    }
+
+    CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Error writing stream file %s header, RC = %ld", Stream->DataFileName, (long)Status);
+
+    return false;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Create the next stream file in the rotation
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_PerfStreamOpenFile(CFE_ES_PerfStreamGlobal_t *Stream)
+{
+    int32 OsStatus;
+
+    snprintf(Stream->DataFileName, sizeof(Stream->DataFileName), "%s_%02u.dat",
+             CFE_PLATFORM_ES_PERF_STREAM_FILE_BASENAME, (unsigned int)Stream->FileIndex);
+
+    OsStatus = OS_OpenCreate(&Stream->FileDesc, Stream->DataFileName, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                             OS_WRITE_ONLY);
+    if (OsStatus != OS_SUCCESS)
+    {
+        Stream->FileDesc = OS_OBJECT_ID_UNDEFINED;
+        CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error creating stream file %s, RC = %ld", Stream->DataFileName, (long)OsStatus);
+        return false;
+    }
+
+    /* the header is written again with the final entry count when the file is closed */
+    Stream->FileEntries = 0;
+    return CFE_ES_PerfStreamWriteHeaders(Stream);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Finalize and close the current stream file
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_PerfStreamCloseFile(CFE_ES_PerfStreamGlobal_t *Stream)
+{
+    bool Result;
+
+    Result = CFE_ES_PerfStreamWriteHeaders(Stream);
+
+    OS_close(Stream->FileDesc);
+    Stream->FileDesc = OS_OBJECT_ID_UNDEFINED;
+
+    return Result;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_RunPerfLogStream(uint32 ElapsedTime, void *Arg)
+{
+    CFE_ES_PerfStreamGlobal_t *Stream = (CFE_ES_PerfStreamGlobal_t *)Arg;
+    CFE_ES_PerfData_t *        Perf;
+    uint32                     ReadSeq;
+    uint32                     Chunk;
+    uint32                     Count;
+    uint32                     NumChunks;
+    size_t                     BlockSize;
+    int32                      OsStatus;
+    bool                       Flush;
+    bool                       Success;
+
+    if (!Stream->Active)
+    {
+        return false;
+    }
+
+    /*
+    ** Set the pointer to the data area
+    */
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    /*
+     * Once the log is stopped, yield once so any writer that saw it as
+     * active can finish, then write out what is left of the last chunk.
+     */
+    Flush = false;
+    if (CFE_Atomic_Load(&Perf->MetaData.State) == CFE_ES_PERF_IDLE)
+    {
+        if (!Stream->StopDelay)
+        {
+            Stream->StopDelay = true;
+            return true;
+        }
+
+        Flush = true;
+    }
+
+    /* At most every chunk in the buffer plus the check for a partial one */
+    Success = true;
+    for (NumChunks = 0; Success && NumChunks <= CFE_ES_PERF_STREAM_NUM_CHUNKS; ++NumChunks)
+    {
+        ReadSeq = CFE_Atomic_Load(&Stream->ReadSeq);
+        Chunk   = (ReadSeq % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE) / CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES;
+        Count   = CFE_Atomic_Load(&Stream->ChunkFill[Chunk]);
+
+        if (Count < CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES)
+        {
+            if (!Flush)
+            {
+                break;
+            }
+
+            /* stopped, so every slot claimed so far has been written */
+            Count = CFE_ES_PerfSeqDistance(CFE_Atomic_Load(&Perf->WriteSeq), ReadSeq);
+            if (Count > CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES)
+            {
+                Count = CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES;
+            }
+            if (Count == 0)
+            {
+                break;
+            }
+        }
+
+        if (!OS_ObjectIdDefined(Stream->FileDesc))
+        {
+            Success = CFE_ES_PerfStreamOpenFile(Stream);
+            if (!Success)
+            {
+                break;
+            }
+        }
+
+        /* chunks never straddle the end of the buffer, so this is one contiguous block */
+        BlockSize = Count * sizeof(CFE_ES_PerfDataEntry_t);
+        OsStatus  = OS_write(Stream->FileDesc, &Perf->DataBuffer[ReadSeq % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE],
+                            BlockSize);
+        if (OsStatus != (long)BlockSize)
+        {
+            CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error writing stream file %s, RC = %ld", Stream->DataFileName, (long)OsStatus);
+            Success = false;
+            break;
+        }
+
+        Stream->FileEntries += Count;
+        Stream->TotalEntries += Count;
+
+        /* release the chunk back to the writers - the count must be cleared first */
+        CFE_Atomic_Store(&Stream->ChunkFill[Chunk], 0);
+        CFE_Atomic_Store(&Stream->ReadSeq, (ReadSeq + Count) % CFE_ES_PERF_SEQ_MODULUS);
+
+        if (Stream->FileEntries >= CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES)
+        {
+            Success = CFE_ES_PerfStreamCloseFile(Stream);
+
+            CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_FILE_EID, CFE_EVS_EventType_DEBUG,
+                              "%s written:EntryCount=%lu", Stream->DataFileName, (unsigned long)Stream->FileEntries);
+
+            ++Stream->FileIndex;
+            if (Stream->FileIndex >= CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES)
+            {
+                Stream->FileIndex = 0;
+            }
+        }
+    }
+
+    if (!Success)
+    {
+        /* give up, leaving the log idle until it is started again */
+        CFE_ES_PerfLogTriggerDone(Perf);
+        if (OS_ObjectIdDefined(Stream->FileDesc))
+        {
+            OS_close(Stream->FileDesc);
+            Stream->FileDesc = OS_OBJECT_ID_UNDEFINED;
+        }
+        Stream->Active = false;
+    }
+    else if (Flush)
+    {
+        if (OS_ObjectIdDefined(Stream->FileDesc))
+        {
+            CFE_ES_PerfStreamCloseFile(Stream);
+        }
+        Stream->Active = false;
+
+        CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_STOPPED_EID, CFE_EVS_EventType_INFORMATION,
+                          "Perf stream stopped:EntryCount=%lu,Dropped=%lu", (unsigned long)Stream->TotalEntries,
+                          (unsigned long)CFE_Atomic_Load(&Stream->DropCount));
+    }
+
+    return Stream->Active;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -555,6 +972,291 @@ int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_ResetPerfStatsCmd(const CFE_ES_ResetPerfStatsCmd_t *data)
+{
+#ifdef CFE_ES_PERF_MARKER_STATS_ENABLED
+    CFE_ES_ResetPerfStats();
+
+    CFE_EVS_SendEvent(CFE_ES_PERF_STATS_RESET_EID, CFE_EVS_EventType_INFORMATION,
+                      "Performance marker statistics reset");
+
+    CFE_ES_Global.TaskData.CommandCounter++;
+#else
+    CFE_EVS_SendEvent(CFE_ES_PERF_STATS_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Performance marker statistics are not enabled");
+
+    CFE_ES_Global.TaskData.CommandErrorCounter++;
+#endif
+
+    return CFE_SUCCESS;
+}
+
+#ifdef CFE_ES_PERF_MARKER_STATS_ENABLED
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_ResetPerfStats(void)
+{
+    CFE_ES_PerfStatsGlobal_t *     Stats = &CFE_ES_Global.PerfStats;
+    CFE_ES_PerfMarkerStatsState_t *MarkerStats;
+    uint32                         i;
+    uint32                         j;
+
+    for (i = 0; i < CFE_MISSION_ES_PERF_MAX_IDS; i++)
+    {
+        MarkerStats = &Stats->Markers[i];
+
+        CFE_Atomic_Store(&MarkerStats->Count, 0);
+        CFE_Atomic_Store(&MarkerStats->MinUsec, 0xFFFFFFFF);
+        CFE_Atomic_Store(&MarkerStats->MaxUsec, 0);
+        CFE_Atomic_Store(&MarkerStats->TotalUsecLow, 0);
+        CFE_Atomic_Store(&MarkerStats->TotalUsecHigh, 0);
+
+        for (j = 0; j < CFE_MISSION_ES_PERF_STATS_HIST_BUCKETS; j++)
+        {
+            CFE_Atomic_Store(&MarkerStats->Histogram[j], 0);
+        }
+    }
+
+    CFE_Atomic_Store(&Stats->UnmatchedCount, 0);
+    CFE_Atomic_Store(&Stats->OverflowCount, 0);
+    Stats->NextReportId = 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_GetPerfStats(CFE_ES_PerfStatsTlm_Payload_t *Payload)
+{
+    CFE_ES_PerfStatsGlobal_t *     Stats = &CFE_ES_Global.PerfStats;
+    CFE_ES_PerfMarkerStatsState_t *MarkerStats;
+    CFE_ES_PerfMarkerStats_t *     OutPtr;
+    uint32                         MarkerId;
+    uint32                         Count;
+    uint64                         TotalUsec;
+    uint32                         i;
+    uint32                         j;
+
+    memset(Payload, 0, sizeof(*Payload));
+
+    Payload->UnmatchedCount = CFE_Atomic_Load(&Stats->UnmatchedCount);
+    Payload->OverflowCount  = CFE_Atomic_Load(&Stats->OverflowCount);
+
+    /* Report measured markers in turn, resuming after the last one reported */
+    MarkerId = Stats->NextReportId;
+    for (i = 0; i < CFE_MISSION_ES_PERF_MAX_IDS && Payload->NumMarkers < CFE_MISSION_ES_PERF_STATS_PER_PKT; i++)
+    {
+        MarkerStats = &Stats->Markers[MarkerId];
+        Count       = CFE_Atomic_Load(&MarkerStats->Count);
+
+        if (Count != 0)
+        {
+            TotalUsec = ((uint64)CFE_Atomic_Load(&MarkerStats->TotalUsecHigh) << 32) |
+                        CFE_Atomic_Load(&MarkerStats->TotalUsecLow);
+
+            OutPtr           = &Payload->MarkerStats[Payload->NumMarkers];
+            OutPtr->MarkerId = MarkerId;
+            OutPtr->Count    = Count;
+            OutPtr->MinUsec  = CFE_Atomic_Load(&MarkerStats->MinUsec);
+            OutPtr->MaxUsec  = CFE_Atomic_Load(&MarkerStats->MaxUsec);
+            OutPtr->MeanUsec = (uint32)(TotalUsec / Count);
+
+            for (j = 0; j < CFE_MISSION_ES_PERF_STATS_HIST_BUCKETS; j++)
+            {
+                OutPtr->Histogram[j] = CFE_Atomic_Load(&MarkerStats->Histogram[j]);
+            }
+
+            ++Payload->NumMarkers;
+        }
+
+        ++MarkerId;
+        if (MarkerId >= CFE_MISSION_ES_PERF_MAX_IDS)
+        {
+            MarkerId = 0;
+        }
+    }
+
+    Stats->NextReportId = MarkerId;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Converts the time between two timebase readings to microseconds,
+ * saturating at the largest value a uint32 can hold.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_PerfStatsElapsedUsec(uint32 StartUpper32, uint32 StartLower32, uint32 EndUpper32,
+                                          uint32 EndLower32)
+{
+    const CFE_ES_PerfMetaData_t *MetaData = &CFE_ES_Global.ResetDataPtr->Perf.MetaData;
+    uint64                       Rollover;
+    uint64                       Ticks;
+    uint64                       Usec;
+
+    Rollover = MetaData->TimerLow32Rollover;
+    if (Rollover == 0)
+    {
+        Rollover = (uint64)1 << 32;
+    }
+
+    Ticks = ((uint64)EndUpper32 * Rollover + EndLower32) - ((uint64)StartUpper32 * Rollover + StartLower32);
+
+    if (MetaData->TimerTicksPerSecond == 0)
+    {
+        Usec = Ticks;
+    }
+    else
+    {
+        Usec = (Ticks / MetaData->TimerTicksPerSecond) * 1000000 +
+               ((Ticks % MetaData->TimerTicksPerSecond) * 1000000) / MetaData->TimerTicksPerSecond;
+    }
+
+    if (Usec > 0xFFFFFFFF)
+    {
+        Usec = 0xFFFFFFFF;
+    }
+
+    return (uint32)Usec;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Adds one measured duration to the statistics of a marker.
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_PerfStatsAddDuration(CFE_ES_PerfMarkerStatsState_t *MarkerStats, uint32 Usec)
+{
+    uint32 Old;
+    uint32 Bucket;
+    uint32 Value;
+
+    Old = CFE_Atomic_FetchAdd(&MarkerStats->TotalUsecLow, Usec);
+    if ((uint32)(Old + Usec) < Old)
+    {
+        CFE_Atomic_FetchAdd(&MarkerStats->TotalUsecHigh, 1);
+    }
+
+    Old = CFE_Atomic_Load(&MarkerStats->MinUsec);
+    while (Usec < Old && !CFE_Atomic_CompareExchange(&MarkerStats->MinUsec, &Old, Usec))
+    {
+        /* Old now holds the value another writer stored, check again */
+    }
+
+    Old = CFE_Atomic_Load(&MarkerStats->MaxUsec);
+    while (Usec > Old && !CFE_Atomic_CompareExchange(&MarkerStats->MaxUsec, &Old, Usec))
+    {
+        /* Old now holds the value another writer stored, check again */
+    }
+
+    /* bucket N holds durations from 2^N up to 2^(N+1) usec, bucket 0 also holds 0 and 1 */
+    Bucket = 0;
+    Value  = Usec >> 1;
+    while (Value != 0 && Bucket < (CFE_MISSION_ES_PERF_STATS_HIST_BUCKETS - 1))
+    {
+        ++Bucket;
+        Value >>= 1;
+    }
+
+    CFE_Atomic_FetchAdd(&MarkerStats->Histogram[Bucket], 1);
+
+    /* count last, so a reader never sees a count without the duration behind it */
+    CFE_Atomic_FetchAdd(&MarkerStats->Count, 1);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Matches an entry or exit event against the open markers of the calling
+ * task, and updates the marker statistics when an exit completes a pair.
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_PerfStatsAdd(uint32 Marker, uint32 EntryExit)
+{
+    CFE_ES_PerfStatsGlobal_t *Stats = &CFE_ES_Global.PerfStats;
+    CFE_ES_PerfTaskMarkers_t *TaskMarkers;
+    osal_id_t                 OsalId;
+    osal_index_t              TaskIdx;
+    uint32                    TimerUpper32;
+    uint32                    TimerLower32;
+    uint32                    Depth;
+    uint32                    Usec;
+
+    CFE_PSP_Get_Timebase(&TimerUpper32, &TimerLower32);
+
+    OsalId = OS_TaskGetId();
+    if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, OsalId, &TaskIdx) != OS_SUCCESS)
+    {
+        /* not called from a task, nothing to match against */
+        return;
+    }
+
+    TaskMarkers = &Stats->Tasks[TaskIdx];
+    if (!OS_ObjectIdEqual(TaskMarkers->TaskId, OsalId))
+    {
+        /* first event from this task, or the slot belonged to a task that has since been deleted */
+        TaskMarkers->TaskId = OsalId;
+        TaskMarkers->Depth  = 0;
+    }
+
+    if (EntryExit == 0)
+    {
+        if (TaskMarkers->Depth >= CFE_PLATFORM_ES_PERF_MARKER_STATS_DEPTH)
+        {
+            CFE_Atomic_FetchAdd(&Stats->OverflowCount, 1);
+        }
+        else
+        {
+            TaskMarkers->Open[TaskMarkers->Depth].Marker       = Marker;
+            TaskMarkers->Open[TaskMarkers->Depth].TimerUpper32 = TimerUpper32;
+            TaskMarkers->Open[TaskMarkers->Depth].TimerLower32 = TimerLower32;
+            ++TaskMarkers->Depth;
+        }
+
+        return;
+    }
+
+    /* find the most recent entry of this marker; anything entered after it was never exited */
+    Depth = TaskMarkers->Depth;
+    while (Depth > 0 && TaskMarkers->Open[Depth - 1].Marker != Marker)
+    {
+        --Depth;
+    }
+
+    if (Depth == 0)
+    {
+        CFE_Atomic_FetchAdd(&Stats->UnmatchedCount, 1);
+        return;
+    }
+
+    --Depth;
+    Usec = CFE_ES_PerfStatsElapsedUsec(TaskMarkers->Open[Depth].TimerUpper32, TaskMarkers->Open[Depth].TimerLower32,
+                                       TimerUpper32, TimerLower32);
+
+    TaskMarkers->Depth = Depth;
+
+    CFE_ES_PerfStatsAddDuration(&Stats->Markers[Marker], Usec);
+}
+
+#endif /* CFE_ES_PERF_MARKER_STATS_ENABLED */
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -563,9 +1265,23 @@ int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data)
  *-----------------------------------------------------------------*/
 void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
 {
-    CFE_ES_PerfDataEntry_t EntryData;
-    uint32                 DataEnd;
-    CFE_ES_PerfData_t *    Perf;
+    CFE_ES_PerfDataEntry_t *   EntryPtr;
+    CFE_ES_PerfData_t *        Perf;
+    CFE_ES_PerfStreamGlobal_t *Stream = &CFE_ES_Global.BackgroundPerfStreamState;
+    uint32                     State;
+    uint32                     Seq;
+    uint32                     NextSeq;
+    uint32                     TriggerSeq;
+    uint32                     Offset;
+    uint32                     Limit;
+
+#ifdef CFE_ES_PERF_MARKER_STATS_ENABLED
+    /* statistics are kept whether or not the log is running */
+    if (Marker < CFE_MISSION_ES_PERF_MAX_IDS)
+    {
+        CFE_ES_PerfStatsAdd(Marker, EntryExit);
+    }
+#endif
 
     /*
     ** Set the pointer to the data area
@@ -573,9 +1289,10 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
     Perf = &CFE_ES_Global.ResetDataPtr->Perf;
 
     /*
-     * If the global state is idle, exit immediately without locking or doing anything
+     * If the global state is idle, exit immediately without doing anything
      */
-    if (Perf->MetaData.State == CFE_ES_PERF_IDLE)
+    State = CFE_Atomic_Load(&Perf->MetaData.State);
+    if (State == CFE_ES_PERF_IDLE)
     {
         return;
     }
@@ -596,11 +1313,8 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
 
     /*
      * check if this ID is filtered.
-     * This is also done outside the lock -
-     * normally masks should NOT be changed while perf log is active / non-idle,
-     * so although this is reading a global it should be constant, and this avoids
-     * locking (and potential task switch) if the data is ultimately not going to
-     * be written to the log.
+     * Normally masks should NOT be changed while perf log is active / non-idle,
+     * so although this is reading a global it should be constant.
      */
     if (!CFE_ES_TEST_U32_MASK(Perf->MetaData.FilterMask, Marker))
     {
@@ -608,82 +1322,92 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
     }
 
     /*
-     * prepare the entry data (timestamp) before locking,
-     * just in case the locking operation incurs a delay
-     */
-    EntryData.Data = (Marker | (EntryExit << CFE_MISSION_ES_PERF_EXIT_BIT));
-    CFE_PSP_Get_Timebase(&EntryData.TimerUpper32, &EntryData.TimerLower32);
-
-    /*
-     * Acquire the perflog mutex before writing into the shared area.
-     * Note this lock is held for long periods while a background dump
-     * is taking place, but the dump should never be active at the
-     * same time that a capture/record is taking place.
-     */
-    OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
-
-    /*
-     * Confirm that the global is still non-idle after lock
-     * (state could become idle while getting lock)
+     * Claim the next slot in the log.  No lock is taken here, so instrumented
+     * tasks never block one another or the task being measured; a writer that
+     * loses the race for a slot simply retries with the next one.
+     *
+     * Note a background dump only reads the log after it has been idled and
+     * a short delay has passed, so it does not need to exclude writers either.
      */
-    if (Perf->MetaData.State != CFE_ES_PERF_IDLE)
+    Seq = CFE_Atomic_Load(&Perf->WriteSeq);
+    do
     {
-        /* copy data to next perflog slot */
-        DataEnd                   = Perf->MetaData.DataEnd;
-        Perf->DataBuffer[DataEnd] = EntryData;
-
-        ++DataEnd;
-        if (DataEnd >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+        /*
+         * When streaming, a slot may only be reused once the background job has
+         * written it out.  If it is behind, count the entry as dropped instead.
+         */
+        if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_STREAM &&
+            CFE_ES_PerfSeqDistance(Seq, CFE_Atomic_Load(&Stream->ReadSeq)) >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
         {
-            DataEnd = 0;
+            CFE_Atomic_FetchAdd(&Stream->DropCount, 1);
+            return;
         }
-        Perf->MetaData.DataEnd = DataEnd;
 
-        /* we have filled up the buffer */
-        if (Perf->MetaData.DataCount < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
-        {
-            Perf->MetaData.DataCount++;
-        }
-        else
+        NextSeq = Seq + 1;
+        if (NextSeq >= CFE_ES_PERF_SEQ_MODULUS)
         {
-            /* after the buffer fills up start and end point to the same entry since we
-               are now overwriting old data */
-            Perf->MetaData.DataStart = Perf->MetaData.DataEnd;
+            NextSeq = 0;
         }
+    } while (!CFE_Atomic_CompareExchange(&Perf->WriteSeq, &Seq, NextSeq));
 
-        /* waiting for trigger */
-        if (Perf->MetaData.State == CFE_ES_PERF_WAITING_FOR_TRIGGER)
+    /*
+     * waiting for trigger - the writer that sets the trigger point owns it, and
+     * only then moves the state, so anything that sees TRIGGERED also sees the
+     * trigger point.  If the log was stopped meanwhile the state is left alone.
+     */
+    if (State == CFE_ES_PERF_WAITING_FOR_TRIGGER && CFE_ES_TEST_U32_MASK(Perf->MetaData.TriggerMask, Marker))
+    {
+        TriggerSeq = CFE_ES_PERF_SEQ_NONE;
+        if (CFE_Atomic_CompareExchange(&Perf->TriggerSeq, &TriggerSeq, Seq))
         {
-            if (CFE_ES_TEST_U32_MASK(Perf->MetaData.TriggerMask, Marker))
-            {
-                Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
-            }
+            CFE_Atomic_CompareExchange(&Perf->MetaData.State, &State, CFE_ES_PERF_TRIGGERED);
         }
+    }
 
-        /* triggered */
-        if (Perf->MetaData.State == CFE_ES_PERF_TRIGGERED)
+    /*
+     * triggered - the log is complete once the number of entries for the
+     * trigger mode have been recorded from the trigger point.  Slots claimed
+     * before the trigger point are always kept; those claimed beyond the end
+     * are discarded, so the trigger entry is never overwritten.
+     */
+    Offset     = 0;
+    Limit      = 0;
+    TriggerSeq = CFE_Atomic_Load(&Perf->TriggerSeq);
+    if (TriggerSeq < CFE_ES_PERF_SEQ_MODULUS)
+    {
+        Offset = CFE_ES_PerfSeqDistance(Seq, TriggerSeq);
+        Limit  = CFE_ES_PerfTriggerLimit(Perf->MetaData.Mode);
+
+        if (Offset < (CFE_ES_PERF_SEQ_MODULUS / 2) && Offset >= Limit)
         {
-            Perf->MetaData.TriggerCount++;
-            if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_START)
-            {
-                if (Perf->MetaData.TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
-                {
-                    Perf->MetaData.State = CFE_ES_PERF_IDLE;
-                }
-            }
-            else if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_CENTER)
-            {
-                if (Perf->MetaData.TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2)
-                {
-                    Perf->MetaData.State = CFE_ES_PERF_IDLE;
-                }
-            }
-            else if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_END)
-            {
-                Perf->MetaData.State = CFE_ES_PERF_IDLE;
-            }
+            CFE_ES_PerfLogTriggerDone(Perf);
+            return;
         }
     }
 
-    OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+    /*
+     * The timestamp is taken after the slot is claimed.  A writer that is
+     * preempted in between stamps its entry later than one in a following
+     * slot, so entries from different tasks are in slot order, which is only
+     * approximately time order; see CFE_ES_PerfLogAdd() in cfe_es.h.
+     *
+     * No entry count is kept here, CFE_ES_UpdatePerfMetaData() derives it
+     * from the sequence so writers share no other counter.
+     */
+    EntryPtr       = &Perf->DataBuffer[Seq % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE];
+    EntryPtr->Data = (Marker | (EntryExit << CFE_MISSION_ES_PERF_EXIT_BIT));
+    CFE_PSP_Get_Timebase(&EntryPtr->TimerUpper32, &EntryPtr->TimerLower32);
+
+    /* streaming - the chunk is handed to the background job once all of its entries are written */
+    if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_STREAM)
+    {
+        CFE_Atomic_FetchAdd(&Stream->ChunkFill[(Seq % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE) /
+                                               CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES],
+                            1);
+    }
+
+    if (Limit != 0 && Offset < (CFE_ES_PERF_SEQ_MODULUS / 2) && (Offset + 1) >= Limit)
+    {
+        CFE_ES_PerfLogTriggerDone(Perf);
+    }
 }
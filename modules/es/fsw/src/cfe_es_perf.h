@@ -35,7 +35,20 @@
 */
 #include "common_types.h"
 #include "osconfig.h"
+#include "cfe_platform_cfg.h"
+#include "cfe_mission_cfg.h"
 #include "cfe_es_api_typedefs.h"
+#include "cfe_es_msg.h"
+#include "cfe_core_atomic.h"
+
+/*
+ * Whether the performance marker statistics are built in.  Besides the platform
+ * configuration, the unit tests define CFE_ES_FORCE_PERF_MARKER_STATS so the
+ * statistics are covered whatever the configuration.
+ */
+#if CFE_PLATFORM_ES_PERF_MARKER_STATS || defined(CFE_ES_FORCE_PERF_MARKER_STATS)
+#define CFE_ES_PERF_MARKER_STATS_ENABLED
+#endif
 
 /*
 ** Macro Definitions
@@ -44,6 +57,40 @@
 #define CFE_ES_DBIT(x)     ((uint32)1 << (x))          /* Places a one at bit positions 0 thru 31 */
 #define CFE_ES_DTEST(i, x) (((i)&CFE_ES_DBIT(x)) != 0) /* true iff bit x of i is set */
 
+/*
+ * All tasks log into one shared ring rather than into per-task rings that
+ * are merged by time when the log is dumped:
+ *
+ * - The ring lives in the reset area, which has a fixed size.  Divided by
+ *   OS_MAX_TASKS, it would leave each task a small ring (about 150 entries
+ *   with the default sizes), and a busy task would overwrite its own history
+ *   long before the others.
+ * - The trigger modes keep a window of the log around one trigger point.
+ *   With per-task rings the window would be cut differently for each task.
+ * - The dump file holds one ring described by DataStart/DataEnd, as read by
+ *   the existing ground tools, and the dump streams it in chunks.  A merge
+ *   would need a second buffer the size of the log.
+ *
+ * A writer does not wait for another one.  It claims its slot with a single
+ * compare-exchange on WriteSeq, which only needs to be retried when another
+ * writer claimed a slot in between.  The cost of the shared ring is that
+ * entries of different tasks may be slightly out of time order, so offline
+ * tools (such as cfe_es_perflog_tool) order them by their time values.
+ *
+ * Perf log slots are claimed by sequence number, and the slot index is the
+ * sequence modulo the buffer size.  The sequence wraps at the largest multiple
+ * of the buffer size below 2^31, so the slot index stays continuous across the
+ * wrap and the distance between two sequence numbers can be computed without
+ * ambiguity as long as they are less than half the modulus apart.
+ */
+#define CFE_ES_PERF_SEQ_MODULUS \
+    (((uint32)0x80000000 / CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE) * CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+#define CFE_ES_PERF_SEQ_NONE 0xFFFFFFFF /* TriggerSeq value when the log has not triggered */
+
+/* Number of chunks the log buffer is divided into when streaming */
+#define CFE_ES_PERF_STREAM_NUM_CHUNKS \
+    (CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES)
+
 /* Test a bit within an array of 32-bit integers. */
 static inline bool CFE_ES_TEST_U32_MASK(const uint32 *m, uint32 s)
 {
@@ -134,6 +181,89 @@ typedef struct
     size_t    FileSize;                      /* Total file size, for progress reporting in telemetry */
 } CFE_ES_PerfDumpGlobal_t;
 
+/**
+ * @brief Performance log streaming state structure
+ *
+ * When the log is started in STREAM mode, writers fill the log buffer
+ * continuously and count completed entries per chunk.  The background job
+ * appends each chunk to the current stream file once it is full, then makes
+ * it available to writers again by advancing ReadSeq.  A writer that would
+ * have to reuse a slot that has not yet been written out drops its entry.
+ *
+ * The atomic members are shared with CFE_ES_PerfLogAdd(); the rest are
+ * owned by the background job while Active is set.
+ */
+typedef struct
+{
+    CFE_Atomic_Uint32_t ReadSeq;   /* sequence number of the next entry to be written to file */
+    CFE_Atomic_Uint32_t DropCount; /* entries discarded because the file writer fell behind */
+    CFE_Atomic_Uint32_t ChunkFill[CFE_ES_PERF_STREAM_NUM_CHUNKS]; /* completed entries in each chunk */
+
+    bool      Active;                        /* streaming started and not yet finished */
+    bool      StopDelay;                     /* stop seen, waiting for in-progress writes to finish */
+    char      DataFileName[OS_MAX_PATH_LEN]; /* name of the current stream file */
+    osal_id_t FileDesc;                      /* file descriptor for writing */
+    uint32    FileIndex;                     /* rotation index of the current stream file */
+    uint32    FileEntries;                   /* entries written to the current stream file */
+    uint32    TotalEntries;                  /* entries written to all stream files since start */
+} CFE_ES_PerfStreamGlobal_t;
+
+/**
+ * @brief Duration statistics of one performance marker
+ *
+ * Updated by CFE_ES_PerfLogAdd() from any task without a lock, so every
+ * member is atomic.  The 64-bit microsecond total used for the mean is kept
+ * as two words; a writer whose addition wraps the low word carries into the
+ * high word.  A reader may therefore see the members slightly out of step
+ * with one another, which is acceptable for telemetry.
+ */
+typedef struct
+{
+    CFE_Atomic_Uint32_t Count;         /* number of durations measured */
+    CFE_Atomic_Uint32_t MinUsec;       /* shortest duration, 0xFFFFFFFF if none */
+    CFE_Atomic_Uint32_t MaxUsec;       /* longest duration */
+    CFE_Atomic_Uint32_t TotalUsecLow;  /* sum of all durations, low word */
+    CFE_Atomic_Uint32_t TotalUsecHigh; /* sum of all durations, high word */
+    CFE_Atomic_Uint32_t Histogram[CFE_MISSION_ES_PERF_STATS_HIST_BUCKETS]; /* power of two usec buckets */
+} CFE_ES_PerfMarkerStatsState_t;
+
+/**
+ * @brief Open performance markers of one task
+ *
+ * Each task only ever touches the entry matching its own OSAL task index, so
+ * no lock is needed.  The owning task ID is kept to detect a table slot that
+ * has been reused by a new task, whose markers must not match the old ones.
+ */
+typedef struct
+{
+    osal_id_t TaskId; /* task that owns the open markers below */
+    uint32    Depth;  /* number of open markers */
+    struct
+    {
+        uint32 Marker;       /* performance marker that was entered */
+        uint32 TimerUpper32; /* timebase at entry, upper word */
+        uint32 TimerLower32; /* timebase at entry, lower word */
+    } Open[CFE_PLATFORM_ES_PERF_MARKER_STATS_DEPTH];
+} CFE_ES_PerfTaskMarkers_t;
+
+/**
+ * @brief Performance marker statistics state
+ *
+ * Entry events are pushed on the open marker stack of the calling task.  An
+ * exit event pops the most recent entry of the same marker, along with any
+ * markers entered after it that were never exited, and adds the elapsed time
+ * to the statistics of that marker.
+ */
+typedef struct
+{
+    CFE_Atomic_Uint32_t UnmatchedCount; /* exit events with no matching entry */
+    CFE_Atomic_Uint32_t OverflowCount;  /* entry events not timed because the stack was full */
+    uint32              NextReportId;   /* first marker to consider for the next telemetry packet */
+
+    CFE_ES_PerfMarkerStatsState_t Markers[CFE_MISSION_ES_PERF_MAX_IDS];
+    CFE_ES_PerfTaskMarkers_t      Tasks[OS_MAX_TASKS];
+} CFE_ES_PerfStatsGlobal_t;
+
 /**
  * @brief Helper function to obtain the progress/remaining items from
  * the background task that is writing the performance log data
@@ -148,6 +278,20 @@ typedef struct
  */
 uint32 CFE_ES_GetPerfLogDumpRemaining(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Bring the performance log metadata up to date
+ *
+ * CFE_ES_PerfLogAdd() records entries without locking, and only keeps the
+ * slot sequence numbers and the data count current.  This computes the
+ * DataStart, DataEnd and TriggerCount metadata values from the recording
+ * state, so they can be reported in telemetry or written to the dump file.
+ *
+ * This is safe to call at any time, but the result is only exact once the
+ * log is idle and any in-progress writes have completed.
+ */
+void CFE_ES_UpdatePerfMetaData(void);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Write performance data to a file
@@ -161,6 +305,39 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void);
  */
 bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Write streamed performance data to files
+ *
+ * Background job that appends each completed chunk of the performance log
+ * to the current stream file, rotating through a fixed set of files, while
+ * the log is running in STREAM mode.  Once the log is stopped, the remaining
+ * entries are written and the last file is closed.
+ */
+bool CFE_ES_RunPerfLogStream(uint32 ElapsedTime, void *Arg);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Clear the performance marker statistics
+ *
+ * Clears the duration statistics of every marker along with the unmatched
+ * and overflow counts.  The open markers of each task are kept, so code
+ * that is running at the time is still timed when it exits.
+ */
+void CFE_ES_ResetPerfStats(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Obtain the next set of performance marker statistics for telemetry
+ *
+ * Fills the payload with the statistics of up to #CFE_MISSION_ES_PERF_STATS_PER_PKT
+ * markers that have been measured, continuing from where the previous call
+ * left off, so successive packets cycle through all measured markers.
+ *
+ * @param[out] Payload  the telemetry payload to fill
+ */
+void CFE_ES_GetPerfStats(CFE_ES_PerfStatsTlm_Payload_t *Payload);
+
 /** @} */
 
 #endif /* CFE_ES_PERF_H */
@@ -37,6 +37,23 @@
 #include <string.h>
 #include <stdlib.h>
 
+/*
+ * The calling context as last resolved by this task, see CFE_ES_UpdateTaskContextCache()
+ */
+typedef struct
+{
+    bool            IsValid;
+    uint32          Generation;
+    CFE_ES_AppId_t  AppId;
+    CFE_ES_TaskId_t TaskId;
+} CFE_ES_TaskContextCache_t;
+
+#ifdef CFE_ES_TASK_CONTEXT_CACHE_ENABLED
+static __thread CFE_ES_TaskContextCache_t CFE_ES_TaskContextCache;
+#endif
+
+CFE_Atomic_Uint32_t CFE_ES_TaskContextGeneration;
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -71,6 +88,58 @@ CFE_ES_TaskId_t CFE_ES_TaskId_FromOSAL(osal_id_t id)
     return CFE_ES_TASKID_C(Result);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Local helper routine, not invoked outside of this unit
+ * Confirms a name index candidate against the app table
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_AppRecordNameMatch(uint32 TableIdx, const char *Name, void *Arg)
+{
+    CFE_ES_AppRecord_t *AppRecPtr = &CFE_ES_Global.AppTable[TableIdx];
+    char                RecName[sizeof(AppRecPtr->AppName)];
+
+    /* lookups may run without the lock, so never read past the end of the stored name */
+    CFE_ES_ReadSharedName(RecName, sizeof(RecName), CFE_ES_AppRecordGetName(AppRecPtr), sizeof(AppRecPtr->AppName));
+
+    return CFE_ES_AppRecordIsUsed(AppRecPtr) && strcmp(Name, RecName) == 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper routine, not invoked outside of this unit
+ * Confirms a name index candidate against the library table
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_LibRecordNameMatch(uint32 TableIdx, const char *Name, void *Arg)
+{
+    CFE_ES_LibRecord_t *LibRecPtr = &CFE_ES_Global.LibTable[TableIdx];
+    char                RecName[sizeof(LibRecPtr->LibName)];
+
+    /* lookups may run without the lock, so never read past the end of the stored name */
+    CFE_ES_ReadSharedName(RecName, sizeof(RecName), CFE_ES_LibRecordGetName(LibRecPtr), sizeof(LibRecPtr->LibName));
+
+    return CFE_ES_LibRecordIsUsed(LibRecPtr) && strcmp(Name, RecName) == 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper routine, not invoked outside of this unit
+ * Confirms a name index candidate against the counter table
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_CounterRecordNameMatch(uint32 TableIdx, const char *Name, void *Arg)
+{
+    CFE_ES_GenCounterRecord_t *CounterRecPtr = &CFE_ES_Global.CounterTable[TableIdx];
+    char                       RecName[sizeof(CounterRecPtr->CounterName)];
+
+    /* lookups may run without the lock, so never read past the end of the stored name */
+    CFE_ES_ReadSharedName(RecName, sizeof(RecName), CFE_ES_CounterRecordGetName(CounterRecPtr),
+                          sizeof(CounterRecPtr->CounterName));
+
+    return CFE_ES_CounterRecordIsUsed(CounterRecPtr) && strcmp(Name, RecName) == 0;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -79,31 +148,22 @@ CFE_ES_TaskId_t CFE_ES_TaskId_FromOSAL(osal_id_t id)
  *-----------------------------------------------------------------*/
 CFE_ES_AppRecord_t *CFE_ES_LocateAppRecordByName(const char *Name)
 {
-    CFE_ES_AppRecord_t *AppRecPtr;
-    uint32              Count;
+    uint32 TableIdx;
 
     /*
-    ** Search the Application table for an app with a matching name.
+    ** Look up the name in the index, which is kept in step with the
+    ** Application table by CFE_ES_AppRecordSetUsed()/SetFree().
     */
-    AppRecPtr = CFE_ES_Global.AppTable;
-    Count     = CFE_PLATFORM_ES_MAX_APPLICATIONS;
-    while (true)
+    if (!CFE_ResourceId_NameIndexFind(CFE_ES_Global.AppNameIndex, CFE_ES_APP_NAMEINDEX_SLOTS, Name,
+                                      CFE_ES_AppRecordNameMatch, NULL, &TableIdx) &&
+        (!CFE_ES_Global.AppNameIndexIncomplete ||
+         !CFE_ResourceId_NameIndexScan(CFE_PLATFORM_ES_MAX_APPLICATIONS, Name, CFE_ES_AppRecordNameMatch, NULL,
+                                       &TableIdx)))
     {
-        if (Count == 0)
-        {
-            AppRecPtr = NULL;
-            break;
-        }
-        if (CFE_ES_AppRecordIsUsed(AppRecPtr) && strcmp(Name, CFE_ES_AppRecordGetName(AppRecPtr)) == 0)
-        {
-            break;
-        }
-
-        ++AppRecPtr;
-        --Count;
+        return NULL;
     }
 
-    return AppRecPtr;
+    return &CFE_ES_Global.AppTable[TableIdx];
 }
 
 /*----------------------------------------------------------------
@@ -114,31 +174,21 @@ CFE_ES_AppRecord_t *CFE_ES_LocateAppRecordByName(const char *Name)
  *-----------------------------------------------------------------*/
 CFE_ES_LibRecord_t *CFE_ES_LocateLibRecordByName(const char *Name)
 {
-    CFE_ES_LibRecord_t *LibRecPtr;
-    uint32              Count;
+    uint32 TableIdx;
 
     /*
-    ** Search the Library table for a library with a matching name.
+    ** Look up the name in the Library table index
     */
-    LibRecPtr = CFE_ES_Global.LibTable;
-    Count     = CFE_PLATFORM_ES_MAX_LIBRARIES;
-    while (true)
+    if (!CFE_ResourceId_NameIndexFind(CFE_ES_Global.LibNameIndex, CFE_ES_LIB_NAMEINDEX_SLOTS, Name,
+                                      CFE_ES_LibRecordNameMatch, NULL, &TableIdx) &&
+        (!CFE_ES_Global.LibNameIndexIncomplete ||
+         !CFE_ResourceId_NameIndexScan(CFE_PLATFORM_ES_MAX_LIBRARIES, Name, CFE_ES_LibRecordNameMatch, NULL,
+                                       &TableIdx)))
     {
-        if (Count == 0)
-        {
-            LibRecPtr = NULL;
-            break;
-        }
-        if (CFE_ES_LibRecordIsUsed(LibRecPtr) && strcmp(Name, CFE_ES_LibRecordGetName(LibRecPtr)) == 0)
-        {
-            break;
-        }
-
-        ++LibRecPtr;
-        --Count;
+        return NULL;
     }
 
-    return LibRecPtr;
+    return &CFE_ES_Global.LibTable[TableIdx];
 }
 
 /*----------------------------------------------------------------
@@ -149,31 +199,21 @@ CFE_ES_LibRecord_t *CFE_ES_LocateLibRecordByName(const char *Name)
  *-----------------------------------------------------------------*/
 CFE_ES_GenCounterRecord_t *CFE_ES_LocateCounterRecordByName(const char *Name)
 {
-    CFE_ES_GenCounterRecord_t *CounterRecPtr;
-    uint32                     Count;
+    uint32 TableIdx;
 
     /*
-    ** Search the Counter table for a matching name.
+    ** Look up the name in the Counter table index
     */
-    CounterRecPtr = CFE_ES_Global.CounterTable;
-    Count         = CFE_PLATFORM_ES_MAX_GEN_COUNTERS;
-    while (true)
+    if (!CFE_ResourceId_NameIndexFind(CFE_ES_Global.CounterNameIndex, CFE_ES_COUNTER_NAMEINDEX_SLOTS, Name,
+                                      CFE_ES_CounterRecordNameMatch, NULL, &TableIdx) &&
+        (!CFE_ES_Global.CounterNameIndexIncomplete ||
+         !CFE_ResourceId_NameIndexScan(CFE_PLATFORM_ES_MAX_GEN_COUNTERS, Name, CFE_ES_CounterRecordNameMatch, NULL,
+                                       &TableIdx)))
     {
-        if (Count == 0)
-        {
-            CounterRecPtr = NULL;
-            break;
-        }
-        if (CFE_ES_CounterRecordIsUsed(CounterRecPtr) && strcmp(Name, CFE_ES_CounterRecordGetName(CounterRecPtr)) == 0)
-        {
-            break;
-        }
-
-        ++CounterRecPtr;
-        --Count;
+        return NULL;
     }
 
-    return CounterRecPtr;
+    return &CFE_ES_Global.CounterTable[TableIdx];
 }
 
 /*----------------------------------------------------------------
@@ -340,6 +380,65 @@ CFE_ES_AppRecord_t *CFE_ES_GetAppRecordByContext(void)
     return AppRecPtr;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_UpdateTaskContextCache(void)
+{
+#ifdef CFE_ES_TASK_CONTEXT_CACHE_ENABLED
+    CFE_ES_TaskRecord_t *TaskRecPtr;
+    CFE_ES_AppRecord_t * AppRecPtr;
+
+    TaskRecPtr = CFE_ES_GetTaskRecordByContext();
+    AppRecPtr  = CFE_ES_GetAppRecordByContext();
+
+    if (TaskRecPtr != NULL && AppRecPtr != NULL)
+    {
+        /*
+         * Generation only changes while the global data is locked, so
+         * it cannot be advanced between the lookup above and this read.
+         */
+        CFE_ES_TaskContextCache.Generation = CFE_Atomic_Load(&CFE_ES_TaskContextGeneration);
+        CFE_ES_TaskContextCache.AppId      = CFE_ES_AppRecordGetID(AppRecPtr);
+        CFE_ES_TaskContextCache.TaskId     = CFE_ES_TaskRecordGetID(TaskRecPtr);
+        CFE_ES_TaskContextCache.IsValid    = true;
+    }
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_GetTaskContextCache(CFE_ES_AppId_t *AppIdPtr, CFE_ES_TaskId_t *TaskIdPtr)
+{
+#ifdef CFE_ES_TASK_CONTEXT_CACHE_ENABLED
+    if (!CFE_ES_TaskContextCache.IsValid ||
+        CFE_ES_TaskContextCache.Generation != CFE_Atomic_Load(&CFE_ES_TaskContextGeneration))
+    {
+        return false;
+    }
+
+    if (AppIdPtr != NULL)
+    {
+        *AppIdPtr = CFE_ES_TaskContextCache.AppId;
+    }
+    if (TaskIdPtr != NULL)
+    {
+        *TaskIdPtr = CFE_ES_TaskContextCache.TaskId;
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -35,6 +35,40 @@
 #include "cfe_resourceid.h"
 #include "cfe_core_resourceid_basevalues.h"
 #include "cfe_es_global.h"
+#include "cfe_core_atomic.h"
+
+/*
+ * The task context cache is only built if it is configured and the
+ * toolchain supports thread-local storage (detected by the build)
+ */
+#if CFE_PLATFORM_ES_TASK_CONTEXT_CACHE && defined(CFE_ES_HAVE_THREAD_LOCAL)
+#define CFE_ES_TASK_CONTEXT_CACHE_ENABLED
+#endif
+
+/**
+ * @brief Generation number of the ES app and task registries
+ *
+ * Advanced whenever an app or task record is freed.  Task context values
+ * cached by CFE_ES_UpdateTaskContextCache() are only used while this
+ * still holds the value it had when they were cached.
+ *
+ * This is deliberately kept outside of CFE_ES_Global so that it never
+ * returns to a prior value if the global data is reinitialized.
+ */
+extern CFE_Atomic_Uint32_t CFE_ES_TaskContextGeneration;
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Invalidate all cached task contexts
+ *
+ * Any task that has a cached app/task ID will resolve its context again
+ * under the shared data lock on its next call to CFE_ES_GetAppID() or
+ * CFE_ES_GetTaskID().
+ */
+static inline void CFE_ES_InvalidateTaskContextCache(void)
+{
+    CFE_Atomic_FetchAdd(&CFE_ES_TaskContextGeneration, 1);
+}
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -198,12 +232,21 @@ static inline CFE_ES_AppId_t CFE_ES_AppRecordGetID(const CFE_ES_AppRecord_t *App
  * @note This internal helper function must only be used on record pointers
  * that are known to refer to an actual table location (i.e. non-null).
  *
+ * The name must already be stored in the record, as it is entered into
+ * the name index here.
+ *
  * @param[in]   AppRecPtr   pointer to app table entry
  * @param[in]   PendingId   the app ID of this entry
  */
 static inline void CFE_ES_AppRecordSetUsed(CFE_ES_AppRecord_t *AppRecPtr, CFE_ResourceId_t PendingId)
 {
     AppRecPtr->AppId = CFE_ES_APPID_C(PendingId);
+    if (CFE_ResourceId_NameIndexAdd(CFE_ES_Global.AppNameIndex, CFE_ES_APP_NAMEINDEX_SLOTS, AppRecPtr->AppName,
+                                    AppRecPtr - CFE_ES_Global.AppTable) != CFE_SUCCESS)
+    {
+        /* name lookups that miss in the index will also scan the table */
+        CFE_ES_Global.AppNameIndexIncomplete = true;
+    }
 }
 
 /*---------------------------------------------------------------------------------------*/
@@ -223,7 +266,10 @@ static inline void CFE_ES_AppRecordSetUsed(CFE_ES_AppRecord_t *AppRecPtr, CFE_Re
  */
 static inline void CFE_ES_AppRecordSetFree(CFE_ES_AppRecord_t *AppRecPtr)
 {
+    CFE_ResourceId_NameIndexRemove(CFE_ES_Global.AppNameIndex, CFE_ES_APP_NAMEINDEX_SLOTS, AppRecPtr->AppName,
+                                   AppRecPtr - CFE_ES_Global.AppTable);
     AppRecPtr->AppId = CFE_ES_APPID_UNDEFINED;
+    CFE_ES_InvalidateTaskContextCache();
 }
 
 /*---------------------------------------------------------------------------------------*/
@@ -323,12 +369,21 @@ static inline CFE_ES_LibId_t CFE_ES_LibRecordGetID(const CFE_ES_LibRecord_t *Lib
  * @note This internal helper function must only be used on record pointers
  * that are known to refer to an actual table location (i.e. non-null).
  *
+ * The name must already be stored in the record, as it is entered into
+ * the name index here.
+ *
  * @param[in]   LibRecPtr   pointer to Lib table entry
  * @param[in]   PendingId   the Lib ID of this entry
  */
 static inline void CFE_ES_LibRecordSetUsed(CFE_ES_LibRecord_t *LibRecPtr, CFE_ResourceId_t PendingId)
 {
     LibRecPtr->LibId = CFE_ES_LIBID_C(PendingId);
+    if (CFE_ResourceId_NameIndexAdd(CFE_ES_Global.LibNameIndex, CFE_ES_LIB_NAMEINDEX_SLOTS, LibRecPtr->LibName,
+                                    LibRecPtr - CFE_ES_Global.LibTable) != CFE_SUCCESS)
+    {
+        /* name lookups that miss in the index will also scan the table */
+        CFE_ES_Global.LibNameIndexIncomplete = true;
+    }
 }
 
 /*---------------------------------------------------------------------------------------*/
@@ -345,6 +400,8 @@ static inline void CFE_ES_LibRecordSetUsed(CFE_ES_LibRecord_t *LibRecPtr, CFE_Re
  */
 static inline void CFE_ES_LibRecordSetFree(CFE_ES_LibRecord_t *LibRecPtr)
 {
+    CFE_ResourceId_NameIndexRemove(CFE_ES_Global.LibNameIndex, CFE_ES_LIB_NAMEINDEX_SLOTS, LibRecPtr->LibName,
+                                   LibRecPtr - CFE_ES_Global.LibTable);
     LibRecPtr->LibId = CFE_ES_LIBID_UNDEFINED;
 }
 
@@ -472,6 +529,7 @@ static inline void CFE_ES_TaskRecordSetUsed(CFE_ES_TaskRecord_t *TaskRecPtr, CFE
 static inline void CFE_ES_TaskRecordSetFree(CFE_ES_TaskRecord_t *TaskRecPtr)
 {
     TaskRecPtr->TaskId = CFE_ES_TASKID_UNDEFINED;
+    CFE_ES_InvalidateTaskContextCache();
 }
 
 /*---------------------------------------------------------------------------------------*/
@@ -570,12 +628,22 @@ static inline CFE_ES_CounterId_t CFE_ES_CounterRecordGetID(const CFE_ES_GenCount
  * @note This internal helper function must only be used on record pointers
  * that are known to refer to an actual table location (i.e. non-null).
  *
+ * The name must already be stored in the record, as it is entered into
+ * the name index here.
+ *
  * @param[in]   CounterRecPtr   pointer to Counter table entry
  * @param[in]   PendingId       the Counter ID of this entry
  */
 static inline void CFE_ES_CounterRecordSetUsed(CFE_ES_GenCounterRecord_t *CounterRecPtr, CFE_ResourceId_t PendingId)
 {
     CounterRecPtr->CounterId = CFE_ES_COUNTERID_C(PendingId);
+    if (CFE_ResourceId_NameIndexAdd(CFE_ES_Global.CounterNameIndex, CFE_ES_COUNTER_NAMEINDEX_SLOTS,
+                                    CounterRecPtr->CounterName,
+                                    CounterRecPtr - CFE_ES_Global.CounterTable) != CFE_SUCCESS)
+    {
+        /* name lookups that miss in the index will also scan the table */
+        CFE_ES_Global.CounterNameIndexIncomplete = true;
+    }
 }
 
 /*---------------------------------------------------------------------------------------*/
@@ -595,6 +663,8 @@ static inline void CFE_ES_CounterRecordSetUsed(CFE_ES_GenCounterRecord_t *Counte
  */
 static inline void CFE_ES_CounterRecordSetFree(CFE_ES_GenCounterRecord_t *CounterRecPtr)
 {
+    CFE_ResourceId_NameIndexRemove(CFE_ES_Global.CounterNameIndex, CFE_ES_COUNTER_NAMEINDEX_SLOTS,
+                                   CounterRecPtr->CounterName, CounterRecPtr - CFE_ES_Global.CounterTable);
     CounterRecPtr->CounterId = CFE_ES_COUNTERID_UNDEFINED;
 }
 
@@ -671,6 +741,34 @@ CFE_ES_AppRecord_t *CFE_ES_GetAppRecordByContext(void);
  */
 CFE_ES_TaskRecord_t *CFE_ES_GetTaskRecordByContext(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Cache the app and task IDs of the calling context.
+ *
+ * Resolves the task and app records of the caller and, if both are valid,
+ * saves their IDs in thread-local storage along with the current value of
+ * CFE_ES_TaskContextGeneration.  Does nothing if the caller is not a
+ * registered task, or if CFE_ES_TASK_CONTEXT_CACHE_ENABLED is not defined.
+ *
+ * The global data lock should be obtained prior to invoking this function.
+ */
+void CFE_ES_UpdateTaskContextCache(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Get the cached app and task IDs of the calling context.
+ *
+ * This does not take the global data lock.  The cached values are only
+ * returned if no app or task record has been freed since they were saved
+ * by CFE_ES_UpdateTaskContextCache().
+ *
+ * @param[out]  AppIdPtr    buffer to store the app ID, may be NULL
+ * @param[out]  TaskIdPtr   buffer to store the task ID, may be NULL
+ * @returns true if the cached values are current and were returned,
+ *          false if the caller must resolve its context under the lock
+ */
+bool CFE_ES_GetTaskContextCache(CFE_ES_AppId_t *AppIdPtr, CFE_ES_TaskId_t *TaskIdPtr);
+
 /*
  * OSAL <-> CFE task ID conversion
  *
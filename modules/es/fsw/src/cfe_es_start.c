@@ -71,7 +71,8 @@ CFE_ES_Global_t CFE_ES_Global;
  *-----------------------------------------------------------------*/
 void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const char *StartFilePath)
 {
-    int32 OsStatus;
+    int32  OsStatus;
+    uint32 StepStart;
 
     /*
      * Clear the entire global data structure.
@@ -80,9 +81,15 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
      */
     memset(&CFE_ES_Global, 0, sizeof(CFE_ES_Global));
 
+    /*
+    ** Start the startup timeline, all times recorded are relative to this
+    */
+    CFE_ES_StartupTimingInit();
+
     /*
     ** Indicate that the CFE is the earliest initialization state
     */
+    CFE_ES_StartupTimingMark(CFE_ES_StartupPhase_SYSTEM_STATE, "EARLY_INIT");
     CFE_ES_Global.SystemState = CFE_ES_SystemState_EARLY_INIT;
 
     /*
@@ -116,14 +123,18 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     ** Before most of the ES functions can be used including the
     ** ES System log.
     */
+    StepStart = CFE_ES_StartupTimingNow();
     CFE_ES_SetupResetVariables(StartType, StartSubtype, ModeId);
+    CFE_ES_StartupTimingRecord(CFE_ES_StartupPhase_MAIN_STEP, "SetupResetVariables", StepStart);
 
     /*
     ** Initialize the Logic Perf variables
     ** Because this is in the ES Reset area, it must be called after
     ** CFE_ES_SetupResetVariables.
     */
+    StepStart = CFE_ES_StartupTimingNow();
     CFE_ES_SetupPerfVariables(StartType);
+    CFE_ES_StartupTimingRecord(CFE_ES_StartupPhase_MAIN_STEP, "SetupPerfVariables", StepStart);
 
     /*
     ** Also Create the ES Performance Data Mutex
@@ -159,7 +170,9 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     /*
     ** Create and Mount the filesystems needed
     */
+    StepStart = CFE_ES_StartupTimingNow();
     CFE_ES_InitializeFileSystems(StartType);
+    CFE_ES_StartupTimingRecord(CFE_ES_StartupPhase_MAIN_STEP, "InitFileSystems", StepStart);
 
     /*
     ** Install exception Handlers ( Placeholder )
@@ -174,21 +187,32 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     CFE_ES_Global.LastCounterId = CFE_ResourceId_FromInteger(CFE_ES_COUNTID_BASE);
     CFE_ES_Global.LastMemPoolId = CFE_ResourceId_FromInteger(CFE_ES_POOLID_BASE);
 
+#ifdef CFE_ES_POOL_ALLOC_TRACKING_ENABLED
+    /*
+    ** Start tracking pool allocations before any pool is created
+    */
+    CFE_ES_PoolAllocTrackInit();
+#endif
+
     /*
     ** Indicate that the CFE core is now starting up / going multi-threaded
     */
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering CORE_STARTUP state\n", __func__);
+    CFE_ES_StartupTimingMark(CFE_ES_StartupPhase_SYSTEM_STATE, "CORE_STARTUP");
     CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_STARTUP;
 
     /*
     ** Create the tasks, OS objects, and initialize hardware
     */
+    StepStart = CFE_ES_StartupTimingNow();
     CFE_ES_CreateObjects();
+    CFE_ES_StartupTimingRecord(CFE_ES_StartupPhase_MAIN_STEP, "CreateObjects", StepStart);
 
     /*
     ** Indicate that the CFE core is ready
     */
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering CORE_READY state\n", __func__);
+    CFE_ES_StartupTimingMark(CFE_ES_StartupPhase_SYSTEM_STATE, "CORE_READY");
     CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_READY;
 
     /*
@@ -196,7 +220,9 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     ** specified in the CFE_PLATFORM_ES_NONVOL_STARTUP_FILE or CFE_PLATFORM_ES_VOLATILE_STARTUP_FILE
     ** ( defined in the cfe_platform_cfg.h file )
     */
+    StepStart = CFE_ES_StartupTimingNow();
     CFE_ES_StartApplications(StartType, StartFilePath);
+    CFE_ES_StartupTimingRecord(CFE_ES_StartupPhase_MAIN_STEP, "StartApplications", StepStart);
 
     /*
      * Wait for applications to be in at least "LATE_INIT"
@@ -205,12 +231,15 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
      * continue anyway since the core apps are OK and control/telemetry should function.
      * The problem app could be deleted/restarted/etc by the ground station.
      */
+    StepStart = CFE_ES_StartupTimingNow();
     if (CFE_ES_MainTaskSyncDelay(CFE_ES_AppState_LATE_INIT, CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC) != CFE_SUCCESS)
     {
         CFE_ES_WriteToSysLog("%s: Startup Sync failed - Applications may not have all initialized\n", __func__);
     }
+    CFE_ES_StartupTimingRecord(CFE_ES_StartupPhase_MAIN_STEP, "SyncLateInit", StepStart);
 
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering APPS_INIT state\n", __func__);
+    CFE_ES_StartupTimingMark(CFE_ES_StartupPhase_SYSTEM_STATE, "APPS_INIT");
     CFE_ES_Global.SystemState = CFE_ES_SystemState_APPS_INIT;
 
     /*
@@ -220,15 +249,18 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
      * continue anyway since the core apps are OK and control/telemetry should function.
      * The problem app could be deleted/restarted/etc by the ground station.
      */
+    StepStart = CFE_ES_StartupTimingNow();
     if (CFE_ES_MainTaskSyncDelay(CFE_ES_AppState_RUNNING, CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC) != CFE_SUCCESS)
     {
         CFE_ES_WriteToSysLog("%s: Startup Sync failed - Applications may not have all started\n", __func__);
     }
+    CFE_ES_StartupTimingRecord(CFE_ES_StartupPhase_MAIN_STEP, "SyncRunning", StepStart);
 
     /*
     ** Startup is fully complete
     */
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering OPERATIONAL state\n", __func__);
+    CFE_ES_StartupTimingMark(CFE_ES_StartupPhase_SYSTEM_STATE, "OPERATIONAL");
     CFE_ES_Global.SystemState = CFE_ES_SystemState_OPERATIONAL;
 }
 
@@ -708,6 +740,7 @@ void CFE_ES_CreateObjects(void)
 {
     int32               ReturnCode;
     uint16              i;
+    uint32              InitStart;
     CFE_ES_AppRecord_t *AppRecPtr;
     CFE_ResourceId_t    PendingAppId;
 
@@ -720,6 +753,8 @@ void CFE_ES_CreateObjects(void)
             case CFE_ES_DRIVER_TASK:
             case CFE_ES_CORE_TASK:
 
+                InitStart = CFE_ES_StartupTimingNow();
+
                 /*
                 ** Allocate an ES AppTable entry
                 */
@@ -788,7 +823,9 @@ void CFE_ES_CreateObjects(void)
                     {
                         /* failure mode - just clear the whole app table entry.
                          * This will set the AppType back to CFE_ES_ResourceType_INVALID (0),
-                         * as well as clearing any other data that had been written */
+                         * as well as clearing any other data that had been written.
+                         * The entry is freed first so its name leaves the name index. */
+                        CFE_ES_AppRecordSetFree(AppRecPtr);
                         memset(AppRecPtr, 0, sizeof(*AppRecPtr));
                     }
 
@@ -809,6 +846,9 @@ void CFE_ES_CreateObjects(void)
                      */
                     ReturnCode =
                         CFE_ES_MainTaskSyncDelay(CFE_ES_AppState_RUNNING, CFE_PLATFORM_CORE_MAX_STARTUP_MSEC);
+
+                    CFE_ES_StartupTimingRecord(CFE_ES_StartupPhase_CORE_INIT, CFE_ES_ObjectTable[i].ObjectName,
+                                               InitStart);
                 }
 
                 if (ReturnCode != CFE_SUCCESS)
@@ -836,7 +876,10 @@ void CFE_ES_CreateObjects(void)
                     /*
                     ** Call the function
                     */
+                    InitStart  = CFE_ES_StartupTimingNow();
                     ReturnCode = (*CFE_ES_ObjectTable[i].FuncPtrUnion.FunctionPtr)();
+                    CFE_ES_StartupTimingRecord(CFE_ES_StartupPhase_CORE_INIT, CFE_ES_ObjectTable[i].ObjectName,
+                                               InitStart);
                     if (ReturnCode != CFE_SUCCESS)
                     {
                         CFE_ES_WriteToSysLog("%s: Error returned when calling function: %s: EC = 0x%08X\n", __func__,
@@ -937,3 +980,295 @@ int32 CFE_ES_MainTaskSyncDelay(uint32 AppStateId, uint32 TimeOutMilliseconds)
 
     return Status;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupTimingInit(void)
+{
+    CFE_PSP_GetTime(&CFE_ES_Global.StartupTiming.StartTime);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_StartupTimingNow(void)
+{
+    OS_time_t Now;
+
+    CFE_PSP_GetTime(&Now);
+
+    return (uint32)OS_TimeGetTotalMicroseconds(OS_TimeSubtract(Now, CFE_ES_Global.StartupTiming.StartTime));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Claims the next slot of the startup timeline and fills it in.
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_StartupTimingAdd(CFE_ES_StartupPhase_Enum_t Phase, const char *Name, uint32 StartUsec,
+                                    uint32 DurationUsec)
+{
+    CFE_ES_StartupTimingGlobal_t *TimingPtr;
+    CFE_ES_StartupTimingSlot_t *  SlotPtr;
+    uint32                        Index;
+
+    TimingPtr = &CFE_ES_Global.StartupTiming;
+
+    if (CFE_Atomic_Load(&TimingPtr->IsClosed) != 0)
+    {
+        return;
+    }
+
+    /*
+     * A claim beyond the end of the table is still counted in NumRecords,
+     * which is how dropped records are reported.
+     */
+    Index = CFE_Atomic_FetchAdd(&TimingPtr->NumRecords, 1);
+    if (Index >= CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS)
+    {
+        return;
+    }
+
+    SlotPtr = &TimingPtr->Slots[Index];
+
+    strncpy(SlotPtr->Rec.Name, Name, sizeof(SlotPtr->Rec.Name) - 1);
+    SlotPtr->Rec.Name[sizeof(SlotPtr->Rec.Name) - 1] = '\0';
+    SlotPtr->Rec.StartUsec                          = StartUsec;
+    SlotPtr->Rec.DurationUsec                       = DurationUsec;
+    SlotPtr->Rec.Phase                              = Phase;
+
+    CFE_Atomic_Store(&SlotPtr->IsValid, 1);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupTimingRecord(CFE_ES_StartupPhase_Enum_t Phase, const char *Name, uint32 StartUsec)
+{
+    CFE_ES_StartupTimingAdd(Phase, Name, StartUsec, CFE_ES_StartupTimingNow() - StartUsec);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupTimingMark(CFE_ES_StartupPhase_Enum_t Phase, const char *Name)
+{
+    CFE_ES_StartupTimingAdd(Phase, Name, CFE_ES_StartupTimingNow(), 0);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_StartupTimingUpdate(CFE_ES_StartupTimingTlm_Payload_t *Payload)
+{
+    CFE_ES_StartupTimingGlobal_t *TimingPtr;
+    uint32                        TotalRecords;
+    uint32                        NumRecords;
+    uint32                        NumInPacket;
+
+    TimingPtr = &CFE_ES_Global.StartupTiming;
+
+    if (CFE_Atomic_Load(&TimingPtr->IsClosed) == 0)
+    {
+        if (CFE_ES_Global.SystemState < CFE_ES_SystemState_OPERATIONAL)
+        {
+            return false;
+        }
+
+        /*
+         * Startup is complete, keep the timeline as it is now and save it.
+         * A failure to write the file is reported by event, and the file
+         * can still be written by command.
+         */
+        CFE_Atomic_Store(&TimingPtr->IsClosed, 1);
+        CFE_ES_StartupTimingWriteFile(NULL, 0);
+    }
+
+    TotalRecords = CFE_Atomic_Load(&TimingPtr->NumRecords);
+    NumRecords   = TotalRecords;
+    if (NumRecords > CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS)
+    {
+        NumRecords = CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS;
+    }
+
+    /*
+     * A slot that was claimed before the timeline closed may still be being
+     * filled in.  Records are only sent in order, so wait for it to become
+     * valid and resume from it with a later housekeeping request.
+     */
+    if (TimingPtr->NextTlmRecord >= NumRecords ||
+        CFE_Atomic_Load(&TimingPtr->Slots[TimingPtr->NextTlmRecord].IsValid) == 0)
+    {
+        return false;
+    }
+
+    memset(Payload, 0, sizeof(*Payload));
+
+    Payload->NumRecords     = NumRecords;
+    Payload->DroppedRecords = TotalRecords - NumRecords;
+    Payload->FirstRecord    = TimingPtr->NextTlmRecord;
+
+    NumInPacket = 0;
+    while (NumInPacket < CFE_MISSION_ES_STARTUP_TIMING_PER_PKT && TimingPtr->NextTlmRecord < NumRecords &&
+           CFE_Atomic_Load(&TimingPtr->Slots[TimingPtr->NextTlmRecord].IsValid) != 0)
+    {
+        Payload->Records[NumInPacket] = TimingPtr->Slots[TimingPtr->NextTlmRecord].Rec;
+        ++NumInPacket;
+        ++TimingPtr->NextTlmRecord;
+    }
+
+    Payload->NumInPacket = NumInPacket;
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_StartupTimingWriteFile(const char *FileName, size_t FileNameSize)
+{
+    CFE_ES_BackgroundStartupTimingDumpGlobal_t *StatePtr;
+    int32                                       Status;
+
+    StatePtr = &CFE_ES_Global.BackgroundStartupTimingDumpState;
+
+    /* check if pending before overwriting fields in the structure */
+    if (CFE_FS_BackgroundFileDumpIsPending(&StatePtr->FileWrite))
+    {
+        Status = CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+    else
+    {
+        /* Reset the entire state object (just for good measure, ensure no stale data) */
+        memset(StatePtr, 0, sizeof(*StatePtr));
+
+        StatePtr->FileWrite.FileSubType = CFE_FS_SubType_ES_STARTUPTIMING;
+        snprintf(StatePtr->FileWrite.Description, sizeof(StatePtr->FileWrite.Description),
+                 CFE_ES_STARTUP_TIMING_DESC);
+
+        StatePtr->FileWrite.GetData = CFE_ES_BackgroundStartupTimingFileDataGetter;
+        StatePtr->FileWrite.OnEvent = CFE_ES_BackgroundStartupTimingFileEventHandler;
+
+        /*
+        ** Copy the filename into local buffer with default name/path/extension if not specified
+        */
+        Status = CFE_FS_ParseInputFileNameEx(StatePtr->FileWrite.FileName, FileName,
+                                             sizeof(StatePtr->FileWrite.FileName), FileNameSize,
+                                             CFE_PLATFORM_ES_DEFAULT_STARTUP_TIMING_FILE,
+                                             CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
+                                             CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
+
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_FS_BackgroundFileDumpRequest(&StatePtr->FileWrite);
+        }
+    }
+
+    if (Status == CFE_STATUS_REQUEST_ALREADY_PENDING)
+    {
+        CFE_EVS_SendEvent(CFE_ES_STARTUP_TIMING_PENDING_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Startup timing write already in progress");
+    }
+    else if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CFE_ES_STARTUP_TIMING_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error creating startup timing file, RC = %d", (int)Status);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_BackgroundStartupTimingFileDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize)
+{
+    CFE_ES_StartupTimingGlobal_t *TimingPtr;
+    uint32                        NumRecords;
+
+    TimingPtr = &CFE_ES_Global.StartupTiming;
+
+    NumRecords = CFE_Atomic_Load(&TimingPtr->NumRecords);
+    if (NumRecords > CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS)
+    {
+        NumRecords = CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS;
+    }
+
+    /* Records do not change once valid, so no lock is needed even before the timeline is closed */
+    if (RecordNum < NumRecords && CFE_Atomic_Load(&TimingPtr->Slots[RecordNum].IsValid) != 0)
+    {
+        *Buffer  = &TimingPtr->Slots[RecordNum].Rec;
+        *BufSize = sizeof(TimingPtr->Slots[RecordNum].Rec);
+    }
+    else
+    {
+        *Buffer  = NULL;
+        *BufSize = 0;
+    }
+
+    /* Check for EOF (last entry)  */
+    return ((RecordNum + 1) >= NumRecords);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_BackgroundStartupTimingFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status,
+                                                    uint32 RecordNum, size_t BlockSize, size_t Position)
+{
+    CFE_ES_BackgroundStartupTimingDumpGlobal_t *StatePtr;
+
+    StatePtr = (CFE_ES_BackgroundStartupTimingDumpGlobal_t *)Meta;
+
+    /* Note that this runs in the context of ES background task (file writer background job) */
+    switch (Event)
+    {
+        case CFE_FS_FileWriteEvent_COMPLETE:
+            CFE_EVS_SendEvent(CFE_ES_STARTUP_TIMING_FILE_EID, CFE_EVS_EventType_DEBUG, "%s written:Size=%lu",
+                              StatePtr->FileWrite.FileName, (unsigned long)Position);
+            break;
+
+        case CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR:
+        case CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_FILEWRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "File write,byte cnt err,file %s,request=%u,actual=%u", StatePtr->FileWrite.FileName,
+                              (int)BlockSize, (int)Status);
+            break;
+
+        case CFE_FS_FileWriteEvent_CREATE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_STARTUP_TIMING_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error creating file %s, RC = %d", StatePtr->FileWrite.FileName, (int)Status);
+            break;
+
+        default:
+            /* unhandled event - ignore */
+            break;
+    }
+}
@@ -36,7 +36,12 @@
 /*
 ** Include Files
 */
+#include "osapi.h"
+#include "cfe_platform_cfg.h"
 #include "cfe_es_api_typedefs.h"
+#include "cfe_fs_api_typedefs.h"
+#include "cfe_es_msg.h"
+#include "cfe_core_atomic.h"
 
 /*
 ** Macro Definitions
@@ -65,6 +70,44 @@ typedef union
     void *                    VoidPtr;
 } CFE_ES_FuncPtrUnion_t;
 
+/*
+** One entry of the startup timeline
+**
+** IsValid is set once the record has been filled in, since a slot is
+** claimed before its record is written.
+*/
+typedef struct
+{
+    CFE_ES_StartupTimingRec_t Rec;
+    CFE_Atomic_Uint32_t       IsValid;
+} CFE_ES_StartupTimingSlot_t;
+
+/*
+** Startup timeline state
+**
+** Records are added without a lock: a slot is claimed by advancing
+** NumRecords.  The timeline is closed at the first housekeeping request
+** after the system becomes operational, after which no more records are
+** added and NextTlmRecord is used by the ES task to send the timeline in
+** telemetry, one packet per housekeeping request.
+*/
+typedef struct
+{
+    OS_time_t                  StartTime;     /* PSP time at the start of CFE_ES_Main */
+    CFE_Atomic_Uint32_t        NumRecords;    /* Slots claimed, may exceed the size of the table */
+    CFE_Atomic_Uint32_t        IsClosed;      /* Set once startup is complete */
+    uint32                     NextTlmRecord; /* Next record to send in telemetry */
+    CFE_ES_StartupTimingSlot_t Slots[CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS];
+} CFE_ES_StartupTimingGlobal_t;
+
+/*
+** Startup timeline file write state
+*/
+typedef struct
+{
+    CFE_FS_FileWriteMetaData_t FileWrite; /**< FS state data - must be first */
+} CFE_ES_BackgroundStartupTimingDumpGlobal_t;
+
 typedef struct
 {
     uint32                ObjectType;                  /* The type of object being created */
@@ -117,4 +160,80 @@ void CFE_ES_InitializeFileSystems(uint32 StartType);
  */
 void CFE_ES_SetupPerfVariables(uint32 ResetType);
 
+/*
+ * Name: CFE_ES_StartupTimingInit
+ *
+ * Purpose: This function starts the startup timeline.
+ *
+ * Assumptions and Notes: This gets called from CFE_ES_Main() right after the
+ * global data is cleared, so the timeline covers all of startup.
+ */
+void CFE_ES_StartupTimingInit(void);
+
+/*
+ * Name: CFE_ES_StartupTimingNow
+ *
+ * Purpose: This function gets the time since the timeline started, in microseconds.
+ */
+uint32 CFE_ES_StartupTimingNow(void);
+
+/*
+ * Name: CFE_ES_StartupTimingRecord
+ *
+ * Purpose: This function adds a record to the startup timeline, for a phase
+ *          that started at StartUsec and ends now.
+ *
+ * Assumptions and Notes: This does not take any lock and may be called from any
+ * task.  Nothing is recorded once the timeline is closed.  If the timeline is
+ * full the record is counted as dropped.
+ */
+void CFE_ES_StartupTimingRecord(CFE_ES_StartupPhase_Enum_t Phase, const char *Name, uint32 StartUsec);
+
+/*
+ * Name: CFE_ES_StartupTimingMark
+ *
+ * Purpose: This function adds a record with no duration to the startup timeline.
+ */
+void CFE_ES_StartupTimingMark(CFE_ES_StartupPhase_Enum_t Phase, const char *Name);
+
+/*
+ * Name: CFE_ES_StartupTimingUpdate
+ *
+ * Purpose: This function is called by the ES task with each housekeeping request.
+ *          At the first request after the system becomes operational it closes
+ *          the timeline and writes it to the default file.  It then fills the
+ *          packet with the next records, until all records have been sent once.
+ *          A packet ends before a record that is not yet filled in, and the next
+ *          request resumes from that record.
+ *
+ * Returns true if the packet was filled and should be sent, false otherwise.
+ */
+bool CFE_ES_StartupTimingUpdate(CFE_ES_StartupTimingTlm_Payload_t *Payload);
+
+/*
+ * Name: CFE_ES_StartupTimingWriteFile
+ *
+ * Purpose: This function requests the startup timeline be written to a file
+ *          by the ES background task.  The default file is used if FileName is
+ *          empty.  An error event is sent if the request fails.
+ */
+int32 CFE_ES_StartupTimingWriteFile(const char *FileName, size_t FileNameSize);
+
+/*
+ * Name: CFE_ES_BackgroundStartupTimingFileDataGetter
+ *
+ * Purpose: Background file write data getter for the startup timeline file.
+ *          Gets one record of the timeline per call, skipping slots that
+ *          were claimed but not filled in.
+ */
+bool CFE_ES_BackgroundStartupTimingFileDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
+
+/*
+ * Name: CFE_ES_BackgroundStartupTimingFileEventHandler
+ *
+ * Purpose: Background file write event handler for the startup timeline file.
+ */
+void CFE_ES_BackgroundStartupTimingFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status,
+                                                    uint32 RecordNum, size_t BlockSize, size_t Position);
+
 #endif /* CFE_ES_START_H */
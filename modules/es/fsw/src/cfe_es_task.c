@@ -169,10 +169,10 @@ void CFE_ES_TaskMain(void)
             CFE_ES_TaskPipe(SBBufPtr);
 
             /*
-             * Wake up the background task, which includes the
-             * scanning of the ES app table for entries that may need cleanup
+             * Wake up the background scan of the ES app table,
+             * for entries that may need cleanup
              */
-            CFE_ES_BackgroundWakeup();
+            CFE_ES_WakeBackgroundJob(CFE_ES_Global.BackgroundTask.AppScanJobNum);
         }
         else
         {
@@ -349,6 +349,31 @@ int32 CFE_ES_TaskInit(void)
     CFE_MSG_Init(CFE_MSG_PTR(CFE_ES_Global.TaskData.MemStatsPacket.TelemetryHeader),
                  CFE_SB_ValueToMsgId(CFE_ES_MEMSTATS_TLM_MID), sizeof(CFE_ES_Global.TaskData.MemStatsPacket));
 
+    /*
+    ** Initialize memory pool diagnostics telemetry packet
+    */
+    CFE_MSG_Init(CFE_MSG_PTR(CFE_ES_Global.TaskData.MemPoolDiagPacket.TelemetryHeader),
+                 CFE_SB_ValueToMsgId(CFE_ES_MEMPOOLDIAG_TLM_MID), sizeof(CFE_ES_Global.TaskData.MemPoolDiagPacket));
+
+    /*
+    ** Initialize performance marker statistics telemetry packet
+    */
+    CFE_MSG_Init(CFE_MSG_PTR(CFE_ES_Global.TaskData.PerfStatsPacket.TelemetryHeader),
+                 CFE_SB_ValueToMsgId(CFE_ES_PERFSTATS_TLM_MID), sizeof(CFE_ES_Global.TaskData.PerfStatsPacket));
+
+    /*
+    ** Initialize startup timeline telemetry packet
+    */
+    CFE_MSG_Init(CFE_MSG_PTR(CFE_ES_Global.TaskData.StartupTimingPacket.TelemetryHeader),
+                 CFE_SB_ValueToMsgId(CFE_ES_STARTUPTIMING_TLM_MID),
+                 sizeof(CFE_ES_Global.TaskData.StartupTimingPacket));
+
+    /*
+    ** Initialize background job statistics telemetry packet
+    */
+    CFE_MSG_Init(CFE_MSG_PTR(CFE_ES_Global.TaskData.BackgroundJobsPacket.TelemetryHeader),
+                 CFE_SB_ValueToMsgId(CFE_ES_BGJOBS_TLM_MID), sizeof(CFE_ES_Global.TaskData.BackgroundJobsPacket));
+
     /*
     ** Create Software Bus message pipe
     */
@@ -502,7 +527,10 @@ int32 CFE_ES_SendHkCmd(const CFE_ES_SendHkCmd_t *data)
         CFE_ES_Global.ResetDataPtr->ResetVars.MaxProcessorResetCount;
     CFE_ES_Global.TaskData.HkPacket.Payload.BootSource = CFE_ES_Global.ResetDataPtr->ResetVars.BootSource;
 
-    CFE_ES_Global.TaskData.HkPacket.Payload.PerfState        = CFE_ES_Global.ResetDataPtr->Perf.MetaData.State;
+    CFE_ES_UpdatePerfMetaData();
+
+    CFE_ES_Global.TaskData.HkPacket.Payload.PerfState =
+        CFE_Atomic_Load(&CFE_ES_Global.ResetDataPtr->Perf.MetaData.State);
     CFE_ES_Global.TaskData.HkPacket.Payload.PerfMode         = CFE_ES_Global.ResetDataPtr->Perf.MetaData.Mode;
     CFE_ES_Global.TaskData.HkPacket.Payload.PerfTriggerCount = CFE_ES_Global.ResetDataPtr->Perf.MetaData.TriggerCount;
     CFE_ES_Global.TaskData.HkPacket.Payload.PerfDataStart    = CFE_ES_Global.ResetDataPtr->Perf.MetaData.DataStart;
@@ -510,6 +538,10 @@ int32 CFE_ES_SendHkCmd(const CFE_ES_SendHkCmd_t *data)
     CFE_ES_Global.TaskData.HkPacket.Payload.PerfDataCount    = CFE_ES_Global.ResetDataPtr->Perf.MetaData.DataCount;
     CFE_ES_Global.TaskData.HkPacket.Payload.PerfDataToWrite  = CFE_ES_GetPerfLogDumpRemaining();
 
+    CFE_ES_Global.TaskData.HkPacket.Payload.PerfStreamEntries = CFE_ES_Global.BackgroundPerfStreamState.TotalEntries;
+    CFE_ES_Global.TaskData.HkPacket.Payload.PerfStreamDropped =
+        CFE_Atomic_Load(&CFE_ES_Global.BackgroundPerfStreamState.DropCount);
+
     /*
      * Fill out the perf trigger/filter mask objects
      * The entire array in the HK payload object (external size) must be filled,
@@ -560,6 +592,33 @@ int32 CFE_ES_SendHkCmd(const CFE_ES_SendHkCmd_t *data)
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.HkPacket.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.HkPacket.TelemetryHeader), true);
 
+#ifdef CFE_ES_PERF_MARKER_STATS_ENABLED
+    /*
+    ** Send the next set of performance marker statistics along with housekeeping
+    */
+    CFE_ES_GetPerfStats(&CFE_ES_Global.TaskData.PerfStatsPacket.Payload);
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.PerfStatsPacket.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.PerfStatsPacket.TelemetryHeader), true);
+#endif
+
+    /*
+    ** Once startup is complete, send the startup timeline, one part with each housekeeping
+    */
+    if (CFE_ES_StartupTimingUpdate(&CFE_ES_Global.TaskData.StartupTimingPacket.Payload))
+    {
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.StartupTimingPacket.TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.StartupTimingPacket.TelemetryHeader), true);
+    }
+
+    /*
+    ** Send the statistics of the next set of background jobs along with housekeeping
+    */
+    if (CFE_ES_GetBackgroundJobStats(&CFE_ES_Global.TaskData.BackgroundJobsPacket.Payload))
+    {
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.BackgroundJobsPacket.TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.BackgroundJobsPacket.TelemetryHeader), true);
+    }
+
     /*
     ** This command does not affect the command execution counter.
     */
@@ -983,36 +1042,40 @@ int32 CFE_ES_QueryAllCmd(const CFE_ES_QueryAllCmd_t *data)
     uint32                              NumResources;
     CFE_ES_AppRecord_t *                AppRecPtr;
     CFE_ES_LibRecord_t *                LibRecPtr;
+    CFE_ES_SharedDataReadState_t        ReadState;
 
     /*
      * Collect list of active resource IDs.
      *
-     * This should be done while locked, but the actual writing
-     * of the AppInfo data should be done while NOT locked.
+     * This is a read-only pass over the tables, and the actual
+     * writing of the AppInfo data should be done while NOT locked.
      */
-    CFE_ES_LockSharedData(__func__, __LINE__);
-    NumResources = 0;
-    AppRecPtr    = CFE_ES_Global.AppTable;
-    for (i = 0; i < CFE_PLATFORM_ES_MAX_APPLICATIONS; ++i)
+    memset(&ReadState, 0, sizeof(ReadState));
+    do
     {
-        if (CFE_ES_AppRecordIsUsed(AppRecPtr))
+        CFE_ES_ReadSharedDataBegin(&ReadState, __func__, __LINE__);
+        NumResources = 0;
+        AppRecPtr    = CFE_ES_Global.AppTable;
+        for (i = 0; i < CFE_PLATFORM_ES_MAX_APPLICATIONS; ++i)
         {
-            ResourceList[NumResources] = CFE_RESOURCEID_UNWRAP(CFE_ES_AppRecordGetID(AppRecPtr));
-            ++NumResources;
+            if (CFE_ES_AppRecordIsUsed(AppRecPtr))
+            {
+                ResourceList[NumResources] = CFE_RESOURCEID_UNWRAP(CFE_ES_AppRecordGetID(AppRecPtr));
+                ++NumResources;
+            }
+            ++AppRecPtr;
         }
-        ++AppRecPtr;
-    }
-    LibRecPtr = CFE_ES_Global.LibTable;
-    for (i = 0; i < CFE_PLATFORM_ES_MAX_LIBRARIES; ++i)
-    {
-        if (CFE_ES_LibRecordIsUsed(LibRecPtr))
+        LibRecPtr = CFE_ES_Global.LibTable;
+        for (i = 0; i < CFE_PLATFORM_ES_MAX_LIBRARIES; ++i)
         {
-            ResourceList[NumResources] = CFE_RESOURCEID_UNWRAP(CFE_ES_LibRecordGetID(LibRecPtr));
-            ++NumResources;
+            if (CFE_ES_LibRecordIsUsed(LibRecPtr))
+            {
+                ResourceList[NumResources] = CFE_RESOURCEID_UNWRAP(CFE_ES_LibRecordGetID(LibRecPtr));
+                ++NumResources;
+            }
+            ++LibRecPtr;
         }
-        ++LibRecPtr;
-    }
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
+    } while (CFE_ES_ReadSharedDataRetry(&ReadState, __func__, __LINE__));
 
     /* Copy the commanded filename, using default if unspecified */
     Result = CFE_FS_ParseInputFileNameEx(QueryAllFilename, CmdPtr->FileName, sizeof(QueryAllFilename),
@@ -1142,26 +1205,30 @@ int32 CFE_ES_QueryAllTasksCmd(const CFE_ES_QueryAllTasksCmd_t *data)
     CFE_ES_TaskId_t                     TaskList[OS_MAX_TASKS];
     uint32                              NumTasks;
     CFE_ES_TaskRecord_t *               TaskRecPtr;
+    CFE_ES_SharedDataReadState_t        ReadState;
 
     /*
      * Collect list of active task IDs.
      *
-     * This should be done while locked, but the actual writing
-     * of the AppInfo data should be done while NOT locked.
+     * This is a read-only pass over the task table, and the actual
+     * writing of the AppInfo data should be done while NOT locked.
      */
-    CFE_ES_LockSharedData(__func__, __LINE__);
-    NumTasks   = 0;
-    TaskRecPtr = CFE_ES_Global.TaskTable;
-    for (i = 0; i < OS_MAX_TASKS; ++i)
+    memset(&ReadState, 0, sizeof(ReadState));
+    do
     {
-        if (CFE_ES_TaskRecordIsUsed(TaskRecPtr))
+        CFE_ES_ReadSharedDataBegin(&ReadState, __func__, __LINE__);
+        NumTasks   = 0;
+        TaskRecPtr = CFE_ES_Global.TaskTable;
+        for (i = 0; i < OS_MAX_TASKS; ++i)
         {
-            TaskList[NumTasks] = CFE_ES_TaskRecordGetID(TaskRecPtr);
-            ++NumTasks;
+            if (CFE_ES_TaskRecordIsUsed(TaskRecPtr))
+            {
+                TaskList[NumTasks] = CFE_ES_TaskRecordGetID(TaskRecPtr);
+                ++NumTasks;
+            }
+            ++TaskRecPtr;
         }
-        ++TaskRecPtr;
-    }
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
+    } while (CFE_ES_ReadSharedDataRetry(&ReadState, __func__, __LINE__));
 
     /*
     ** Copy the commanded filename into local buffer to ensure size limitation and to allow for modification
@@ -1483,6 +1550,175 @@ int32 CFE_ES_WriteERLogCmd(const CFE_ES_WriteERLogCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_WriteMemPoolStatsCmd(const CFE_ES_WriteMemPoolStatsCmd_t *data)
+{
+    const CFE_ES_FileNameCmd_Payload_t *    CmdPtr = &data->Payload;
+    CFE_ES_BackgroundPoolStatsDumpGlobal_t *StatePtr;
+    int32                                   Status;
+
+    StatePtr = &CFE_ES_Global.BackgroundPoolStatsDumpState;
+
+    /* check if pending before overwriting fields in the structure */
+    if (CFE_FS_BackgroundFileDumpIsPending(&StatePtr->FileWrite))
+    {
+        Status = CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+    else
+    {
+        /* Reset the entire state object (just for good measure, ensure no stale data) */
+        memset(StatePtr, 0, sizeof(*StatePtr));
+
+        StatePtr->FileWrite.FileSubType = CFE_FS_SubType_ES_POOLSTATS;
+        snprintf(StatePtr->FileWrite.Description, sizeof(StatePtr->FileWrite.Description), CFE_ES_POOL_STATS_DESC);
+
+        StatePtr->FileWrite.GetData = CFE_ES_BackgroundPoolStatsFileDataGetter;
+        StatePtr->FileWrite.OnEvent = CFE_ES_BackgroundPoolStatsFileEventHandler;
+
+        /*
+        ** Copy the filename into local buffer with default name/path/extension if not specified
+        */
+        Status = CFE_FS_ParseInputFileNameEx(StatePtr->FileWrite.FileName, CmdPtr->FileName,
+                                             sizeof(StatePtr->FileWrite.FileName), sizeof(CmdPtr->FileName),
+                                             CFE_PLATFORM_ES_DEFAULT_POOL_STATS_FILE,
+                                             CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
+                                             CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
+
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_FS_BackgroundFileDumpRequest(&StatePtr->FileWrite);
+        }
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        if (Status == CFE_STATUS_REQUEST_ALREADY_PENDING)
+        {
+            CFE_EVS_SendEvent(CFE_ES_POOL_STATS_PENDING_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Memory pool stats write already in progress");
+        }
+        else
+        {
+            CFE_EVS_SendEvent(CFE_ES_POOL_STATS_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error creating memory pool stats file, RC = %d", (int)Status);
+        }
+
+        /* background dump did not start, consider this an error */
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
+    }
+    else
+    {
+        CFE_ES_Global.TaskData.CommandCounter++;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_WritePoolAllocSitesCmd(const CFE_ES_WritePoolAllocSitesCmd_t *data)
+{
+#ifdef CFE_ES_POOL_ALLOC_TRACKING_ENABLED
+    const CFE_ES_FileNameCmd_Payload_t *     CmdPtr = &data->Payload;
+    CFE_ES_BackgroundAllocSitesDumpGlobal_t *StatePtr;
+    int32                                    Status;
+
+    StatePtr = &CFE_ES_Global.BackgroundAllocSitesDumpState;
+
+    /* check if pending before overwriting fields in the structure */
+    if (CFE_FS_BackgroundFileDumpIsPending(&StatePtr->FileWrite))
+    {
+        Status = CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+    else
+    {
+        /* Reset the entire state object (just for good measure, ensure no stale data) */
+        memset(StatePtr, 0, sizeof(*StatePtr));
+
+        StatePtr->FileWrite.FileSubType = CFE_FS_SubType_ES_POOLALLOCSITES;
+        snprintf(StatePtr->FileWrite.Description, sizeof(StatePtr->FileWrite.Description),
+                 CFE_ES_POOL_ALLOC_SITES_DESC);
+
+        StatePtr->FileWrite.GetData = CFE_ES_BackgroundAllocSitesFileDataGetter;
+        StatePtr->FileWrite.OnEvent = CFE_ES_BackgroundAllocSitesFileEventHandler;
+
+        /*
+        ** Copy the filename into local buffer with default name/path/extension if not specified
+        */
+        Status = CFE_FS_ParseInputFileNameEx(StatePtr->FileWrite.FileName, CmdPtr->FileName,
+                                             sizeof(StatePtr->FileWrite.FileName), sizeof(CmdPtr->FileName),
+                                             CFE_PLATFORM_ES_DEFAULT_POOL_ALLOC_SITES_FILE,
+                                             CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
+                                             CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
+
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_FS_BackgroundFileDumpRequest(&StatePtr->FileWrite);
+        }
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        if (Status == CFE_STATUS_REQUEST_ALREADY_PENDING)
+        {
+            CFE_EVS_SendEvent(CFE_ES_POOL_ALLOC_SITES_PENDING_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Memory pool allocation sites write already in progress");
+        }
+        else
+        {
+            CFE_EVS_SendEvent(CFE_ES_POOL_ALLOC_SITES_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error creating memory pool allocation sites file, RC = %d", (int)Status);
+        }
+
+        /* background dump did not start, consider this an error */
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
+    }
+    else
+    {
+        CFE_ES_Global.TaskData.CommandCounter++;
+    }
+#else
+    CFE_EVS_SendEvent(CFE_ES_POOL_ALLOC_SITES_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Memory pool allocation tracking is not enabled");
+    CFE_ES_Global.TaskData.CommandErrorCounter++;
+#endif
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_WriteStartupTimingCmd(const CFE_ES_WriteStartupTimingCmd_t *data)
+{
+    const CFE_ES_FileNameCmd_Payload_t *CmdPtr = &data->Payload;
+
+    /* The error event, if any, is sent by CFE_ES_StartupTimingWriteFile() */
+    if (CFE_ES_StartupTimingWriteFile(CmdPtr->FileName, sizeof(CmdPtr->FileName)) != CFE_SUCCESS)
+    {
+        /* background dump did not start, consider this an error */
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
+    }
+    else
+    {
+        CFE_ES_Global.TaskData.CommandCounter++;
+    }
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1620,6 +1856,18 @@ int32 CFE_ES_SendMemPoolStatsCmd(const CFE_ES_SendMemPoolStatsCmd_t *data)
         CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.MemStatsPacket.TelemetryHeader));
         CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.MemStatsPacket.TelemetryHeader), true);
 
+        /*
+        ** Pools that keep diagnostics also get a diagnostics telemetry packet.
+        */
+        CFE_ES_GetMemPoolDiag(&CFE_ES_Global.TaskData.MemPoolDiagPacket.Payload.PoolDiag, MemHandle);
+        if (CFE_ES_Global.TaskData.MemPoolDiagPacket.Payload.PoolDiag.DiagEnabled)
+        {
+            CFE_ES_Global.TaskData.MemPoolDiagPacket.Payload.PoolHandle = MemHandle;
+
+            CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.MemPoolDiagPacket.TelemetryHeader));
+            CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.MemPoolDiagPacket.TelemetryHeader), true);
+        }
+
         CFE_ES_Global.TaskData.CommandCounter++;
         CFE_EVS_SendEvent(CFE_ES_TLM_POOL_STATS_INFO_EID, CFE_EVS_EventType_DEBUG,
                           "Successfully telemetered memory pool stats for 0x%08lX",
@@ -54,11 +54,14 @@
 /*
 ** ES File descriptions
 */
-#define CFE_ES_SYS_LOG_DESC  "ES system log data file"
-#define CFE_ES_TASK_LOG_DESC "ES Task Info file"
-#define CFE_ES_APP_LOG_DESC  "ES Application Info file"
-#define CFE_ES_ER_LOG_DESC   "ES ERlog data file"
-#define CFE_ES_PERF_LOG_DESC "ES Performance data file"
+#define CFE_ES_SYS_LOG_DESC          "ES system log data file"
+#define CFE_ES_TASK_LOG_DESC         "ES Task Info file"
+#define CFE_ES_APP_LOG_DESC          "ES Application Info file"
+#define CFE_ES_ER_LOG_DESC           "ES ERlog data file"
+#define CFE_ES_PERF_LOG_DESC         "ES Performance data file"
+#define CFE_ES_POOL_STATS_DESC       "ES Memory Pool Statistics file"
+#define CFE_ES_POOL_ALLOC_SITES_DESC "ES Memory Pool Allocation Sites file"
+#define CFE_ES_STARTUP_TIMING_DESC   "ES Startup Timeline file"
 
 /*
  * Limit for the total number of entries that may be
@@ -113,6 +116,34 @@ int32 CFE_ES_BackgroundInit(void);
  */
 void CFE_ES_BackgroundTask(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Calls the background jobs that are due
+ *
+ * Purpose: Runs one pass of the background task.  The timers of all jobs are
+ * advanced by the elapsed time, then the jobs that are due or were woken are
+ * called in priority order until the time budget of the pass is used up.
+ * Jobs past their deadline are called even when the budget is used up.
+ *
+ * \param ElapsedTime Time in milliseconds since the previous pass
+ *
+ * \return The time in milliseconds until the next job is due
+ */
+uint32 CFE_ES_BackgroundRunJobs(uint32 ElapsedTime);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Fills in the next part of the background job statistics telemetry
+ *
+ * Purpose: Copies the statistics of up to #CFE_MISSION_ES_BACKGROUND_JOBS_PER_PKT
+ * jobs, continuing after the last job reported by the previous call.
+ *
+ * \param Payload Telemetry payload to fill in
+ *
+ * \return true if the payload was filled in, false if no jobs are registered
+ */
+bool CFE_ES_GetBackgroundJobStats(CFE_ES_BackgroundJobsTlm_Payload_t *Payload);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Exit/Stop the background task
@@ -255,12 +286,36 @@ int32 CFE_ES_SetPerfFilterMaskCmd(const CFE_ES_SetPerfFilterMaskCmd_t *data);
  */
 int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Process Cmd to clear the performance marker duration statistics.
+ */
+int32 CFE_ES_ResetPerfStatsCmd(const CFE_ES_ResetPerfStatsCmd_t *data);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief  Telemeter Memory Pool Statistics
  */
 int32 CFE_ES_SendMemPoolStatsCmd(const CFE_ES_SendMemPoolStatsCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Process Cmd to write the statistics of all memory pools to a file.
+ */
+int32 CFE_ES_WriteMemPoolStatsCmd(const CFE_ES_WriteMemPoolStatsCmd_t *data);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Process Cmd to write the live memory pool blocks, grouped by allocation site, to a file.
+ */
+int32 CFE_ES_WritePoolAllocSitesCmd(const CFE_ES_WritePoolAllocSitesCmd_t *data);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Process Cmd to write the startup timeline to a file.
+ */
+int32 CFE_ES_WriteStartupTimingCmd(const CFE_ES_WriteStartupTimingCmd_t *data);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief  Dump CDS Registry to a file
@@ -53,6 +53,14 @@
 #error CFE_PLATFORM_ES_SYSTEM_LOG_SIZE cannot be less than 512 Bytes!
 #endif
 
+#if CFE_PLATFORM_ES_STARTUP_SCRIPT_CACHE_SIZE < 128
+#error CFE_PLATFORM_ES_STARTUP_SCRIPT_CACHE_SIZE cannot be less than 128 bytes!
+#endif
+
+#if CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS < 1
+#error CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS cannot be less than 1!
+#endif
+
 #if CFE_PLATFORM_ES_DEFAULT_STACK_SIZE < 2048
 #error CFE_PLATFORM_ES_DEFAULT_STACK_SIZE cannot be less than 2048 Bytes!
 #endif
@@ -149,6 +157,66 @@
 #error CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE cannot be less than 1025 entries!
 #endif
 
+/*
+** Performance data streaming
+*/
+#if CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES < 1
+#error CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES cannot be less than 1!
+#elif (CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE % CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES) != 0
+#error CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE must be a multiple of CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES!
+#elif (CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES) < 2
+#error CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE must hold at least two CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES chunks!
+#endif
+
+#if CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES < CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES
+#error CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES cannot be less than CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES!
+#endif
+
+#if CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES < 1
+#error CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES cannot be less than 1!
+#elif CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES > 100
+#error CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES cannot be greater than 100!
+#endif
+
+/*
+** Performance marker duration statistics
+*/
+#if (CFE_PLATFORM_ES_PERF_MARKER_STATS != 0) && (CFE_PLATFORM_ES_PERF_MARKER_STATS != 1)
+#error CFE_PLATFORM_ES_PERF_MARKER_STATS must be 0 or 1
+#endif
+
+#if CFE_PLATFORM_ES_PERF_MARKER_STATS_DEPTH < 1
+#error CFE_PLATFORM_ES_PERF_MARKER_STATS_DEPTH cannot be less than 1!
+#elif CFE_PLATFORM_ES_PERF_MARKER_STATS_DEPTH > 255
+#error CFE_PLATFORM_ES_PERF_MARKER_STATS_DEPTH cannot be greater than 255!
+#endif
+
+#if CFE_MISSION_ES_PERF_STATS_PER_PKT < 1
+#error CFE_MISSION_ES_PERF_STATS_PER_PKT cannot be less than 1!
+#endif
+
+#if CFE_MISSION_ES_STARTUP_TIMING_PER_PKT < 1
+#error CFE_MISSION_ES_STARTUP_TIMING_PER_PKT cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS < 32
+#error CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS cannot be less than 32!
+#endif
+
+#if CFE_MISSION_ES_BACKGROUND_JOBS_PER_PKT < 1
+#error CFE_MISSION_ES_BACKGROUND_JOBS_PER_PKT cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS < 8
+#error CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS cannot be less than 8!
+#endif
+
+#if CFE_MISSION_ES_PERF_STATS_HIST_BUCKETS < 2
+#error CFE_MISSION_ES_PERF_STATS_HIST_BUCKETS cannot be less than 2!
+#elif CFE_MISSION_ES_PERF_STATS_HIST_BUCKETS > 32
+#error CFE_MISSION_ES_PERF_STATS_HIST_BUCKETS cannot be greater than 32!
+#endif
+
 /*
 ** Maximum number of Registered CDS blocks
 */
@@ -156,6 +224,19 @@
 #error CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES cannot be less than 8!
 #endif
 
+/*
+** Deferred CDS writes
+*/
+#if CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_BYTES < 4
+#error CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_BYTES cannot be less than 4!
+#endif
+
+#if CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_RATE < 10
+#error CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_RATE cannot be less than 10 milliseconds!
+#elif CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_RATE > 60000
+#error CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_RATE cannot be greater than 60000 milliseconds!
+#endif
+
 /*
 ** Maximum number of processor resets before a power-on
 */
@@ -210,4 +291,32 @@
 #error CFE_MISSION_ES_CDS_MAX_FULL_NAME_LEN must be a multiple of 4
 #endif
 
+#if (CFE_PLATFORM_ES_TASK_CONTEXT_CACHE != 0) && (CFE_PLATFORM_ES_TASK_CONTEXT_CACHE != 1)
+#error CFE_PLATFORM_ES_TASK_CONTEXT_CACHE must be 0 or 1
+#endif
+
+#if CFE_PLATFORM_ES_POOL_TASK_CACHES < 1
+#error CFE_PLATFORM_ES_POOL_TASK_CACHES cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH < 2
+#error CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH cannot be less than 2!
+#endif
+
+#if (CFE_PLATFORM_ES_POOL_ALLOC_TRACKING != 0) && (CFE_PLATFORM_ES_POOL_ALLOC_TRACKING != 1)
+#error CFE_PLATFORM_ES_POOL_ALLOC_TRACKING must be 0 or 1
+#endif
+
+#if CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES < 1
+#error CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_ES_POOL_LEAK_AGE_MSEC < 0
+#error CFE_PLATFORM_ES_POOL_LEAK_AGE_MSEC cannot be less than 0!
+#endif
+
+#if (CFE_PLATFORM_ES_CRC_HW_ACCEL != 0) && (CFE_PLATFORM_ES_CRC_HW_ACCEL != 1)
+#error CFE_PLATFORM_ES_CRC_HW_ACCEL must be 0 or 1
+#endif
+
 #endif /* CFE_ES_VERIFY_H */
@@ -23,3 +23,6 @@ set(ES_MISSION_CONFIG_FILE_LIST
 
 
 generate_configfile_set(${ES_MISSION_CONFIG_FILE_LIST})
+
+# Add the subdirectory for the host tool that converts performance log files
+add_subdirectory(${CMAKE_CURRENT_LIST_DIR}/tool cfe_es_perflog_tool)
@@ -0,0 +1,909 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Host tool to convert CFE ES performance log files
+ *
+ * Reads a file written by the ES performance log dump (or one of the
+ * files written in STREAM mode) and writes it out as either:
+ *
+ *  - Chrome trace event JSON, which can be loaded by chrome://tracing and
+ *    by the Perfetto UI.  Each marker is shown on its own track, since the
+ *    log does not record which task logged an entry.
+ *  - Collapsed stacks, one line per distinct marker nesting with the time
+ *    spent in it in microseconds, as used by flame graph generators.  The
+ *    nesting is rebuilt separately for each context (normally a task) from
+ *    the order of entry and exit events, see CFE_ES_PerfLogTool_FindContexts().
+ *
+ * Writers claim log slots before reading the timer, so the entries in the
+ * file are not strictly in time order.  They are sorted by time on input.
+ *
+ * Marker names are taken from perf ID header files, by matching lines of
+ * the form "#define XXX_PERF_ID value".
+ */
+
+#include "common_types.h"
+#include "cfe_mission_cfg.h"
+#include "cfe_fs_filedef.h"
+#include "cfe_perfids.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+#define CFE_ES_PERFLOG_TOOL_MAX_NAME_LEN      64
+#define CFE_ES_PERFLOG_TOOL_MAX_IDS_FILES     16
+#define CFE_ES_PERFLOG_TOOL_MAX_INCLUDE_DEPTH 8
+#define CFE_ES_PERFLOG_TOOL_MAX_STACK_DEPTH   32
+
+/*
+ * Size of the fixed part of CFE_ES_PerfMetaData_t as written to the file,
+ * up to the filter and trigger masks.  The masks follow, each holding the
+ * number of words given by FilterTriggerMaskSize.
+ */
+#define CFE_ES_PERFLOG_TOOL_METADATA_FIXED_SIZE 44
+
+/* Size of one CFE_ES_PerfDataEntry_t as written to the file */
+#define CFE_ES_PERFLOG_TOOL_ENTRY_SIZE 12
+
+typedef enum
+{
+    CFE_ES_PerfLogTool_Format_CHROME,
+    CFE_ES_PerfLogTool_Format_COLLAPSED
+} CFE_ES_PerfLogTool_Format_t;
+
+/**
+ * One decoded log entry
+ */
+typedef struct CFE_ES_PerfLogTool_Entry
+{
+    uint32 Marker;   /**< Marker ID */
+    bool   IsExit;   /**< Whether this is an exit */
+    size_t FileSeq;  /**< Position in the file, keeps entries with the same time in file order */
+    double TimeUsec; /**< Time relative to the earliest entry */
+} CFE_ES_PerfLogTool_Entry_t;
+
+/**
+ * Decoded performance log
+ */
+typedef struct CFE_ES_PerfLogTool_Log
+{
+    uint32                      ProcessorID;
+    uint32                      TimerTicksPerSecond;
+    uint32                      TimerLow32Rollover;
+    uint32                      Mode;
+    uint32                      TriggerCount;
+    size_t                      NumEntries;
+    CFE_ES_PerfLogTool_Entry_t *Entries; /**< Entries in time order */
+} CFE_ES_PerfLogTool_Log_t;
+
+/**
+ * One distinct marker nesting and the time spent in it, for collapsed stacks
+ */
+typedef struct CFE_ES_PerfLogTool_Stack
+{
+    uint32 Depth;
+    uint32 Marker[CFE_ES_PERFLOG_TOOL_MAX_STACK_DEPTH];
+    double TotalUsec;
+} CFE_ES_PerfLogTool_Stack_t;
+
+/**
+ * Value of a marker's context when it has not been seen yet
+ */
+#define CFE_ES_PERFLOG_TOOL_NO_CONTEXT (-1)
+
+static char CFE_ES_PerfLogTool_MarkerNames[CFE_MISSION_ES_PERF_MAX_IDS][CFE_ES_PERFLOG_TOOL_MAX_NAME_LEN];
+
+/*----------------------------------------------------------------
+ *
+ * Prints command line usage information
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfLogTool_PrintUsage(const char *cmd)
+{
+    fprintf(stderr, "Usage: %s [-f chrome|collapsed] [-i perfids_header]... [-o output_file] perf_log_file\n\n", cmd);
+    fprintf(stderr, " -f: output format (default chrome)\n");
+    fprintf(stderr, "     chrome:    Chrome trace event JSON, for chrome://tracing or the Perfetto UI\n");
+    fprintf(stderr, "     collapsed: collapsed stacks with time in microseconds, for flame graphs\n");
+    fprintf(stderr, " -i: header file with perf ID definitions, may be repeated\n");
+#ifdef CFE_ES_PERFLOG_TOOL_DEFAULT_IDS_FILE
+    fprintf(stderr, "     (default %s)\n", CFE_ES_PERFLOG_TOOL_DEFAULT_IDS_FILE);
+#endif
+    fprintf(stderr, " -o: output file (default standard output)\n\n");
+}
+
+/*----------------------------------------------------------------
+ *
+ * Decodes a 32-bit value stored in big endian byte order
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_PerfLogTool_GetBigEndian32(const uint8 *Ptr)
+{
+    return ((uint32)Ptr[0] << 24) | ((uint32)Ptr[1] << 16) | ((uint32)Ptr[2] << 8) | (uint32)Ptr[3];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Decodes a 32-bit value stored in the byte order of the target
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_PerfLogTool_GetTarget32(const uint8 *Ptr, bool IsBigEndian)
+{
+    if (IsBigEndian)
+    {
+        return CFE_ES_PerfLogTool_GetBigEndian32(Ptr);
+    }
+
+    return ((uint32)Ptr[3] << 24) | ((uint32)Ptr[2] << 16) | ((uint32)Ptr[1] << 8) | (uint32)Ptr[0];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Reads perf ID definitions from a header file, following any
+ * #include "..." directives, such as those in generated wrapper headers
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_PerfLogTool_ReadIdsFile(const char *FileName, int IncludeDepth)
+{
+    FILE *        fp;
+    char          LineBuf[512];
+    char          PathBuf[1024];
+    char          NameBuf[CFE_ES_PERFLOG_TOOL_MAX_NAME_LEN];
+    char *        Token;
+    char *        EndPtr;
+    const char *  Slash;
+    size_t        NameLen;
+    unsigned long Value;
+
+    if (IncludeDepth > CFE_ES_PERFLOG_TOOL_MAX_INCLUDE_DEPTH)
+    {
+        fprintf(stderr, "%s: includes nested too deeply\n", FileName);
+        return false;
+    }
+
+    fp = fopen(FileName, "r");
+    if (fp == NULL)
+    {
+        perror(FileName);
+        return false;
+    }
+
+    while (fgets(LineBuf, sizeof(LineBuf), fp) != NULL)
+    {
+        Token = strtok(LineBuf, " \t\r\n");
+        if (Token == NULL)
+        {
+            continue;
+        }
+
+        if (strcmp(Token, "#include") == 0)
+        {
+            Token = strtok(NULL, " \t\r\n");
+            if (Token == NULL || Token[0] != '"')
+            {
+                /* system headers do not hold perf IDs */
+                continue;
+            }
+
+            ++Token;
+            EndPtr = strchr(Token, '"');
+            if (EndPtr != NULL)
+            {
+                *EndPtr = 0;
+            }
+
+            /* relative paths are relative to the including file */
+            Slash = strrchr(FileName, '/');
+            if (Token[0] == '/' || Slash == NULL)
+            {
+                snprintf(PathBuf, sizeof(PathBuf), "%s", Token);
+            }
+            else
+            {
+                snprintf(PathBuf, sizeof(PathBuf), "%.*s/%s", (int)(Slash - FileName), FileName, Token);
+            }
+
+            if (!CFE_ES_PerfLogTool_ReadIdsFile(PathBuf, IncludeDepth + 1))
+            {
+                fclose(fp);
+                return false;
+            }
+        }
+        else if (strcmp(Token, "#define") == 0)
+        {
+            Token = strtok(NULL, " \t\r\n");
+            if (Token == NULL)
+            {
+                continue;
+            }
+
+            NameLen = strlen(Token);
+            if (NameLen <= 8 || strcmp(&Token[NameLen - 8], "_PERF_ID") != 0)
+            {
+                continue;
+            }
+
+            snprintf(NameBuf, sizeof(NameBuf), "%.*s", (int)(NameLen - 8), Token);
+
+            Token = strtok(NULL, " \t\r\n");
+            if (Token == NULL)
+            {
+                continue;
+            }
+
+            Value = strtoul(Token, &EndPtr, 0);
+            if (EndPtr == Token || Value >= CFE_MISSION_ES_PERF_MAX_IDS)
+            {
+                /* not a plain number, or not a valid marker */
+                continue;
+            }
+
+            /* drop the common prefix of the cFE core IDs */
+            Token = NameBuf;
+            if (strncmp(Token, "CFE_MISSION_", 12) == 0)
+            {
+                Token += 12;
+            }
+
+            snprintf(CFE_ES_PerfLogTool_MarkerNames[Value], CFE_ES_PERFLOG_TOOL_MAX_NAME_LEN, "%s", Token);
+        }
+    }
+
+    fclose(fp);
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Returns the display name of a marker
+ *
+ *-----------------------------------------------------------------*/
+const char *CFE_ES_PerfLogTool_MarkerName(uint32 Marker)
+{
+    static char UnnamedBuf[CFE_ES_PERFLOG_TOOL_MAX_NAME_LEN];
+
+    if (Marker < CFE_MISSION_ES_PERF_MAX_IDS && CFE_ES_PerfLogTool_MarkerNames[Marker][0] != 0)
+    {
+        return CFE_ES_PerfLogTool_MarkerNames[Marker];
+    }
+
+    snprintf(UnnamedBuf, sizeof(UnnamedBuf), "MARKER_%lu", (unsigned long)Marker);
+    return UnnamedBuf;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Orders log entries by time, and by file position for equal times
+ *
+ *-----------------------------------------------------------------*/
+static int CFE_ES_PerfLogTool_CompareEntries(const void *A, const void *B)
+{
+    const CFE_ES_PerfLogTool_Entry_t *EntryA = A;
+    const CFE_ES_PerfLogTool_Entry_t *EntryB = B;
+
+    if (EntryA->TimeUsec != EntryB->TimeUsec)
+    {
+        return (EntryA->TimeUsec < EntryB->TimeUsec) ? -1 : 1;
+    }
+    if (EntryA->FileSeq != EntryB->FileSeq)
+    {
+        return (EntryA->FileSeq < EntryB->FileSeq) ? -1 : 1;
+    }
+
+    return 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Reads and decodes a performance log file
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_PerfLogTool_ReadLog(const char *FileName, CFE_ES_PerfLogTool_Log_t *Log)
+{
+    FILE * fp;
+    uint8 *FileData;
+    long   FileSize;
+    size_t Offset;
+    size_t i;
+    bool   IsBigEndian;
+    uint32 MaskSize;
+    uint32 Data;
+    uint64 Rollover;
+    uint64 Ticks;
+    uint64 FirstTicks;
+    double BaseUsec;
+    bool   Success;
+
+    fp = fopen(FileName, "rb");
+    if (fp == NULL)
+    {
+        perror(FileName);
+        return false;
+    }
+
+    FileData = NULL;
+    Success  = false;
+
+    if (fseek(fp, 0, SEEK_END) == 0 && (FileSize = ftell(fp)) >= 0 && fseek(fp, 0, SEEK_SET) == 0)
+    {
+        FileData = malloc(FileSize + 1);
+        if (FileData != NULL && fread(FileData, 1, FileSize, fp) == (size_t)FileSize)
+        {
+            Success = true;
+        }
+    }
+
+    fclose(fp);
+
+    if (!Success)
+    {
+        fprintf(stderr, "%s: unable to read file\n", FileName);
+        free(FileData);
+        return false;
+    }
+
+    Success = false;
+
+    /* The cFE file header is always big endian */
+    if ((size_t)FileSize < sizeof(CFE_FS_Header_t) + CFE_ES_PERFLOG_TOOL_METADATA_FIXED_SIZE)
+    {
+        fprintf(stderr, "%s: file is too short\n", FileName);
+    }
+    else if (CFE_ES_PerfLogTool_GetBigEndian32(&FileData[offsetof(CFE_FS_Header_t, ContentType)]) !=
+                 CFE_FS_FILE_CONTENT_ID ||
+             CFE_ES_PerfLogTool_GetBigEndian32(&FileData[offsetof(CFE_FS_Header_t, SubType)]) !=
+                 CFE_FS_SubType_ES_PERFDATA)
+    {
+        fprintf(stderr, "%s: not a performance log file\n", FileName);
+    }
+    else
+    {
+        Log->ProcessorID = CFE_ES_PerfLogTool_GetBigEndian32(&FileData[offsetof(CFE_FS_Header_t, ProcessorID)]);
+
+        /* The metadata and entries are in the byte order of the target, as given by the Endian field */
+        Offset      = sizeof(CFE_FS_Header_t);
+        IsBigEndian = (FileData[Offset + 1] != 0);
+
+        Log->TimerTicksPerSecond = CFE_ES_PerfLogTool_GetTarget32(&FileData[Offset + 4], IsBigEndian);
+        Log->TimerLow32Rollover  = CFE_ES_PerfLogTool_GetTarget32(&FileData[Offset + 8], IsBigEndian);
+        Log->Mode                = CFE_ES_PerfLogTool_GetTarget32(&FileData[Offset + 16], IsBigEndian);
+        Log->TriggerCount        = CFE_ES_PerfLogTool_GetTarget32(&FileData[Offset + 20], IsBigEndian);
+        MaskSize                 = CFE_ES_PerfLogTool_GetTarget32(&FileData[Offset + 40], IsBigEndian);
+
+        Offset += CFE_ES_PERFLOG_TOOL_METADATA_FIXED_SIZE + (2 * sizeof(uint32) * (size_t)MaskSize);
+
+        if (Log->TimerTicksPerSecond == 0 || Offset > (size_t)FileSize)
+        {
+            fprintf(stderr, "%s: invalid performance log metadata\n", FileName);
+        }
+        else
+        {
+            Success = true;
+        }
+    }
+
+    if (Success)
+    {
+        /* Use every complete entry in the file, a stream file may still be growing */
+        Log->NumEntries = ((size_t)FileSize - Offset) / CFE_ES_PERFLOG_TOOL_ENTRY_SIZE;
+        Log->Entries    = calloc(Log->NumEntries + 1, sizeof(*Log->Entries));
+
+        if (Log->Entries == NULL)
+        {
+            fprintf(stderr, "%s: out of memory\n", FileName);
+            Success = false;
+        }
+    }
+
+    if (Success)
+    {
+        Rollover = Log->TimerLow32Rollover;
+        if (Rollover == 0)
+        {
+            Rollover = (uint64)1 << 32;
+        }
+
+        FirstTicks = 0;
+        for (i = 0; i < Log->NumEntries; ++i)
+        {
+            Data  = CFE_ES_PerfLogTool_GetTarget32(&FileData[Offset], IsBigEndian);
+            Ticks = (uint64)CFE_ES_PerfLogTool_GetTarget32(&FileData[Offset + 4], IsBigEndian) * Rollover +
+                    CFE_ES_PerfLogTool_GetTarget32(&FileData[Offset + 8], IsBigEndian);
+
+            if (i == 0)
+            {
+                FirstTicks = Ticks;
+            }
+
+            Log->Entries[i].Marker   = Data & ~((uint32)1 << CFE_MISSION_ES_PERF_EXIT_BIT);
+            Log->Entries[i].IsExit   = (Data & ((uint32)1 << CFE_MISSION_ES_PERF_EXIT_BIT)) != 0;
+            Log->Entries[i].FileSeq  = i;
+            Log->Entries[i].TimeUsec = ((double)(int64)(Ticks - FirstTicks) * 1000000.0) / Log->TimerTicksPerSecond;
+
+            Offset += CFE_ES_PERFLOG_TOOL_ENTRY_SIZE;
+        }
+
+        /* A writer may be preempted between claiming its slot and reading the timer */
+        qsort(Log->Entries, Log->NumEntries, sizeof(*Log->Entries), CFE_ES_PerfLogTool_CompareEntries);
+
+        if (Log->NumEntries > 0)
+        {
+            BaseUsec = Log->Entries[0].TimeUsec;
+            for (i = 0; i < Log->NumEntries; ++i)
+            {
+                Log->Entries[i].TimeUsec -= BaseUsec;
+            }
+        }
+    }
+
+    free(FileData);
+    return Success;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Writes the log as Chrome trace event JSON
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfLogTool_WriteChrome(FILE *fp, const CFE_ES_PerfLogTool_Log_t *Log)
+{
+    static bool Seen[CFE_MISSION_ES_PERF_MAX_IDS];
+    size_t      i;
+    uint32      Marker;
+
+    fprintf(fp, "{\"displayTimeUnit\":\"ns\",\"otherData\":{\"ProcessorID\":%lu,\"TimerTicksPerSecond\":%lu,",
+            (unsigned long)Log->ProcessorID, (unsigned long)Log->TimerTicksPerSecond);
+    fprintf(fp, "\"TimerLow32Rollover\":%lu,\"Mode\":%lu,\"TriggerCount\":%lu},\n\"traceEvents\":[\n",
+            (unsigned long)Log->TimerLow32Rollover, (unsigned long)Log->Mode, (unsigned long)Log->TriggerCount);
+
+    fprintf(fp, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%lu,\"args\":{\"name\":\"CPU %lu\"}}",
+            (unsigned long)Log->ProcessorID, (unsigned long)Log->ProcessorID);
+
+    /* name and order the track of each marker that appears in the log */
+    memset(Seen, 0, sizeof(Seen));
+    for (i = 0; i < Log->NumEntries; ++i)
+    {
+        Marker = Log->Entries[i].Marker;
+        if (Marker < CFE_MISSION_ES_PERF_MAX_IDS && !Seen[Marker])
+        {
+            Seen[Marker] = true;
+            fprintf(fp, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%lu,\"tid\":%lu,\"args\":{\"name\":\"%s\"}}",
+                    (unsigned long)Log->ProcessorID, (unsigned long)Marker, CFE_ES_PerfLogTool_MarkerName(Marker));
+            fprintf(fp,
+                    ",\n{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":%lu,\"tid\":%lu,\"args\":{\"sort_index\":%lu}}",
+                    (unsigned long)Log->ProcessorID, (unsigned long)Marker, (unsigned long)Marker);
+        }
+    }
+
+    for (i = 0; i < Log->NumEntries; ++i)
+    {
+        fprintf(fp, ",\n{\"name\":\"%s\",\"cat\":\"perf\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":%lu,\"tid\":%lu}",
+                CFE_ES_PerfLogTool_MarkerName(Log->Entries[i].Marker), Log->Entries[i].IsExit ? 'E' : 'B',
+                Log->Entries[i].TimeUsec, (unsigned long)Log->ProcessorID, (unsigned long)Log->Entries[i].Marker);
+    }
+
+    fprintf(fp, "\n]}\n");
+}
+
+/*----------------------------------------------------------------
+ *
+ * Adds time to the total of a marker nesting, for collapsed stacks
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_PerfLogTool_AddStackTime(CFE_ES_PerfLogTool_Stack_t **Stacks, size_t *NumStacks,
+                                            size_t *MaxStacks, const CFE_ES_PerfLogTool_Stack_t *Current,
+                                            double Elapsed)
+{
+    CFE_ES_PerfLogTool_Stack_t *StackPtr;
+    size_t                      j;
+
+    for (j = 0; j < *NumStacks; ++j)
+    {
+        if ((*Stacks)[j].Depth == Current->Depth &&
+            memcmp((*Stacks)[j].Marker, Current->Marker, Current->Depth * sizeof(Current->Marker[0])) == 0)
+        {
+            break;
+        }
+    }
+
+    if (j == *NumStacks)
+    {
+        if (*NumStacks == *MaxStacks)
+        {
+            *MaxStacks = (*MaxStacks == 0) ? 64 : (*MaxStacks * 2);
+            StackPtr   = realloc(*Stacks, *MaxStacks * sizeof(**Stacks));
+            if (StackPtr == NULL)
+            {
+                fprintf(stderr, "out of memory\n");
+                return false;
+            }
+            *Stacks = StackPtr;
+        }
+
+        (*Stacks)[j]           = *Current;
+        (*Stacks)[j].TotalUsec = 0;
+        ++(*NumStacks);
+    }
+
+    (*Stacks)[j].TotalUsec += Elapsed;
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Pushes a marker entry on a marker nesting
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_PerfLogTool_StackPush(CFE_ES_PerfLogTool_Stack_t *Stack, uint32 Marker)
+{
+    /* deeper nesting than this is treated as a sibling of the deepest marker */
+    if (Stack->Depth == CFE_ES_PERFLOG_TOOL_MAX_STACK_DEPTH)
+    {
+        --Stack->Depth;
+    }
+    Stack->Marker[Stack->Depth] = Marker;
+    ++Stack->Depth;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Pops a marker nesting back to the most recent entry of a marker
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_PerfLogTool_StackPop(CFE_ES_PerfLogTool_Stack_t *Stack, uint32 Marker)
+{
+    uint32 k;
+
+    k = Stack->Depth;
+    while (k > 0 && Stack->Marker[k - 1] != Marker)
+    {
+        --k;
+    }
+
+    /* an exit without an entry (e.g. from before the log started) is ignored */
+    if (k > 0)
+    {
+        Stack->Depth = k - 1;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Assigns each marker to a context, for collapsed stacks
+ *
+ * The log does not record which task logged each entry, so this infers it
+ * from the nesting of the whole log, in two passes over a single stack:
+ *
+ *  - A marker that is entered at least once while no other marker is open
+ *    is a root, such as the main loop marker of a task, and has a context
+ *    of its own.
+ *  - Every other marker belongs to the context of the root it is most often
+ *    nested in, taking the innermost root on the stack at each entry.  Using
+ *    the majority keeps an entry logged just after a task switch from
+ *    placing the marker in the wrong task.
+ *
+ * Contexts are identified by their root marker.  Markers that are never
+ * entered are left without a context.
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_PerfLogTool_FindContexts(const CFE_ES_PerfLogTool_Log_t *Log, int *MarkerContext)
+{
+    static uint32                     NestCount[CFE_MISSION_ES_PERF_MAX_IDS][CFE_MISSION_ES_PERF_MAX_IDS];
+    static bool                       IsRoot[CFE_MISSION_ES_PERF_MAX_IDS];
+    CFE_ES_PerfLogTool_Stack_t        Global;
+    const CFE_ES_PerfLogTool_Entry_t *EntryPtr;
+    size_t                            i;
+    uint32                            k;
+    uint32                            Marker;
+    uint32                            Root;
+
+    memset(NestCount, 0, sizeof(NestCount));
+    memset(IsRoot, 0, sizeof(IsRoot));
+
+    /* first pass finds the roots */
+    memset(&Global, 0, sizeof(Global));
+    for (i = 0; i < Log->NumEntries; ++i)
+    {
+        EntryPtr = &Log->Entries[i];
+        if (EntryPtr->Marker >= CFE_MISSION_ES_PERF_MAX_IDS)
+        {
+            continue;
+        }
+
+        if (EntryPtr->IsExit)
+        {
+            CFE_ES_PerfLogTool_StackPop(&Global, EntryPtr->Marker);
+        }
+        else
+        {
+            if (Global.Depth == 0)
+            {
+                IsRoot[EntryPtr->Marker] = true;
+            }
+            CFE_ES_PerfLogTool_StackPush(&Global, EntryPtr->Marker);
+        }
+    }
+
+    /* second pass counts the innermost root below each entry of the other markers */
+    memset(&Global, 0, sizeof(Global));
+    for (i = 0; i < Log->NumEntries; ++i)
+    {
+        EntryPtr = &Log->Entries[i];
+        if (EntryPtr->Marker >= CFE_MISSION_ES_PERF_MAX_IDS)
+        {
+            continue;
+        }
+
+        if (EntryPtr->IsExit)
+        {
+            CFE_ES_PerfLogTool_StackPop(&Global, EntryPtr->Marker);
+            continue;
+        }
+
+        if (!IsRoot[EntryPtr->Marker])
+        {
+            /* the bottom of the stack is always a root */
+            k = Global.Depth;
+            while (k > 1 && !IsRoot[Global.Marker[k - 1]])
+            {
+                --k;
+            }
+            ++NestCount[EntryPtr->Marker][Global.Marker[k - 1]];
+        }
+
+        CFE_ES_PerfLogTool_StackPush(&Global, EntryPtr->Marker);
+    }
+
+    for (Marker = 0; Marker < CFE_MISSION_ES_PERF_MAX_IDS; ++Marker)
+    {
+        MarkerContext[Marker] = CFE_ES_PERFLOG_TOOL_NO_CONTEXT;
+
+        if (IsRoot[Marker])
+        {
+            MarkerContext[Marker] = Marker;
+            continue;
+        }
+
+        for (Root = 0; Root < CFE_MISSION_ES_PERF_MAX_IDS; ++Root)
+        {
+            if (NestCount[Marker][Root] != 0 && (MarkerContext[Marker] == CFE_ES_PERFLOG_TOOL_NO_CONTEXT ||
+                                                 NestCount[Marker][Root] > NestCount[Marker][MarkerContext[Marker]]))
+            {
+                MarkerContext[Marker] = Root;
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Writes the log as collapsed stacks
+ *
+ * The nesting is rebuilt separately for each context (see
+ * CFE_ES_PerfLogTool_FindContexts()), so entries of different tasks that
+ * interleave in the log do not nest in one another.  Within a context, an
+ * entry pushes its marker and an exit pops back to the most recent entry of
+ * the same marker.
+ *
+ * The time between two events is charged to the stack of the context that
+ * logged the first of them, as that is the task that was running.
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_PerfLogTool_WriteCollapsed(FILE *fp, const CFE_ES_PerfLogTool_Log_t *Log)
+{
+    static CFE_ES_PerfLogTool_Stack_t Contexts[CFE_MISSION_ES_PERF_MAX_IDS];
+    static int                        MarkerContext[CFE_MISSION_ES_PERF_MAX_IDS];
+    const CFE_ES_PerfLogTool_Entry_t *EntryPtr;
+    CFE_ES_PerfLogTool_Stack_t *      Current;
+    CFE_ES_PerfLogTool_Stack_t *      Stacks;
+    size_t                            NumStacks;
+    size_t                            MaxStacks;
+    size_t                            i;
+    size_t                            j;
+    uint32                            k;
+    int                               LastContext;
+    double                            LastUsec;
+    bool                              Success;
+
+    CFE_ES_PerfLogTool_FindContexts(Log, MarkerContext);
+    memset(Contexts, 0, sizeof(Contexts));
+
+    Stacks      = NULL;
+    NumStacks   = 0;
+    MaxStacks   = 0;
+    LastContext = CFE_ES_PERFLOG_TOOL_NO_CONTEXT;
+    LastUsec    = 0;
+    Success     = true;
+
+    for (i = 0; Success && i < Log->NumEntries; ++i)
+    {
+        EntryPtr = &Log->Entries[i];
+        if (EntryPtr->Marker >= CFE_MISSION_ES_PERF_MAX_IDS ||
+            MarkerContext[EntryPtr->Marker] == CFE_ES_PERFLOG_TOOL_NO_CONTEXT)
+        {
+            /* not a valid marker, or only ever exited, so it cannot be placed in a context */
+            continue;
+        }
+
+        if (LastContext != CFE_ES_PERFLOG_TOOL_NO_CONTEXT && Contexts[LastContext].Depth > 0)
+        {
+            Success = CFE_ES_PerfLogTool_AddStackTime(&Stacks, &NumStacks, &MaxStacks, &Contexts[LastContext],
+                                                      EntryPtr->TimeUsec - LastUsec);
+        }
+
+        LastContext = MarkerContext[EntryPtr->Marker];
+        LastUsec    = EntryPtr->TimeUsec;
+        Current     = &Contexts[LastContext];
+
+        if (EntryPtr->IsExit)
+        {
+            CFE_ES_PerfLogTool_StackPop(Current, EntryPtr->Marker);
+        }
+        else
+        {
+            CFE_ES_PerfLogTool_StackPush(Current, EntryPtr->Marker);
+        }
+    }
+
+    for (j = 0; Success && j < NumStacks; ++j)
+    {
+        /* flame graph tools take integer sample counts, so round to whole microseconds */
+        if (Stacks[j].TotalUsec < 0.5)
+        {
+            continue;
+        }
+
+        for (k = 0; k < Stacks[j].Depth; ++k)
+        {
+            fprintf(fp, "%s%s", (k == 0) ? "" : ";", CFE_ES_PerfLogTool_MarkerName(Stacks[j].Marker[k]));
+        }
+
+        fprintf(fp, " %.0f\n", Stacks[j].TotalUsec);
+    }
+
+    free(Stacks);
+    return Success;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Main entry point
+ *
+ *-----------------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+    CFE_ES_PerfLogTool_Log_t    Log;
+    CFE_ES_PerfLogTool_Format_t Format;
+    const char *                IdsFiles[CFE_ES_PERFLOG_TOOL_MAX_IDS_FILES];
+    const char *                OutFileName;
+    FILE *                      OutFile;
+    int                         NumIdsFiles;
+    int                         opt;
+    int                         i;
+    bool                        Success;
+
+    Format      = CFE_ES_PerfLogTool_Format_CHROME;
+    OutFileName = NULL;
+    NumIdsFiles = 0;
+    Success     = true;
+
+    while ((opt = getopt(argc, argv, "f:i:o:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'f':
+                if (strcasecmp(optarg, "chrome") == 0)
+                {
+                    Format = CFE_ES_PerfLogTool_Format_CHROME;
+                }
+                else if (strcasecmp(optarg, "collapsed") == 0)
+                {
+                    Format = CFE_ES_PerfLogTool_Format_COLLAPSED;
+                }
+                else
+                {
+                    Success = false;
+                }
+                break;
+
+            case 'i':
+                if (NumIdsFiles < CFE_ES_PERFLOG_TOOL_MAX_IDS_FILES)
+                {
+                    IdsFiles[NumIdsFiles] = optarg;
+                    ++NumIdsFiles;
+                }
+                else
+                {
+                    Success = false;
+                }
+                break;
+
+            case 'o':
+                OutFileName = optarg;
+                break;
+
+            default:
+                Success = false;
+                break;
+        }
+    }
+
+    if (!Success || optind != (argc - 1))
+    {
+        CFE_ES_PerfLogTool_PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+#ifdef CFE_ES_PERFLOG_TOOL_DEFAULT_IDS_FILE
+    if (NumIdsFiles == 0)
+    {
+        IdsFiles[NumIdsFiles] = CFE_ES_PERFLOG_TOOL_DEFAULT_IDS_FILE;
+        ++NumIdsFiles;
+    }
+#endif
+
+    for (i = 0; i < NumIdsFiles; ++i)
+    {
+        /* markers without a name are still converted, so this is not fatal */
+        CFE_ES_PerfLogTool_ReadIdsFile(IdsFiles[i], 0);
+    }
+
+    memset(&Log, 0, sizeof(Log));
+    if (!CFE_ES_PerfLogTool_ReadLog(argv[optind], &Log))
+    {
+        return EXIT_FAILURE;
+    }
+
+    OutFile = stdout;
+    if (OutFileName != NULL)
+    {
+        OutFile = fopen(OutFileName, "w");
+        if (OutFile == NULL)
+        {
+            perror(OutFileName);
+            Success = false;
+        }
+    }
+
+    if (Success)
+    {
+        if (Format == CFE_ES_PerfLogTool_Format_COLLAPSED)
+        {
+            Success = CFE_ES_PerfLogTool_WriteCollapsed(OutFile, &Log);
+        }
+        else
+        {
+            CFE_ES_PerfLogTool_WriteChrome(OutFile, &Log);
+        }
+
+        if (OutFile != stdout)
+        {
+            fclose(OutFile);
+        }
+    }
+
+    free(Log.Entries);
+
+    return Success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -103,14 +103,17 @@ void TestInit(void)
 
 void TestStartupErrorPaths(void)
 {
-    int                     j;
-    ES_UT_SetAppStateHook_t StateHook;
-    uint32                  PanicStatus;
-    uint32                  ResetType;
-    OS_statvfs_t            StatBuf;
-    CFE_ES_TaskRecord_t *   TaskRecPtr;
-    CFE_ES_AppRecord_t *    AppRecPtr;
-    void *                  TempBuff;
+    int                               j;
+    ES_UT_SetAppStateHook_t           StateHook;
+    uint32                            PanicStatus;
+    uint32                            ResetType;
+    OS_statvfs_t                      StatBuf;
+    CFE_ES_TaskRecord_t *             TaskRecPtr;
+    CFE_ES_AppRecord_t *              AppRecPtr;
+    void *                            TempBuff;
+    CFE_ES_StartupTimingTlm_Payload_t TimingPayload;
+    size_t                            LocalBufSize;
+    uint32                            RunStatus;
 
     UtPrintf("Begin Test Startup Error Paths");
 
@@ -470,6 +473,107 @@ void TestStartupErrorPaths(void)
     ES_UT_SetupSingleAppId(CFE_ES_AppType_CORE, CFE_ES_AppState_EARLY_INIT, NULL, &AppRecPtr, NULL);
     CFE_ES_Global.SystemState = CFE_ES_SystemState_EARLY_INIT;
     CFE_UtAssert_SUCCESS(CFE_ES_WaitForSystemState(CFE_ES_SystemState_EARLY_INIT, 0));
+
+    /* The wait is added to the startup timeline under the name of the app */
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupTiming.NumRecords, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupTiming.Slots[0].Rec.Phase, CFE_ES_StartupPhase_STARTUP_SYNC);
+    UtAssert_STRINGBUF_EQ(CFE_ES_Global.StartupTiming.Slots[0].Rec.Name, -1, AppRecPtr->AppName,
+                          sizeof(AppRecPtr->AppName));
+
+    /* Only the first call to CFE_ES_RunLoop() is added to the timeline */
+    RunStatus = CFE_ES_RunStatus_APP_RUN;
+    UtAssert_BOOL_TRUE(CFE_ES_RunLoop(&RunStatus));
+    UtAssert_BOOL_TRUE(CFE_ES_RunLoop(&RunStatus));
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupTiming.NumRecords, 2);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupTiming.Slots[1].Rec.Phase, CFE_ES_StartupPhase_RUN_LOOP);
+    UtAssert_BOOL_TRUE(AppRecPtr->RunLoopEntered);
+
+    /* Records beyond the size of the timeline are dropped */
+    ES_ResetUnitTest();
+    for (j = 0; j <= CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS; ++j)
+    {
+        CFE_ES_StartupTimingRecord(CFE_ES_StartupPhase_MAIN_STEP, "UT", 0);
+    }
+
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupTiming.NumRecords, CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS + 1);
+
+    /* Nothing is sent until the system is operational */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), false);
+    UtAssert_BOOL_FALSE(CFE_ES_StartupTimingUpdate(&TimingPayload));
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 0);
+
+    /* The first update after that closes the timeline and writes it to a file */
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_OPERATIONAL;
+    UtAssert_BOOL_TRUE(CFE_ES_StartupTimingUpdate(&TimingPayload));
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+    UtAssert_UINT32_EQ(TimingPayload.NumRecords, CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS);
+    UtAssert_UINT32_EQ(TimingPayload.DroppedRecords, 1);
+    UtAssert_ZERO(TimingPayload.FirstRecord);
+    UtAssert_UINT32_EQ(TimingPayload.NumInPacket, CFE_MISSION_ES_STARTUP_TIMING_PER_PKT);
+    UtAssert_STRINGBUF_EQ(TimingPayload.Records[0].Name, sizeof(TimingPayload.Records[0].Name), "UT", -1);
+
+    /* Once closed nothing more is added, and the next update sends the next records */
+    CFE_ES_StartupTimingMark(CFE_ES_StartupPhase_RUN_LOOP, "UT");
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupTiming.NumRecords, CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS + 1);
+    UtAssert_BOOL_TRUE(CFE_ES_StartupTimingUpdate(&TimingPayload));
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+    UtAssert_UINT32_EQ(TimingPayload.FirstRecord, CFE_MISSION_ES_STARTUP_TIMING_PER_PKT);
+
+    /* A packet ends before a record that was claimed but not yet filled in */
+    CFE_ES_Global.StartupTiming.NextTlmRecord = CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS - 2;
+    CFE_ES_Global.StartupTiming.Slots[CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS - 1].IsValid = 0;
+    UtAssert_BOOL_TRUE(CFE_ES_StartupTimingUpdate(&TimingPayload));
+    UtAssert_UINT32_EQ(TimingPayload.NumInPacket, 1);
+
+    /* Nothing is sent while it is still not filled in, then sending resumes from it */
+    UtAssert_BOOL_FALSE(CFE_ES_StartupTimingUpdate(&TimingPayload));
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupTiming.NextTlmRecord, CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS - 1);
+    CFE_ES_Global.StartupTiming.Slots[CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS - 1].IsValid = 1;
+    UtAssert_BOOL_TRUE(CFE_ES_StartupTimingUpdate(&TimingPayload));
+    UtAssert_UINT32_EQ(TimingPayload.FirstRecord, CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS - 1);
+    UtAssert_UINT32_EQ(TimingPayload.NumInPacket, 1);
+
+    /* Updates stop after the last record */
+    UtAssert_BOOL_FALSE(CFE_ES_StartupTimingUpdate(&TimingPayload));
+
+    /* Test the startup timeline file background write functions */
+    TempBuff = NULL;
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundStartupTimingFileDataGetter(&CFE_ES_Global.BackgroundStartupTimingDumpState,
+                                                                     0, &TempBuff, &LocalBufSize));
+    UtAssert_ADDRESS_EQ(TempBuff, &CFE_ES_Global.StartupTiming.Slots[0].Rec);
+    UtAssert_EQ(size_t, LocalBufSize, sizeof(CFE_ES_StartupTimingRec_t));
+    CFE_ES_Global.StartupTiming.Slots[CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS - 1].IsValid = 0;
+    UtAssert_BOOL_TRUE(CFE_ES_BackgroundStartupTimingFileDataGetter(
+        &CFE_ES_Global.BackgroundStartupTimingDumpState, CFE_PLATFORM_ES_STARTUP_TIMING_MAX_RECORDS - 1, &TempBuff,
+        &LocalBufSize));
+    UtAssert_NULL(TempBuff);
+    UtAssert_ZERO(LocalBufSize);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundStartupTimingFileEventHandler(&CFE_ES_Global.BackgroundStartupTimingDumpState,
+                                                   CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 10, 0, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_STARTUP_TIMING_FILE_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundStartupTimingFileEventHandler(&CFE_ES_Global.BackgroundStartupTimingDumpState,
+                                                   CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, -1, 10, 10, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundStartupTimingFileEventHandler(&CFE_ES_Global.BackgroundStartupTimingDumpState,
+                                                   CFE_FS_FileWriteEvent_CREATE_ERROR, -1, 10, 10, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_STARTUP_TIMING_FILE_ERR_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundStartupTimingFileEventHandler(&CFE_ES_Global.BackgroundStartupTimingDumpState,
+                                                   CFE_FS_FileWriteEvent_UNDEFINED, CFE_SUCCESS, 10, 0, 100);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* An empty timeline is written as just the file header */
+    ES_ResetUnitTest();
+    UtAssert_BOOL_TRUE(CFE_ES_BackgroundStartupTimingFileDataGetter(&CFE_ES_Global.BackgroundStartupTimingDumpState,
+                                                                    0, &TempBuff, &LocalBufSize));
+    UtAssert_NULL(TempBuff);
 }
 
 static void ES_UT_UnusedAppTask(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
@@ -500,11 +604,6 @@ static void ES_UT_UsedAppTask(void *UserObj, UT_EntryKey_t FuncKey, const UT_Stu
     UtAppRecPtr->AppId   = UtTaskRecPtr->AppId;
 }
 
-static void ES_UT_SetPerfIdle(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
-{
-    CFE_ES_Global.ResetDataPtr->Perf.MetaData.State = CFE_ES_PERF_IDLE;
-}
-
 static void ES_UT_ForEachObjectIncrease(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
     OS_ArgCallback_t callback_ptr = UT_Hook_GetArgValueByName(Context, "callback_ptr", OS_ArgCallback_t);
@@ -543,17 +642,22 @@ static void ES_UT_Config_IterateAll(void *UserObj, UT_EntryKey_t FuncKey, const
 
 void TestApps(void)
 {
-    size_t                  NumBytes;
-    CFE_ES_AppInfo_t        AppInfo;
-    CFE_ES_AppId_t          AppId;
-    CFE_ES_TaskId_t         TaskId;
-    CFE_ES_TaskRecord_t *   UtTaskRecPtr;
-    CFE_ES_AppRecord_t *    UtAppRecPtr;
-    CFE_ES_AppRecord_t *    UtAppRecPtr1;
-    CFE_ES_MemPoolRecord_t *UtPoolRecPtr;
-    char                    NameBuffer[OS_MAX_API_NAME + 5];
-    CFE_ES_AppStartParams_t StartParams;
-    int                     ObjCount;
+    size_t                       NumBytes;
+    CFE_ES_AppInfo_t             AppInfo;
+    CFE_ES_AppId_t               AppId;
+    CFE_ES_TaskId_t              TaskId;
+    CFE_ES_TaskRecord_t *        UtTaskRecPtr;
+    CFE_ES_AppRecord_t *         UtAppRecPtr;
+    CFE_ES_AppRecord_t *         UtAppRecPtr1;
+    CFE_ES_MemPoolRecord_t *     UtPoolRecPtr;
+    char                         NameBuffer[OS_MAX_API_NAME + 5];
+    CFE_ES_AppStartParams_t      StartParams;
+    int                          ObjCount;
+    CFE_ES_StartupScriptCache_t  SavedCache;
+    CFE_ES_StartupScriptCache_t *CachePtr;
+    os_fstat_t                   StatBuf;
+    uint32                       NumLoads;
+    char                         LargeScript[2 * CFE_PLATFORM_ES_STARTUP_SCRIPT_CACHE_SIZE];
 
     UtPrintf("Begin Test Apps");
 
@@ -629,6 +733,234 @@ void TestApps(void)
     CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_ES_APP_STARTUP_OPEN]);
 
+    /* Test that the startup file is read in one chunk and its valid lines are kept in the reset area */
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, NULL);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
+    UtAssert_STUB_COUNT(OS_read, 1);
+    NumLoads = UT_GetStubCount(UT_KEY(OS_ModuleLoad));
+    UtAssert_NONZERO(NumLoads);
+    CachePtr = &ES_UT_PersistentResetData->StartupScript;
+    UtAssert_UINT32_EQ(CachePtr->Signature, CFE_ES_STARTSCRIPT_CACHE_SIGNATURE);
+    UtAssert_STRINGBUF_EQ(CachePtr->Data, CachePtr->Length,
+                          "CFE_LIB,/cf/apps/tst_lib.bundle,TST_LIB_Init,TST_LIB,0,0,0x0,1;"
+                          "CFE_APP,/cf/apps/ci.bundle,CI_task_main,CI_APP,70,4096,0x0,1;"
+                          "CFE_APP,/cf/apps/sch.bundle,SCH_TaskMain,SCH_APP,120,4096,0x0,1;"
+                          "CFE_APP,/cf/apps/to.bundle,TO_task_main,TO_APP,74,4096,0x0,1;",
+                          -1);
+    memcpy(&SavedCache, CachePtr, sizeof(SavedCache));
+
+    /* Test that a processor reset starts the same applications from the kept lines, without opening the file */
+    ES_ResetUnitTest();
+    memcpy(CachePtr, &SavedCache, sizeof(SavedCache));
+    UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, NULL);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
+    CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_STARTUP_CACHED]);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(OS_ModuleLoad)), NumLoads);
+
+    /* Test that the kept lines are not used when the file changed, or on a power on reset */
+    ES_ResetUnitTest();
+    memcpy(CachePtr, &SavedCache, sizeof(SavedCache));
+    memset(&StatBuf, 0, sizeof(StatBuf));
+    StatBuf.FileSize = NumBytes;
+    UT_SetDataBuffer(UT_KEY(OS_stat), &StatBuf, sizeof(StatBuf), false);
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
+    CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_ES_APP_STARTUP_OPEN]);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    ES_ResetUnitTest();
+    memcpy(CachePtr, &SavedCache, sizeof(SavedCache));
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_POWERON, "ut_startup");
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+
+    /* Test that the kept lines are used in place of the nonvolatile file when the volatile one is not found */
+    ES_ResetUnitTest();
+    memcpy(CachePtr, &SavedCache, sizeof(SavedCache));
+    strncpy(CachePtr->FileName, "ut_startup", sizeof(CachePtr->FileName) - 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 1, OS_ERROR);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
+    CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_STARTUP_CACHED]);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+
+    /* Test that corrupted kept lines are not used */
+    ES_ResetUnitTest();
+    memcpy(CachePtr, &SavedCache, sizeof(SavedCache));
+    CachePtr->Data[0] ^= 0x20;
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+
+    /* Test that a startup file is not kept when it cannot be read completely, or its file status is unknown */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, -1);
+    strncpy(LargeScript, "CFE_LIB,/cf/apps/tst_lib.bundle,TST_LIB_Init,TST_LIB,0,0,0x0,1;", sizeof(LargeScript) - 1);
+    LargeScript[sizeof(LargeScript) - 1] = '\0';
+    UT_SetReadBuffer(LargeScript, strlen(LargeScript));
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
+    CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_STARTUP_READ]);
+    UtAssert_ZERO(CachePtr->Signature);
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), OS_ERROR);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
+    UtAssert_ZERO(CachePtr->Signature);
+
+    /* Test that a startup file too large to keep is still used */
+    ES_ResetUnitTest();
+    memset(LargeScript, 0, sizeof(LargeScript));
+    while (strlen(LargeScript) + NumBytes < sizeof(LargeScript))
+    {
+        strncat(LargeScript, "CFE_LIB, /cf/apps/tst_lib.bundle, TST_LIB_Init, TST_LIB, 0, 0, 0x0, 1; ",
+                sizeof(LargeScript) - strlen(LargeScript) - 1);
+    }
+    UT_SetReadBuffer(LargeScript, strlen(LargeScript));
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
+    CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_STARTUP_TOO_LARGE_TO_KEEP]);
+    UtAssert_ZERO(CachePtr->Signature);
+    UtAssert_UINT32_GTEQ(UT_GetStubCount(UT_KEY(OS_read)), 2);
+
+    /* Test the load stages of startup script entries, with and without a dependency field */
+    ES_ResetUnitTest();
+    {
+        const char *LibA[] = {"CFE_LIB", "/cf/a.so", "A_Init", "A_LIB", "0", "0", "0x0", "0"};
+        const char *AppB[] = {"CFE_APP", "/cf/b.so", "B_Main", "B_APP", "70", "4096", "0x0", "0"};
+        const char *LibC[] = {"CFE_LIB", "/cf/c.so", "C_Init", "C_LIB", "0", "0", "0x0", "0"};
+        const char *AppD[] = {"CFE_APP", "/cf/d.so", "D_Main", "D_APP", "70", "4096", "0x0", "0", "A_LIB"};
+        const char *AppE[] = {"CFE_APP", "/cf/e.so", "E_Main", "E_APP", "70", "4096", "0x0", "0", "B_APP|D_APP"};
+        const char *AppF[] = {"CFE_APP", "/cf/f.so", "F_Main", "F_APP", "70", "4096", "0x0", "0", "NONE"};
+        const char *DrvG[] = {"CFE_DRV", "/cf/g.so", "G_Init", "G_DRV", "0", "0", "0x0", "0"};
+
+        CFE_ES_StartupLoadAddEntry(LibA, 8);
+        CFE_ES_StartupLoadAddEntry(AppB, 8);
+        CFE_ES_StartupLoadAddEntry(LibC, 8);
+        CFE_ES_StartupLoadAddEntry(AppD, 9);
+        CFE_ES_StartupLoadAddEntry(AppE, 9);
+        CFE_ES_StartupLoadAddEntry(AppF, 9);
+        CFE_ES_StartupLoadAddEntry(DrvG, 8);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.NumEntries, 7);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.Entries[0].Stage, 0);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.Entries[1].Stage, 1);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.Entries[2].Stage, 1);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.Entries[3].Stage, 1);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.Entries[4].Stage, 2);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.Entries[5].Stage, 0);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.Entries[6].State, CFE_ES_StartupLoadState_DONE);
+        UtAssert_STRINGBUF_EQ(CFE_ES_Global.StartupLoad.Entries[4].TokenList[8], -1, "B_APP|D_APP", -1);
+        UtAssert_ZERO(UT_PrintfIsInHistory(UT_OSP_MESSAGES[UT_OSP_STARTUP_UNKNOWN_DEPENDENCY]));
+
+        /* The modules are loaded once, ahead of the apps and libraries that use them */
+        UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, NULL);
+        CFE_ES_StartupLoadRun();
+        UtAssert_STUB_COUNT(OS_ModuleLoad, 6);
+        UtAssert_STUB_COUNT(OS_ModuleUnload, 0);
+        UtAssert_STUB_COUNT(OS_CountSemCreate, 1);
+        UtAssert_STUB_COUNT(OS_CountSemDelete, 1);
+        UtAssert_STUB_COUNT(OS_MutSemDelete, 1);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.NumEntries, 0);
+        UtAssert_BOOL_FALSE(CFE_ES_Global.StartupLoad.IsLoaded);
+    }
+
+    /* Test a dependency field naming an entry that is not before it, or not at all, and an empty name */
+    ES_ResetUnitTest();
+    {
+        const char *AppA[] = {"CFE_APP", "/cf/a.so", "A_Main", "A_APP", "70", "4096", "0x0", "0", "B_LIB|"};
+        const char *LibB[] = {"CFE_LIB", "/cf/b.so", "B_Init", "B_LIB", "0", "0", "0x0", "0", "NONE"};
+        const char *AppC[] = {"CFE_APP", "/cf/c.so", "C_Main", "C_APP", "70", "4096", "0x0", "0", "B_LI|B_LIB"};
+
+        CFE_ES_StartupLoadAddEntry(AppA, 9);
+        CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_STARTUP_UNKNOWN_DEPENDENCY]);
+        CFE_ES_StartupLoadAddEntry(LibB, 9);
+        CFE_ES_StartupLoadAddEntry(AppC, 9);
+        UtAssert_UINT32_EQ(UT_PrintfIsInHistory(UT_OSP_MESSAGES[UT_OSP_STARTUP_UNKNOWN_DEPENDENCY]), 2);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.Entries[0].Stage, 0);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.Entries[1].Stage, 0);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.Entries[2].Stage, 1);
+    }
+
+    /* Test loader tasks for libraries in the same stage, and a loader task creation failure */
+    ES_ResetUnitTest();
+    {
+        const char *LibA[] = {"CFE_LIB", "/cf/a.so", "A_Init", "A_LIB", "0", "0", "0x0", "0", "NONE"};
+        const char *LibB[] = {"CFE_LIB", "/cf/b.so", "B_Init", "B_LIB", "0", "0", "0x0", "0", "NONE"};
+        const char *LibC[] = {"CFE_LIB", "/cf/c.so", "C_Init", "C_LIB", "0", "0", "0x0", "0", "NONE"};
+
+        CFE_ES_StartupLoadAddEntry(LibA, 9);
+        CFE_ES_StartupLoadAddEntry(LibB, 9);
+        CFE_ES_StartupLoadAddEntry(LibC, 9);
+        CFE_ES_StartupLoadRun();
+        UtAssert_STUB_COUNT(OS_TaskCreate, 2);
+        UtAssert_STUB_COUNT(OS_CountSemTake, 2);
+        UtAssert_STUB_COUNT(OS_ModuleLoad, 3);
+
+        ES_ResetUnitTest();
+        CFE_ES_StartupLoadAddEntry(LibA, 9);
+        CFE_ES_StartupLoadAddEntry(LibB, 9);
+        CFE_ES_StartupLoadAddEntry(LibC, 9);
+        UT_SetDeferredRetcode(UT_KEY(OS_TaskCreate), 1, OS_ERROR);
+        CFE_ES_StartupLoadRun();
+        UtAssert_STUB_COUNT(OS_CountSemTake, 0);
+        UtAssert_STUB_COUNT(OS_ModuleLoad, 3);
+
+        /* Test that the modules are loaded in sequence if the loader sync objects cannot be created */
+        ES_ResetUnitTest();
+        CFE_ES_StartupLoadAddEntry(LibA, 9);
+        CFE_ES_StartupLoadAddEntry(LibB, 9);
+        UT_SetDefaultReturnValue(UT_KEY(OS_MutSemCreate), OS_ERROR);
+        CFE_ES_StartupLoadRun();
+        UtAssert_STUB_COUNT(OS_TaskCreate, 0);
+        UtAssert_STUB_COUNT(OS_CountSemCreate, 0);
+        UtAssert_STUB_COUNT(OS_ModuleLoad, 2);
+        ES_ResetUnitTest();
+        CFE_ES_StartupLoadAddEntry(LibA, 9);
+        CFE_ES_StartupLoadAddEntry(LibB, 9);
+        UT_SetDefaultReturnValue(UT_KEY(OS_CountSemCreate), OS_ERROR);
+        CFE_ES_StartupLoadRun();
+        UtAssert_STUB_COUNT(OS_TaskCreate, 0);
+        UtAssert_STUB_COUNT(OS_MutSemDelete, 1);
+        UtAssert_STUB_COUNT(OS_ModuleLoad, 2);
+
+        /* Test that a module which failed to load ahead is loaded again when its library is created */
+        ES_ResetUnitTest();
+        CFE_ES_StartupLoadAddEntry(LibA, 9);
+        UT_SetDeferredRetcode(UT_KEY(OS_ModuleLoad), 1, OS_ERROR);
+        CFE_ES_StartupLoadRun();
+        UtAssert_STUB_COUNT(OS_ModuleLoad, 2);
+        UtAssert_STUB_COUNT(OS_ModuleUnload, 0);
+
+        /* Test that a module loaded ahead but not used is unloaded, with and without an unload failure */
+        ES_ResetUnitTest();
+        CFE_ES_StartupLoadAddEntry(LibA, 9);
+        UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileName), 2, CFE_FS_INVALID_PATH);
+        CFE_ES_StartupLoadRun();
+        UtAssert_STUB_COUNT(OS_ModuleLoad, 1);
+        UtAssert_STUB_COUNT(OS_ModuleUnload, 1);
+        ES_ResetUnitTest();
+        CFE_ES_StartupLoadAddEntry(LibA, 9);
+        UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileName), 2, CFE_FS_INVALID_PATH);
+        UT_SetDefaultReturnValue(UT_KEY(OS_ModuleUnload), OS_ERROR);
+        CFE_ES_StartupLoadRun();
+        UtAssert_STUB_COUNT(OS_ModuleUnload, 1);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.NumEntries, 0);
+
+        /* Test a loader task, which loads the modules of the current stage and reports when it is done */
+        ES_ResetUnitTest();
+        CFE_ES_StartupLoadAddEntry(LibA, 9);
+        CFE_ES_StartupLoadAddEntry(LibB, 9);
+        CFE_ES_StartupLoaderTask();
+        UtAssert_STUB_COUNT(OS_ModuleLoad, 2);
+        UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.Entries[1].State, CFE_ES_StartupLoadState_LOADED);
+        UtAssert_BOOL_FALSE(OS_ObjectIdDefined(CFE_ES_StartupLoadTakeModule("B_LIB", "/cf/b.so")));
+        CFE_ES_Global.StartupLoad.IsLoaded = true;
+        UtAssert_BOOL_TRUE(OS_ObjectIdDefined(CFE_ES_StartupLoadTakeModule("B_LIB", "/cf/b.so")));
+        UtAssert_BOOL_FALSE(OS_ObjectIdDefined(CFE_ES_StartupLoadTakeModule("B_LIB", "/cf/b.so")));
+        UtAssert_BOOL_FALSE(OS_ObjectIdDefined(CFE_ES_StartupLoadTakeModule("A_LIB", "/cf/other.so")));
+    }
+
     /* Test parsing the startup script with an unknown entry type */
     ES_ResetUnitTest();
     {
@@ -1342,8 +1674,12 @@ void TestResourceID(void)
      * The conversion is only implemented for tasks, because this is the only resource type where
      * there is overlap between OSAL and CFE (they both have task records).
      */
-    CFE_ES_TaskId_t cfe_id1, cfe_id2;
-    osal_id_t       osal_id;
+    CFE_ES_TaskId_t     cfe_id1, cfe_id2;
+    osal_id_t           osal_id;
+    CFE_ES_AppRecord_t *UtAppRecPtr1;
+    CFE_ES_AppRecord_t *UtAppRecPtr2;
+    CFE_ES_LibRecord_t *UtLibRecPtr;
+    uint32              i;
 
     /*
      * In this function the actual values may or may not change,
@@ -1356,6 +1692,39 @@ void TestResourceID(void)
     osal_id = CFE_ES_TaskId_ToOSAL(cfe_id1);
     cfe_id2 = CFE_ES_TaskId_FromOSAL(osal_id);
     CFE_UtAssert_RESOURCEID_EQ(cfe_id1, cfe_id2);
+
+    /*
+     * Lookups by name go through the name index, which must follow
+     * the tables as records are marked used and free
+     */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT1", &UtAppRecPtr1, NULL);
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT2", &UtAppRecPtr2, NULL);
+    ES_UT_SetupSingleLibId("UT1", &UtLibRecPtr);
+    UtAssert_ADDRESS_EQ(CFE_ES_LocateAppRecordByName("UT1"), UtAppRecPtr1);
+    UtAssert_ADDRESS_EQ(CFE_ES_LocateAppRecordByName("UT2"), UtAppRecPtr2);
+    UtAssert_ADDRESS_EQ(CFE_ES_LocateLibRecordByName("UT1"), UtLibRecPtr);
+    UtAssert_NULL(CFE_ES_LocateLibRecordByName("UT2"));
+
+    CFE_ES_AppRecordSetFree(UtAppRecPtr1);
+    UtAssert_NULL(CFE_ES_LocateAppRecordByName("UT1"));
+    UtAssert_ADDRESS_EQ(CFE_ES_LocateAppRecordByName("UT2"), UtAppRecPtr2);
+    UtAssert_ADDRESS_EQ(CFE_ES_LocateLibRecordByName("UT1"), UtLibRecPtr);
+
+    /* An entry left behind in the index is always confirmed against the table */
+    UtAppRecPtr2->AppId = CFE_ES_APPID_UNDEFINED;
+    UtAssert_NULL(CFE_ES_LocateAppRecordByName("UT2"));
+
+    /* A record that could not be indexed is still found by scanning the table */
+    ES_ResetUnitTest();
+    for (i = 0; i < CFE_ES_APP_NAMEINDEX_SLOTS; ++i)
+    {
+        CFE_ES_Global.AppNameIndex[i].Entry = CFE_PLATFORM_ES_MAX_APPLICATIONS;
+    }
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT1", &UtAppRecPtr1, NULL);
+    UtAssert_BOOL_TRUE(CFE_ES_Global.AppNameIndexIncomplete);
+    UtAssert_ADDRESS_EQ(CFE_ES_LocateAppRecordByName("UT1"), UtAppRecPtr1);
+    UtAssert_NULL(CFE_ES_LocateAppRecordByName("UT2"));
 }
 
 void TestLibs(void)
@@ -1591,6 +1960,9 @@ void TestGenericPool(void)
     uint16              i;
     uint32              ExpectedCount;
     CFE_ES_GenPoolBD_t *BdPtr;
+    size_t              GeometricSizes[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];
+    size_t              Offset5;
+    size_t              TopSize;
 
     ES_ResetUnitTest();
 
@@ -1886,6 +2258,205 @@ void TestGenericPool(void)
     ES_ResetUnitTest();
     UtAssert_INT32_EQ(CFE_ES_GenPoolRecyclePoolBlock(&Pool1, 0, Pool1.Buckets[0].BlockSize, &Offset1),
                       CFE_ES_BUFFER_NOT_IN_POOL);
+
+    /*
+     * The size class lookup must select the same bucket as a linear
+     * search of the sorted sizes would, including sizes beyond the largest
+     */
+    ES_ResetUnitTest();
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolInitialize(&Pool1, 0, sizeof(UT_MemPoolDirectBuffer.Data), 32,
+                                                  CFE_PLATFORM_ES_POOL_MAX_BUCKETS, UT_POOL_BLOCK_SIZES,
+                                                  ES_UT_PoolDirectRetrieve, ES_UT_PoolDirectCommit));
+    ExpectedCount = 0;
+    for (BlockSize = 0; BlockSize <= 300; ++BlockSize)
+    {
+        for (i = 0; i < Pool1.NumBuckets && BlockSize > Pool1.Buckets[i].BlockSize; ++i)
+        {
+            /* linear search for the reference answer */
+        }
+        if (CFE_ES_GenPoolFindBucket(&Pool1, BlockSize) != (Pool1.NumBuckets - i))
+        {
+            ++ExpectedCount;
+        }
+    }
+    UtAssert_ZERO(ExpectedCount);
+    UtAssert_ZERO(CFE_ES_GenPoolFindBucket(&Pool1, SIZE_MAX));
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 0), Pool1.NumBuckets);
+
+    /* Geometric size classes keep the wasted space of any block within the bound */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolMakeGeometricSizes(NULL, &NumBlocks, 16, 1024, 25), CFE_ES_BAD_ARGUMENT);
+    NumBlocks = CFE_PLATFORM_ES_POOL_MAX_BUCKETS;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolMakeGeometricSizes(GeometricSizes, &NumBlocks, 0, 1024, 25), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolMakeGeometricSizes(GeometricSizes, &NumBlocks, 64, 32, 25), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolMakeGeometricSizes(GeometricSizes, &NumBlocks, 16, 1024, 0), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolMakeGeometricSizes(GeometricSizes, &NumBlocks, 16, 1024, 100),
+                      CFE_ES_BAD_ARGUMENT);
+
+    /* does not fit: 16 to 1024 with 1% waste needs far more than the available sizes */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolMakeGeometricSizes(GeometricSizes, &NumBlocks, 16, 1024, 1), CFE_ES_BAD_ARGUMENT);
+    UtAssert_UINT32_EQ(NumBlocks, CFE_PLATFORM_ES_POOL_MAX_BUCKETS);
+
+    /* 16, 21, 28, 37, 49, 65, 86, 114, 152, 202, 269, 358, 477, 636, 848, 1024 */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolMakeGeometricSizes(GeometricSizes, &NumBlocks, 16, 1024, 25));
+    UtAssert_UINT32_EQ(NumBlocks, 16);
+    UtAssert_EQ(size_t, GeometricSizes[0], 16);
+    UtAssert_EQ(size_t, GeometricSizes[1], 21);
+    UtAssert_EQ(size_t, GeometricSizes[NumBlocks - 1], 1024);
+    ExpectedCount = 0;
+    for (i = 1; i < NumBlocks; ++i)
+    {
+        /* worst case is a request one byte larger than the previous size */
+        if (GeometricSizes[i] <= GeometricSizes[i - 1] ||
+            (GeometricSizes[i] - GeometricSizes[i - 1] - 1) * 100 > GeometricSizes[i] * 25)
+        {
+            ++ExpectedCount;
+        }
+    }
+    UtAssert_ZERO(ExpectedCount);
+
+    /* A single size when the range is empty, and one byte steps where the bound cannot be met */
+    NumBlocks = CFE_PLATFORM_ES_POOL_MAX_BUCKETS;
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolMakeGeometricSizes(GeometricSizes, &NumBlocks, 64, 64, 25));
+    UtAssert_UINT32_EQ(NumBlocks, 1);
+    NumBlocks = CFE_PLATFORM_ES_POOL_MAX_BUCKETS;
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolMakeGeometricSizes(GeometricSizes, &NumBlocks, 1, 4, 10));
+    UtAssert_UINT32_EQ(NumBlocks, 4);
+
+    /* Very large sizes do not overflow */
+    NumBlocks = CFE_PLATFORM_ES_POOL_MAX_BUCKETS;
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolMakeGeometricSizes(GeometricSizes, &NumBlocks, SIZE_MAX / 2, SIZE_MAX, 75));
+    UtAssert_UINT32_EQ(NumBlocks, 2);
+    UtAssert_EQ(size_t, GeometricSizes[1], SIZE_MAX);
+
+    /* Blocks can be kept on a free stack outside of the pool, without changing the pool counts */
+    ES_ResetUnitTest();
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolInitialize(&Pool1, 0, sizeof(UT_MemPoolDirectBuffer.Data), 32,
+                                                  CFE_PLATFORM_ES_POOL_MAX_BUCKETS, UT_POOL_BLOCK_SIZES,
+                                                  ES_UT_PoolDirectRetrieve, ES_UT_PoolDirectCommit));
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 10));
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 10));
+    i       = CFE_ES_GenPoolFindBucket(&Pool1, 10);
+    Offset3 = 0;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPopBlock(&Pool1, &Offset3, i, 10, &Offset4), CFE_ES_BUFFER_NOT_IN_POOL);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPushBlock(&Pool1, &Offset3, i, Pool1.TailPosition), CFE_ES_BUFFER_NOT_IN_POOL);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPushBlock(&Pool1, &Offset3, i - 1, Offset1), CFE_ES_POOL_BLOCK_INVALID);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPushBlock(&Pool1, &Offset3, i, Offset1));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPushBlock(&Pool1, &Offset3, i, Offset2));
+    UtAssert_EQ(size_t, Offset3, Offset2);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPushBlock(&Pool1, &Offset3, i, Offset2), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlockSize(&Pool1, &BlockSize, Offset2), CFE_ES_POOL_BLOCK_INVALID);
+    CFE_ES_GenPoolGetBucketUsage(&Pool1, i, &BlockStats);
+    UtAssert_UINT32_EQ(BlockStats.NumCreated, 2);
+    UtAssert_ZERO(BlockStats.NumFree);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPopBlock(&Pool1, &Offset3, i - 1, 10, &Offset4), CFE_ES_BUFFER_NOT_IN_POOL);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPopBlock(&Pool1, &Offset3, i, 5, &Offset4));
+    UtAssert_EQ(size_t, Offset4, Offset2);
+    UtAssert_EQ(size_t, Offset3, Offset1);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlockSize(&Pool1, &BlockSize, Offset4));
+    UtAssert_EQ(size_t, BlockSize, 5);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPopBlock(&Pool1, &Offset3, i, 10, &Offset4));
+    UtAssert_EQ(size_t, Offset4, Offset1);
+    UtAssert_ZERO(Offset3);
+
+    /* The stack is unchanged if the descriptor cannot be accessed */
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolPushBlock(&Pool1, &Offset3, i, Offset2));
+    Pool1.Commit = ES_UT_PoolCommitFail;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPopBlock(&Pool1, &Offset3, i, 10, &Offset4), CFE_ES_CDS_ACCESS_ERROR);
+    UtAssert_EQ(size_t, Offset3, Offset2);
+    Pool1.Retrieve = ES_UT_PoolRetrieveFail;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPopBlock(&Pool1, &Offset3, i, 10, &Offset4), CFE_ES_CDS_ACCESS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPushBlock(&Pool1, &Offset3, i, Offset1), CFE_ES_CDS_ACCESS_ERROR);
+    Pool1.Retrieve = ES_UT_PoolDirectRetrieve;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPushBlock(&Pool1, &Offset3, i, Offset1), CFE_ES_CDS_ACCESS_ERROR);
+    UtAssert_EQ(size_t, Offset3, Offset2);
+
+    /* Buddy pool initialization errors */
+    ES_ResetUnitTest();
+    memset(&UT_MemPoolDirectBuffer, 0xee, sizeof(UT_MemPoolDirectBuffer));
+    OffsetEnd = sizeof(UT_MemPoolDirectBuffer.Data);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolInitializeBuddy(&Pool1, 0, OffsetEnd, 8, 0, 60, ES_UT_PoolDirectRetrieve,
+                                                    ES_UT_PoolDirectCommit),
+                      CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolInitializeBuddy(&Pool1, 0, OffsetEnd, 8, 60, 8, ES_UT_PoolDirectRetrieve,
+                                                    ES_UT_PoolDirectCommit),
+                      CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(
+        CFE_ES_GenPoolInitializeBuddy(&Pool1, 0, 16, 8, 8, 60, ES_UT_PoolDirectRetrieve, ES_UT_PoolDirectCommit),
+        CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolInitializeBuddy(&Pool1, 0, OffsetEnd, 42, 8, 60, ES_UT_PoolDirectRetrieve,
+                                                    ES_UT_PoolDirectCommit),
+                      CFE_ES_BAD_ARGUMENT);
+
+    /* A wide range of sizes drops the smallest ones to fit in the buckets */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolInitializeBuddy(&Pool2, 0, (size_t)1 << 30, 8, 8, (size_t)1 << 29,
+                                                       ES_UT_PoolDirectRetrieve, ES_UT_PoolDirectCommit));
+    UtAssert_UINT32_LTEQ(Pool2.NumBuckets, CFE_PLATFORM_ES_POOL_MAX_BUCKETS);
+    UtAssert_UINT32_GTEQ(Pool2.Buckets[Pool2.NumBuckets - 1].BlockSize, (size_t)1 << 29);
+    UtAssert_UINT32_LTEQ(Pool2.Buckets[Pool2.NumBuckets - 1].BlockSize, (size_t)1 << 30);
+
+    /*
+     * Test a buddy pool.  With 8 to 60 byte requests the blocks are 32, 64
+     * and 128 bytes including the header, so this pool holds two of the
+     * largest blocks and one of the smallest.
+     */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolInitializeBuddy(&Pool1, 0, OffsetEnd, 8, 8, 60, ES_UT_PoolDirectRetrieve,
+                                                       ES_UT_PoolDirectCommit));
+    UtAssert_BOOL_TRUE(Pool1.BuddyMode);
+    UtAssert_UINT32_EQ(Pool1.NumBuckets, 3);
+    UtAssert_UINT32_GTEQ(Pool1.Buckets[2].BlockSize, 60);
+    TopSize = Pool1.BuddyUnitSize << 2;
+
+    /* Splitting a new block serves the first requests in order */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 8));
+    UtAssert_EQ(size_t, Offset1, Pool1.BuddyHeaderSize);
+    UtAssert_True((Offset1 & 0x7) == 0, "Offset1(%lu) 8 byte alignment", (unsigned long)Offset1);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 8));
+    UtAssert_EQ(size_t, Offset2, Offset1 + Pool1.BuddyUnitSize);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offset3, Pool1.Buckets[1].BlockSize));
+    UtAssert_EQ(size_t, Offset3, Offset1 + (2 * Pool1.BuddyUnitSize));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offset4, 60));
+    UtAssert_EQ(size_t, Offset4, Offset1 + TopSize);
+
+    /* The rest of the pool only fits a small block */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset5, 60), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offset5, 8));
+    UtAssert_EQ(size_t, Offset5, Offset1 + (2 * TopSize));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset5));
+
+    /* Freed blocks are merged with their free buddies */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset1));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset2));
+    UtAssert_EQ(size_t, BlockSize, 8);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset2), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlockSize(&Pool1, &BlockSize, Offset1), CFE_ES_POOL_BLOCK_INVALID);
+    CFE_ES_GenPoolGetUsage(&Pool1, &FreeSize, &TotalSize);
+    UtAssert_EQ(size_t, CFE_ES_MEMOFFSET_TO_SIZET(FreeSize),
+                (OffsetEnd - Pool1.TailPosition) + (3 * Pool1.BuddyUnitSize));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset3));
+    CFE_ES_GenPoolGetBucketUsage(&Pool1, 1, &BlockStats);
+    UtAssert_UINT32_EQ(BlockStats.NumCreated, 2);
+    UtAssert_UINT32_EQ(BlockStats.NumFree, 1);
+    CFE_ES_GenPoolGetBucketUsage(&Pool1, 2, &BlockStats);
+    UtAssert_ZERO(BlockStats.NumCreated);
+
+    /* Memory released as small blocks is reused for a large one */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 60));
+    UtAssert_EQ(size_t, Offset2, Offset1);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlockSize(&Pool1, &BlockSize, Offset2));
+    UtAssert_EQ(size_t, BlockSize, 60);
+
+    /* A corrupt free list is detected */
+    CFE_UtAssert_SETUP(ES_UT_PoolDirectRetrieve(&Pool1, Offset5 - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr));
+    BdPtr->CheckBits = 0;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset5, 8), CFE_ES_BUFFER_NOT_IN_POOL);
+
+    /* Descriptor access failures */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolInitializeBuddy(&Pool1, 0, OffsetEnd, 8, 8, 60, ES_UT_PoolDirectRetrieve,
+                                                       ES_UT_PoolCommitFail));
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 8), CFE_ES_CDS_ACCESS_ERROR);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolInitializeBuddy(&Pool1, 0, OffsetEnd, 8, 8, 60, ES_UT_PoolRetrieveFail,
+                                                       ES_UT_PoolDirectCommit));
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 60), CFE_ES_CDS_ACCESS_ERROR);
 }
 
 void TestTask(void)
@@ -1913,9 +2484,12 @@ void TestTask(void)
         CFE_ES_WriteERLogCmd_t       WriteERLogCmd;
         CFE_ES_SetMaxPRCountCmd_t    SetMaxPRCountCmd;
         CFE_ES_DeleteCDSCmd_t        DeleteCDSCmd;
-        CFE_ES_SendMemPoolStatsCmd_t SendMemPoolStatsCmd;
-        CFE_ES_DumpCDSRegistryCmd_t  DumpCDSRegistryCmd;
-        CFE_ES_QueryAllTasksCmd_t    QueryAllTasksCmd;
+        CFE_ES_SendMemPoolStatsCmd_t  SendMemPoolStatsCmd;
+        CFE_ES_WriteMemPoolStatsCmd_t   WriteMemPoolStatsCmd;
+        CFE_ES_WritePoolAllocSitesCmd_t WritePoolAllocSitesCmd;
+        CFE_ES_WriteStartupTimingCmd_t  WriteStartupTimingCmd;
+        CFE_ES_DumpCDSRegistryCmd_t     DumpCDSRegistryCmd;
+        CFE_ES_QueryAllTasksCmd_t       QueryAllTasksCmd;
     } CmdBuf;
     CFE_ES_AppRecord_t *    UtAppRecPtr;
     CFE_ES_AppRecord_t *    UtAppRecPtr1;
@@ -2027,6 +2601,16 @@ void TestTask(void)
     UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.SendHkCmd), UT_TPID_CFE_ES_SEND_HK);
     UtAssert_ZERO(CFE_ES_MEMOFFSET_TO_SIZET(CFE_ES_Global.TaskData.HkPacket.Payload.HeapBytesFree));
 
+    /* Test the HK request sending the background job statistics */
+    ES_ResetUnitTest();
+    CFE_Atomic_Store(&CFE_ES_Global.BackgroundTask.NumJobs, 1);
+    strncpy(CFE_ES_Global.BackgroundTask.Jobs[0].Stats.Name, "UT_JOB",
+            sizeof(CFE_ES_Global.BackgroundTask.Jobs[0].Stats.Name) - 1);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.SendHkCmd), UT_TPID_CFE_ES_SEND_HK);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.BackgroundJobsPacket.Payload.NumInPacket, 1);
+    UtAssert_STRINGBUF_EQ(CFE_ES_Global.TaskData.BackgroundJobsPacket.Payload.Jobs[0].Name,
+                          sizeof(CFE_ES_Global.TaskData.BackgroundJobsPacket.Payload.Jobs[0].Name), "UT_JOB", -1);
+
     /* Test successful no-op command */
     ES_ResetUnitTest();
     UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.NoopCmd), UT_TPID_CFE_ES_CMD_NOOP_CC);
@@ -2787,6 +3371,123 @@ void TestTask(void)
                     UT_TPID_CFE_ES_CMD_SEND_MEM_POOL_STATS_CC);
     CFE_UtAssert_EVENTSENT(CFE_ES_TLM_POOL_STATS_INFO_EID);
 
+    /* Pools with diagnostics enabled also send the diagnostics packet */
+    ES_ResetUnitTest();
+    ES_UT_SetupMemPoolId(&UtPoolRecPtr);
+    UtPoolRecPtr->UseDiagnostics                  = true;
+    CmdBuf.SendMemPoolStatsCmd.Payload.PoolHandle = CFE_ES_MemPoolRecordGetID(UtPoolRecPtr);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.SendMemPoolStatsCmd),
+                    UT_TPID_CFE_ES_CMD_SEND_MEM_POOL_STATS_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_TLM_POOL_STATS_INFO_EID);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+
+    /* Test successful request to write the pool statistics file */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), false);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WriteMemPoolStatsCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_MEM_POOL_STATS_CC);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Failure of parsing the file name */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileNameEx), 1, CFE_FS_INVALID_PATH);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WriteMemPoolStatsCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_MEM_POOL_STATS_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_POOL_STATS_FILE_ERR_EID);
+
+    /* Request rejected by the background file writer */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_BackgroundFileDumpRequest), 1, CFE_STATUS_REQUEST_ALREADY_PENDING);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WriteMemPoolStatsCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_MEM_POOL_STATS_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_POOL_STATS_PENDING_ERR_EID);
+
+    /* Same event but pending locally */
+    UT_ClearEventHistory();
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), true);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WriteMemPoolStatsCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_MEM_POOL_STATS_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_POOL_STATS_PENDING_ERR_EID);
+
+    /* Test request to write the allocation sites file */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), false);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WritePoolAllocSitesCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_POOL_ALLOC_SITES_CC);
+#ifdef CFE_ES_POOL_ALLOC_TRACKING_ENABLED
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Failure of parsing the file name */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileNameEx), 1, CFE_FS_INVALID_PATH);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WritePoolAllocSitesCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_POOL_ALLOC_SITES_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_POOL_ALLOC_SITES_FILE_ERR_EID);
+
+    /* Request rejected by the background file writer */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_BackgroundFileDumpRequest), 1, CFE_STATUS_REQUEST_ALREADY_PENDING);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WritePoolAllocSitesCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_POOL_ALLOC_SITES_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_POOL_ALLOC_SITES_PENDING_ERR_EID);
+
+    /* Same event but pending locally */
+    UT_ClearEventHistory();
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), true);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WritePoolAllocSitesCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_POOL_ALLOC_SITES_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_POOL_ALLOC_SITES_PENDING_ERR_EID);
+#else
+    /* Rejected when tracking is not built in */
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 0);
+    CFE_UtAssert_EVENTSENT(CFE_ES_POOL_ALLOC_SITES_FILE_ERR_EID);
+#endif
+
+    /* Test successful request to write the startup timeline file */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), false);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WriteStartupTimingCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_STARTUP_TIMING_CC);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandCounter, 1);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Failure of parsing the file name */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileNameEx), 1, CFE_FS_INVALID_PATH);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WriteStartupTimingCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_STARTUP_TIMING_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_STARTUP_TIMING_FILE_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandErrorCounter, 1);
+
+    /* Request rejected by the background file writer */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_BackgroundFileDumpRequest), 1, CFE_STATUS_REQUEST_ALREADY_PENDING);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WriteStartupTimingCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_STARTUP_TIMING_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_STARTUP_TIMING_PENDING_ERR_EID);
+
+    /* Same event but pending locally */
+    UT_ClearEventHistory();
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), true);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WriteStartupTimingCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_STARTUP_TIMING_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_STARTUP_TIMING_PENDING_ERR_EID);
+
+    /* The timeline is sent with housekeeping once the system is operational */
+    ES_ResetUnitTest();
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), false);
+    CFE_ES_StartupTimingMark(CFE_ES_StartupPhase_SYSTEM_STATE, "OPERATIONAL");
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_OPERATIONAL;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.SendHkCmd), UT_TPID_CFE_ES_SEND_HK);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.StartupTimingPacket.Payload.NumInPacket, 1);
+
     /* Test the command pipe message process with an invalid command */
     ES_ResetUnitTest();
     UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.NoopCmd), UT_TPID_CFE_ES_CMD_INVALID_CC);
@@ -2996,12 +3697,18 @@ void TestPerf(void)
         CFE_ES_StopPerfDataCmd_t       PerfStopCmd;
         CFE_ES_SetPerfFilterMaskCmd_t  PerfSetFilterMaskCmd;
         CFE_ES_SetPerfTriggerMaskCmd_t PerfSetTrigMaskCmd;
+        CFE_ES_ResetPerfStatsCmd_t     ResetPerfStatsCmd;
+        CFE_ES_SendHkCmd_t             SendHkCmd;
     } CmdBuf;
 
     UtPrintf("Begin Test Performance Log");
 
     CFE_ES_PerfData_t *Perf;
     void *             TempBuff;
+#ifdef CFE_ES_PERF_MARKER_STATS_ENABLED
+    CFE_ES_PerfStatsTlm_Payload_t StatsPayload;
+    uint32                        i;
+#endif
 
     /*
     ** Set the pointer to the data area
@@ -3027,6 +3734,9 @@ void TestPerf(void)
     UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStartCmd),
                     UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
     CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STARTCMD_EID);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_WAITING_FOR_TRIGGER);
+    UtAssert_UINT32_EQ(Perf->WriteSeq, 0);
+    UtAssert_UINT32_EQ(Perf->TriggerSeq, CFE_ES_PERF_SEQ_NONE);
 
     /* Test successful performance data collection start in CENTER
      * trigger mode
@@ -3053,7 +3763,7 @@ void TestPerf(void)
      */
     ES_ResetUnitTest();
     memset(&CmdBuf, 0, sizeof(CmdBuf));
-    CmdBuf.PerfStartCmd.Payload.TriggerMode = (CFE_ES_PerfTrigger_END + 1);
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = (CFE_ES_PerfTrigger_STREAM + 1);
     UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStartCmd),
                     UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
     CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STARTCMD_TRIG_ERR_EID);
@@ -3189,50 +3899,144 @@ void TestPerf(void)
     /* Test successful addition of a new entry to the performance log */
     ES_ResetUnitTest();
     Perf->MetaData.State                 = CFE_ES_PERF_WAITING_FOR_TRIGGER;
-    Perf->MetaData.TriggerCount          = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 1;
     Perf->MetaData.InvalidMarkerReported = false;
-    Perf->MetaData.DataEnd               = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 1;
     CFE_ES_PerfLogAdd(CFE_MISSION_ES_PERF_MAX_IDS, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.InvalidMarkerReported, true);
 
-    /* Test addition of a new entry to the performance log with START
-     * trigger mode
+    /* Test addition of the trigger entry to the performance log with START
+     * trigger mode, which claims the next slot and records the trigger point
+     */
+    ES_ResetUnitTest();
+    Perf->MetaData.State          = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.Mode           = CFE_ES_PerfTrigger_START;
+    Perf->MetaData.DataCount      = 0;
+    Perf->MetaData.FilterMask[0]  = 0xFFFF;
+    Perf->MetaData.TriggerMask[0] = 0xFFFF;
+    Perf->WriteSeq                = 5;
+    Perf->TriggerSeq              = CFE_ES_PERF_SEQ_NONE;
+    CFE_ES_PerfLogAdd(1, 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
+    UtAssert_UINT32_EQ(Perf->TriggerSeq, 5);
+    UtAssert_UINT32_EQ(Perf->WriteSeq, 6);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[5].Data, 1 | (1 << CFE_MISSION_ES_PERF_EXIT_BIT));
+    CFE_ES_UpdatePerfMetaData();
+    UtAssert_UINT32_EQ(Perf->MetaData.TriggerCount, 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 6);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataStart, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 6);
+
+    /* Test a second trigger marker while the log is still waiting - only
+     * the writer that set the trigger point moves the state
      */
     ES_ResetUnitTest();
-    Perf->MetaData.InvalidMarkerReported = true;
-    Perf->MetaData.Mode                  = CFE_ES_PerfTrigger_START;
-    Perf->MetaData.DataCount             = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 1;
-    Perf->MetaData.TriggerMask[0]        = 0xFFFF;
+    Perf->MetaData.State          = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.Mode           = CFE_ES_PerfTrigger_START;
+    Perf->MetaData.TriggerMask[0] = 0xFFFF;
+    Perf->WriteSeq                = 5;
+    Perf->TriggerSeq              = 3;
+    CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_WAITING_FOR_TRIGGER);
+    UtAssert_UINT32_EQ(Perf->TriggerSeq, 3);
+    UtAssert_UINT32_EQ(Perf->WriteSeq, 6);
+
+    /* Test addition of the last entry to the performance log with START
+     * trigger mode, which fills the buffer from the trigger point
+     */
+    ES_ResetUnitTest();
+    Perf->MetaData.State     = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.Mode      = CFE_ES_PerfTrigger_START;
+    Perf->MetaData.DataCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    Perf->TriggerSeq         = 10;
+    Perf->WriteSeq           = 10 + CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1;
     CFE_ES_PerfLogAdd(1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.Mode, CFE_ES_PerfTrigger_START);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
+    CFE_ES_UpdatePerfMetaData();
+    UtAssert_UINT32_EQ(Perf->MetaData.TriggerCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataStart, 10);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 10);
 
     /* Test addition of a new entry to the performance log with CENTER
      * trigger mode
      */
     ES_ResetUnitTest();
-    Perf->MetaData.State        = CFE_ES_PERF_TRIGGERED;
-    Perf->MetaData.Mode         = CFE_ES_PerfTrigger_CENTER;
-    Perf->MetaData.TriggerCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2 + 1;
+    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.Mode  = CFE_ES_PerfTrigger_CENTER;
+    Perf->TriggerSeq     = 0;
+    Perf->WriteSeq       = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2 - 1;
     CFE_ES_PerfLogAdd(1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.Mode, CFE_ES_PerfTrigger_CENTER);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
 
     /* Test addition of a new entry to the performance log with END
-     * trigger mode
+     * trigger mode, where the trigger entry is also the last entry
      */
     ES_ResetUnitTest();
-    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
-    Perf->MetaData.Mode  = CFE_ES_PerfTrigger_END;
+    Perf->MetaData.State          = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.Mode           = CFE_ES_PerfTrigger_END;
+    Perf->MetaData.TriggerMask[0] = 0xFFFF;
+    Perf->TriggerSeq              = CFE_ES_PERF_SEQ_NONE;
+    Perf->WriteSeq                = 0;
     CFE_ES_PerfLogAdd(1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.Mode, CFE_ES_PerfTrigger_END);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
+    CFE_ES_UpdatePerfMetaData();
+    UtAssert_UINT32_EQ(Perf->MetaData.TriggerCount, 1);
 
-    /* Test addition where state goes to idle after first check */
+    /* Test addition where the slot claimed is beyond the end of the triggered
+     * log (e.g. another writer completed it first) - entry must be discarded
+     */
     ES_ResetUnitTest();
-    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
-    UT_SetHandlerFunction(UT_KEY(OS_MutSemTake), ES_UT_SetPerfIdle, NULL);
+    Perf->MetaData.State     = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.Mode      = CFE_ES_PerfTrigger_END;
+    Perf->MetaData.DataCount = 0;
+    Perf->TriggerSeq         = 3;
+    Perf->WriteSeq           = 4;
+    CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
+    CFE_ES_UpdatePerfMetaData();
+    UtAssert_UINT32_EQ(Perf->MetaData.TriggerCount, 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 4);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 4);
+
+    /* Test addition where the slot was claimed before the trigger point - entry is kept */
+    ES_ResetUnitTest();
+    Perf->MetaData.State     = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.Mode      = CFE_ES_PerfTrigger_END;
+    Perf->MetaData.DataCount = 0;
+    Perf->TriggerSeq         = 10;
+    Perf->WriteSeq           = 9;
     CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
+    UtAssert_UINT32_EQ(Perf->WriteSeq, 10);
+
+    /* Test that the slot sequence wraps back to zero while the slot index stays continuous */
+    ES_ResetUnitTest();
+    Perf->MetaData.State          = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.TriggerMask[0] = 0x0;
+    Perf->TriggerSeq              = CFE_ES_PERF_SEQ_NONE;
+    Perf->WriteSeq                = CFE_ES_PERF_SEQ_MODULUS - 1;
+    Perf->DataBuffer[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1].Data = 0;
+    CFE_ES_PerfLogAdd(2, 0);
+    UtAssert_UINT32_EQ(Perf->WriteSeq, 0);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1].Data, 2);
+
+    /* Test that the data count follows the sequence until the buffer is full */
+    ES_ResetUnitTest();
+    Perf->MetaData.DataCount = 0;
+    Perf->TriggerSeq         = CFE_ES_PERF_SEQ_NONE;
+    Perf->WriteSeq           = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 20;
+    CFE_ES_UpdatePerfMetaData();
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataStart, 20);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 20);
+    UtAssert_UINT32_EQ(Perf->MetaData.TriggerCount, 0);
+
+    /* Test that the buffer stays full once the sequence has wrapped */
+    Perf->WriteSeq = 20;
+    CFE_ES_UpdatePerfMetaData();
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataStart, 20);
 
     /* Test addition of a new entry to the performance log with an invalid
      * marker after an invalid marker has already been reported
@@ -3249,9 +4053,9 @@ void TestPerf(void)
     ES_ResetUnitTest();
     Perf->MetaData.State         = CFE_ES_PERF_TRIGGERED;
     Perf->MetaData.FilterMask[0] = 0x0;
-    Perf->MetaData.DataEnd       = 0;
+    Perf->WriteSeq               = 0;
     CFE_ES_PerfLogAdd(0x1, 0);
-    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 0);
+    UtAssert_UINT32_EQ(Perf->WriteSeq, 0);
 
     /* Test addition of a new entry to the performance log with the data count
      * below the maximum allowed
@@ -3260,7 +4064,9 @@ void TestPerf(void)
     Perf->MetaData.State         = CFE_ES_PERF_WAITING_FOR_TRIGGER;
     Perf->MetaData.DataCount     = 0;
     Perf->MetaData.FilterMask[0] = 0xffff;
+    Perf->WriteSeq               = 0;
     CFE_ES_PerfLogAdd(0x1, 0);
+    CFE_ES_UpdatePerfMetaData();
     UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 1);
 
     /* Test addition of a new entry to the performance log with a marker that
@@ -3272,24 +4078,14 @@ void TestPerf(void)
     CFE_ES_PerfLogAdd(0x1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_WAITING_FOR_TRIGGER);
 
-    /* Test addition of a new entry to the performance log with a start
-     * trigger mode and the trigger count is less the buffer size
-     */
-    ES_ResetUnitTest();
-    Perf->MetaData.TriggerCount   = 0;
-    Perf->MetaData.State          = CFE_ES_PERF_TRIGGERED;
-    Perf->MetaData.Mode           = CFE_ES_PerfTrigger_START;
-    Perf->MetaData.TriggerMask[0] = 0xffff;
-    CFE_ES_PerfLogAdd(0x1, 0);
-    UtAssert_UINT32_EQ(Perf->MetaData.TriggerCount, 1);
-
     /* Test addition of a new entry to the performance log with a center
      * trigger mode and the trigger count is less than half the buffer size
      */
     ES_ResetUnitTest();
-    Perf->MetaData.TriggerCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2 - 2;
-    Perf->MetaData.State        = CFE_ES_PERF_TRIGGERED;
-    Perf->MetaData.Mode         = CFE_ES_PerfTrigger_CENTER;
+    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.Mode  = CFE_ES_PerfTrigger_CENTER;
+    Perf->TriggerSeq     = 0;
+    Perf->WriteSeq       = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2 - 3;
     CFE_ES_PerfLogAdd(0x1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
 
@@ -3297,12 +4093,17 @@ void TestPerf(void)
      * trigger mode
      */
     ES_ResetUnitTest();
-    Perf->MetaData.TriggerCount = 0;
-    Perf->MetaData.State        = CFE_ES_PERF_TRIGGERED;
-    Perf->MetaData.Mode         = -1;
+    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.Mode  = -1;
+    Perf->TriggerSeq     = 0;
+    Perf->WriteSeq       = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
     CFE_ES_PerfLogAdd(0x1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
 
+    /* Leave the log idle and untriggered for subsequent tests */
+    Perf->MetaData.State = CFE_ES_PERF_IDLE;
+    Perf->TriggerSeq     = CFE_ES_PERF_SEQ_NONE;
+
     /* Test performance data collection start with an invalid message length */
     ES_ResetUnitTest();
     UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), 0, UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
@@ -3405,6 +4206,181 @@ void TestPerf(void)
     /* in WRITE_PERF_ENTRIES, it should report the StateCounter */
     CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
     UtAssert_UINT32_EQ(CFE_ES_GetPerfLogDumpRemaining(), 10);
+
+    /* Test successful performance data collection start in STREAM mode */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = CFE_ES_PerfTrigger_STREAM;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStartCmd),
+                    UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STARTCMD_EID);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
+    UtAssert_UINT32_EQ(Perf->TriggerSeq, CFE_ES_PERF_SEQ_NONE);
+    UtAssert_BOOL_TRUE(CFE_ES_Global.BackgroundPerfStreamState.Active);
+
+    /* Starting again while the stream is still being written must fail */
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStartCmd),
+                    UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STARTCMD_ERR_EID);
+
+    /* Entries recorded while streaming are counted against their chunk */
+    Perf->MetaData.FilterMask[0] = 0xFFFF;
+    CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_UINT32_EQ(Perf->WriteSeq, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.ChunkFill[0], 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
+
+    /* A partial chunk is not written out while the log is running */
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(1000, &CFE_ES_Global.BackgroundPerfStreamState));
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.ReadSeq, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+
+    /* An entry that would reuse a slot not yet written out is dropped */
+    Perf->WriteSeq = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_UINT32_EQ(Perf->WriteSeq, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.DropCount, 1);
+
+    /* A full chunk is appended to a new stream file and released back to the writers */
+    CFE_ES_Global.BackgroundPerfStreamState.ChunkFill[0] = CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES;
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(1000, &CFE_ES_Global.BackgroundPerfStreamState));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.ReadSeq, CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.ChunkFill[0], 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.TotalEntries, CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES);
+    UtAssert_STRINGBUF_EQ(CFE_ES_Global.BackgroundPerfStreamState.DataFileName,
+                          sizeof(CFE_ES_Global.BackgroundPerfStreamState.DataFileName),
+                          CFE_PLATFORM_ES_PERF_STREAM_FILE_BASENAME "_00.dat", -1);
+
+    /* Once the file is full it is closed and the next file in the rotation is used */
+    CFE_ES_Global.BackgroundPerfStreamState.FileEntries =
+        CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES - CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES;
+    CFE_ES_Global.BackgroundPerfStreamState.ChunkFill[1] = CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES;
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(1000, &CFE_ES_Global.BackgroundPerfStreamState));
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STREAM_FILE_EID);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.FileIndex, 1 % CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(CFE_ES_Global.BackgroundPerfStreamState.FileDesc));
+
+    /* Stopping hands the remainder to the background job rather than starting a dump */
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStopCmd),
+                    UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STOPCMD_EID);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.PendingState, CFE_ES_PerfDumpState_IDLE);
+
+    /* The first pass after stopping only yields, the second writes the partial chunk and finishes */
+    Perf->WriteSeq = 2 * CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES + 3;
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(1000, &CFE_ES_Global.BackgroundPerfStreamState));
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.ReadSeq, 2 * CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES);
+    UtAssert_BOOL_FALSE(CFE_ES_RunPerfLogStream(1000, &CFE_ES_Global.BackgroundPerfStreamState));
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STREAM_STOPPED_EID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.TotalEntries,
+                       2 * CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES + 3);
+    UtAssert_BOOL_FALSE(CFE_ES_Global.BackgroundPerfStreamState.Active);
+    UtAssert_BOOL_FALSE(CFE_ES_RunPerfLogStream(1000, &CFE_ES_Global.BackgroundPerfStreamState));
+
+    /* Failure to create a stream file stops streaming */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = CFE_ES_PerfTrigger_STREAM;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStartCmd),
+                    UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    CFE_ES_Global.BackgroundPerfStreamState.ChunkFill[0] = CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES;
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+    UtAssert_BOOL_FALSE(CFE_ES_RunPerfLogStream(1000, &CFE_ES_Global.BackgroundPerfStreamState));
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STREAM_ERR_EID);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
+
+    /* Failure to write the stream file header stops streaming */
+    ES_ResetUnitTest();
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStartCmd),
+                    UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    CFE_ES_Global.BackgroundPerfStreamState.ChunkFill[0] = CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), -1);
+    UtAssert_BOOL_FALSE(CFE_ES_RunPerfLogStream(1000, &CFE_ES_Global.BackgroundPerfStreamState));
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STREAM_ERR_EID);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    /* Failure to write entries to the stream file stops streaming */
+    ES_ResetUnitTest();
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStartCmd),
+                    UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    CFE_ES_Global.BackgroundPerfStreamState.ChunkFill[0] = CFE_PLATFORM_ES_PERF_STREAM_CHUNK_ENTRIES;
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    UtAssert_BOOL_FALSE(CFE_ES_RunPerfLogStream(1000, &CFE_ES_Global.BackgroundPerfStreamState));
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STREAM_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfStreamState.TotalEntries, 0);
+
+#ifdef CFE_ES_PERF_MARKER_STATS_ENABLED
+    /* An exit is matched with the most recent entry of the same marker in the task */
+    ES_ResetUnitTest();
+    Perf->MetaData.State               = CFE_ES_PERF_IDLE;
+    Perf->MetaData.TimerTicksPerSecond = 1000000;
+    Perf->MetaData.TimerLow32Rollover  = 0;
+    CFE_ES_ResetPerfStats();
+    CFE_ES_PerfLogAdd(1, 0);
+    CFE_ES_PerfLogAdd(2, 0);
+    CFE_ES_PerfLogAdd(1, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfStats.Markers[1].Count, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfStats.Markers[1].Histogram[0], 1);
+    UtAssert_ZERO(CFE_ES_Global.PerfStats.Markers[1].MinUsec);
+    UtAssert_ZERO(CFE_ES_Global.PerfStats.Markers[2].Count);
+
+    /* Marker 2 was discarded with the exit of marker 1, so its exit is unmatched */
+    CFE_ES_PerfLogAdd(2, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfStats.UnmatchedCount, 1);
+
+    /* Entries beyond the nesting depth are counted but not timed */
+    for (i = 0; i <= CFE_PLATFORM_ES_PERF_MARKER_STATS_DEPTH; i++)
+    {
+        CFE_ES_PerfLogAdd(3, 0);
+    }
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfStats.OverflowCount, 1);
+    CFE_ES_PerfLogAdd(3, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfStats.Markers[3].Count, 1);
+
+    /* Out of range markers are ignored */
+    CFE_ES_PerfLogAdd(CFE_MISSION_ES_PERF_MAX_IDS, 0);
+
+    /* Measured markers are reported in turn */
+    CFE_ES_GetPerfStats(&StatsPayload);
+    UtAssert_UINT32_EQ(StatsPayload.NumMarkers, 2);
+    UtAssert_UINT32_EQ(StatsPayload.MarkerStats[0].MarkerId, 1);
+    UtAssert_UINT32_EQ(StatsPayload.MarkerStats[1].MarkerId, 3);
+    UtAssert_UINT32_EQ(StatsPayload.MarkerStats[1].Count, 1);
+    UtAssert_UINT32_EQ(StatsPayload.UnmatchedCount, 1);
+    UtAssert_UINT32_EQ(StatsPayload.OverflowCount, 1);
+
+    /* The statistics packet goes out with housekeeping */
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.SendHkCmd), UT_TPID_CFE_ES_SEND_HK);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+
+    /* Reset the statistics by command */
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.ResetPerfStatsCmd),
+                    UT_TPID_CFE_ES_CMD_RESET_PERF_STATS_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STATS_RESET_EID);
+    UtAssert_ZERO(CFE_ES_Global.PerfStats.Markers[1].Count);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfStats.Markers[1].MinUsec, 0xFFFFFFFF);
+    UtAssert_ZERO(CFE_ES_Global.PerfStats.UnmatchedCount);
+    CFE_ES_GetPerfStats(&StatsPayload);
+    UtAssert_ZERO(StatsPayload.NumMarkers);
+#else
+    /* Reset of the statistics is rejected when they are not built in */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.ResetPerfStatsCmd),
+                    UT_TPID_CFE_ES_CMD_RESET_PERF_STATS_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STATS_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandErrorCounter, 1);
+#endif
+
+    /* Leave the log idle in the default mode for subsequent tests */
+    Perf->MetaData.State = CFE_ES_PERF_IDLE;
+    Perf->MetaData.Mode  = CFE_ES_PerfTrigger_START;
+    Perf->TriggerSeq     = CFE_ES_PERF_SEQ_NONE;
 }
 
 void TestAPI(void)
@@ -3415,6 +4391,8 @@ void TestAPI(void)
     size_t               SysLogBufSize;
     uint32               StackBuf[8];
     uint8                Data[12];
+    uint8                CrcBuf[67];
+    size_t               i;
     uint32               ResetType;
     CFE_ES_AppId_t       AppId;
     CFE_ES_TaskId_t      TaskId;
@@ -3423,6 +4401,9 @@ void TestAPI(void)
     CFE_ES_AppInfo_t     AppInfo;
     CFE_ES_AppRecord_t * UtAppRecPtr;
     CFE_ES_TaskRecord_t *UtTaskRecPtr;
+    uint32               SharedDataSeq;
+
+    CFE_ES_SharedDataReadState_t ReadState;
 
     UtPrintf("Begin Test API");
 
@@ -3613,12 +4594,23 @@ void TestAPI(void)
 
     /* Test run loop with startup sync code */
     ES_ResetUnitTest();
-    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_LATE_INIT, NULL, &UtAppRecPtr, NULL);
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_LATE_INIT, NULL, &UtAppRecPtr, &UtTaskRecPtr);
     RunStatus                                 = CFE_ES_RunStatus_APP_RUN;
     UtAppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_APP_RUN;
     UtAssert_BOOL_TRUE(CFE_ES_RunLoop(&RunStatus));
     UtAssert_UINT32_EQ(UtAppRecPtr->AppState, CFE_ES_AppState_RUNNING);
 
+    /* Once running, each cycle only reads the app record and does not advance the sequence */
+    SharedDataSeq = CFE_Atomic_Load(&CFE_ES_Global.SharedDataSeq);
+    UtAssert_BOOL_TRUE(CFE_ES_RunLoop(&RunStatus));
+    UtAssert_UINT32_EQ(CFE_Atomic_Load(&CFE_ES_Global.SharedDataSeq), SharedDataSeq);
+    UtAssert_UINT32_EQ(CFE_Atomic_Load(&UtTaskRecPtr->ExecutionCounter), 2);
+
+    UtAppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_APP_EXIT;
+    UtAssert_BOOL_FALSE(CFE_ES_RunLoop(&RunStatus));
+    UtAssert_UINT32_EQ(RunStatus, CFE_ES_RunStatus_APP_EXIT);
+    UtAssert_UINT32_EQ(CFE_Atomic_Load(&CFE_ES_Global.SharedDataSeq), SharedDataSeq);
+
     /* Hit NULL TaskRecPtr case */
     ES_ResetUnitTest();
     UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdToArrayIndex), 1, OS_ERROR);
@@ -3773,6 +4765,13 @@ void TestAPI(void)
     CFE_ES_TaskEntryPoint();
     UtAssert_STUB_COUNT(ES_UT_TaskFunction, 1);
 
+#ifdef CFE_ES_TASK_CONTEXT_CACHE_ENABLED
+    /* The entry point caches the context of the task before calling it */
+    UtAssert_BOOL_TRUE(CFE_ES_GetTaskContextCache(&AppId, &TaskId));
+    CFE_UtAssert_RESOURCEID_EQ(AppId, CFE_ES_AppRecordGetID(UtAppRecPtr));
+    CFE_UtAssert_RESOURCEID_EQ(TaskId, CFE_ES_TaskRecordGetID(UtTaskRecPtr));
+#endif
+
     /* Case where not fully set up */
     UtTaskRecPtr->AppId = CFE_ES_APPID_UNDEFINED;
     CFE_ES_TaskEntryPoint();
@@ -3904,6 +4903,40 @@ void TestAPI(void)
      * CFE_ES_ComputeCRC_GetParams. */
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_ES_CrcType_NONE), 0);
 
+    /* Test calculating a CRC on a range of memory using CRC-32C */
+    ES_ResetUnitTest();
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_ES_CrcType_32_C), 942868152);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_ES_CrcType_32_C), 0xE3069283);
+    UtAssert_UINT32_EQ(CFE_ES_ComputeCRC_Algo_32_C_Portable("123456789", 9, 0), 0xE3069283);
+
+    /* CRC-32C over non-contiguous pieces gives the same result as over the whole range */
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("56789", 5, CFE_ES_CalculateCRC("1234", 4, 0, CFE_ES_CrcType_32_C),
+                                           CFE_ES_CrcType_32_C),
+                       0xE3069283);
+
+    /*
+     * The processor CRC instructions (when used) and the portable algorithm
+     * must agree, including on unaligned buffers and partial words
+     */
+    for (i = 0; i < sizeof(CrcBuf); ++i)
+    {
+        CrcBuf[i] = (uint8)(i * 37);
+    }
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&CrcBuf[3], sizeof(CrcBuf) - 3, 0, CFE_ES_CrcType_32_C),
+                       CFE_ES_ComputeCRC_Algo_32_C_Portable(&CrcBuf[3], sizeof(CrcBuf) - 3, 0));
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CrcBuf, sizeof(CrcBuf), 0, CFE_ES_CrcType_16_ARC), 0x2A75);
+
+    /* Advancing a raw CRC over zero bytes gives the same result as processing them */
+    memset(CrcBuf, 0, sizeof(CrcBuf));
+    UtAssert_UINT32_EQ(CFE_ES_ComputeCRC_ShiftZeros(CFE_ES_ComputeCRC_GetParams(CFE_ES_CrcType_32_C), 0x12345678,
+                                                    sizeof(CrcBuf)),
+                       CFE_ES_ComputeCRC_Raw(CFE_ES_ComputeCRC_GetParams(CFE_ES_CrcType_32_C), CrcBuf, sizeof(CrcBuf),
+                                             0x12345678));
+    UtAssert_UINT32_EQ(
+        CFE_ES_ComputeCRC_ShiftZeros(CFE_ES_ComputeCRC_GetParams(CFE_ES_CrcType_16_ARC), 0x1234, sizeof(CrcBuf)),
+        CFE_ES_ComputeCRC_Raw(CFE_ES_ComputeCRC_GetParams(CFE_ES_CrcType_16_ARC), CrcBuf, sizeof(CrcBuf), 0x1234));
+    UtAssert_UINT32_EQ(CFE_ES_ComputeCRC_ShiftZeros(CFE_ES_ComputeCRC_GetParams(CFE_ES_CrcType_NONE), 0x1234, 1), 0);
+
     /* Test shared mutex take with a take error */
     ES_ResetUnitTest();
     ES_UT_SetupSingleAppId(CFE_ES_AppType_CORE, CFE_ES_AppState_RUNNING, "UT", NULL, NULL);
@@ -3918,6 +4951,73 @@ void TestAPI(void)
     CFE_ES_UnlockSharedData(__func__, 98765);
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_MUTEX_GIVE]);
 
+    /* Test a lock-free read of the shared data that is not interrupted */
+    ES_ResetUnitTest();
+    memset(&ReadState, 0, sizeof(ReadState));
+    CFE_ES_ReadSharedDataBegin(&ReadState, __func__, __LINE__);
+    UtAssert_BOOL_FALSE(ReadState.IsLocked);
+    UtAssert_BOOL_FALSE(CFE_ES_ReadSharedDataRetry(&ReadState, __func__, __LINE__));
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+
+    /* Test a read while a writer holds the lock, which must wait on the mutex */
+    ES_ResetUnitTest();
+    CFE_ES_LockSharedData(__func__, __LINE__);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SharedDataSeq, 1);
+    memset(&ReadState, 0, sizeof(ReadState));
+    CFE_ES_ReadSharedDataBegin(&ReadState, __func__, __LINE__);
+    UtAssert_BOOL_TRUE(ReadState.IsLocked);
+    UtAssert_BOOL_FALSE(CFE_ES_ReadSharedDataRetry(&ReadState, __func__, __LINE__));
+    UtAssert_UINT32_EQ(CFE_ES_Global.SharedDataSeq, 1); /* nested lock does not end the write */
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SharedDataSeq, 2);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 2);
+
+    /* Test a reader interrupted by writers, which falls back to the mutex */
+    ES_ResetUnitTest();
+    memset(&ReadState, 0, sizeof(ReadState));
+    do
+    {
+        CFE_ES_ReadSharedDataBegin(&ReadState, __func__, __LINE__);
+        if (!ReadState.IsLocked)
+        {
+            CFE_ES_LockSharedData(__func__, __LINE__);
+            CFE_ES_UnlockSharedData(__func__, __LINE__);
+        }
+    } while (CFE_ES_ReadSharedDataRetry(&ReadState, __func__, __LINE__));
+    UtAssert_UINT32_EQ(ReadState.Attempts, CFE_ES_SHARED_DATA_READ_ATTEMPTS);
+    UtAssert_STUB_COUNT(OS_MutSemTake, CFE_ES_SHARED_DATA_READ_ATTEMPTS + 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SharedDataLockDepth, 0);
+
+    /* An unbalanced release must not disturb the sequence */
+    ES_ResetUnitTest();
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SharedDataSeq, 0);
+
+    /* A reader that falls back to the mutex is not a writer and must not advance the sequence */
+    ES_ResetUnitTest();
+    memset(&ReadState, 0, sizeof(ReadState));
+    ReadState.Attempts = CFE_ES_SHARED_DATA_READ_ATTEMPTS;
+    CFE_ES_ReadSharedDataBegin(&ReadState, __func__, __LINE__);
+    UtAssert_BOOL_TRUE(ReadState.IsLocked);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SharedDataSeq, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SharedDataLockDepth, 0);
+    UtAssert_BOOL_FALSE(CFE_ES_ReadSharedDataRetry(&ReadState, __func__, __LINE__));
+    UtAssert_UINT32_EQ(CFE_ES_Global.SharedDataSeq, 0);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+
+    /* Names are copied without reading past the stored array, even if unterminated */
+    memset(AppName, 'x', sizeof(AppName));
+    CFE_ES_ReadSharedName(AppName, sizeof(AppName), "UnterminatedName", 4);
+    UtAssert_STRINGBUF_EQ(AppName, sizeof(AppName), "Unte", 5);
+    CFE_ES_ReadSharedName(AppName, 3, "UT", 3);
+    UtAssert_STRINGBUF_EQ(AppName, sizeof(AppName), "UT", 3);
+    CFE_ES_ReadSharedName(AppName, 3, "LongName", 9);
+    UtAssert_STRINGBUF_EQ(AppName, sizeof(AppName), "Lo", 3);
+    AppName[0] = 'x';
+    CFE_ES_ReadSharedName(AppName, 0, "UT", 3);
+    UtAssert_INT32_EQ(AppName[0], 'x');
+
     /* Test waiting for apps to initialize before continuing; transition from
      * initializing to running
      */
@@ -4027,6 +5127,26 @@ void TestAPI(void)
     ES_ResetUnitTest();
     UT_SetDeferredRetcode(UT_KEY(OS_TaskGetId), 1, OS_ObjectIdToInteger(OS_OBJECT_ID_UNDEFINED));
     UtAssert_INT32_EQ(CFE_ES_GetTaskID(&TaskId), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+#ifdef CFE_ES_TASK_CONTEXT_CACHE_ENABLED
+    /* The first lookup caches the context, later lookups do not take the lock */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, &UtTaskRecPtr);
+    UtAssert_BOOL_FALSE(CFE_ES_GetTaskContextCache(NULL, NULL));
+    CFE_UtAssert_SUCCESS(CFE_ES_GetAppID(&AppId));
+    CFE_UtAssert_RESOURCEID_EQ(AppId, CFE_ES_AppRecordGetID(UtAppRecPtr));
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetTaskID(&TaskId));
+    CFE_UtAssert_RESOURCEID_EQ(TaskId, CFE_ES_TaskRecordGetID(UtTaskRecPtr));
+    CFE_UtAssert_SUCCESS(CFE_ES_GetAppID(&AppId));
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+
+    /* Freeing any task record invalidates the cached context */
+    CFE_ES_TaskRecordSetFree(UtTaskRecPtr);
+    UtAssert_INT32_EQ(CFE_ES_GetAppID(&AppId), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_ES_GetTaskID(&TaskId), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 3);
+#endif
 }
 
 void TestGenericCounterAPI(void)
@@ -4247,6 +5367,19 @@ void TestCDS(void)
     /* No reset here -- just attempt to register the same name again */
     CFE_UtAssert_SUCCESS(CFE_ES_RegisterCDS(&CDSHandle, 6, "Name"));
 
+    /* Test registering the same name as double buffered, which needs a new block */
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterCDSDoubleBuffered(&CDSHandle, 6, "Name"));
+    UtAssert_INT32_EQ(CFE_ES_RegisterCDSDoubleBuffered(&CDSHandle, 6, "Name"), CFE_ES_CDS_ALREADY_EXISTS);
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CDSHandle, BlockData, 0, 1), CFE_ES_NOT_IMPLEMENTED);
+
+    /* Test changing the mode where the raw sizes of the two layouts are the same */
+    TempSize = 2 * (6 + sizeof(CFE_ES_CDS_SequencedHeader_t)) - sizeof(CFE_ES_CDS_BlockHeader_t);
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterCDS(&CDSHandle, TempSize, "Name"));
+    UtAssert_BOOL_FALSE(CFE_ES_LocateCDSBlockRecordByID(CDSHandle)->DoubleBuffered);
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterCDSDoubleBuffered(&CDSHandle, 6, "Name"));
+    UtAssert_BOOL_TRUE(CFE_ES_LocateCDSBlockRecordByID(CDSHandle)->DoubleBuffered);
+    UtAssert_INT32_EQ(CFE_ES_RegisterCDSDoubleBuffered(&CDSHandle, 6, "Name"), CFE_ES_CDS_ALREADY_EXISTS);
+
     /* Register a new size with a read CDS failure */
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 1, OS_ERROR);
     UtAssert_INT32_EQ(CFE_ES_RegisterCDS(&CDSHandle, 8, "Name"), CFE_ES_CDS_ACCESS_ERROR);
@@ -4299,6 +5432,15 @@ void TestCDS(void)
     /* Copy to CDS with NULL */
     UtAssert_INT32_EQ(CFE_ES_CopyToCDS(CDSHandle, NULL), CFE_ES_BAD_ARGUMENT);
 
+    /* Test successfully copying a range to a CDS, and with NULL */
+    CFE_UtAssert_SUCCESS(CFE_ES_CopyToCDSRange(CDSHandle, &BlockData[2], 2, 4));
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CDSHandle, NULL, 2, 4), CFE_ES_BAD_ARGUMENT);
+
+    /* Test successfully posting a deferred copy to a CDS and flushing it, and with NULL */
+    CFE_UtAssert_SUCCESS(CFE_ES_CopyToCDSDeferred(CDSHandle, &BlockData));
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSDeferred(CDSHandle, NULL), CFE_ES_BAD_ARGUMENT);
+    CFE_UtAssert_SUCCESS(CFE_ES_FlushCDS(CDSHandle));
+
     /* Test successfully restoring from a CDS */
     CFE_UtAssert_SUCCESS(CFE_ES_RestoreFromCDS(&BlockData, CDSHandle));
 
@@ -4514,12 +5656,17 @@ void TestCDS(void)
 
 void TestCDSMempool(void)
 {
-    CFE_ES_CDS_RegRec_t *UtCdsRegRecPtr;
-    int                  Data;
-    CFE_ES_CDSHandle_t   BlockHandle;
-    size_t               SavedSize;
-    size_t               SavedOffset;
-    void *               CdsPtr;
+    CFE_ES_CDS_RegRec_t *    UtCdsRegRecPtr;
+    int                      Data;
+    CFE_ES_CDSHandle_t       BlockHandle;
+    size_t                   SavedSize;
+    size_t                   SavedOffset;
+    void *                   CdsPtr;
+    uint8                    RangeData[150];
+    uint8                    RangeCheck[150];
+    uint32                   WriteCount;
+    size_t                   i;
+    CFE_ES_CDS_BlockState_t *BlockStatePtr;
 
     UtPrintf("Begin Test CDS memory pool");
 
@@ -4618,6 +5765,296 @@ void TestCDSMempool(void)
     UtAssert_INT32_EQ(CFE_ES_CDSBlockRead(&Data, BlockHandle), CFE_ES_CDS_BLOCK_CRC_ERR);
     *((unsigned char *)CdsPtr + UtCdsRegRecPtr->BlockOffset) ^= 0x02; /* Fix Bit */
 
+    /* Test CDS block range writes, with a block that spans several chunks */
+    ES_ResetUnitTest();
+    ES_UT_SetupCDSGlobal(ES_UT_CDS_SMALL_TEST_SIZE);
+    ES_UT_SetupSingleCDSRegistry("UT", sizeof(RangeData) + sizeof(CFE_ES_CDS_BlockHeader_t), false, &UtCdsRegRecPtr);
+    BlockHandle = CFE_ES_CDSBlockRecordGetID(UtCdsRegRecPtr);
+    for (i = 0; i < sizeof(RangeData); ++i)
+    {
+        RangeData[i] = (uint8)i;
+    }
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, RangeData));
+
+    /* Update a few bytes in the middle, the block CRC must still match on read */
+    RangeData[70] = 0xAA;
+    RangeData[73] = 0x55;
+    WriteCount    = UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteRange(BlockHandle, &RangeData[70], 70, 4));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS)), WriteCount + 2);
+    memset(RangeCheck, 0, sizeof(RangeCheck));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(RangeCheck, BlockHandle));
+    UtAssert_MemCmp(RangeCheck, RangeData, sizeof(RangeData), "CDS content after range write");
+
+    /* A range covering the whole block, where only the last chunk has changed */
+    RangeData[sizeof(RangeData) - 1] ^= 0xFF;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, sizeof(RangeData)));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(RangeCheck, BlockHandle));
+    UtAssert_MemCmp(RangeCheck, RangeData, sizeof(RangeData), "CDS content after range write");
+
+    /* Writing unchanged content does not write to the CDS at all */
+    WriteCount = UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteRange(BlockHandle, &RangeData[10], 10, 100));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, sizeof(RangeData), 0));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS)), WriteCount);
+
+    /* Range outside of the block */
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 1, sizeof(RangeData)), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, sizeof(RangeData) + 1, 0),
+                      CFE_ES_BAD_ARGUMENT);
+
+    /* Corrupt/change the block offset and size, should fail validation */
+    --UtCdsRegRecPtr->BlockOffset;
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 1), CFE_ES_POOL_BLOCK_INVALID);
+    ++UtCdsRegRecPtr->BlockOffset;
+    --UtCdsRegRecPtr->BlockSize;
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 1), CFE_ES_CDS_INVALID_SIZE);
+    ++UtCdsRegRecPtr->BlockSize;
+
+    /* CDS read errors: block descriptor, block header and current content */
+    RangeData[0] ^= 0xFF;
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 1), CFE_ES_CDS_ACCESS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 2, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 1), CFE_ES_CDS_ACCESS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 3, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 1), CFE_ES_CDS_ACCESS_ERROR);
+
+    /* CDS write errors: block header and new content */
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 1), CFE_ES_CDS_ACCESS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 2, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 1), CFE_ES_CDS_ACCESS_ERROR);
+
+    /* Invalid handle */
+    BlockHandle = CFE_ES_CDSHANDLE_C(CFE_ResourceId_FromInteger(7));
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 1), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /* Test deferred CDS block writes */
+    ES_ResetUnitTest();
+    ES_UT_SetupCDSGlobal(ES_UT_CDS_SMALL_TEST_SIZE);
+    ES_UT_SetupSingleCDSRegistry("UT", sizeof(RangeData) + sizeof(CFE_ES_CDS_BlockHeader_t), false, &UtCdsRegRecPtr);
+    BlockHandle = CFE_ES_CDSBlockRecordGetID(UtCdsRegRecPtr);
+    memset(RangeData, 0x11, sizeof(RangeData));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, RangeData));
+
+    /* Posting snapshots does not write to the CDS, and wakes the background job only once */
+    CFE_Atomic_Store(&CFE_ES_Global.BackgroundTask.NumJobs, 1);
+    WriteCount   = UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS));
+    RangeData[5] = 0x22;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteDeferred(BlockHandle, RangeData));
+    RangeData[6] = 0x33;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteDeferred(BlockHandle, RangeData));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS)), WriteCount);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    UtAssert_UINT32_EQ(CFE_Atomic_Load(&CFE_ES_Global.BackgroundTask.Jobs[0].WakeRequested), 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.CDSVars.DeferredPendingCount, 1);
+
+    /* Reading the block returns the latest snapshot */
+    memset(RangeCheck, 0, sizeof(RangeCheck));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(RangeCheck, BlockHandle));
+    UtAssert_MemCmp(RangeCheck, RangeData, sizeof(RangeData), "CDS content with pending snapshot");
+
+    /* The background job writes the snapshot once the rate has elapsed */
+    UtAssert_BOOL_TRUE(CFE_ES_RunCDSDeferredWrite(CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_RATE - 1, &CFE_ES_Global.CDSVars));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS)), WriteCount);
+    UtAssert_BOOL_FALSE(CFE_ES_RunCDSDeferredWrite(1, &CFE_ES_Global.CDSVars));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS)), WriteCount + 2);
+    UtAssert_ZERO(CFE_ES_Global.CDSVars.DeferredPendingCount);
+    memset(RangeCheck, 0, sizeof(RangeCheck));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(RangeCheck, BlockHandle));
+    UtAssert_MemCmp(RangeCheck, RangeData, sizeof(RangeData), "CDS content after deferred write");
+
+    /* Nothing to write when idle */
+    UtAssert_BOOL_FALSE(CFE_ES_RunCDSDeferredWrite(CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_RATE, &CFE_ES_Global.CDSVars));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS)), WriteCount + 2);
+
+    /* Flush writes a pending snapshot right away, and nothing if none is pending */
+    RangeData[7] = 0x44;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteDeferred(BlockHandle, RangeData));
+    WriteCount = UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockFlush(BlockHandle));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockFlush(BlockHandle));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS)), WriteCount + 2);
+
+    /* A full write supersedes a pending snapshot */
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteDeferred(BlockHandle, RangeData));
+    RangeData[8] = 0x55;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, RangeData));
+    UtAssert_ZERO(CFE_ES_Global.CDSVars.DeferredPendingCount);
+
+    /* A range write applies on top of a pending snapshot */
+    RangeData[9] = 0x66;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteDeferred(BlockHandle, RangeData));
+    RangeData[100] = 0x77;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteRange(BlockHandle, &RangeData[100], 100, 1));
+    UtAssert_ZERO(CFE_ES_Global.CDSVars.DeferredPendingCount);
+    memset(RangeCheck, 0, sizeof(RangeCheck));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(RangeCheck, BlockHandle));
+    UtAssert_MemCmp(RangeCheck, RangeData, sizeof(RangeData), "CDS content after range write");
+
+    /* A pending snapshot that fails to be written is reported, and no longer pending */
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteDeferred(BlockHandle, RangeData));
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockFlush(BlockHandle), CFE_ES_CDS_ACCESS_ERROR);
+    UtAssert_ZERO(CFE_ES_Global.CDSVars.DeferredPendingCount);
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteDeferred(BlockHandle, RangeData));
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 1, OS_ERROR);
+    UtAssert_BOOL_FALSE(CFE_ES_RunCDSDeferredWrite(CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_RATE, &CFE_ES_Global.CDSVars));
+    UtAssert_ZERO(CFE_ES_Global.CDSVars.DeferredPendingCount);
+
+    /* A range write fails if the pending snapshot cannot be written first */
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteDeferred(BlockHandle, RangeData));
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 1), CFE_ES_CDS_ACCESS_ERROR);
+
+    /* The snapshot of a block that was deleted is discarded */
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteDeferred(BlockHandle, RangeData));
+    CFE_ES_DeleteCDS("UT", false);
+    UtAssert_ZERO(CFE_ES_Global.CDSVars.DeferredPendingCount);
+    WriteCount = UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS));
+    UtAssert_BOOL_FALSE(CFE_ES_RunCDSDeferredWrite(CFE_PLATFORM_ES_CDS_DEFERRED_WRITE_RATE, &CFE_ES_Global.CDSVars));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS)), WriteCount);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteDeferred(BlockHandle, RangeData), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockFlush(BlockHandle), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /* The snapshot of a block that is registered again with a larger size is discarded */
+    ES_ResetUnitTest();
+    ES_UT_SetupCDSGlobal(ES_UT_CDS_SMALL_TEST_SIZE);
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterCDSBlock(&BlockHandle, 10, "UT.RESIZE", false, false));
+    memset(RangeData, 0xA5, sizeof(RangeData));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteDeferred(BlockHandle, RangeData));
+    UtAssert_UINT32_EQ(CFE_ES_Global.CDSVars.DeferredPendingCount, 1);
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterCDSBlock(&BlockHandle, sizeof(RangeData), "UT.RESIZE", false, false));
+    UtAssert_ZERO(CFE_ES_Global.CDSVars.DeferredPendingCount);
+    WriteCount = UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockFlush(BlockHandle));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS)), WriteCount);
+    memset(RangeCheck, 0, sizeof(RangeCheck));
+    CFE_ES_CDSBlockRead(RangeCheck, BlockHandle);
+    UtAssert_True(RangeCheck[0] != 0xA5, "Stale snapshot not read back");
+
+    /* A snapshot that does not match the size of its block is neither read back nor written */
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteDeferred(BlockHandle, RangeData));
+    UtCdsRegRecPtr = CFE_ES_LocateCDSBlockRecordByID(BlockHandle);
+    CFE_ES_Global.CDSVars.DeferredWrite[UtCdsRegRecPtr - CFE_ES_Global.CDSVars.Registry].DataSize = 10;
+    memset(RangeCheck, 0, sizeof(RangeCheck));
+    CFE_ES_CDSBlockRead(RangeCheck, BlockHandle);
+    UtAssert_True(RangeCheck[0] != 0xA5, "Stale snapshot not read back");
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockFlush(BlockHandle));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS)), WriteCount);
+    UtAssert_ZERO(CFE_ES_Global.CDSVars.DeferredPendingCount);
+
+    /* Without staging space left while another snapshot is pending, the snapshot is written right away */
+    ES_ResetUnitTest();
+    ES_UT_SetupCDSGlobal(ES_UT_CDS_SMALL_TEST_SIZE);
+    ES_UT_SetupSingleCDSRegistry("UT", sizeof(RangeData) + sizeof(CFE_ES_CDS_BlockHeader_t), false, &UtCdsRegRecPtr);
+    BlockHandle = CFE_ES_CDSBlockRecordGetID(UtCdsRegRecPtr);
+    WriteCount  = UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS));
+
+    CFE_ES_Global.CDSVars.DeferredMemUsed      = sizeof(CFE_ES_Global.CDSVars.DeferredMem) - sizeof(RangeData) + 1;
+    CFE_ES_Global.CDSVars.DeferredPendingCount = 1;
+
+    CFE_ES_Global.CDSVars.DeferredWrite[CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES - 1].IsPending = true;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteDeferred(BlockHandle, RangeData));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS)), WriteCount + 2);
+    UtAssert_UINT32_EQ(CFE_ES_Global.CDSVars.DeferredPendingCount, 1);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 0);
+
+    /* Once no snapshot is pending, the staging space is reclaimed and the snapshot is deferred */
+    CFE_ES_Global.CDSVars.DeferredWrite[CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES - 1].IsPending = false;
+
+    CFE_ES_Global.CDSVars.DeferredPendingCount = 0;
+    WriteCount                                 = UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteDeferred(BlockHandle, RangeData));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS)), WriteCount);
+    UtAssert_UINT32_EQ(CFE_ES_Global.CDSVars.DeferredPendingCount, 1);
+    UtAssert_EQ(size_t, CFE_ES_Global.CDSVars.DeferredMemUsed, sizeof(RangeData));
+
+    /* Test double buffered CDS block access, starting with neither copy written */
+    ES_ResetUnitTest();
+    ES_UT_SetupCDSGlobal(ES_UT_CDS_SMALL_TEST_SIZE);
+    ES_UT_SetupSingleCDSRegistry("UT", 2 * (sizeof(RangeData) + sizeof(CFE_ES_CDS_SequencedHeader_t)), false,
+                                 &UtCdsRegRecPtr);
+    BlockHandle                    = CFE_ES_CDSBlockRecordGetID(UtCdsRegRecPtr);
+    BlockStatePtr                  = CFE_ES_CDSBlockRecordGetState(UtCdsRegRecPtr);
+    UtCdsRegRecPtr->DoubleBuffered = true;
+    UtAssert_UINT32_EQ(CFE_ES_CDSBlockRecordGetUserSize(UtCdsRegRecPtr), sizeof(RangeData));
+    UT_GetDataBuffer(UT_KEY(CFE_PSP_ReadFromCDS), &CdsPtr, NULL, NULL);
+    memset((uint8 *)CdsPtr + UtCdsRegRecPtr->BlockOffset, 0, UtCdsRegRecPtr->BlockSize);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockRead(RangeCheck, BlockHandle), CFE_ES_CDS_BLOCK_CRC_ERR);
+
+    /* Writes alternate between the copies, and the newest one is restored */
+    memset(RangeData, 0x11, sizeof(RangeData));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, RangeData));
+    UtAssert_UINT32_EQ(BlockStatePtr->CurrentCopy, 1);
+    memset(RangeData, 0x22, sizeof(RangeData));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, RangeData));
+    UtAssert_UINT32_EQ(BlockStatePtr->CurrentCopy, 0);
+    UtAssert_UINT32_EQ(BlockStatePtr->Sequence, 2);
+    memset(RangeCheck, 0, sizeof(RangeCheck));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(RangeCheck, BlockHandle));
+    UtAssert_MemCmp(RangeCheck, RangeData, sizeof(RangeData), "Newest copy restored");
+
+    /* A corrupted newest copy leaves the previous data to restore, and is the next one written */
+    *((uint8 *)CdsPtr + UtCdsRegRecPtr->BlockOffset + sizeof(CFE_ES_CDS_SequencedHeader_t)) ^= 0x02;
+    BlockStatePtr->IsCopyKnown = false;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(RangeCheck, BlockHandle));
+    memset(RangeData, 0x11, sizeof(RangeData));
+    UtAssert_MemCmp(RangeCheck, RangeData, sizeof(RangeData), "Previous copy restored");
+    UtAssert_UINT32_EQ(BlockStatePtr->CurrentCopy, 1);
+    memset(RangeData, 0x33, sizeof(RangeData));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, RangeData));
+    UtAssert_UINT32_EQ(BlockStatePtr->CurrentCopy, 0);
+
+    /* A write interrupted before its header is written does not replace the data */
+    memset(RangeData, 0x44, sizeof(RangeData));
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 2, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWrite(BlockHandle, RangeData), CFE_ES_CDS_ACCESS_ERROR);
+    BlockStatePtr->IsCopyKnown = false;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(RangeCheck, BlockHandle));
+    memset(RangeData, 0x33, sizeof(RangeData));
+    UtAssert_MemCmp(RangeCheck, RangeData, sizeof(RangeData), "Data of interrupted write not restored");
+
+    /* A write without a known newest copy checks the copies first, in chunks */
+    BlockStatePtr->IsCopyKnown = false;
+    memset(RangeData, 0x55, sizeof(RangeData));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, RangeData));
+    UtAssert_UINT32_EQ(BlockStatePtr->CurrentCopy, 1);
+    UtAssert_UINT32_EQ(BlockStatePtr->Sequence, 3);
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(RangeCheck, BlockHandle));
+    UtAssert_MemCmp(RangeCheck, RangeData, sizeof(RangeData), "CDS content after write");
+
+    /* Deferred writes go through the same path */
+    memset(RangeData, 0x66, sizeof(RangeData));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteDeferred(BlockHandle, RangeData));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockFlush(BlockHandle));
+    UtAssert_UINT32_EQ(BlockStatePtr->CurrentCopy, 0);
+
+    /* The sequence number skips zero when it rolls over */
+    BlockStatePtr->Sequence = 0xFFFFFFFF;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, RangeData));
+    UtAssert_UINT32_EQ(BlockStatePtr->Sequence, 1);
+
+    /* Range writes are not supported */
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 1), CFE_ES_NOT_IMPLEMENTED);
+
+    /* CDS read errors: copy header and copy content, on read and on write */
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 2, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockRead(RangeCheck, BlockHandle), CFE_ES_CDS_ACCESS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 4, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockRead(RangeCheck, BlockHandle), CFE_ES_CDS_ACCESS_ERROR);
+    BlockStatePtr->IsCopyKnown = false;
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 2, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWrite(BlockHandle, RangeData), CFE_ES_CDS_ACCESS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 4, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWrite(BlockHandle, RangeData), CFE_ES_CDS_ACCESS_ERROR);
+
+    /* CDS write error: copy content */
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(RangeCheck, BlockHandle));
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWrite(BlockHandle, RangeData), CFE_ES_CDS_ACCESS_ERROR);
+
     /* Set up again with a CDS that is too small to get branch coverage */
     /* Test CDS block access */
     ES_ResetUnitTest();
@@ -4625,6 +6062,7 @@ void TestCDSMempool(void)
     ES_UT_SetupSingleCDSRegistry("UT", sizeof(CFE_ES_CDS_BlockHeader_t) - 2, false, &UtCdsRegRecPtr);
     BlockHandle = CFE_ES_CDSBlockRecordGetID(UtCdsRegRecPtr);
     UtAssert_INT32_EQ(CFE_ES_CDSBlockWrite(BlockHandle, &Data), CFE_ES_CDS_INVALID_SIZE);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteDeferred(BlockHandle, &Data), CFE_ES_CDS_INVALID_SIZE);
     UtAssert_INT32_EQ(CFE_ES_CDSBlockRead(&Data, BlockHandle), CFE_ES_CDS_INVALID_SIZE);
 }
 
@@ -4639,8 +6077,26 @@ void TestESMempool(void)
     CFE_ES_MemPoolRecord_t *PoolPtr;
     CFE_ES_MemPoolStats_t   Stats;
     size_t                  BlockSizes[CFE_PLATFORM_ES_POOL_MAX_BUCKETS + 2];
+    uint16                  NumBlockSizes;
     CFE_ES_GenPoolBD_t *    BdPtr;
     uint32                  i;
+    CFE_ES_AppRecord_t *    UtAppRecPtr;
+    CFE_ES_TaskRecord_t *   UtTaskRecPtr;
+    CFE_ES_TaskRecord_t *   UtChildTaskRecPtr;
+    osal_id_t               TestObjId;
+    CFE_ES_MemPoolBuf_t     CacheBufs[CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH + 1];
+    CFE_ES_MemPoolTaskCache_t *CachePtr;
+    uint16                     BucketId;
+    uint32                     TakeCount;
+    uint32                     NumCreated;
+    uint32                     NumFree;
+    CFE_ES_MemPoolDiag_t       Diag;
+    CFE_ES_BackgroundPoolStatsDumpGlobal_t PoolStatsState;
+    void *                                 LocalBuffer;
+    size_t                                 LocalBufSize;
+#ifdef CFE_ES_POOL_ALLOC_TRACKING_ENABLED
+    CFE_ES_PoolAllocTrackEntry_t TrackEntry;
+#endif
 
     UtPrintf("Begin Test ES memory pool");
 
@@ -5008,6 +6464,357 @@ void TestESMempool(void)
     /* Test getting the size of a pool buffer with an invalid memory handle, NULL buffer */
     UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(CFE_ES_MEMHANDLE_UNDEFINED, addressp1), CFE_ES_ERR_RESOURCEID_NOT_VALID);
     UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, NULL), CFE_ES_BAD_ARGUMENT);
+
+    /* Test generating geometric block sizes and creating a pool with them */
+    ES_ResetUnitTest();
+    UtAssert_INT32_EQ(CFE_ES_PoolGeometricBlockSizes(BlockSizes, NULL, 16, 512, 25), CFE_ES_BAD_ARGUMENT);
+    NumBlockSizes = 4;
+    UtAssert_INT32_EQ(CFE_ES_PoolGeometricBlockSizes(BlockSizes, &NumBlockSizes, 16, 512, 25), CFE_ES_BAD_ARGUMENT);
+    UtAssert_UINT32_EQ(NumBlockSizes, 4);
+    CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_GEOMETRIC_SIZES]);
+
+    /* the buffer may be larger than the pool limit, the output never is */
+    NumBlockSizes = CFE_PLATFORM_ES_POOL_MAX_BUCKETS + 2;
+    UtAssert_INT32_EQ(CFE_ES_PoolGeometricBlockSizes(BlockSizes, &NumBlockSizes, 1, 512, 1), CFE_ES_BAD_ARGUMENT);
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolGeometricBlockSizes(BlockSizes, &NumBlockSizes, 16, 512, 25));
+    UtAssert_UINT32_LTEQ(NumBlockSizes, CFE_PLATFORM_ES_POOL_MAX_BUCKETS);
+    UtAssert_EQ(size_t, BlockSizes[NumBlockSizes - 1], 512);
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolCreateEx(&PoolID1, Buffer1, sizeof(Buffer1), NumBlockSizes, BlockSizes,
+                                             CFE_ES_NO_MUTEX));
+    CFE_UtAssert_SUCCESS(CFE_ES_GetPoolBuf(&addressp1, PoolID1, 100));
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBufInfo(PoolID1, addressp1), 100);
+
+    /* Test creating pools with flags */
+    ES_ResetUnitTest();
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateWithFlags(&PoolID1, Buffer1, sizeof(Buffer1), 0, NULL, 0x80),
+                      CFE_ES_BAD_ARGUMENT);
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolCreateWithFlags(&PoolID1, Buffer1, sizeof(Buffer1), 0, NULL, 0));
+    PoolPtr = CFE_ES_LocateMemPoolRecordByID(PoolID1);
+    UtAssert_BOOL_FALSE(PoolPtr->UseTaskCache);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(PoolPtr->MutexId));
+    CFE_UtAssert_SUCCESS(
+        CFE_ES_PoolCreateWithFlags(&PoolID2, Buffer2, sizeof(Buffer2), 0, NULL, CFE_ES_POOL_USE_MUTEX));
+    PoolPtr = CFE_ES_LocateMemPoolRecordByID(PoolID2);
+    UtAssert_BOOL_FALSE(PoolPtr->UseTaskCache);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(PoolPtr->MutexId));
+
+    /* Test a pool with task caches, where a task reuses its own blocks without the mutex */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, &UtTaskRecPtr);
+    TestObjId = CFE_ES_TaskId_ToOSAL(CFE_ES_TaskRecordGetID(UtTaskRecPtr));
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskGetId), OS_ObjectIdToInteger(TestObjId));
+    CFE_UtAssert_SUCCESS(
+        CFE_ES_PoolCreateWithFlags(&PoolID1, Buffer1, sizeof(Buffer1), 0, NULL, CFE_ES_POOL_TASK_CACHE));
+    PoolPtr = CFE_ES_LocateMemPoolRecordByID(PoolID1);
+    UtAssert_BOOL_TRUE(PoolPtr->UseTaskCache);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(PoolPtr->MutexId));
+    BucketId = CFE_ES_GenPoolFindBucket(&PoolPtr->Pool, 10);
+    CachePtr = &PoolPtr->TaskCache[0];
+
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID1, 10), 10);
+    CFE_UtAssert_RESOURCEID_EQ(CachePtr->OwnerTaskId, CFE_ES_TaskRecordGetID(UtTaskRecPtr));
+    TakeCount = UT_GetStubCount(UT_KEY(OS_MutSemTake));
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp1), 10);
+    UtAssert_UINT32_EQ(CachePtr->Buckets[BucketId - 1].Count, 1);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID1, 12), 12);
+    UtAssert_ADDRESS_EQ(addressp2, addressp1);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp2), 12);
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(OS_MutSemTake)), TakeCount);
+
+    /* Filling the cache returns half of it to the pool, and all of the blocks are reported as free */
+    for (i = 0; i <= CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&CacheBufs[i], PoolID1, 10), 10);
+    }
+    for (i = 0; i <= CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, CacheBufs[i]), 10);
+    }
+    UtAssert_UINT32_EQ(CachePtr->Buckets[BucketId - 1].Count,
+                       CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH - (CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH / 2));
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBufInfo(PoolID1, CacheBufs[0]), CFE_ES_POOL_BLOCK_INVALID);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID1));
+    NumCreated = 0;
+    NumFree    = 0;
+    for (i = 0; i < CFE_MISSION_ES_POOL_MAX_BUCKETS; ++i)
+    {
+        NumCreated += Stats.BlockStats[i].NumCreated;
+        NumFree += Stats.BlockStats[i].NumFree;
+    }
+    UtAssert_UINT32_EQ(NumCreated, CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH + 1);
+    UtAssert_UINT32_EQ(NumFree, CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH + 1);
+
+    /* An empty cache is refilled from the blocks that were returned to the pool */
+    for (i = 0; i < CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH - (CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH / 2); ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&CacheBufs[i], PoolID1, 10), 10);
+    }
+    UtAssert_ZERO(CachePtr->Buckets[BucketId - 1].Count);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&CacheBufs[i], PoolID1, 10), 10);
+    UtAssert_UINT32_EQ(CachePtr->Buckets[BucketId - 1].Count, (CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH / 2) - 1);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID1));
+    NumCreated = 0;
+    for (i = 0; i < CFE_MISSION_ES_POOL_MAX_BUCKETS; ++i)
+    {
+        NumCreated += Stats.BlockStats[i].NumCreated;
+    }
+    UtAssert_UINT32_EQ(NumCreated, CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH + 1);
+
+    /* Requests served from the cache are counted too */
+    UtAssert_UINT32_EQ(Stats.NumBlocksRequested,
+                       2 * CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH - (CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH / 2) + 4);
+
+    /* Oversized requests and calls from outside of a CFE task use the pool directly */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID1, sizeof(Buffer1)), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    CFE_ES_InvalidateTaskContextCache();
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskGetId), 1, OS_ObjectIdToInteger(OS_OBJECT_ID_UNDEFINED));
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID1, 100), 100);
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskGetId), 1, OS_ObjectIdToInteger(OS_OBJECT_ID_UNDEFINED));
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp1), 100);
+    UtAssert_ZERO(CachePtr->Buckets[CFE_ES_GenPoolFindBucket(&PoolPtr->Pool, 100) - 1].Count);
+
+    /* A corrupt cached block is dropped and counted, the other cached blocks are kept */
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, CacheBufs[0]), 10);
+    UtAssert_UINT32_EQ(CachePtr->Buckets[BucketId - 1].Count, CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH / 2);
+    BdPtr            = (CFE_ES_GenPoolBD_t *)((cpuaddr)CacheBufs[0] - sizeof(CFE_ES_GenPoolBD_t));
+    BdPtr->CheckBits = 0;
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID1, 10), 10);
+    UtAssert_BOOL_TRUE(addressp1 != CacheBufs[0]);
+    UtAssert_UINT32_EQ(CachePtr->Buckets[BucketId - 1].Count, (CFE_PLATFORM_ES_POOL_TASK_CACHE_DEPTH / 2) - 1);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID1));
+    UtAssert_UINT32_EQ(Stats.CheckErrCtr, 1);
+
+    /* Invalid blocks are still detected */
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp1), 10);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp1), CFE_ES_POOL_BLOCK_INVALID);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID1));
+    UtAssert_UINT32_EQ(Stats.CheckErrCtr, 2);
+
+    /* Each task gets its own cache while there are caches left */
+    for (i = 1; i <= CFE_PLATFORM_ES_POOL_TASK_CACHES; ++i)
+    {
+        ES_UT_SetupChildTaskId(UtAppRecPtr, NULL, &UtChildTaskRecPtr);
+        TestObjId = CFE_ES_TaskId_ToOSAL(CFE_ES_TaskRecordGetID(UtChildTaskRecPtr));
+        UT_SetDefaultReturnValue(UT_KEY(OS_TaskGetId), OS_ObjectIdToInteger(TestObjId));
+        CFE_ES_InvalidateTaskContextCache();
+        UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID1, 10), 10);
+        UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp2), 10);
+    }
+    for (i = 0; i < CFE_PLATFORM_ES_POOL_TASK_CACHES; ++i)
+    {
+        UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_EQUAL(PoolPtr->TaskCache[i].OwnerTaskId,
+                                                      CFE_ES_TaskRecordGetID(UtChildTaskRecPtr)));
+    }
+
+    /* The cache of a task that no longer exists is handed over, after returning its blocks */
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID1));
+    NumCreated = 0;
+    for (i = 0; i < CFE_MISSION_ES_POOL_MAX_BUCKETS; ++i)
+    {
+        NumCreated += Stats.BlockStats[i].NumCreated;
+    }
+    CFE_ES_TaskRecordSetFree(UtTaskRecPtr);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID1, 10), 10);
+    CFE_UtAssert_RESOURCEID_EQ(CachePtr->OwnerTaskId, CFE_ES_TaskRecordGetID(UtChildTaskRecPtr));
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID1));
+    for (i = 0; i < CFE_MISSION_ES_POOL_MAX_BUCKETS; ++i)
+    {
+        NumCreated -= Stats.BlockStats[i].NumCreated;
+    }
+    UtAssert_ZERO(NumCreated);
+
+    /* Test a buddy pool, where a large block that was freed can be split for small requests */
+    ES_ResetUnitTest();
+    UtAssert_INT32_EQ(
+        CFE_ES_PoolCreateWithFlags(&PoolID1, Buffer1, sizeof(Buffer1), 0, BlockSizes, CFE_ES_POOL_BUDDY),
+        CFE_ES_BAD_ARGUMENT);
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolCreateWithFlags(&PoolID1, Buffer1, sizeof(Buffer1), 0, NULL, CFE_ES_POOL_BUDDY));
+    PoolPtr = CFE_ES_LocateMemPoolRecordByID(PoolID1);
+    UtAssert_BOOL_TRUE(PoolPtr->Pool.BuddyMode);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID1, 400), 400);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp1), 400);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID1, 10), 10);
+    UtAssert_ADDRESS_EQ(addressp2, addressp1);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBufInfo(PoolID1, addressp2), 10);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp2), 10);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp2), CFE_ES_POOL_BLOCK_INVALID);
+
+    /* Test pool diagnostics */
+    ES_ResetUnitTest();
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateWithFlags(&PoolID1, Buffer1, sizeof(Buffer1), 0, NULL, 0x10),
+                      CFE_ES_BAD_ARGUMENT);
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolCreateWithFlags(&PoolID1, Buffer1, sizeof(Buffer1), 0, NULL,
+                                                    CFE_ES_POOL_USE_MUTEX | CFE_ES_POOL_DIAGNOSTICS));
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolCreate(&PoolID2, Buffer2, sizeof(Buffer2)));
+    UtAssert_INT32_EQ(CFE_ES_GetMemPoolDiag(NULL, PoolID1), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_GetMemPoolDiag(&Diag, CFE_ES_MEMHANDLE_UNDEFINED), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /* A fresh pool is one contiguous free region */
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolDiag(&Diag, PoolID1));
+    UtAssert_BOOL_TRUE(Diag.DiagEnabled);
+    UtAssert_NONZERO(Diag.TotalFreeBytes);
+    UtAssert_EQ(CFE_ES_MemOffset_t, Diag.LargestFreeBytes, Diag.TotalFreeBytes);
+    UtAssert_ZERO(Diag.FragmentationPerMille);
+
+    /* Live and peak block counts follow allocations, and failures are counted */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID1, 10), 10);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID1, 10), 10);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&CacheBufs[0], PoolID1, sizeof(Buffer1)), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp1), 10);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolDiag(&Diag, PoolID1));
+    BucketId = CFE_ES_GenPoolFindBucket(&CFE_ES_LocateMemPoolRecordByID(PoolID1)->Pool, 10);
+    i        = CFE_ES_LocateMemPoolRecordByID(PoolID1)->Pool.NumBuckets - BucketId;
+    UtAssert_UINT32_EQ(Diag.BlockDiag[i].NumLive, 1);
+    UtAssert_UINT32_EQ(Diag.BlockDiag[i].PeakLive, 2);
+    UtAssert_UINT32_EQ(Diag.AllocFailCount, 1);
+    UtAssert_NONZERO(Diag.LockCount);
+
+    /* The freed block is not adjacent to the tail, so the free space is now fragmented */
+    UtAssert_BOOL_TRUE(Diag.LargestFreeBytes < Diag.TotalFreeBytes);
+    UtAssert_NONZERO(Diag.FragmentationPerMille);
+
+    /* Pools without diagnostics only report free space */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID2, 10), 10);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolDiag(&Diag, PoolID2));
+    UtAssert_BOOL_FALSE(Diag.DiagEnabled);
+    UtAssert_ZERO(Diag.LockCount);
+    UtAssert_ZERO(Diag.BlockDiag[i].NumLive);
+    UtAssert_NONZERO(Diag.TotalFreeBytes);
+
+    /* Test the pool statistics file background write functions */
+    memset(&PoolStatsState, 0, sizeof(PoolStatsState));
+    LocalBuffer  = NULL;
+    LocalBufSize = 0;
+    PoolPtr      = CFE_ES_LocateMemPoolRecordByID(PoolID1);
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundPoolStatsFileDataGetter(
+        &PoolStatsState, (uint32)(PoolPtr - CFE_ES_Global.MemPoolTable), &LocalBuffer, &LocalBufSize));
+    UtAssert_ADDRESS_EQ(LocalBuffer, &PoolStatsState.EntryBuffer);
+    UtAssert_EQ(size_t, LocalBufSize, sizeof(PoolStatsState.EntryBuffer));
+    CFE_UtAssert_RESOURCEID_EQ(PoolStatsState.EntryBuffer.PoolHandle, PoolID1);
+    UtAssert_BOOL_TRUE(PoolStatsState.EntryBuffer.PoolDiag.DiagEnabled);
+
+    CFE_ES_MemPoolRecordSetFree(PoolPtr);
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundPoolStatsFileDataGetter(
+        &PoolStatsState, (uint32)(PoolPtr - CFE_ES_Global.MemPoolTable), &LocalBuffer, &LocalBufSize));
+    UtAssert_NULL(LocalBuffer);
+    UtAssert_ZERO(LocalBufSize);
+
+    UtAssert_BOOL_TRUE(CFE_ES_BackgroundPoolStatsFileDataGetter(&PoolStatsState, CFE_PLATFORM_ES_MAX_MEMORY_POOLS,
+                                                                &LocalBuffer, &LocalBufSize));
+    UtAssert_NULL(LocalBuffer);
+    UtAssert_ZERO(LocalBufSize);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundPoolStatsFileEventHandler(&PoolStatsState, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 10, 0,
+                                               100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_POOL_STATS_FILE_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundPoolStatsFileEventHandler(&PoolStatsState, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, -1, 10, 10,
+                                               100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundPoolStatsFileEventHandler(&PoolStatsState, CFE_FS_FileWriteEvent_CREATE_ERROR, -1, 10, 10, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_POOL_STATS_FILE_ERR_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundPoolStatsFileEventHandler(&PoolStatsState, CFE_FS_FileWriteEvent_UNDEFINED, CFE_SUCCESS, 10, 0,
+                                               100);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+#ifdef CFE_ES_POOL_ALLOC_TRACKING_ENABLED
+    /* Test allocation tracking, blocks from the same call site are grouped together */
+    ES_ResetUnitTest();
+    CFE_ES_PoolAllocTrackInit();
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolCreate(&PoolID1, Buffer1, sizeof(Buffer1)));
+    for (i = 0; i < 3; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&CacheBufs[i], PoolID1, 10), 10);
+    }
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID1, 20), 20);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PoolAllocTrack.NumLive, 4);
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundAllocSitesFileDataGetter(&CFE_ES_Global.BackgroundAllocSitesDumpState, 0,
+                                                                  &LocalBuffer, &LocalBufSize));
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundAllocSitesDumpState.NumSites, 2);
+    UtAssert_EQ(size_t, LocalBufSize, sizeof(CFE_ES_PoolAllocSiteRec_t));
+    UtAssert_BOOL_TRUE(CFE_ES_BackgroundAllocSitesFileDataGetter(&CFE_ES_Global.BackgroundAllocSitesDumpState, 1,
+                                                                 &LocalBuffer, &LocalBufSize));
+    NumCreated = CFE_ES_Global.BackgroundAllocSitesDumpState.Sites[0].NumBlocks +
+                 CFE_ES_Global.BackgroundAllocSitesDumpState.Sites[1].NumBlocks;
+    UtAssert_UINT32_EQ(NumCreated, 4);
+
+    /* Blocks are reported once when they get too old */
+    UT_ClearEventHistory();
+    UtAssert_BOOL_FALSE(CFE_ES_RunPoolLeakScan(CFE_PLATFORM_ES_POOL_LEAK_AGE_MSEC - 1, &CFE_ES_Global.PoolAllocTrack));
+    CFE_UtAssert_EVENTCOUNT(0);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp1), 20);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PoolAllocTrack.NumLive, 3);
+    UtAssert_BOOL_FALSE(CFE_ES_RunPoolLeakScan(1, &CFE_ES_Global.PoolAllocTrack));
+    CFE_UtAssert_EVENTSENT(CFE_ES_POOL_LEAK_EID);
+    CFE_UtAssert_EVENTCOUNT(3);
+    UT_ClearEventHistory();
+    UtAssert_BOOL_FALSE(CFE_ES_RunPoolLeakScan(0xFFFFFFFF, &CFE_ES_Global.PoolAllocTrack));
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Services allocating on behalf of an application record the application call site */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBufForCaller(&addressp1, PoolID1, 20, (cpuaddr)0x1234), 20);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PoolAllocTrack.NumLive, 4);
+    UtAssert_BOOL_TRUE(CFE_ES_PoolAllocTrackRemove((cpuaddr)addressp1, &TrackEntry));
+    UtAssert_EQ(cpuaddr, TrackEntry.CallerAddr, 0x1234);
+    UtAssert_EQ(size_t, TrackEntry.Size, 20);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PoolAllocTrack.NumLive, 3);
+    UtAssert_BOOL_FALSE(CFE_ES_PoolAllocTrackRemove((cpuaddr)addressp1, &TrackEntry));
+    CFE_ES_PoolAllocTrackRestore(&TrackEntry);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PoolAllocTrack.NumLive, 4);
+
+    /* A block that fails to go back to the pool stays tracked */
+    BdPtr            = (CFE_ES_GenPoolBD_t *)((cpuaddr)addressp1 - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE);
+    BdPtr->CheckBits = ~CFE_ES_CHECK_PATTERN;
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp1), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PoolAllocTrack.NumLive, 4);
+    BdPtr->CheckBits = CFE_ES_CHECK_PATTERN;
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp1), 20);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PoolAllocTrack.NumLive, 3);
+
+    /* Putting the block again fails without touching the other entries */
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp1), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PoolAllocTrack.NumLive, 3);
+
+    /* Deleting the pool forgets its blocks, leaving an empty file */
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolDelete(PoolID1));
+    UtAssert_ZERO(CFE_ES_Global.PoolAllocTrack.NumLive);
+    UtAssert_BOOL_TRUE(CFE_ES_BackgroundAllocSitesFileDataGetter(&CFE_ES_Global.BackgroundAllocSitesDumpState, 0,
+                                                                 &LocalBuffer, &LocalBufSize));
+    UtAssert_NULL(LocalBuffer);
+    UtAssert_ZERO(LocalBufSize);
+
+    /* Allocations are counted but not tracked when the table is full */
+    CFE_ES_Global.PoolAllocTrack.NumLive = CFE_PLATFORM_ES_POOL_ALLOC_TRACK_ENTRIES;
+    CFE_ES_PoolAllocTrackAdd(PoolID1, (cpuaddr)Buffer1, 10, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PoolAllocTrack.MissedCount, 1);
+    CFE_ES_Global.PoolAllocTrack.NumLive = 0;
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundAllocSitesFileEventHandler(&CFE_ES_Global.BackgroundAllocSitesDumpState,
+                                                CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 10, 0, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_POOL_ALLOC_SITES_FILE_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundAllocSitesFileEventHandler(&CFE_ES_Global.BackgroundAllocSitesDumpState,
+                                                CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR, -1, 10, 10, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundAllocSitesFileEventHandler(&CFE_ES_Global.BackgroundAllocSitesDumpState,
+                                                CFE_FS_FileWriteEvent_CREATE_ERROR, -1, 10, 10, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_POOL_ALLOC_SITES_FILE_ERR_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundAllocSitesFileEventHandler(&CFE_ES_Global.BackgroundAllocSitesDumpState,
+                                                CFE_FS_FileWriteEvent_UNDEFINED, CFE_SUCCESS, 10, 0, 100);
+    CFE_UtAssert_EVENTCOUNT(0);
+#endif
 }
 
 /* Tests to fill gaps in coverage in SysLog */
@@ -5091,13 +6898,69 @@ void TestSysLog(void)
     CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("%s", TmpString));
 }
 
+/*
+ * State of a background job registered by the unit test
+ */
+typedef struct
+{
+    bool   ReturnActive;
+    uint32 CallCount;
+    uint32 CallOrder;
+    uint32 LastElapsedTime;
+} ES_UT_BackgroundJobState_t;
+
+static uint32 ES_UT_BackgroundCallOrder;
+
+static bool ES_UT_BackgroundJob(uint32 ElapsedTime, void *Arg)
+{
+    ES_UT_BackgroundJobState_t *State = Arg;
+
+    ++State->CallCount;
+    State->CallOrder       = ++ES_UT_BackgroundCallOrder;
+    State->LastElapsedTime = ElapsedTime;
+
+    return State->ReturnActive;
+}
+
 void TestBackground(void)
 {
+    CFE_ES_BackgroundJobConfig_t       JobConfig;
+    ES_UT_BackgroundJobState_t         JobState[3];
+    CFE_ES_BackgroundJobsTlm_Payload_t Payload;
+    OS_time_t                          PassTimes[2];
+    uint32                             JobNum[3];
+    uint32                             TestJobNum;
+    char                               LongName[CFE_MISSION_MAX_API_LEN + 1];
+
+    memset(&JobConfig, 0, sizeof(JobConfig));
+    memset(JobState, 0, sizeof(JobState));
+    JobConfig.RunFunc = ES_UT_BackgroundJob;
+
     /* CFE_ES_BackgroundInit() with default setup
-     * causes  CFE_ES_CreateChildTask to fail.
+     * causes  CFE_ES_CreateChildTask to fail,
+     * after the jobs of ES have been registered.
      */
     ES_ResetUnitTest();
     UtAssert_INT32_EQ(CFE_ES_BackgroundInit(), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_STRINGBUF_EQ(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_Global.BackgroundTask.AppScanJobNum].Stats.Name,
+                          -1, "ES_APP_SCAN", -1);
+    UtAssert_STRINGBUF_EQ(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_Global.BackgroundTask.CDSWriteJobNum].Stats.Name,
+                          -1, "ES_CDS_WRITE", -1);
+    UtAssert_STRINGBUF_EQ(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_Global.BackgroundTask.PerfStreamJobNum].Stats.Name,
+                          -1, "ES_PERF_STREAM", -1);
+    UtAssert_STRINGBUF_EQ(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_Global.BackgroundTask.PerfDumpJobNum].Stats.Name,
+                          -1, "ES_PERF_DUMP", -1);
+
+    /* CFE_ES_BackgroundInit() with a failure to create the semaphore */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_BackgroundInit(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_ZERO(CFE_Atomic_Load(&CFE_ES_Global.BackgroundTask.NumJobs));
+
+    /* CFE_ES_BackgroundInit() when the job table is already full */
+    ES_ResetUnitTest();
+    CFE_Atomic_Store(&CFE_ES_Global.BackgroundTask.NumJobs, CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS);
+    UtAssert_INT32_EQ(CFE_ES_BackgroundInit(), CFE_ES_NO_RESOURCE_IDS_AVAILABLE);
 
     /* The CFE_ES_BackgroundCleanup() function has no conditionals -
      * it just needs to be executed as part of this routine,
@@ -5108,25 +6971,199 @@ void TestBackground(void)
     CFE_ES_BackgroundCleanup();
     UtAssert_STUB_COUNT(OS_BinSemDelete, 1);
 
+    /* Test CFE_ES_RegisterBackgroundJob() with bad arguments */
+    ES_ResetUnitTest();
+    JobConfig.Name = "UT_JOB";
+    UtAssert_INT32_EQ(CFE_ES_RegisterBackgroundJob(NULL, &JobConfig), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_RegisterBackgroundJob(&TestJobNum, NULL), CFE_ES_BAD_ARGUMENT);
+    JobConfig.RunFunc = NULL;
+    UtAssert_INT32_EQ(CFE_ES_RegisterBackgroundJob(&TestJobNum, &JobConfig), CFE_ES_BAD_ARGUMENT);
+    JobConfig.RunFunc = ES_UT_BackgroundJob;
+    JobConfig.Name    = NULL;
+    UtAssert_INT32_EQ(CFE_ES_RegisterBackgroundJob(&TestJobNum, &JobConfig), CFE_ES_BAD_ARGUMENT);
+    JobConfig.Name = "";
+    UtAssert_INT32_EQ(CFE_ES_RegisterBackgroundJob(&TestJobNum, &JobConfig), CFE_ES_BAD_ARGUMENT);
+    memset(LongName, 'a', sizeof(LongName) - 1);
+    LongName[sizeof(LongName) - 1] = 0;
+    JobConfig.Name                 = LongName;
+    UtAssert_INT32_EQ(CFE_ES_RegisterBackgroundJob(&TestJobNum, &JobConfig), CFE_ES_BAD_ARGUMENT);
+    UtAssert_ZERO(CFE_Atomic_Load(&CFE_ES_Global.BackgroundTask.NumJobs));
+
+    /* Test CFE_ES_RegisterBackgroundJob() with the longest name that fits */
+    LongName[sizeof(LongName) - 2] = 0;
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterBackgroundJob(&TestJobNum, &JobConfig));
+    UtAssert_UINT32_EQ(TestJobNum, 0);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+
+    /* Test CFE_ES_RegisterBackgroundJob() with a duplicate name */
+    UtAssert_INT32_EQ(CFE_ES_RegisterBackgroundJob(&TestJobNum, &JobConfig), CFE_ES_ERR_DUPLICATE_NAME);
+
+    /* Test CFE_ES_RegisterBackgroundJob() when the job table is full */
+    CFE_Atomic_Store(&CFE_ES_Global.BackgroundTask.NumJobs, CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS);
+    JobConfig.Name = "UT_JOB";
+    UtAssert_INT32_EQ(CFE_ES_RegisterBackgroundJob(&TestJobNum, &JobConfig), CFE_ES_NO_RESOURCE_IDS_AVAILABLE);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+
+    /*
+     * Register three jobs: an active job with a period, an idle job that is only
+     * called when woken, and an idle job with a period, which has the highest priority.
+     */
+    ES_ResetUnitTest();
+    ES_UT_BackgroundCallOrder = 0;
+    memset(JobState, 0, sizeof(JobState));
+    JobState[0].ReturnActive = true;
+    JobConfig.Name           = "UT_ACTIVE";
+    JobConfig.JobArg         = &JobState[0];
+    JobConfig.Priority       = 30;
+    JobConfig.ActivePeriod   = 100;
+    JobConfig.IdlePeriod     = 1000;
+    JobConfig.Deadline       = 100;
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterBackgroundJob(&JobNum[0], &JobConfig));
+    JobConfig.Name         = "UT_WAKE";
+    JobConfig.JobArg       = &JobState[1];
+    JobConfig.Priority     = 20;
+    JobConfig.ActivePeriod = 10;
+    JobConfig.IdlePeriod   = 0;
+    JobConfig.Deadline     = 0;
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterBackgroundJob(&JobNum[1], &JobConfig));
+    JobConfig.Name       = "UT_IDLE";
+    JobConfig.JobArg     = &JobState[2];
+    JobConfig.Priority   = 10;
+    JobConfig.IdlePeriod = 500;
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterBackgroundJob(&JobNum[2], &JobConfig));
+    UtAssert_UINT32_EQ(JobNum[2], 2);
+
+    /* New jobs are all called on the first pass, in priority order */
+    UtAssert_UINT32_EQ(CFE_ES_BackgroundRunJobs(0), 100);
+    UtAssert_UINT32_EQ(JobState[0].CallCount, 1);
+    UtAssert_UINT32_EQ(JobState[1].CallCount, 1);
+    UtAssert_UINT32_EQ(JobState[2].CallCount, 1);
+    UtAssert_UINT32_EQ(JobState[2].CallOrder, 1);
+    UtAssert_UINT32_EQ(JobState[1].CallOrder, 2);
+    UtAssert_UINT32_EQ(JobState[0].CallOrder, 3);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.NumJobsRunning, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.Jobs[JobNum[0]].Stats.RunCount, 1);
+    UtAssert_BOOL_TRUE(CFE_ES_Global.BackgroundTask.Jobs[JobNum[0]].Stats.IsActive);
+    UtAssert_BOOL_FALSE(CFE_ES_Global.BackgroundTask.Jobs[JobNum[1]].Stats.IsActive);
+
+    /* Nothing is due before the period of the active job expires */
+    UtAssert_UINT32_EQ(CFE_ES_BackgroundRunJobs(60), 40);
+    UtAssert_UINT32_EQ(JobState[0].CallCount, 1);
+
+    /* The active job is called with the time since its previous call, within its deadline */
+    UtAssert_UINT32_EQ(CFE_ES_BackgroundRunJobs(50), 100);
+    UtAssert_UINT32_EQ(JobState[0].CallCount, 2);
+    UtAssert_UINT32_EQ(JobState[0].LastElapsedTime, 110);
+    UtAssert_ZERO(CFE_ES_Global.BackgroundTask.Jobs[JobNum[0]].Stats.DeadlineMisses);
+
+    /* A job called later than its deadline counts a miss */
+    UtAssert_UINT32_EQ(CFE_ES_BackgroundRunJobs(250), 100);
+    UtAssert_UINT32_EQ(JobState[0].CallCount, 3);
+    UtAssert_UINT32_EQ(JobState[2].CallCount, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.Jobs[JobNum[0]].Stats.DeadlineMisses, 1);
+
+    /* The job with an idle period of 0 is only called when woken */
+    UtAssert_UINT32_EQ(JobState[1].CallCount, 1);
+    UT_ResetState(UT_KEY(OS_BinSemGive));
+    CFE_ES_WakeBackgroundJob(JobNum[1]);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    UtAssert_UINT32_EQ(CFE_ES_BackgroundRunJobs(0), 100);
+    UtAssert_UINT32_EQ(JobState[1].CallCount, 2);
+    UtAssert_UINT32_EQ(JobState[1].LastElapsedTime, 360);
+    UtAssert_UINT32_EQ(JobState[0].CallCount, 3);
+
+    /* Waking a job that is not registered does nothing */
+    CFE_ES_WakeBackgroundJob(3);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    UtAssert_ZERO(CFE_Atomic_Load(&CFE_ES_Global.BackgroundTask.Jobs[3].WakeRequested));
+
+    /* The generic wakeup calls all jobs on the next pass */
+    UtAssert_VOIDCALL(CFE_ES_BackgroundWakeup());
+    UtAssert_STUB_COUNT(OS_BinSemGive, 2);
+    UtAssert_UINT32_EQ(CFE_ES_BackgroundRunJobs(0), 100);
+    UtAssert_UINT32_EQ(JobState[0].CallCount, 4);
+    UtAssert_UINT32_EQ(JobState[1].CallCount, 3);
+    UtAssert_UINT32_EQ(JobState[2].CallCount, 2);
+
+    /*
+     * When a job uses up the time budget of the pass, the other jobs that are due
+     * stay due unless they are past their deadline, and the pass ends with a short delay.
+     */
+    memset(PassTimes, 0, sizeof(PassTimes));
+    PassTimes[1] = OS_TimeFromTotalMicroseconds(CFE_PLATFORM_ES_BACKGROUND_TIME_BUDGET);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTime), PassTimes, sizeof(PassTimes), false);
+    CFE_ES_WakeBackgroundJob(JobNum[1]);
+    CFE_ES_WakeBackgroundJob(JobNum[2]);
+    UtAssert_UINT32_EQ(CFE_ES_BackgroundRunJobs(0), 10);
+    UtAssert_UINT32_EQ(JobState[2].CallCount, 3);
+    UtAssert_UINT32_EQ(JobState[1].CallCount, 3);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.Jobs[JobNum[2]].Stats.LastRunUsec,
+                       CFE_PLATFORM_ES_BACKGROUND_TIME_BUDGET);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.Jobs[JobNum[2]].Stats.TotalRunMsec,
+                       CFE_PLATFORM_ES_BACKGROUND_TIME_BUDGET / 1000);
+
+    memset(PassTimes, 0, sizeof(PassTimes));
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTime), PassTimes, sizeof(PassTimes), false);
+    UtAssert_UINT32_EQ(CFE_ES_BackgroundRunJobs(10), 90);
+    UtAssert_UINT32_EQ(JobState[1].CallCount, 4);
+
+    /* A job without a deadline is held back by the time budget for a limited time only */
+    memset(PassTimes, 0, sizeof(PassTimes));
+    PassTimes[1] = OS_TimeFromTotalMicroseconds(CFE_PLATFORM_ES_BACKGROUND_TIME_BUDGET);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTime), PassTimes, sizeof(PassTimes), false);
+    CFE_ES_WakeBackgroundJob(JobNum[1]);
+    CFE_ES_WakeBackgroundJob(JobNum[2]);
+    UtAssert_UINT32_EQ(CFE_ES_BackgroundRunJobs(0), 10);
+    UtAssert_UINT32_EQ(JobState[2].CallCount, 4);
+    UtAssert_UINT32_EQ(JobState[1].CallCount, 4);
+
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTime), PassTimes, sizeof(PassTimes), false);
+    CFE_ES_WakeBackgroundJob(JobNum[2]);
+    UtAssert_UINT32_EQ(CFE_ES_BackgroundRunJobs(30000), 100);
+    UtAssert_UINT32_EQ(JobState[2].CallCount, 5);
+    UtAssert_UINT32_EQ(JobState[1].CallCount, 5);
+
+    /* Test CFE_ES_GetBackgroundJobStats() with no jobs registered */
+    ES_ResetUnitTest();
+    UtAssert_BOOL_FALSE(CFE_ES_GetBackgroundJobStats(&Payload));
+
+    /* Test CFE_ES_GetBackgroundJobStats() reporting the jobs in turn */
+    CFE_Atomic_Store(&CFE_ES_Global.BackgroundTask.NumJobs, CFE_MISSION_ES_BACKGROUND_JOBS_PER_PKT + 1);
+    CFE_ES_Global.BackgroundTask.Jobs[CFE_MISSION_ES_BACKGROUND_JOBS_PER_PKT].Stats.RunCount = 5;
+    UtAssert_BOOL_TRUE(CFE_ES_GetBackgroundJobStats(&Payload));
+    UtAssert_UINT32_EQ(Payload.NumJobs, CFE_MISSION_ES_BACKGROUND_JOBS_PER_PKT + 1);
+    UtAssert_UINT32_EQ(Payload.FirstJob, 0);
+    UtAssert_UINT32_EQ(Payload.NumInPacket, CFE_MISSION_ES_BACKGROUND_JOBS_PER_PKT);
+    UtAssert_BOOL_TRUE(CFE_ES_GetBackgroundJobStats(&Payload));
+    UtAssert_UINT32_EQ(Payload.FirstJob, CFE_MISSION_ES_BACKGROUND_JOBS_PER_PKT);
+    UtAssert_UINT32_EQ(Payload.NumInPacket, 1);
+    UtAssert_UINT32_EQ(Payload.Jobs[0].RunCount, 5);
+    UtAssert_BOOL_TRUE(CFE_ES_GetBackgroundJobStats(&Payload));
+    UtAssert_UINT32_EQ(Payload.FirstJob, 0);
+
     /*
      * When testing the background task loop, it is normally an infinite loop,
      * so this is needed to set a condition for the loop to exit.
      *
-     * This also sets a state so the background perf log dump will be "Active" to
-     * execute the code which counts the number of active jobs.
-     */
-    ES_ResetUnitTest();
-    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
-    UT_SetDefaultReturnValue(UT_KEY(OS_write), -10);
-    CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_INIT;
+     * This also registers an active and an idle job, to execute the code
+     * which counts the number of active jobs.
+     */
+    ES_ResetUnitTest();
+    memset(JobState, 0, sizeof(JobState));
+    JobState[0].ReturnActive = true;
+    JobConfig.Name           = "UT_ACTIVE";
+    JobConfig.JobArg         = &JobState[0];
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterBackgroundJob(&JobNum[0], &JobConfig));
+    JobConfig.Name   = "UT_IDLE";
+    JobConfig.JobArg = &JobState[1];
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterBackgroundJob(&JobNum[1], &JobConfig));
     UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 2, OS_SEM_TIMEOUT);
     UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, -4);
     UtAssert_VOIDCALL(CFE_ES_BackgroundTask());
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_BACKGROUND_TAKE]);
-
-    /* The number of jobs running should be 3: (perf log dump) and the
-     * two dummy active jobs invoked by .RunFunc = CFE_ES_ActiveJob */
-    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.NumJobsRunning, 3);
+    UtAssert_NONZERO(JobState[0].CallCount);
+    UtAssert_UINT32_EQ(JobState[1].CallCount, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.NumJobsRunning, 1);
 }
 
 /*--------------------------------------------------------------------------------*
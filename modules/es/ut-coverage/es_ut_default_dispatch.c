@@ -100,6 +100,14 @@ const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_SEND_MEM_POOL_STATS_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_SEND_MEM_POOL_STATS_CC, SendMemPoolStatsCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_DUMP_CDS_REGISTRY_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_DUMP_CDS_REGISTRY_CC, DumpCDSRegistryCmd) };
+const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_WRITE_MEM_POOL_STATS_CC =
+    { ES_UT_CC_DISPATCH(CMD, CFE_ES_WRITE_MEM_POOL_STATS_CC, WriteMemPoolStatsCmd) };
+const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_WRITE_POOL_ALLOC_SITES_CC =
+    { ES_UT_CC_DISPATCH(CMD, CFE_ES_WRITE_POOL_ALLOC_SITES_CC, WritePoolAllocSitesCmd) };
+const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_RESET_PERF_STATS_CC =
+    { ES_UT_CC_DISPATCH(CMD, CFE_ES_RESET_PERF_STATS_CC, ResetPerfStatsCmd) };
+const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_WRITE_STARTUP_TIMING_CC =
+    { ES_UT_CC_DISPATCH(CMD, CFE_ES_WRITE_STARTUP_TIMING_CC, WriteStartupTimingCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_SEND_HK =
     { ES_UT_MSG_DISPATCH(SEND_HK, SendHkCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_INVALID_LENGTH =
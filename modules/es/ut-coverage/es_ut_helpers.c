@@ -204,13 +204,8 @@ void ES_UT_SetupSingleAppId(CFE_ES_AppType_Enum_t AppType, CFE_ES_AppState_Enum_
 
     LocalTaskPtr = CFE_ES_LocateTaskRecordByID(CFE_ES_TASKID_C(UtTaskId));
     LocalAppPtr  = CFE_ES_LocateAppRecordByID(CFE_ES_APPID_C(UtAppId));
-    CFE_ES_TaskRecordSetUsed(LocalTaskPtr, UtTaskId);
-    CFE_ES_AppRecordSetUsed(LocalAppPtr, UtAppId);
-    LocalTaskPtr->AppId     = CFE_ES_AppRecordGetID(LocalAppPtr);
-    LocalAppPtr->MainTaskId = CFE_ES_TaskRecordGetID(LocalTaskPtr);
-    LocalAppPtr->AppState   = AppState;
-    LocalAppPtr->Type       = AppType;
 
+    /* names must be set first, as marking the app record used enters its name into the index */
     if (AppName)
     {
         strncpy(LocalAppPtr->AppName, AppName, sizeof(LocalAppPtr->AppName) - 1);
@@ -219,6 +214,13 @@ void ES_UT_SetupSingleAppId(CFE_ES_AppType_Enum_t AppType, CFE_ES_AppState_Enum_
         LocalTaskPtr->TaskName[sizeof(LocalTaskPtr->TaskName) - 1] = 0;
     }
 
+    CFE_ES_TaskRecordSetUsed(LocalTaskPtr, UtTaskId);
+    CFE_ES_AppRecordSetUsed(LocalAppPtr, UtAppId);
+    LocalTaskPtr->AppId     = CFE_ES_AppRecordGetID(LocalAppPtr);
+    LocalAppPtr->MainTaskId = CFE_ES_TaskRecordGetID(LocalTaskPtr);
+    LocalAppPtr->AppState   = AppState;
+    LocalAppPtr->Type       = AppType;
+
     if (OutAppRec)
     {
         *OutAppRec = LocalAppPtr;
@@ -290,7 +292,6 @@ void ES_UT_SetupSingleLibId(const char *LibName, CFE_ES_LibRecord_t **OutLibRec)
     CFE_ES_Global.LastLibId = CFE_ResourceId_FromInteger(CFE_ResourceId_ToInteger(UtLibId) + 1);
 
     LocalLibPtr = CFE_ES_LocateLibRecordByID(CFE_ES_LIBID_C(UtLibId));
-    CFE_ES_LibRecordSetUsed(LocalLibPtr, UtLibId);
 
     if (LibName)
     {
@@ -298,6 +299,8 @@ void ES_UT_SetupSingleLibId(const char *LibName, CFE_ES_LibRecord_t **OutLibRec)
         LocalLibPtr->LibName[sizeof(LocalLibPtr->LibName) - 1] = 0;
     }
 
+    CFE_ES_LibRecordSetUsed(LocalLibPtr, UtLibId);
+
     if (OutLibRec)
     {
         *OutLibRec = LocalLibPtr;
@@ -566,6 +569,12 @@ void ES_ResetUnitTest(void)
 
     memset(&CFE_ES_Global, 0, sizeof(CFE_ES_Global));
 
+    /*
+     * The task and app records are recreated without being freed, so any
+     * context cached by the previous test must be explicitly discarded.
+     */
+    CFE_ES_InvalidateTaskContextCache();
+
     /*
     ** Initialize the Last Id
     */
@@ -584,6 +593,15 @@ void ES_ResetUnitTest(void)
      */
     CFE_ES_Global.ResetDataPtr = ES_UT_PersistentResetData;
 
+    /*
+     * The startup script kept in the reset area would otherwise be used instead
+     * of the script set up by the test, on every processor reset start.
+     */
+    if (ES_UT_PersistentResetData != NULL)
+    {
+        ES_UT_PersistentResetData->StartupScript.Signature = 0;
+    }
+
     UT_SetHandlerFunction(UT_KEY(CFE_Config_GetArrayValue), UT_ArrayConfigHandler, (void *)&UT_MemPoolAV);
 
 } /* end ES_ResetUnitTest() */
@@ -0,0 +1,118 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Throughput benchmark of the ES CRC algorithms
+ *
+ * Computes each implemented CRC repeatedly over a buffer about the size of
+ * a large table image and reports the throughput, so the cost of table
+ * loads and CDS updates on a given platform can be characterized.  CRC-32C
+ * is measured both as selected for this processor and with the portable
+ * table driven code, to show the gain of the processor CRC instructions.
+ *
+ * This runs the real CRC code, built without coverage instrumentation.
+ * The result is only reported, not checked.
+ */
+
+/*
+** Includes
+*/
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+
+#include "cfe_es_crc.h"
+
+/* Size of the buffer used in each CRC calculation */
+#define UT_CRC_BUFFER_SIZE 65536
+
+/* Minimum run time of each algorithm, long enough to average out timer resolution */
+#define UT_CRC_MIN_RUN_MSEC 250
+
+static uint8 UT_CrcBuffer[UT_CRC_BUFFER_SIZE];
+
+static void UT_CRCThroughput(CFE_ES_ComputeCRC_Algo_t Algorithm, const char *Name)
+{
+    OS_time_t StartTime;
+    OS_time_t ElapsedTime;
+    uint32    Iterations;
+    uint32    FirstCrc;
+    uint32    Crc;
+    int64     ElapsedMsec;
+    int64     Rate;
+
+    FirstCrc    = Algorithm(UT_CrcBuffer, sizeof(UT_CrcBuffer), 0);
+    Iterations  = 0;
+    ElapsedMsec = 0;
+
+    OS_GetLocalTime(&StartTime);
+
+    do
+    {
+        Crc = Algorithm(UT_CrcBuffer, sizeof(UT_CrcBuffer), 0);
+        ++Iterations;
+
+        /* In order to not "flood" with test results, only report a mismatch */
+        if (Crc != FirstCrc)
+        {
+            UtAssert_UINT32_EQ(Crc, FirstCrc);
+            break;
+        }
+
+        OS_GetLocalTime(&ElapsedTime);
+        ElapsedMsec = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(ElapsedTime, StartTime));
+    } while (ElapsedMsec < UT_CRC_MIN_RUN_MSEC);
+
+    UtAssert_MIR("%s: %lu calculations of %lu bytes in %ld msec", Name, (unsigned long)Iterations,
+                 (unsigned long)sizeof(UT_CrcBuffer), (long)ElapsedMsec);
+
+    /* If ElapsedMsec is 0, then something is probably wrong - but do not divide by 0 */
+    if (ElapsedMsec != 0)
+    {
+        Rate = ((int64)Iterations * (sizeof(UT_CrcBuffer) / 1024) * 1000) / ElapsedMsec;
+        UtAssert_MIR("%s throughput: %ld KiB/sec", Name, (long)Rate);
+    }
+}
+
+void Test_CRC_Throughput(void)
+{
+    uint32 i;
+    uint32 SelectedCrc;
+    uint32 PortableCrc;
+
+    for (i = 0; i < sizeof(UT_CrcBuffer); ++i)
+    {
+        UT_CrcBuffer[i] = (uint8)((i * 2654435761U) >> 13);
+    }
+
+    /* The processor specific and portable CRC-32C code must agree before comparing them */
+    SelectedCrc = CFE_ES_ComputeCRC_GetParams(CFE_ES_CrcType_32_C)->Algorithm(UT_CrcBuffer, sizeof(UT_CrcBuffer), 0);
+    PortableCrc = CFE_ES_ComputeCRC_Algo_32_C_Portable(UT_CrcBuffer, sizeof(UT_CrcBuffer), 0);
+    UtAssert_UINT32_EQ(SelectedCrc, PortableCrc);
+
+    UT_CRCThroughput(CFE_ES_ComputeCRC_GetParams(CFE_ES_CrcType_16_ARC)->Algorithm, "CRC-16/ARC");
+    UT_CRCThroughput(CFE_ES_ComputeCRC_GetParams(CFE_ES_CrcType_32_C)->Algorithm, "CRC-32C");
+    UT_CRCThroughput(CFE_ES_ComputeCRC_Algo_32_C_Portable, "CRC-32C (portable)");
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_CRC_Throughput, NULL, NULL, "CRC Throughput");
+}
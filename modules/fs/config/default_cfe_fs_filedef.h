@@ -165,7 +165,60 @@ enum CFE_FS_SubType
      * command.
      *
      */
-    CFE_FS_SubType_ES_QUERYALLTASKS = 23
+    CFE_FS_SubType_ES_QUERYALLTASKS = 23,
+
+    /**
+     * @brief Software Bus Traffic Capture File
+     *
+     * Software Bus Traffic Capture File which is generated in response to a
+     * \link #CFE_SB_STOP_CAPTURE_CC \SB_STOPCAPTURE \endlink
+     * command, and read back by the
+     * \link #CFE_SB_START_REPLAY_CC \SB_STARTREPLAY \endlink
+     * command.
+     *
+     */
+    CFE_FS_SubType_SB_CAPTUREDATA = 24,
+
+    /**
+     * @brief Software Bus Snapshot File
+     *
+     * Software Bus Routing/Pipe Snapshot File which is generated in response to a
+     * \link #CFE_SB_WRITE_SNAPSHOT_CC \SB_WRITESNAPSHOT2FILE \endlink
+     * command.
+     *
+     */
+    CFE_FS_SubType_SB_SNAPSHOT = 25,
+
+    /**
+     * @brief Executive Services Memory Pool Statistics File
+     *
+     * Executive Services Memory Pool Statistics File which is generated in response to a
+     * \link #CFE_ES_WRITE_MEM_POOL_STATS_CC \ES_WRITEPOOLSTATS2FILE \endlink
+     * command.
+     *
+     */
+    CFE_FS_SubType_ES_POOLSTATS = 26,
+
+    /**
+     * @brief Executive Services Memory Pool Allocation Sites File
+     *
+     * Executive Services Memory Pool Allocation Sites File which is generated in response to a
+     * \link #CFE_ES_WRITE_POOL_ALLOC_SITES_CC \ES_WRITEALLOCSITES2FILE \endlink
+     * command.
+     *
+     */
+    CFE_FS_SubType_ES_POOLALLOCSITES = 27,
+
+    /**
+     * @brief Executive Services Startup Timeline File
+     *
+     * Executive Services Startup Timeline File which is generated once the system becomes
+     * operational and in response to a
+     * \link #CFE_ES_WRITE_STARTUP_TIMING_CC \ES_WRITESTARTUPTIMING2FILE \endlink
+     * command.
+     *
+     */
+    CFE_FS_SubType_ES_STARTUPTIMING = 28
 };
 
 /**
@@ -900,12 +900,11 @@ int32 CFE_FS_BackgroundFileDumpRequest(CFE_FS_FileWriteMetaData_t *Meta)
     if (Status == CFE_SUCCESS)
     {
         /*
-         * If successfully added to write queue, then wake the ES background task to get started.
+         * If successfully added to write queue, then wake the background job to get started.
          *
-         * This may reduce the overall latency between request and completion (depending on other
-         * background task work).  If this is the only pending job, this should get it started faster.
+         * The job is idle while no writes are pending, so this is what gets the write started.
          */
-        CFE_ES_BackgroundWakeup();
+        CFE_ES_WakeBackgroundJob(CFE_FS_Global.FileDump.JobNum);
     }
 
     return Status;
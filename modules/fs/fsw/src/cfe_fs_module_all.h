@@ -35,5 +35,6 @@
 #include "cfe.h"
 #include "cfe_fs_priv.h"
 #include "cfe_fs_core_internal.h"
+#include "cfe_es_core_internal.h"
 
 #endif /* CFE_FS_MODULE_ALL_H */
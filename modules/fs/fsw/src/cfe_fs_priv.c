@@ -48,7 +48,16 @@ CFE_FS_Global_t CFE_FS_Global;
  *-----------------------------------------------------------------*/
 int32 CFE_FS_EarlyInit(void)
 {
+    static const CFE_ES_BackgroundJobConfig_t FileDumpJob = {.Name         = "FS_FILE_DUMP",
+                                                             .RunFunc      = CFE_FS_RunBackgroundFileDump,
+                                                             .JobArg       = NULL,
+                                                             .Priority     = CFE_FS_BACKGROUND_JOB_PRIORITY,
+                                                             .ActivePeriod = CFE_FS_BACKGROUND_JOB_PERIOD,
+                                                             .IdlePeriod   = 0,
+                                                             .Deadline     = 0};
+
     int32 OsStatus;
+    int32 Status;
 
     memset(&CFE_FS_Global, 0, sizeof(CFE_FS_Global));
 
@@ -59,6 +68,13 @@ int32 CFE_FS_EarlyInit(void)
         return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
     }
 
+    Status = CFE_ES_RegisterBackgroundJob(&CFE_FS_Global.FileDump.JobNum, &FileDumpJob);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Background job registration failed! RC=%08lx\n", __func__, (unsigned long)Status);
+        return Status;
+    }
+
     return CFE_SUCCESS;
 }
 
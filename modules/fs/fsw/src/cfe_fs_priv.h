@@ -72,6 +72,20 @@
  */
 #define CFE_FS_BACKGROUND_MAX_CREDIT 10000
 
+/*
+ * Background file write job period and priority
+ *
+ * File writes are done by a job of the ES background task.  While a write is
+ * in progress the job is called this often (in milliseconds), and writes as much
+ * as its credit allows.  When no write is pending the job is idle, and is woken
+ * by the next request.
+ *
+ * The priority places file writes after the ES app table scan and exception scan,
+ * so a long file write does not delay those.
+ */
+#define CFE_FS_BACKGROUND_JOB_PERIOD   1000
+#define CFE_FS_BACKGROUND_JOB_PRIORITY 50
+
 /*
 ** Type Definitions
 */
@@ -112,6 +126,7 @@ typedef struct
 {
     uint32 RequestCount;  /**< Total Number of background file writes requested */
     uint32 CompleteCount; /**< Total Number of background file writes completed */
+    uint32 JobNum;        /**< Number of the ES background job that does the writes */
 
     /**
      * Data related to each background file write request
@@ -487,12 +487,19 @@ void Test_CFE_FS_Private(void)
     /* Test successful FS initialization */
     UT_InitData();
     CFE_UtAssert_SUCCESS(CFE_FS_EarlyInit());
+    UtAssert_STUB_COUNT(CFE_ES_RegisterBackgroundJob, 1);
 
     /* Test FS initialization with a mutex creation failure */
     UT_InitData();
     UT_SetDefaultReturnValue(UT_KEY(OS_MutSemCreate), OS_ERROR);
     UtAssert_INT32_EQ(CFE_FS_EarlyInit(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
 
+    /* Test FS initialization with a background job registration failure */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RegisterBackgroundJob), 1, CFE_ES_NO_RESOURCE_IDS_AVAILABLE);
+    UtAssert_INT32_EQ(CFE_FS_EarlyInit(), CFE_ES_NO_RESOURCE_IDS_AVAILABLE);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+
     /* Test successful locking of shared data */
     UT_InitData();
     CFE_FS_LockSharedData("FunctionName");
@@ -554,7 +561,7 @@ void Test_CFE_FS_BackgroundFileDump(void)
     UtAssert_INT32_EQ(CFE_FS_BackgroundFileDumpRequest(&State), CFE_FS_BAD_ARGUMENT);
 
     UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
-    UtAssert_STUB_COUNT(CFE_ES_BackgroundWakeup, 0); /* confirm CFE_ES_BackgroundWakeup() was not invoked */
+    UtAssert_STUB_COUNT(CFE_ES_WakeBackgroundJob, 0); /* confirm CFE_ES_WakeBackgroundJob() was not invoked */
 
     /* Set the data except file name and description */
     State.FileSubType = 2;
@@ -562,7 +569,7 @@ void Test_CFE_FS_BackgroundFileDump(void)
     State.OnEvent     = UT_FS_OnEvent;
     UtAssert_INT32_EQ(CFE_FS_BackgroundFileDumpRequest(&State), CFE_FS_INVALID_PATH);
     UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
-    UtAssert_STUB_COUNT(CFE_ES_BackgroundWakeup, 0); /* confirm CFE_ES_BackgroundWakeup() was not invoked */
+    UtAssert_STUB_COUNT(CFE_ES_WakeBackgroundJob, 0); /* confirm CFE_ES_WakeBackgroundJob() was not invoked */
 
     /* Set up remainder of fields, so entry is valid */
     strncpy(State.FileName, "/ram/UT.bin", sizeof(State.FileName));
@@ -570,7 +577,7 @@ void Test_CFE_FS_BackgroundFileDump(void)
 
     CFE_UtAssert_SUCCESS(CFE_FS_BackgroundFileDumpRequest(&State));
     UtAssert_BOOL_TRUE(CFE_FS_BackgroundFileDumpIsPending(&State));
-    UtAssert_STUB_COUNT(CFE_ES_BackgroundWakeup, 1); /* confirm CFE_ES_BackgroundWakeup() was invoked */
+    UtAssert_STUB_COUNT(CFE_ES_WakeBackgroundJob, 1); /* confirm CFE_ES_WakeBackgroundJob() was invoked */
 
     /*
      * Set up a fixed data buffer which will be written,
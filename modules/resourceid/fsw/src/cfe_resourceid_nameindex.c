@@ -0,0 +1,252 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+**  File:
+**      cfe_resourceid_nameindex.c
+**
+**  Purpose:
+**      Fixed-capacity name index for CFE core resource tables
+**
+**      This is an open addressing hash table with linear probing.  Entries
+**      are deleted by shifting the rest of the probe sequence back, so the
+**      table never accumulates deleted markers and lookups of absent names
+**      stay short no matter how many create/delete cycles have occurred.
+*/
+
+/*
+** Includes
+*/
+#include <string.h>
+
+#include "cfe_resourceid_nameindex.h"
+
+/*
+ * 32-bit FNV-1a parameters
+ */
+#define CFE_RESOURCEID_NAMEINDEX_FNV_OFFSET 0x811C9DC5
+#define CFE_RESOURCEID_NAMEINDEX_FNV_PRIME  0x01000193
+
+/*----------------------------------------------------------------
+ *
+ * Core-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ResourceId_NameIndexHash(const char *Name)
+{
+    const uint8 *Ptr  = (const uint8 *)Name;
+    uint32       Hash = CFE_RESOURCEID_NAMEINDEX_FNV_OFFSET;
+
+    while (*Ptr != 0)
+    {
+        Hash ^= *Ptr;
+        Hash *= CFE_RESOURCEID_NAMEINDEX_FNV_PRIME;
+        ++Ptr;
+    }
+
+    return Hash;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Core-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ResourceId_NameIndexClear(CFE_ResourceId_NameIndexSlot_t *Index, uint32 NumSlots)
+{
+    memset(Index, 0, sizeof(*Index) * NumSlots);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Core-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ResourceId_NameIndexAdd(CFE_ResourceId_NameIndexSlot_t *Index, uint32 NumSlots, const char *Name,
+                                         uint32 TableIdx)
+{
+    uint32 Hash;
+    uint32 Pos;
+    uint32 Count;
+
+    if (Index == NULL || Name == NULL || NumSlots == 0 || TableIdx >= 0xFFFFFFFF)
+    {
+        return CFE_STATUS_VALIDATION_FAILURE;
+    }
+
+    Hash = CFE_ResourceId_NameIndexHash(Name);
+    Pos  = Hash % NumSlots;
+
+    for (Count = 0; Count < NumSlots; ++Count)
+    {
+        if (Index[Pos].Entry == 0)
+        {
+            Index[Pos].Hash  = Hash;
+            Index[Pos].Entry = TableIdx + 1;
+            return CFE_SUCCESS;
+        }
+
+        if (Index[Pos].Entry == (TableIdx + 1) && Index[Pos].Hash == Hash)
+        {
+            /* already indexed under this name */
+            return CFE_SUCCESS;
+        }
+
+        Pos = (Pos + 1) % NumSlots;
+    }
+
+    return CFE_STATUS_RANGE_ERROR;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Core-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ResourceId_NameIndexRemove(CFE_ResourceId_NameIndexSlot_t *Index, uint32 NumSlots, const char *Name,
+                                    uint32 TableIdx)
+{
+    uint32 Hash;
+    uint32 Hole;
+    uint32 Next;
+    uint32 Home;
+    uint32 Count;
+
+    if (Index == NULL || Name == NULL || NumSlots == 0)
+    {
+        return;
+    }
+
+    Hash = CFE_ResourceId_NameIndexHash(Name);
+    Hole = Hash % NumSlots;
+
+    for (Count = 0; Count < NumSlots; ++Count)
+    {
+        if (Index[Hole].Entry == 0)
+        {
+            /* not indexed */
+            return;
+        }
+
+        if (Index[Hole].Entry == (TableIdx + 1) && Index[Hole].Hash == Hash)
+        {
+            break;
+        }
+
+        Hole = (Hole + 1) % NumSlots;
+    }
+
+    if (Count == NumSlots)
+    {
+        return;
+    }
+
+    /*
+     * Close the gap: walk the rest of the probe run and move back any entry
+     * whose home slot is at or before the hole, so it remains reachable.
+     */
+    Next = (Hole + 1) % NumSlots;
+    for (Count = 1; Count < NumSlots && Index[Next].Entry != 0; ++Count)
+    {
+        Home = Index[Next].Hash % NumSlots;
+        if (((Next + NumSlots - Home) % NumSlots) >= ((Next + NumSlots - Hole) % NumSlots))
+        {
+            Index[Hole] = Index[Next];
+            Hole        = Next;
+        }
+
+        Next = (Next + 1) % NumSlots;
+    }
+
+    Index[Hole].Entry = 0;
+    Index[Hole].Hash  = 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Core-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ResourceId_NameIndexFind(const CFE_ResourceId_NameIndexSlot_t *Index, uint32 NumSlots, const char *Name,
+                                  CFE_ResourceId_NameMatchFunc_t MatchFunc, void *Arg, uint32 *TableIdxPtr)
+{
+    uint32 Hash;
+    uint32 Pos;
+    uint32 Count;
+    uint32 Entry;
+
+    if (Index == NULL || Name == NULL || NumSlots == 0 || MatchFunc == NULL || TableIdxPtr == NULL)
+    {
+        return false;
+    }
+
+    Hash = CFE_ResourceId_NameIndexHash(Name);
+    Pos  = Hash % NumSlots;
+
+    for (Count = 0; Count < NumSlots; ++Count)
+    {
+        Entry = Index[Pos].Entry;
+        if (Entry == 0)
+        {
+            break;
+        }
+
+        if (Index[Pos].Hash == Hash && MatchFunc(Entry - 1, Name, Arg))
+        {
+            *TableIdxPtr = Entry - 1;
+            return true;
+        }
+
+        Pos = (Pos + 1) % NumSlots;
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Core-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ResourceId_NameIndexScan(uint32 TableSize, const char *Name, CFE_ResourceId_NameMatchFunc_t MatchFunc,
+                                  void *Arg, uint32 *TableIdxPtr)
+{
+    uint32 TableIdx;
+
+    if (Name == NULL || MatchFunc == NULL || TableIdxPtr == NULL)
+    {
+        return false;
+    }
+
+    for (TableIdx = 0; TableIdx < TableSize; ++TableIdx)
+    {
+        if (MatchFunc(TableIdx, Name, Arg))
+        {
+            *TableIdxPtr = TableIdx;
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -19,9 +19,13 @@
 /*
  * Includes
  */
+#include <stdio.h>
+#include <string.h>
+
 #include "cfe.h"
 #include "cfe_resourceid.h"
 #include "cfe_resourceid_basevalue.h"
+#include "cfe_resourceid_nameindex.h"
 #include "utassert.h"
 #include "utstubs.h"
 #include "uttest.h"
@@ -29,6 +33,12 @@
 #define UT_RESOURCEID_BASE_OFFSET 37
 #define UT_RESOURCEID_TEST_SLOTS  149 /* oddball for test purposes */
 
+#define UT_NAMEINDEX_TABLE_SIZE 4
+#define UT_NAMEINDEX_SLOTS      CFE_RESOURCEID_NAMEINDEX_SLOTS(UT_NAMEINDEX_TABLE_SIZE)
+
+/* The table indexed by the name index tests, NULL entries are unused */
+static const char *UT_NameIndexTable[UT_NAMEINDEX_TABLE_SIZE];
+
 static bool UT_ResourceId_CheckIdSlotUsed(CFE_ResourceId_t Id)
 {
     return UT_DEFAULT_IMPL(UT_ResourceId_CheckIdSlotUsed) != 0;
@@ -40,6 +50,12 @@ static CFE_ResourceId_t UT_ResourceId_IncrementSerial(CFE_ResourceId_t Id, void
     return CFE_ResourceId_FromInteger(UT_DEFAULT_IMPL(UT_ResourceId_IncrementSerial));
 }
 
+static bool UT_NameIndex_Match(uint32 TableIdx, const char *Name, void *Arg)
+{
+    return TableIdx < UT_NAMEINDEX_TABLE_SIZE && UT_NameIndexTable[TableIdx] != NULL &&
+           strcmp(UT_NameIndexTable[TableIdx], Name) == 0;
+}
+
 void TestResourceID_Conversions(void)
 {
     CFE_ResourceId_t Id;
@@ -245,9 +261,144 @@ void TestResourceID_FindNext(void)
                   CFE_ResourceId_ToInteger(Id));
 }
 
+void TestResourceID_NameIndex(void)
+{
+    CFE_ResourceId_NameIndexSlot_t Index[UT_NAMEINDEX_SLOTS];
+    CFE_ResourceId_NameIndexSlot_t SmallIndex[2];
+    char                           Names[3][8];
+    char                           Other[8];
+    char                           Candidate[8];
+    uint32                         Home;
+    uint32                         Found;
+    uint32                         Count;
+    uint32                         TableIdx;
+
+    /* Hash is 32-bit FNV-1a */
+    UtAssert_UINT32_EQ(CFE_ResourceId_NameIndexHash(""), 0x811C9DC5);
+    UtAssert_UINT32_EQ(CFE_ResourceId_NameIndexHash("a"), 0xE40C292C);
+
+    /* Pick three names that all hash to the same home slot, and one that does not */
+    Home     = CFE_ResourceId_NameIndexHash("N0") % UT_NAMEINDEX_SLOTS;
+    Found    = 0;
+    Other[0] = 0;
+    for (Count = 0; Count < 1000 && (Found < 3 || Other[0] == 0); ++Count)
+    {
+        snprintf(Candidate, sizeof(Candidate), "N%u", (unsigned int)Count);
+        if (CFE_ResourceId_NameIndexHash(Candidate) % UT_NAMEINDEX_SLOTS != Home)
+        {
+            if (Other[0] == 0)
+            {
+                strcpy(Other, Candidate);
+            }
+        }
+        else if (Found < 3)
+        {
+            strcpy(Names[Found], Candidate);
+            ++Found;
+        }
+    }
+    UtAssert_UINT32_EQ(Found, 3);
+
+    /* A zeroed index is empty */
+    memset(Index, 0, sizeof(Index));
+    memset(UT_NameIndexTable, 0, sizeof(UT_NameIndexTable));
+    UtAssert_BOOL_FALSE(CFE_ResourceId_NameIndexFind(Index, UT_NAMEINDEX_SLOTS, Names[0], UT_NameIndex_Match, NULL,
+                                                     &TableIdx));
+
+    /* Colliding names occupy consecutive slots and are all found */
+    for (Count = 0; Count < 3; ++Count)
+    {
+        UT_NameIndexTable[Count] = Names[Count];
+        UtAssert_INT32_EQ(CFE_ResourceId_NameIndexAdd(Index, UT_NAMEINDEX_SLOTS, Names[Count], Count), CFE_SUCCESS);
+    }
+    UT_NameIndexTable[3] = Other;
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexAdd(Index, UT_NAMEINDEX_SLOTS, Other, 3), CFE_SUCCESS);
+
+    /* Adding the same record again has no effect */
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexAdd(Index, UT_NAMEINDEX_SLOTS, Names[1], 1), CFE_SUCCESS);
+
+    for (Count = 0; Count < 4; ++Count)
+    {
+        TableIdx = 0xFFFFFFFF;
+        UtAssert_BOOL_TRUE(CFE_ResourceId_NameIndexFind(Index, UT_NAMEINDEX_SLOTS, UT_NameIndexTable[Count],
+                                                        UT_NameIndex_Match, NULL, &TableIdx));
+        UtAssert_UINT32_EQ(TableIdx, Count);
+    }
+
+    /* Removing the head of a probe run shifts the rest back, so they are still found */
+    CFE_ResourceId_NameIndexRemove(Index, UT_NAMEINDEX_SLOTS, Names[0], 0);
+    UT_NameIndexTable[0] = NULL;
+    UtAssert_BOOL_FALSE(CFE_ResourceId_NameIndexFind(Index, UT_NAMEINDEX_SLOTS, Names[0], UT_NameIndex_Match, NULL,
+                                                     &TableIdx));
+    UtAssert_UINT32_EQ(Index[Home].Entry, 2);
+    UtAssert_UINT32_EQ(Index[(Home + 1) % UT_NAMEINDEX_SLOTS].Entry, 3);
+    UtAssert_BOOL_TRUE(CFE_ResourceId_NameIndexFind(Index, UT_NAMEINDEX_SLOTS, Names[2], UT_NameIndex_Match, NULL,
+                                                    &TableIdx));
+    UtAssert_UINT32_EQ(TableIdx, 2);
+
+    /* Removing something not indexed has no effect */
+    CFE_ResourceId_NameIndexRemove(Index, UT_NAMEINDEX_SLOTS, Names[0], 0);
+    CFE_ResourceId_NameIndexRemove(Index, UT_NAMEINDEX_SLOTS, Names[1], 2);
+    UtAssert_BOOL_TRUE(CFE_ResourceId_NameIndexFind(Index, UT_NAMEINDEX_SLOTS, Names[1], UT_NameIndex_Match, NULL,
+                                                    &TableIdx));
+    UtAssert_UINT32_EQ(TableIdx, 1);
+
+    /* An entry that no longer matches the table is rejected by the match function */
+    UT_NameIndexTable[1] = Other;
+    UtAssert_BOOL_FALSE(CFE_ResourceId_NameIndexFind(Index, UT_NAMEINDEX_SLOTS, Names[1], UT_NameIndex_Match, NULL,
+                                                     &TableIdx));
+
+    /* Clearing empties the index */
+    CFE_ResourceId_NameIndexClear(Index, UT_NAMEINDEX_SLOTS);
+    UtAssert_BOOL_FALSE(CFE_ResourceId_NameIndexFind(Index, UT_NAMEINDEX_SLOTS, Other, UT_NameIndex_Match, NULL,
+                                                     &TableIdx));
+
+    /* A full index reports it, and lookups of absent names still terminate */
+    memset(SmallIndex, 0, sizeof(SmallIndex));
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexAdd(SmallIndex, 2, Names[0], 0), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexAdd(SmallIndex, 2, Names[1], 1), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexAdd(SmallIndex, 2, Names[2], 2), CFE_STATUS_RANGE_ERROR);
+    UtAssert_BOOL_FALSE(CFE_ResourceId_NameIndexFind(SmallIndex, 2, Names[2], UT_NameIndex_Match, NULL, &TableIdx));
+    CFE_ResourceId_NameIndexRemove(SmallIndex, 2, Names[2], 2);
+    CFE_ResourceId_NameIndexRemove(SmallIndex, 2, Names[0], 0);
+    UtAssert_UINT32_EQ(SmallIndex[0].Entry + SmallIndex[1].Entry, 2);
+
+    /* Validate off-nominal inputs */
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexAdd(NULL, UT_NAMEINDEX_SLOTS, Other, 0), CFE_STATUS_VALIDATION_FAILURE);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexAdd(Index, 0, Other, 0), CFE_STATUS_VALIDATION_FAILURE);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexAdd(Index, UT_NAMEINDEX_SLOTS, NULL, 0), CFE_STATUS_VALIDATION_FAILURE);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexAdd(Index, UT_NAMEINDEX_SLOTS, Other, 0xFFFFFFFF),
+                      CFE_STATUS_VALIDATION_FAILURE);
+    UtAssert_BOOL_FALSE(CFE_ResourceId_NameIndexFind(NULL, UT_NAMEINDEX_SLOTS, Other, UT_NameIndex_Match, NULL,
+                                                     &TableIdx));
+    UtAssert_BOOL_FALSE(CFE_ResourceId_NameIndexFind(Index, 0, Other, UT_NameIndex_Match, NULL, &TableIdx));
+    UtAssert_BOOL_FALSE(CFE_ResourceId_NameIndexFind(Index, UT_NAMEINDEX_SLOTS, NULL, UT_NameIndex_Match, NULL,
+                                                     &TableIdx));
+    UtAssert_BOOL_FALSE(CFE_ResourceId_NameIndexFind(Index, UT_NAMEINDEX_SLOTS, Other, NULL, NULL, &TableIdx));
+    UtAssert_BOOL_FALSE(CFE_ResourceId_NameIndexFind(Index, UT_NAMEINDEX_SLOTS, Other, UT_NameIndex_Match, NULL, NULL));
+    CFE_ResourceId_NameIndexRemove(NULL, UT_NAMEINDEX_SLOTS, Other, 0);
+    CFE_ResourceId_NameIndexRemove(Index, 0, Other, 0);
+    CFE_ResourceId_NameIndexRemove(Index, UT_NAMEINDEX_SLOTS, NULL, 0);
+
+    /* A scan of the table finds records whether or not they are indexed */
+    memset(UT_NameIndexTable, 0, sizeof(UT_NameIndexTable));
+    UT_NameIndexTable[2] = Names[2];
+    TableIdx             = 0xFFFFFFFF;
+    UtAssert_BOOL_TRUE(CFE_ResourceId_NameIndexScan(UT_NAMEINDEX_TABLE_SIZE, Names[2], UT_NameIndex_Match, NULL,
+                                                    &TableIdx));
+    UtAssert_UINT32_EQ(TableIdx, 2);
+    UtAssert_BOOL_FALSE(CFE_ResourceId_NameIndexScan(UT_NAMEINDEX_TABLE_SIZE, Other, UT_NameIndex_Match, NULL,
+                                                     &TableIdx));
+    UtAssert_BOOL_FALSE(CFE_ResourceId_NameIndexScan(UT_NAMEINDEX_TABLE_SIZE, NULL, UT_NameIndex_Match, NULL,
+                                                     &TableIdx));
+    UtAssert_BOOL_FALSE(CFE_ResourceId_NameIndexScan(UT_NAMEINDEX_TABLE_SIZE, Other, NULL, NULL, &TableIdx));
+    UtAssert_BOOL_FALSE(CFE_ResourceId_NameIndexScan(UT_NAMEINDEX_TABLE_SIZE, Other, UT_NameIndex_Match, NULL, NULL));
+}
+
 void UtTest_Setup(void)
 {
     UtTest_Add(TestResourceID_Conversions, NULL, NULL, "Resource ID Conversions");
     UtTest_Add(TestResourceID_FindNextEx, NULL, NULL, "Resource ID FindNextEx");
     UtTest_Add(TestResourceID_FindNext, NULL, NULL, "Resource ID FindNext");
+    UtTest_Add(TestResourceID_NameIndex, NULL, NULL, "Resource ID NameIndex");
 }
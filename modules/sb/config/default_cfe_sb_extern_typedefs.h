@@ -75,6 +75,34 @@ enum CFE_SB_QosReliability
  */
 typedef uint8 CFE_SB_QosReliability_Enum_t;
 
+/**
+ * @brief Label definitions associated with CFE_SB_ReplayRate_Enum_t
+ */
+enum CFE_SB_ReplayRate
+{
+    /**
+     * @brief Replay messages with the same spacing as they were captured
+     */
+    CFE_SB_ReplayRate_ORIGINAL = 0,
+
+    /**
+     * @brief Replay messages with the captured spacing scaled by a percentage
+     */
+    CFE_SB_ReplayRate_SCALED = 1,
+
+    /**
+     * @brief Replay messages as fast as possible
+     */
+    CFE_SB_ReplayRate_MAX = 2
+};
+
+/**
+ * @brief Selects the pacing of a replayed SB capture file
+ *
+ * @sa enum CFE_SB_ReplayRate
+ */
+typedef uint8 CFE_SB_ReplayRate_Enum_t;
+
 /**
  * @brief An integer type that should be used for indexing into the Routing Table
  */
@@ -47,6 +47,11 @@ enum CFE_SB_FunctionCode_
     CFE_SB_FunctionCode_ENABLE_SUB_REPORTING  = 9,
     CFE_SB_FunctionCode_DISABLE_SUB_REPORTING = 10,
     CFE_SB_FunctionCode_SEND_PREV_SUBS        = 11,
+    CFE_SB_FunctionCode_START_CAPTURE         = 12,
+    CFE_SB_FunctionCode_STOP_CAPTURE          = 13,
+    CFE_SB_FunctionCode_START_REPLAY          = 14,
+    CFE_SB_FunctionCode_STOP_REPLAY           = 15,
+    CFE_SB_FunctionCode_WRITE_SNAPSHOT        = 16,
 };
 
 #endif
@@ -57,6 +57,32 @@ typedef struct CFE_SB_RouteCmd_Payload
     uint8           Spare; /**<\brief Spare byte to make command even number of bytes */
 } CFE_SB_RouteCmd_Payload_t;
 
+/**
+**  \brief Start Capture Command Payload
+**
+**  Selects which messages are recorded by #CFE_SB_START_CAPTURE_CC.  A message
+**  is captured when the bits of its MsgId selected by MsgIdMask match the
+**  same bits of MsgIdFilter.  A mask of zero captures all traffic.
+*/
+typedef struct CFE_SB_StartCaptureCmd_Payload
+{
+    CFE_SB_MsgId_t MsgIdFilter; /**< \brief Message ID value to match */
+    uint32         MsgIdMask;   /**< \brief Bits of the Message ID to compare, 0 matches all */
+} CFE_SB_StartCaptureCmd_Payload_t;
+
+/**
+**  \brief Start Replay Command Payload
+**
+**  Structure used by #CFE_SB_START_REPLAY_CC to select the capture file and pacing
+*/
+typedef struct CFE_SB_StartReplayCmd_Payload
+{
+    char Filename[CFE_MISSION_MAX_PATH_LEN]; /**< \brief Path and Filename of capture file to replay */
+    CFE_SB_ReplayRate_Enum_t RateMode;       /**< \brief Pacing of replayed messages #CFE_SB_ReplayRate_Enum_t */
+    uint8                    Spare;          /**< \brief Spare byte for alignment */
+    uint16 RateScale; /**< \brief Replay rate in percent of the original rate, used with #CFE_SB_ReplayRate_SCALED */
+} CFE_SB_StartReplayCmd_Payload_t;
+
 /****************************
 **  SB Telemetry Formats   **
 *****************************/
@@ -201,6 +227,12 @@ typedef struct CFE_SB_StatsTlm_Payload
     CFE_SB_PipeDepthStats_t
         PipeDepthStats[CFE_MISSION_SB_MAX_PIPES]; /**< \cfetlmmnemonic \SB_SMPDS
                                                \brief Pipe Depth Statistics #CFE_SB_PipeDepthStats_t*/
+
+    uint32 BufPoolShards;         /**< \cfetlmmnemonic \SB_SMBPSHRD
+                                       \brief cFE Cfg Param \link #CFE_PLATFORM_SB_BUF_POOL_SHARDS \endlink */
+    uint32 BufPoolShardFallbacks; /**< \cfetlmmnemonic \SB_SMBPSFB
+                                       \brief Number of buffer allocations that overflowed from a producer
+                                       shard into the global pool */
 } CFE_SB_StatsTlm_Payload_t;
 
 /**
@@ -229,6 +261,74 @@ typedef struct CFE_SB_MsgMapFileEntry
     CFE_SB_RouteId_Atom_t Index; /**< \brief Routing raw index value (0 based, not Route ID) */
 } CFE_SB_MsgMapFileEntry_t;
 
+/**
+** \brief SB Capture File Entry
+**
+** Header of one recorded message in the file written by #CFE_SB_STOP_CAPTURE_CC.
+** Each entry is followed by MsgSize bytes of message content, padded to a
+** multiple of 4 bytes.
+*/
+typedef struct CFE_SB_CaptureFileEntry
+{
+    uint32         TimeSeconds;    /**< \brief Seconds portion of the time the message was sent */
+    uint32         TimeSubseconds; /**< \brief Subseconds portion of the time the message was sent */
+    CFE_SB_MsgId_t MsgId;          /**< \brief Message Id of the recorded message */
+    uint32         MsgSize;        /**< \brief Size of the recorded message in bytes, excluding padding */
+} CFE_SB_CaptureFileEntry_t;
+
+/**
+** \brief SB Snapshot File Header
+**
+** First record of the file written by #CFE_SB_WRITE_SNAPSHOT_CC, directly
+** following the standard cFE file header.  It is followed by the route,
+** destination and pipe tables.  Each offset is in bytes, relative to the
+** start of this structure.
+*/
+typedef struct CFE_SB_SnapshotFileHeader
+{
+    uint32 RouteCount;          /**< \brief Number of #CFE_SB_SnapshotRouteEntry_t records */
+    uint32 RouteOffset;         /**< \brief Offset of the route table */
+    uint32 DestinationCount;    /**< \brief Number of #CFE_SB_SnapshotDestEntry_t records */
+    uint32 DestinationOffset;   /**< \brief Offset of the destination table */
+    uint32 PipeCount;           /**< \brief Number of #CFE_SB_PipeInfoEntry_t records */
+    uint32 PipeOffset;          /**< \brief Offset of the pipe table */
+    uint32 MapCollisions;       /**< \brief Total message map collisions over all routes */
+    uint32 DestinationsDropped; /**< \brief Destinations not recorded because the table was full */
+} CFE_SB_SnapshotFileHeader_t;
+
+/**
+** \brief SB Snapshot Route Entry
+**
+** One route in the file written by #CFE_SB_WRITE_SNAPSHOT_CC.  The destinations
+** of the route are the DestinationCount entries of the destination table
+** starting at index FirstDestination.
+*/
+typedef struct CFE_SB_SnapshotRouteEntry
+{
+    CFE_SB_MsgId_t        MsgId;            /**< \brief Message Id of the route */
+    uint32                FirstDestination; /**< \brief Index of the first destination in the destination table */
+    uint32                MapCollisions;    /**< \brief Message map collisions when the route was added */
+    CFE_SB_RouteId_Atom_t Index;            /**< \brief Routing raw index value (0 based, not Route ID) */
+    uint16                DestinationCount; /**< \brief Number of destinations recorded for this route */
+    uint16                SequenceCount;    /**< \brief Current sequence counter of the route */
+    uint16                Spare;            /**< \brief Spare to keep the entry size a multiple of 4 */
+} CFE_SB_SnapshotRouteEntry_t;
+
+/**
+** \brief SB Snapshot Destination Entry
+**
+** One destination in the file written by #CFE_SB_WRITE_SNAPSHOT_CC.
+*/
+typedef struct CFE_SB_SnapshotDestEntry
+{
+    CFE_SB_PipeId_t PipeId;        /**< \brief Destination pipe */
+    uint16          MsgCnt;        /**< \brief Number of msgs with this MsgId sent to this PipeId */
+    uint16          BuffCount;     /**< \brief Number of msgs with this MsgId currently in the pipe */
+    uint16          MsgId2PipeLim; /**< \brief Limit of msgs with this MsgId in the pipe */
+    uint8           State;         /**< \brief Route is enabled or disabled for this pipe */
+    uint8           Scope;         /**< \brief Scope of the subscription */
+} CFE_SB_SnapshotDestEntry_t;
+
 /**
 ** \cfesbtlm SB Subscription Report Packet
 **
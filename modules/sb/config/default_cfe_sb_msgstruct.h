@@ -77,6 +77,11 @@ typedef struct CFE_SB_SendHkCmd
     CFE_MSG_CommandHeader_t CommandHeader;
 } CFE_SB_SendHkCmd_t;
 
+typedef struct CFE_SB_StopReplayCmd
+{
+    CFE_MSG_CommandHeader_t CommandHeader;
+} CFE_SB_StopReplayCmd_t;
+
 /*
  * Create a unique typedef for each of the commands that share this format.
  */
@@ -98,6 +103,18 @@ typedef struct CFE_SB_WriteMapInfoCmd
     CFE_SB_WriteFileInfoCmd_Payload_t Payload;       /**< \brief Command payload */
 } CFE_SB_WriteMapInfoCmd_t;
 
+typedef struct CFE_SB_StopCaptureCmd
+{
+    CFE_MSG_CommandHeader_t           CommandHeader; /**< \brief Command header */
+    CFE_SB_WriteFileInfoCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_SB_StopCaptureCmd_t;
+
+typedef struct CFE_SB_WriteSnapshotCmd
+{
+    CFE_MSG_CommandHeader_t           CommandHeader; /**< \brief Command header */
+    CFE_SB_WriteFileInfoCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_SB_WriteSnapshotCmd_t;
+
 /*
  * Create a unique typedef for each of the commands that share this format.
  */
@@ -113,6 +130,18 @@ typedef struct CFE_SB_DisableRouteCmd
     CFE_SB_RouteCmd_Payload_t Payload;       /**< \brief Command payload */
 } CFE_SB_DisableRouteCmd_t;
 
+typedef struct CFE_SB_StartCaptureCmd
+{
+    CFE_MSG_CommandHeader_t          CommandHeader; /**< \brief Command header */
+    CFE_SB_StartCaptureCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_SB_StartCaptureCmd_t;
+
+typedef struct CFE_SB_StartReplayCmd
+{
+    CFE_MSG_CommandHeader_t         CommandHeader; /**< \brief Command header */
+    CFE_SB_StartReplayCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_SB_StartReplayCmd_t;
+
 /****************************
 **  SB Telemetry Formats   **
 *****************************/
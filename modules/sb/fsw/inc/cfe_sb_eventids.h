@@ -784,6 +784,78 @@
  */
 #define CFE_SB_RCV_MESSAGE_INTEGRITY_FAIL_EID 72
 
+/**
+ * \brief SB Start Capture Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_SB_START_CAPTURE_CC SB Start Capture Command \endlink success.
+ */
+#define CFE_SB_CAPTURE_START_EID 73
+
+/**
+ * \brief SB Stop Capture Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_SB_STOP_CAPTURE_CC SB Stop Capture Command \endlink success, the
+ *  capture file write has been requested.
+ */
+#define CFE_SB_CAPTURE_STOP_EID 74
+
+/**
+ * \brief SB Capture Command Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_SB_START_CAPTURE_CC SB Start Capture Command \endlink or
+ *  \link #CFE_SB_STOP_CAPTURE_CC SB Stop Capture Command \endlink failure
+ *  because a previous file write request is still pending.
+ */
+#define CFE_SB_CAPTURE_ERR_EID 75
+
+/**
+ * \brief SB Start Replay Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_SB_START_REPLAY_CC SB Start Replay Command \endlink success.
+ */
+#define CFE_SB_REPLAY_START_EID 76
+
+/**
+ * \brief SB Replay Complete Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  The SB replay task reached the end of the capture file or was stopped by
+ *  \link #CFE_SB_STOP_REPLAY_CC SB Stop Replay Command \endlink.
+ */
+#define CFE_SB_REPLAY_STOP_EID 77
+
+/**
+ * \brief SB Replay Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_SB_START_REPLAY_CC SB Start Replay Command \endlink or
+ *  \link #CFE_SB_STOP_REPLAY_CC SB Stop Replay Command \endlink failure, or
+ *  the replay task could not open or read the capture file.
+ */
+#define CFE_SB_REPLAY_ERR_EID 78
+
 /**\}*/
 
 #endif /* CFE_SB_EVENTS_H */
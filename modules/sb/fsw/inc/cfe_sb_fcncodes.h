@@ -178,6 +178,7 @@
 **
 **  \par Error Conditions
 **       This command may fail for the following reason(s):
+**       - No capture was started since the last capture file was written
 **       - A previous request to write a software bus information file has not yet completed
 **       - The specified FileName cannot be parsed
 **
@@ -302,6 +303,7 @@
 **
 **  \par Error Conditions
 **       This command may fail for the following reason(s):
+**       - No capture was started since the last capture file was written
 **       - A previous request to write a software bus information file has not yet completed
 **       - The specified FileName cannot be parsed
 **
@@ -348,6 +350,7 @@
 **
 **  \par Error Conditions
 **       This command may fail for the following reason(s):
+**       - No capture was started since the last capture file was written
 **       - A previous request to write a software bus information file has not yet completed
 **       - The specified FileName cannot be parsed
 **
@@ -461,4 +464,213 @@
 */
 #define CFE_SB_SEND_PREV_SUBS_CC CFE_SB_CCVAL(SEND_PREV_SUBS)
 
+/** \cfesbcmd Start Traffic Capture Command
+**
+**  \par Description
+**       This command starts recording messages sent on the software bus into
+**       an in-memory capture buffer of #CFE_PLATFORM_SB_CAPTURE_BUFFER_BYTES bytes.
+**       Each recorded message is stored with its MsgId, size and send time.
+**       Only messages whose MsgId matches the filter and mask in the command
+**       are recorded.  A previous capture must have been stopped and its file
+**       written before a new capture can be started.
+**
+**  \cfecmdmnemonic \SB_STARTCAPTURE
+**
+**  \par Command Structure
+**       #CFE_SB_StartCaptureCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with the
+**       following telemetry:
+**       - \b \c \SB_CMDPC - command execution counter will increment
+**       - The #CFE_SB_CAPTURE_START_EID debug event message will be generated
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - A previous request to write a software bus information file has not yet completed
+**       - The previous capture has not been written to a file
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \SB_CMDEC - command error counter will increment
+**       - The #CFE_SB_CAPTURE_ERR_EID error event message will be generated
+**
+**  \par Criticality
+**       None.  Messages that do not fit in the capture buffer are counted
+**       and dropped from the capture; software bus traffic is not affected.
+**
+**  \sa #CFE_SB_STOP_CAPTURE_CC, #CFE_SB_START_REPLAY_CC
+*/
+#define CFE_SB_START_CAPTURE_CC CFE_SB_CCVAL(START_CAPTURE)
+
+/** \cfesbcmd Stop Traffic Capture Command
+**
+**  \par Description
+**       This command stops an active traffic capture and writes the recorded
+**       messages to the specified file using the background file writer.  The
+**       file consists of a standard cFE file header followed by a series of
+**       #CFE_SB_CaptureFileEntry_t records, each followed by the message content.
+**       If the file could not be written, the command may be sent again to retry.
+**
+**  \cfecmdmnemonic \SB_STOPCAPTURE
+**
+**  \par Command Structure
+**       #CFE_SB_StopCaptureCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with the
+**       following telemetry:
+**       - \b \c \SB_CMDPC - command execution counter will increment
+**       - The #CFE_SB_CAPTURE_STOP_EID debug event message will be generated
+**       - The file specified in the command (or the default specified
+**         by the #CFE_PLATFORM_SB_DEFAULT_CAPTURE_FILENAME configuration parameter)
+**         will be created
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - No capture was started since the last capture file was written
+**       - A previous request to write a software bus information file has not yet completed
+**       - The specified FileName cannot be parsed
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \SB_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases. See #CFE_SB_CAPTURE_ERR_EID and #CFE_SB_FILEWRITE_ERR_EID
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new
+**       file in the file system and could, if performed repeatedly without
+**       sufficient file management by the operator, fill the file system.
+**
+**  \sa #CFE_SB_START_CAPTURE_CC, #CFE_SB_START_REPLAY_CC
+*/
+#define CFE_SB_STOP_CAPTURE_CC CFE_SB_CCVAL(STOP_CAPTURE)
+
+/** \cfesbcmd Start Traffic Replay Command
+**
+**  \par Description
+**       This command starts a child task that reads a capture file written by
+**       #CFE_SB_STOP_CAPTURE_CC and sends each recorded message on the
+**       software bus.  Messages are paced according to their recorded send
+**       times (#CFE_SB_ReplayRate_ORIGINAL), those times scaled by a percentage
+**       (#CFE_SB_ReplayRate_SCALED), or sent as fast as possible
+**       (#CFE_SB_ReplayRate_MAX).  Recorded sequence counts are preserved.
+**
+**  \cfecmdmnemonic \SB_STARTREPLAY
+**
+**  \par Command Structure
+**       #CFE_SB_StartReplayCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with the
+**       following telemetry:
+**       - \b \c \SB_CMDPC - command execution counter will increment
+**       - The #CFE_SB_REPLAY_START_EID debug event message will be generated
+**       - The #CFE_SB_REPLAY_STOP_EID event message will be generated when
+**         the replay completes
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - A replay is already in progress
+**       - The rate mode or rate scale is invalid
+**       - The specified FileName cannot be parsed
+**       - The replay child task could not be created
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \SB_CMDEC - command error counter will increment
+**       - The #CFE_SB_REPLAY_ERR_EID error event message will be generated
+**
+**  \par Criticality
+**       Replayed messages are delivered to all current subscribers exactly
+**       as if they had been sent by their original producers, including
+**       commands.  Operators should verify the contents of a capture file
+**       before replaying it on a live system.
+**
+**  \sa #CFE_SB_STOP_REPLAY_CC, #CFE_SB_START_CAPTURE_CC
+*/
+#define CFE_SB_START_REPLAY_CC CFE_SB_CCVAL(START_REPLAY)
+
+/** \cfesbcmd Stop Traffic Replay Command
+**
+**  \par Description
+**       This command requests that an active replay stop after the message
+**       currently being replayed.
+**
+**  \cfecmdmnemonic \SB_STOPREPLAY
+**
+**  \par Command Structure
+**       #CFE_SB_StopReplayCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with the
+**       following telemetry:
+**       - \b \c \SB_CMDPC - command execution counter will increment
+**       - The #CFE_SB_REPLAY_STOP_EID event message will be generated when
+**         the replay task exits
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - No replay is in progress
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \SB_CMDEC - command error counter will increment
+**       - The #CFE_SB_REPLAY_ERR_EID error event message will be generated
+**
+**  \par Criticality
+**       None
+**
+**  \sa #CFE_SB_START_REPLAY_CC
+*/
+#define CFE_SB_STOP_REPLAY_CC CFE_SB_CCVAL(STOP_REPLAY)
+
+/** \cfesbcmd Write Routing/Pipe Snapshot to a File
+**
+**  \par Description
+**       This command creates a single file holding a consistent snapshot of
+**       the software bus routes, their destinations, the pipes and the
+**       message map collisions.  The snapshot is copied in one pass while
+**       the software bus data is locked and then written to the file as a
+**       background task.  The file starts with a #CFE_SB_SnapshotFileHeader_t
+**       giving the count and offset of each table.  An absolute path and
+**       filename may be specified in the command.  If this command field
+**       contains an empty string (NULL terminator as the first character)
+**       the default file path and name is used.  The default file path and
+**       name is defined in the platform configuration file as
+**       #CFE_PLATFORM_SB_DEFAULT_SNAPSHOT_FILENAME.
+**
+**  \cfecmdmnemonic \SB_WRITESNAPSHOT2FILE
+**
+**  \par Command Structure
+**       #CFE_SB_WriteSnapshotCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with the
+**       following telemetry:
+**       - \b \c \SB_CMDPC - command execution counter will increment.
+**         NOTE: the command counter is incremented when the request is accepted,
+**         before writing the file, which is performed as a background task.
+**       - The file specified in the command (or the default specified
+**         by the #CFE_PLATFORM_SB_DEFAULT_SNAPSHOT_FILENAME configuration parameter) will be
+**         updated with the latest information.
+**       - The #CFE_SB_SND_RTG_EID debug event message will be generated
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - No capture was started since the last capture file was written
+**       - A previous request to write a software bus information file has not yet completed
+**       - The specified FileName cannot be parsed
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \SB_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases. See #CFE_SB_SND_RTG_ERR1_EID and #CFE_SB_FILEWRITE_ERR_EID
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new
+**       file in the file system and could, if performed repeatedly without
+**       sufficient file management by the operator, fill the file system.
+**
+**  \sa #CFE_SB_WRITE_ROUTING_INFO_CC, #CFE_SB_WRITE_PIPE_INFO_CC, #CFE_SB_WRITE_MAP_INFO_CC
+*/
+#define CFE_SB_WRITE_SNAPSHOT_CC CFE_SB_CCVAL(WRITE_SNAPSHOT)
+
 #endif
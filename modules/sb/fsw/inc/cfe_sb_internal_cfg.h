@@ -129,6 +129,52 @@
 #define CFE_PLATFORM_SB_BUF_MEMORY_BYTES         CFE_PLATFORM_SB_CFGVAL(BUF_MEMORY_BYTES)
 #define DEFAULT_CFE_PLATFORM_SB_BUF_MEMORY_BYTES 524288
 
+/**
+**  \cfesbcfg Number of per-producer SB buffer pool shards
+**
+**  \par Description:
+**       Dictates the number of additional, independent pools that the SB buffer
+**       memory (#CFE_PLATFORM_SB_BUF_MEMORY_BYTES) is split into.  Message buffers
+**       are allocated from the "home" shard of the producing application, selected
+**       by the application index, and are always returned to the shard they came
+**       from.  The remainder of the SB memory forms the global pool, which holds
+**       the destination descriptors and serves as the fallback whenever the home
+**       shard is exhausted.
+**
+**       Shards keep one busy producer from using up the buffer memory of the
+**       others.  Each shard also has its own lock and usage counters, so buffer
+**       allocations for producers on different shards do not contend with each
+**       other; the counters are summed when the housekeeping and statistics
+**       telemetry are built.  The buffer tracking lists are still protected by
+**       the SB shared data lock.
+**
+**       Setting this to 0 keeps the traditional single pool configuration.
+**
+**  \par Limits
+**       This parameter has a lower limit of 0 and an upper limit of 254.  The total
+**       shard memory (this value multiplied by #CFE_PLATFORM_SB_BUF_POOL_SHARD_BYTES)
+**       must leave some memory in the global pool.
+**
+*/
+#define CFE_PLATFORM_SB_BUF_POOL_SHARDS         CFE_PLATFORM_SB_CFGVAL(BUF_POOL_SHARDS)
+#define DEFAULT_CFE_PLATFORM_SB_BUF_POOL_SHARDS 0
+
+/**
+**  \cfesbcfg Size of each per-producer SB buffer pool shard
+**
+**  \par Description:
+**       Dictates the number of bytes of the SB buffer memory that are given to
+**       each of the #CFE_PLATFORM_SB_BUF_POOL_SHARDS producer shards.  This value
+**       is not used when the number of shards is 0.
+**
+**  \par Limits
+**       This parameter has a lower limit of 512.  The product of this value and
+**       the number of shards must be less than #CFE_PLATFORM_SB_BUF_MEMORY_BYTES.
+**
+*/
+#define CFE_PLATFORM_SB_BUF_POOL_SHARD_BYTES         CFE_PLATFORM_SB_CFGVAL(BUF_POOL_SHARD_BYTES)
+#define DEFAULT_CFE_PLATFORM_SB_BUF_POOL_SHARD_BYTES 65536
+
 /**
 **  \cfesbcfg Highest Valid Message Id
 **
@@ -203,6 +249,72 @@
 #define CFE_PLATFORM_SB_DEFAULT_MAP_FILENAME         CFE_PLATFORM_SB_CFGVAL(DEFAULT_MAP_FILENAME)
 #define DEFAULT_CFE_PLATFORM_SB_DEFAULT_MAP_FILENAME "/ram/cfe_sb_msgmap.dat"
 
+/**
+**  \cfesbcfg Default Snapshot Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the software
+**       bus routing/pipe snapshot.  This filename is used only when no filename is
+**       specified in the command.  The snapshot holds the routes, destinations,
+**       pipes and map collision counts in a single indexed file.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_SB_DEFAULT_SNAPSHOT_FILENAME         CFE_PLATFORM_SB_CFGVAL(DEFAULT_SNAPSHOT_FILENAME)
+#define DEFAULT_CFE_PLATFORM_SB_DEFAULT_SNAPSHOT_FILENAME "/ram/cfe_sb_snapshot.dat"
+
+/**
+**  \cfesbcfg Maximum Number of Destinations in a Snapshot
+**
+**  \par Description:
+**       Dictates the number of destination records reserved for the software bus
+**       routing/pipe snapshot.  All destinations of all routes are copied into
+**       this table while the SB shared data is locked.  Destinations beyond this
+**       limit are counted in the snapshot header but not recorded.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1.  The upper limit is only
+**       constrained by available memory.  Setting it to #CFE_PLATFORM_SB_MAX_MSG_IDS
+**       times #CFE_PLATFORM_SB_MAX_DEST_PER_PKT guarantees a complete snapshot.
+*/
+#define CFE_PLATFORM_SB_SNAPSHOT_MAX_DESTINATIONS         CFE_PLATFORM_SB_CFGVAL(SNAPSHOT_MAX_DESTINATIONS)
+#define DEFAULT_CFE_PLATFORM_SB_SNAPSHOT_MAX_DESTINATIONS 1024
+
+/**
+**  \cfesbcfg Default Traffic Capture Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the software
+**       bus traffic capture.  This filename is used only when no filename is
+**       specified in the stop capture command.  The same default is used for the
+**       replay command when no filename is specified.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_SB_DEFAULT_CAPTURE_FILENAME         CFE_PLATFORM_SB_CFGVAL(DEFAULT_CAPTURE_FILENAME)
+#define DEFAULT_CFE_PLATFORM_SB_DEFAULT_CAPTURE_FILENAME "/ram/cfe_sb_capture.dat"
+
+/**
+**  \cfesbcfg Size of the SB traffic capture buffer
+**
+**  \par Description:
+**       Dictates the number of bytes reserved for recording software bus traffic
+**       while a capture is active.  Each recorded message uses the size of the
+**       message plus a small record header (#CFE_SB_CaptureFileEntry_t).  Once the
+**       buffer is full, further messages are counted as dropped until the capture
+**       is stopped and written to a file.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1024.  The upper limit is only
+**       constrained by available memory.
+*/
+#define CFE_PLATFORM_SB_CAPTURE_BUFFER_BYTES         CFE_PLATFORM_SB_CFGVAL(CAPTURE_BUFFER_BYTES)
+#define DEFAULT_CFE_PLATFORM_SB_CAPTURE_BUFFER_BYTES 32768
+
 /**
 **  \cfesbcfg SB Event Filtering
 **
@@ -327,6 +439,61 @@
 #define CFE_PLATFORM_SB_MAX_BLOCK_SIZE            CFE_PLATFORM_SB_CFGVAL(MAX_BLOCK_SIZE)
 #define DEFAULT_CFE_PLATFORM_SB_MAX_BLOCK_SIZE    (CFE_MISSION_SB_MAX_SB_MSG_SIZE + 128)
 
+/**
+**  \cfeescfg Define SB Memory Pool Block Reservations
+**
+**  \par Description:
+**       Number of buffers of each SB memory pool block size to carve out of
+**       the global SB pool during early initialization.  Reserved buffers are
+**       released straight back to the free list of their block size, so the
+**       first messages of each size are served from the free list instead of
+**       carving new blocks, and transmit latency is the same from the first
+**       message on.  Each entry corresponds to the block size of the same
+**       number, and #CFE_PLATFORM_SB_MAX_BLOCK_RESERVE corresponds to
+**       #CFE_PLATFORM_SB_MAX_BLOCK_SIZE.
+**
+**  \par Limits
+**       The reservation (number times block size, plus the pool overhead for
+**       each block) must fit in the global pool, otherwise a message is
+**       written to the system log at startup and the reservation stops at the
+**       first block that cannot be carved.  Per-producer shards are not
+**       pre-carved.  Zero disables the reservation for that block size.
+*/
+#define CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_01         CFE_PLATFORM_SB_CFGVAL(MEM_BLOCK_RESERVE_01)
+#define DEFAULT_CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_01 0
+#define CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_02         CFE_PLATFORM_SB_CFGVAL(MEM_BLOCK_RESERVE_02)
+#define DEFAULT_CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_02 0
+#define CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_03         CFE_PLATFORM_SB_CFGVAL(MEM_BLOCK_RESERVE_03)
+#define DEFAULT_CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_03 0
+#define CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_04         CFE_PLATFORM_SB_CFGVAL(MEM_BLOCK_RESERVE_04)
+#define DEFAULT_CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_04 0
+#define CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_05         CFE_PLATFORM_SB_CFGVAL(MEM_BLOCK_RESERVE_05)
+#define DEFAULT_CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_05 0
+#define CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_06         CFE_PLATFORM_SB_CFGVAL(MEM_BLOCK_RESERVE_06)
+#define DEFAULT_CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_06 0
+#define CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_07         CFE_PLATFORM_SB_CFGVAL(MEM_BLOCK_RESERVE_07)
+#define DEFAULT_CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_07 0
+#define CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_08         CFE_PLATFORM_SB_CFGVAL(MEM_BLOCK_RESERVE_08)
+#define DEFAULT_CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_08 0
+#define CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_09         CFE_PLATFORM_SB_CFGVAL(MEM_BLOCK_RESERVE_09)
+#define DEFAULT_CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_09 0
+#define CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_10         CFE_PLATFORM_SB_CFGVAL(MEM_BLOCK_RESERVE_10)
+#define DEFAULT_CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_10 0
+#define CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_11         CFE_PLATFORM_SB_CFGVAL(MEM_BLOCK_RESERVE_11)
+#define DEFAULT_CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_11 0
+#define CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_12         CFE_PLATFORM_SB_CFGVAL(MEM_BLOCK_RESERVE_12)
+#define DEFAULT_CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_12 0
+#define CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_13         CFE_PLATFORM_SB_CFGVAL(MEM_BLOCK_RESERVE_13)
+#define DEFAULT_CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_13 0
+#define CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_14         CFE_PLATFORM_SB_CFGVAL(MEM_BLOCK_RESERVE_14)
+#define DEFAULT_CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_14 0
+#define CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_15         CFE_PLATFORM_SB_CFGVAL(MEM_BLOCK_RESERVE_15)
+#define DEFAULT_CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_15 0
+#define CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_16         CFE_PLATFORM_SB_CFGVAL(MEM_BLOCK_RESERVE_16)
+#define DEFAULT_CFE_PLATFORM_SB_MEM_BLOCK_RESERVE_16 0
+#define CFE_PLATFORM_SB_MAX_BLOCK_RESERVE            CFE_PLATFORM_SB_CFGVAL(MAX_BLOCK_RESERVE)
+#define DEFAULT_CFE_PLATFORM_SB_MAX_BLOCK_RESERVE    0
+
 /**
 **  \cfeescfg Define SB Task Priority
 **
@@ -355,4 +522,29 @@
 #define CFE_PLATFORM_SB_START_TASK_STACK_SIZE         CFE_PLATFORM_SB_CFGVAL(START_TASK_STACK_SIZE)
 #define DEFAULT_CFE_PLATFORM_SB_START_TASK_STACK_SIZE CFE_PLATFORM_ES_DEFAULT_STACK_SIZE
 
+/**
+**  \cfeescfg Define SB Replay Task Priority
+**
+**  \par Description:
+**       Defines the priority of the SB child task that re-publishes a traffic
+**       capture file in response to the #CFE_SB_START_REPLAY_CC command.
+**
+**  \par Limits
+**       Not Applicable
+*/
+#define CFE_PLATFORM_SB_REPLAY_TASK_PRIORITY         CFE_PLATFORM_SB_CFGVAL(REPLAY_TASK_PRIORITY)
+#define DEFAULT_CFE_PLATFORM_SB_REPLAY_TASK_PRIORITY 200
+
+/**
+**  \cfeescfg Define SB Replay Task Stack Size
+**
+**  \par Description:
+**       Defines the stack size of the SB traffic replay child task.
+**
+**  \par Limits
+**       There is a lower limit of 2048 on this configuration parameter.
+*/
+#define CFE_PLATFORM_SB_REPLAY_TASK_STACK_SIZE         CFE_PLATFORM_SB_CFGVAL(REPLAY_TASK_STACK_SIZE)
+#define DEFAULT_CFE_PLATFORM_SB_REPLAY_TASK_STACK_SIZE CFE_PLATFORM_ES_DEFAULT_STACK_SIZE
+
 #endif
@@ -192,6 +192,7 @@ CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const c
         PipeDscPtr->AppId         = AppId;
 
         CFE_SB_PipeDescSetUsed(PipeDscPtr, PendingPipeId);
+        CFE_SB_PipeDescSetName(PipeDscPtr, PipeName);
 
         /* Increment the Pipes in use ctr and if it's > the high water mark,*/
         /* adjust the high water mark */
@@ -385,8 +386,10 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
          * Mark entry as "reserved" so other resources can be deleted
          * while the SB global is unlocked.  This prevents other tasks
          * from trying to use this Pipe Desc slot, and also should prevents
-         * any task from re-subscribing to this pipe.
+         * any task from re-subscribing to this pipe.  The name is dropped
+         * now as well, so the pipe can no longer be found by name.
          */
+        CFE_SB_PipeDescClearName(PipeDscPtr);
         CFE_SB_PipeDescSetUsed(PipeDscPtr, CFE_RESOURCEID_RESERVED);
     }
 
@@ -726,17 +729,13 @@ CFE_Status_t CFE_SB_GetPipeName(char *PipeNameBuf, size_t PipeNameSize, CFE_SB_P
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *PipeName)
 {
-    int32           OsStatus;
     int32           Status;
     CFE_ES_TaskId_t TskId;
-    uint32          Idx;
     char            FullName[(OS_MAX_API_NAME * 2)];
     uint16          PendingEventID;
     CFE_SB_PipeD_t *PipeDscPtr;
-    osal_id_t       SysQueueId;
 
     PendingEventID = 0;
-    SysQueueId     = OS_OBJECT_ID_UNDEFINED;
 
     if (PipeName == NULL || PipeIdPtr == NULL)
     {
@@ -745,43 +744,23 @@ CFE_Status_t CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *Pipe
     }
     else
     {
-        /* Get QueueID from OSAL */
-        OsStatus = OS_QueueGetIdByName(&SysQueueId, PipeName);
-        if (OsStatus == OS_SUCCESS)
-        {
-            Status = CFE_SUCCESS;
-        }
-        else
-        {
-            PendingEventID = CFE_SB_GETPIPEIDBYNAME_NAME_ERR_EID;
-            Status         = CFE_SB_BAD_ARGUMENT;
-        }
+        Status = CFE_SUCCESS;
     }
 
     CFE_SB_LockSharedData(__func__, __LINE__);
 
     if (Status == CFE_SUCCESS)
     {
-        Idx        = CFE_PLATFORM_SB_MAX_PIPES;
-        PipeDscPtr = CFE_SB_Global.PipeTbl;
-        while (true)
+        PipeDscPtr = CFE_SB_LocatePipeDescByName(PipeName);
+        if (PipeDscPtr != NULL)
         {
-            if (Idx == 0)
-            {
-                PendingEventID = CFE_SB_GETPIPEIDBYNAME_NAME_ERR_EID;
-                Status         = CFE_SB_BAD_ARGUMENT;
-                break;
-            }
-
-            if (OS_ObjectIdEqual(PipeDscPtr->SysQueueId, SysQueueId))
-            {
-                /* grab the ID before we release the lock */
-                *PipeIdPtr = CFE_SB_PipeDescGetID(PipeDscPtr);
-                break;
-            }
-
-            --Idx;
-            ++PipeDscPtr;
+            /* grab the ID before we release the lock */
+            *PipeIdPtr = CFE_SB_PipeDescGetID(PipeDscPtr);
+        }
+        else
+        {
+            PendingEventID = CFE_SB_GETPIPEIDBYNAME_NAME_ERR_EID;
+            Status         = CFE_SB_BAD_ARGUMENT;
         }
     }
 
@@ -1339,6 +1318,17 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
  *
  *-----------------------------------------------------------------*/
 CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize)
+{
+    return CFE_SB_AllocateMessageBufferForCaller(MsgSize, CFE_ES_CALLER_ADDRESS());
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_Buffer_t *CFE_SB_AllocateMessageBufferForCaller(size_t MsgSize, cpuaddr CallerAddr)
 {
     CFE_ES_AppId_t    AppId;
     char              AppName[OS_MAX_API_NAME] = {""};
@@ -1363,23 +1353,25 @@ CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize)
     /* get callers AppId */
     if (Status == CFE_SUCCESS)
     {
-        CFE_SB_LockSharedData(__func__, __LINE__);
-
         /*
          * All this needs to do is get a descriptor from the pool,
          * and associate that descriptor with this app ID, so it
          * can be freed if this app is deleted before it uses it.
+         *
+         * The pool is protected by its shard lock, so only the
+         * tracking list needs the SB shared data lock.
          */
-        BufDscPtr = CFE_SB_GetBufferFromPool(MsgSize);
+        BufDscPtr = CFE_SB_GetBufferFromPool(AppId, MsgSize, CallerAddr);
+    }
 
-        if (BufDscPtr != NULL)
-        {
-            /* Track the buffer as a zero-copy assigned to this app ID */
-            BufDscPtr->AppId = AppId;
-            BufPtr           = &BufDscPtr->Content;
-            CFE_SB_TrackingListAdd(&CFE_SB_Global.ZeroCopyList, &BufDscPtr->Link);
-        }
+    if (BufDscPtr != NULL)
+    {
+        /* Track the buffer as a zero-copy assigned to this app ID */
+        BufDscPtr->AppId = AppId;
+        BufPtr           = &BufDscPtr->Content;
 
+        CFE_SB_LockSharedData(__func__, __LINE__);
+        CFE_SB_TrackingListAdd(&CFE_SB_Global.ZeroCopyList, &BufDscPtr->Link);
         CFE_SB_UnlockSharedData(__func__, __LINE__);
     }
 
@@ -1488,7 +1480,8 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOriginat
     {
         /* Get buffer - note this pre-initializes the returned buffer with
          * a use count of 1, which refers to this task as it fills the buffer. */
-        BufPtr = CFE_SB_AllocateMessageBuffer(CFE_SB_MessageTxn_GetContentSize(Txn));
+        BufPtr = CFE_SB_AllocateMessageBufferForCaller(CFE_SB_MessageTxn_GetContentSize(Txn),
+                                                       CFE_ES_CALLER_ADDRESS());
         if (BufPtr == NULL)
         {
             CFE_SB_MessageTxn_SetEventAndStatus(Txn, CFE_SB_GET_BUF_ERR_EID, CFE_SB_BUF_ALOC_ERR);
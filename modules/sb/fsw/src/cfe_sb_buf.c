@@ -92,36 +92,115 @@ void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
+uint8 CFE_SB_GetBufferShard(CFE_ES_AppId_t AppId)
 {
-    int32               stat1;
-    size_t              AllocSize;
-    CFE_ES_MemPoolBuf_t addr = NULL;
-    CFE_SB_BufferD_t *  bd;
+    uint32 AppIndex;
+    uint8  ShardIdx;
+
+    ShardIdx = CFE_SB_BUF_POOL_GLOBAL_SHARD;
+
+    if (CFE_PLATFORM_SB_BUF_POOL_SHARDS > 0 && CFE_ES_AppID_ToIndex(AppId, &AppIndex) == CFE_SUCCESS)
+    {
+        /* producer shards follow the global shard */
+        ShardIdx = 1 + (AppIndex % CFE_PLATFORM_SB_BUF_POOL_SHARDS);
+    }
+
+    return ShardIdx;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_LockBufferShard(CFE_SB_BufPoolShard_t *ShardPtr)
+{
+    int32 OsStatus;
+
+    OsStatus = OS_MutSemTake(ShardPtr->MutexId);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Buffer shard %u Mutex Take Err Stat=%ld\n", __func__,
+                             (unsigned int)(ShardPtr - CFE_SB_Global.Mem.Shard), (long)OsStatus);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_UnlockBufferShard(CFE_SB_BufPoolShard_t *ShardPtr)
+{
+    int32 OsStatus;
+
+    OsStatus = OS_MutSemGive(ShardPtr->MutexId);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Buffer shard %u Mutex Give Err Stat=%ld\n", __func__,
+                             (unsigned int)(ShardPtr - CFE_SB_Global.Mem.Shard), (long)OsStatus);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(CFE_ES_AppId_t AppId, size_t MaxMsgSize, cpuaddr CallerAddr)
+{
+    int32                  stat1;
+    size_t                 AllocSize;
+    CFE_ES_MemPoolBuf_t    addr = NULL;
+    CFE_SB_BufferD_t *     bd;
+    CFE_SB_BufPoolShard_t *ShardPtr;
+    uint8                  ShardIdx;
 
     /* The allocation needs to include enough space for the descriptor object */
     AllocSize = MaxMsgSize + CFE_SB_BUFFERD_CONTENT_OFFSET;
 
-    /* Allocate a new buffer descriptor from the SB memory pool.*/
-    stat1 = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, AllocSize);
-    if (stat1 < 0)
+    /* Allocate a new buffer descriptor from the home shard of the producer */
+    ShardIdx = CFE_SB_GetBufferShard(AppId);
+    ShardPtr = &CFE_SB_Global.Mem.Shard[ShardIdx];
+
+    CFE_SB_LockBufferShard(ShardPtr);
+    stat1 = CFE_ES_GetPoolBufForCaller(&addr, ShardPtr->PoolHdl, AllocSize, CallerAddr);
+    if (stat1 < 0 && ShardIdx != CFE_SB_BUF_POOL_GLOBAL_SHARD)
     {
-        return NULL;
+        /* home shard is exhausted (or too small for this size), overflow into the global pool */
+        ++ShardPtr->FallbackCount;
+        CFE_SB_UnlockBufferShard(ShardPtr);
+
+        ShardIdx = CFE_SB_BUF_POOL_GLOBAL_SHARD;
+        ShardPtr = &CFE_SB_Global.Mem.Shard[ShardIdx];
+
+        CFE_SB_LockBufferShard(ShardPtr);
+        stat1 = CFE_ES_GetPoolBufForCaller(&addr, ShardPtr->PoolHdl, AllocSize, CallerAddr);
     }
 
-    /* increment the number of buffers in use and adjust the high water mark if needed */
-    CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse++;
-    if (CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse)
+    if (stat1 >= 0)
     {
-        CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse = CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse;
+        /* increment the buffers and memory in use of this shard and adjust the high water marks if needed */
+        ++ShardPtr->BuffersInUse;
+        if (ShardPtr->BuffersInUse > ShardPtr->PeakBuffersInUse)
+        {
+            ShardPtr->PeakBuffersInUse = ShardPtr->BuffersInUse;
+        }
+
+        ShardPtr->MemInUse += AllocSize;
+        if (ShardPtr->MemInUse > ShardPtr->PeakMemInUse)
+        {
+            ShardPtr->PeakMemInUse = ShardPtr->MemInUse;
+        }
     }
+    CFE_SB_UnlockBufferShard(ShardPtr);
 
-    /* Add the size of the actual buffer to the memory-in-use ctr and */
-    /* adjust the high water mark if needed */
-    CFE_SB_Global.StatTlmMsg.Payload.MemInUse += AllocSize;
-    if (CFE_SB_Global.StatTlmMsg.Payload.MemInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse)
+    if (stat1 < 0)
     {
-        CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
+        return NULL;
     }
 
     /* Initialize the buffer descriptor structure. */
@@ -130,6 +209,7 @@ CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
 
     bd->UseCount      = 1;
     bd->AllocatedSize = AllocSize;
+    bd->ShardIdx      = ShardIdx;
 
     CFE_SB_TrackingListReset(&bd->Link);
 
@@ -144,14 +224,65 @@ CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
  *-----------------------------------------------------------------*/
 void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd)
 {
+    CFE_SB_BufPoolShard_t *ShardPtr;
+
     /* Remove from any tracking list (no effect if not in a list) */
     CFE_SB_TrackingListRemove(&bd->Link);
 
-    --CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse;
-    CFE_SB_Global.StatTlmMsg.Payload.MemInUse -= bd->AllocatedSize;
+    /* buffers always go back to the shard they came from */
+    ShardPtr = &CFE_SB_Global.Mem.Shard[bd->ShardIdx];
+
+    CFE_SB_LockBufferShard(ShardPtr);
+
+    --ShardPtr->BuffersInUse;
+    ShardPtr->MemInUse -= bd->AllocatedSize;
 
     /* finally give the buf descriptor back to the buf descriptor pool */
-    CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, bd);
+    CFE_ES_PutPoolBuf(ShardPtr->PoolHdl, bd);
+
+    CFE_SB_UnlockBufferShard(ShardPtr);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_UpdateBufferStats(void)
+{
+    CFE_SB_BufPoolShard_t *ShardPtr;
+    uint32                 ShardIdx;
+    uint32                 BuffersInUse;
+    uint32                 PeakBuffersInUse;
+    size_t                 MemInUse;
+    size_t                 PeakMemInUse;
+    uint32                 Fallbacks;
+
+    BuffersInUse     = 0;
+    PeakBuffersInUse = 0;
+    MemInUse         = 0;
+    PeakMemInUse     = 0;
+    Fallbacks        = 0;
+
+    for (ShardIdx = 0; ShardIdx < CFE_SB_BUF_POOL_NUM_SHARDS; ++ShardIdx)
+    {
+        ShardPtr = &CFE_SB_Global.Mem.Shard[ShardIdx];
+
+        CFE_SB_LockBufferShard(ShardPtr);
+        BuffersInUse += ShardPtr->BuffersInUse;
+        PeakBuffersInUse += ShardPtr->PeakBuffersInUse;
+        MemInUse += ShardPtr->MemInUse;
+        PeakMemInUse += ShardPtr->PeakMemInUse;
+        Fallbacks += ShardPtr->FallbackCount;
+        CFE_SB_UnlockBufferShard(ShardPtr);
+    }
+
+    CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse        = BuffersInUse;
+    CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse    = PeakBuffersInUse;
+    CFE_SB_Global.StatTlmMsg.Payload.MemInUse              = MemInUse;
+    CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse          = PeakMemInUse;
+    CFE_SB_Global.StatTlmMsg.Payload.BufPoolShardFallbacks = Fallbacks;
 }
 
 /*----------------------------------------------------------------
@@ -197,22 +328,33 @@ void CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd)
  *-----------------------------------------------------------------*/
 CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
 {
-    int32               Stat;
-    CFE_ES_MemPoolBuf_t addr = NULL;
+    int32                  Stat;
+    CFE_ES_MemPoolBuf_t    addr = NULL;
+    CFE_SB_BufPoolShard_t *ShardPtr;
+
+    /* Destination descriptors always come from the global pool */
+    ShardPtr = &CFE_SB_Global.Mem.Shard[CFE_SB_BUF_POOL_GLOBAL_SHARD];
+
+    CFE_SB_LockBufferShard(ShardPtr);
 
     /* Allocate a new destination descriptor from the SB memory pool.*/
-    Stat = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, sizeof(CFE_SB_DestinationD_t));
-    if (Stat < 0)
+    Stat = CFE_ES_GetPoolBuf(&addr, ShardPtr->PoolHdl, sizeof(CFE_SB_DestinationD_t));
+    if (Stat >= 0)
     {
-        return NULL;
+        /* Add the size of a destination descriptor to the memory-in-use ctr and */
+        /* adjust the high water mark if needed */
+        ShardPtr->MemInUse += Stat;
+        if (ShardPtr->MemInUse > ShardPtr->PeakMemInUse)
+        {
+            ShardPtr->PeakMemInUse = ShardPtr->MemInUse;
+        }
     }
 
-    /* Add the size of a destination descriptor to the memory-in-use ctr and */
-    /* adjust the high water mark if needed */
-    CFE_SB_Global.StatTlmMsg.Payload.MemInUse += Stat;
-    if (CFE_SB_Global.StatTlmMsg.Payload.MemInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse)
+    CFE_SB_UnlockBufferShard(ShardPtr);
+
+    if (Stat < 0)
     {
-        CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
+        return NULL;
     }
 
     return (CFE_SB_DestinationD_t *)addr;
@@ -226,20 +368,27 @@ CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
  *-----------------------------------------------------------------*/
 int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest)
 {
-    int32 Stat;
+    int32                  Stat;
+    CFE_SB_BufPoolShard_t *ShardPtr;
 
     if (Dest == NULL)
     {
         return CFE_SB_BAD_ARGUMENT;
     }
 
+    ShardPtr = &CFE_SB_Global.Mem.Shard[CFE_SB_BUF_POOL_GLOBAL_SHARD];
+
+    CFE_SB_LockBufferShard(ShardPtr);
+
     /* give the destination block back to the SB memory pool */
-    Stat = CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, Dest);
+    Stat = CFE_ES_PutPoolBuf(ShardPtr->PoolHdl, Dest);
     if (Stat > 0)
     {
         /* Subtract the size of the destination block from the Memory in use ctr */
-        CFE_SB_Global.StatTlmMsg.Payload.MemInUse -= Stat;
+        ShardPtr->MemInUse -= Stat;
     }
 
+    CFE_SB_UnlockBufferShard(ShardPtr);
+
     return CFE_SUCCESS;
 }
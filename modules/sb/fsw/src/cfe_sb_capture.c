@@ -0,0 +1,609 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/******************************************************************************
+** File: cfe_sb_capture.c
+**
+** Purpose:
+**      This file contains the SB traffic capture and replay functions.
+**
+**      Messages matching a MsgId filter are recorded into an in-memory
+**      buffer as they are sent.  When the capture is stopped the buffer is
+**      written to a file by the FS background file writer.  A capture file
+**      may later be replayed onto the bus by an SB child task, either with
+**      the original message spacing, a scaled spacing, or as fast as possible.
+**
+******************************************************************************/
+
+/*
+**  Include Files
+*/
+
+#include "cfe_sb_module_all.h"
+
+#include <string.h>
+
+/*
+ * Longest single delay taken by the replay task between checks of the stop request
+ */
+#define CFE_SB_REPLAY_MAX_DELAY_SLICE_MSEC 100
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_CaptureMessage(const CFE_SB_BufferD_t *BufDscPtr)
+{
+    CFE_SB_CaptureState_t *    CapPtr;
+    CFE_SB_CaptureFileEntry_t *EntryPtr;
+    CFE_TIME_SysTime_t         Now;
+    size_t                     RecordSize;
+
+    CapPtr = &CFE_SB_Global.Capture;
+
+    if ((CFE_SB_MsgIdToValue(BufDscPtr->MsgId) & CapPtr->MsgIdMask) !=
+        (CFE_SB_MsgIdToValue(CapPtr->MsgIdFilter) & CapPtr->MsgIdMask))
+    {
+        return;
+    }
+
+    Now        = CFE_TIME_GetTime();
+    RecordSize = CFE_SB_CAPTURE_RECORD_SIZE(BufDscPtr->ContentSize);
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /* capture may have been stopped while this message was in flight */
+    if (CapPtr->IsActive)
+    {
+        if (RecordSize > (sizeof(CapPtr->Buffer.Data) - CapPtr->UsedBytes))
+        {
+            ++CapPtr->DroppedCount;
+        }
+        else
+        {
+            EntryPtr = (CFE_SB_CaptureFileEntry_t *)&CapPtr->Buffer.Data[CapPtr->UsedBytes];
+
+            EntryPtr->TimeSeconds    = Now.Seconds;
+            EntryPtr->TimeSubseconds = Now.Subseconds;
+            EntryPtr->MsgId          = BufDscPtr->MsgId;
+            EntryPtr->MsgSize        = BufDscPtr->ContentSize;
+
+            memcpy(EntryPtr + 1, &BufDscPtr->Content, BufDscPtr->ContentSize);
+
+            CapPtr->UsedBytes += RecordSize;
+            ++CapPtr->RecordCount;
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_WriteCaptureDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize)
+{
+    CFE_SB_CaptureState_t *    CapPtr;
+    CFE_SB_CaptureFileEntry_t *EntryPtr;
+    size_t                     RecordSize;
+
+    CapPtr = &CFE_SB_Global.Capture;
+
+    /*
+     * Capture is not active while the file is being written, and a new capture
+     * cannot be started until the write is complete, so no lock is needed here.
+     */
+    if (CapPtr->WritePosition < CapPtr->UsedBytes)
+    {
+        EntryPtr   = (CFE_SB_CaptureFileEntry_t *)&CapPtr->Buffer.Data[CapPtr->WritePosition];
+        RecordSize = CFE_SB_CAPTURE_RECORD_SIZE(EntryPtr->MsgSize);
+
+        *Buffer  = EntryPtr;
+        *BufSize = RecordSize;
+
+        CapPtr->WritePosition += RecordSize;
+    }
+    else
+    {
+        *Buffer  = NULL;
+        *BufSize = 0;
+    }
+
+    return (CapPtr->WritePosition >= CapPtr->UsedBytes);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Checks if the background file writer is still busy with a capture file
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_SB_CaptureWriteIsPending(void)
+{
+    CFE_SB_BackgroundFileStateInfo_t *StatePtr;
+
+    StatePtr = &CFE_SB_Global.BackgroundFile;
+
+    return (CFE_FS_BackgroundFileDumpIsPending(&StatePtr->FileWrite) &&
+            StatePtr->FileWrite.GetData == CFE_SB_WriteCaptureDataGetter);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Handles the file writer events of a capture file, the retained capture
+ * is released once its file is complete
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_SB_CaptureFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status, uint32 RecordNum,
+                                           size_t BlockSize, size_t Position)
+{
+    if (Event == CFE_FS_FileWriteEvent_COMPLETE)
+    {
+        CFE_SB_Global.Capture.IsRetained = false;
+    }
+
+    CFE_SB_BackgroundFileEventHandler(Meta, Event, Status, RecordNum, BlockSize, Position);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_StartCaptureCmd(const CFE_SB_StartCaptureCmd_t *data)
+{
+    const CFE_SB_StartCaptureCmd_Payload_t *CmdPtr;
+    CFE_SB_CaptureState_t *                 CapPtr;
+    int32                                   Status;
+
+    CmdPtr = &data->Payload;
+    CapPtr = &CFE_SB_Global.Capture;
+
+    /* The buffer must not be reset while it is still being written out */
+    if (CFE_SB_CaptureWriteIsPending())
+    {
+        CFE_EVS_SendEvent(CFE_SB_CAPTURE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Start Capture Err:Previous capture file write still pending");
+        Status = CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+    else if (CapPtr->IsRetained)
+    {
+        /* The previous capture must be stopped and written out before it is replaced */
+        CFE_EVS_SendEvent(CFE_SB_CAPTURE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Start Capture Err:Previous capture not yet written to a file");
+        Status = CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+    else
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        CapPtr->MsgIdFilter   = CmdPtr->MsgIdFilter;
+        CapPtr->MsgIdMask     = CmdPtr->MsgIdMask;
+        CapPtr->RecordCount   = 0;
+        CapPtr->DroppedCount  = 0;
+        CapPtr->UsedBytes     = 0;
+        CapPtr->WritePosition = 0;
+        CapPtr->IsRetained    = true;
+        CapPtr->IsActive      = true;
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+        CFE_EVS_SendEvent(CFE_SB_CAPTURE_START_EID, CFE_EVS_EventType_DEBUG, "Capture started,MsgId 0x%x,Mask 0x%x",
+                          (unsigned int)CFE_SB_MsgIdToValue(CmdPtr->MsgIdFilter), (unsigned int)CmdPtr->MsgIdMask);
+        Status = CFE_SUCCESS;
+    }
+
+    CFE_SB_IncrCmdCtr(Status);
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_StopCaptureCmd(const CFE_SB_StopCaptureCmd_t *data)
+{
+    const CFE_SB_WriteFileInfoCmd_Payload_t *CmdPtr;
+    CFE_SB_BackgroundFileStateInfo_t *       StatePtr;
+    CFE_SB_CaptureState_t *                  CapPtr;
+    int32                                    Status;
+
+    StatePtr = &CFE_SB_Global.BackgroundFile;
+    CapPtr   = &CFE_SB_Global.Capture;
+    CmdPtr   = &data->Payload;
+
+    if (!CapPtr->IsRetained)
+    {
+        /* Nothing was captured since the last file was written */
+        CFE_EVS_SendEvent(CFE_SB_CAPTURE_ERR_EID, CFE_EVS_EventType_ERROR, "Stop Capture Err:No capture to write");
+        CFE_SB_IncrCmdCtr(CFE_SB_BAD_ARGUMENT);
+        return CFE_SUCCESS;
+    }
+
+    /* Stop recording regardless, so the buffer contents are stable */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+    CapPtr->IsActive      = false;
+    CapPtr->WritePosition = 0;
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    /* If another file write was already pending, do not overwrite the current request */
+    if (!CFE_FS_BackgroundFileDumpIsPending(&StatePtr->FileWrite))
+    {
+        /* Reset the entire state object (just for good measure, ensure no stale data) */
+        memset(StatePtr, 0, sizeof(*StatePtr));
+
+        StatePtr->FileWrite.FileSubType = CFE_FS_SubType_SB_CAPTUREDATA;
+        snprintf(StatePtr->FileWrite.Description, sizeof(StatePtr->FileWrite.Description), "SB Traffic Capture");
+
+        StatePtr->FileWrite.GetData = CFE_SB_WriteCaptureDataGetter;
+        StatePtr->FileWrite.OnEvent = CFE_SB_CaptureFileEventHandler;
+
+        /*
+        ** Copy the filename into local buffer with default name/path/extension if not specified
+        */
+        Status = CFE_FS_ParseInputFileNameEx(StatePtr->FileWrite.FileName, CmdPtr->Filename,
+                                             sizeof(StatePtr->FileWrite.FileName), sizeof(CmdPtr->Filename),
+                                             CFE_PLATFORM_SB_DEFAULT_CAPTURE_FILENAME,
+                                             CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
+                                             CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
+
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_FS_BackgroundFileDumpRequest(&StatePtr->FileWrite);
+        }
+
+        if (Status == CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(CFE_SB_CAPTURE_STOP_EID, CFE_EVS_EventType_DEBUG,
+                              "Capture stopped,%u msgs recorded,%u dropped,writing %s",
+                              (unsigned int)CapPtr->RecordCount, (unsigned int)CapPtr->DroppedCount,
+                              StatePtr->FileWrite.FileName);
+        }
+        else
+        {
+            /* generate the same event as is generated when unable to create the file (same thing, really) */
+            CFE_SB_BackgroundFileEventHandler(StatePtr, CFE_FS_FileWriteEvent_CREATE_ERROR, Status, 0, 0, 0);
+        }
+    }
+    else
+    {
+        CFE_EVS_SendEvent(CFE_SB_CAPTURE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Stop Capture Err:Previous file write still pending, capture retained");
+        Status = CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+
+    CFE_SB_IncrCmdCtr(Status);
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_StartReplayCmd(const CFE_SB_StartReplayCmd_t *data)
+{
+    const CFE_SB_StartReplayCmd_Payload_t *CmdPtr;
+    CFE_SB_ReplayState_t *                 ReplayPtr;
+    int32                                  Status;
+
+    CmdPtr    = &data->Payload;
+    ReplayPtr = &CFE_SB_Global.Replay;
+
+    if (ReplayPtr->IsActive)
+    {
+        CFE_EVS_SendEvent(CFE_SB_REPLAY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Start Replay Err:Replay of %s already in progress", ReplayPtr->FileName);
+        Status = CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+    else if (CmdPtr->RateMode > CFE_SB_ReplayRate_MAX ||
+             (CmdPtr->RateMode == CFE_SB_ReplayRate_SCALED && CmdPtr->RateScale == 0))
+    {
+        CFE_EVS_SendEvent(CFE_SB_REPLAY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Start Replay Err:Invalid rate mode %u,scale %u", (unsigned int)CmdPtr->RateMode,
+                          (unsigned int)CmdPtr->RateScale);
+        Status = CFE_SB_BAD_ARGUMENT;
+    }
+    else
+    {
+        /*
+        ** Copy the filename into local buffer with default name/path/extension if not specified
+        */
+        Status = CFE_FS_ParseInputFileNameEx(ReplayPtr->FileName, CmdPtr->Filename, sizeof(ReplayPtr->FileName),
+                                             sizeof(CmdPtr->Filename), CFE_PLATFORM_SB_DEFAULT_CAPTURE_FILENAME,
+                                             CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
+                                             CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
+
+        if (Status == CFE_SUCCESS)
+        {
+            ReplayPtr->RateMode    = CmdPtr->RateMode;
+            ReplayPtr->RateScale   = CmdPtr->RateScale;
+            ReplayPtr->MsgCount    = 0;
+            ReplayPtr->ErrorCount  = 0;
+            ReplayPtr->StopRequest = false;
+            ReplayPtr->IsActive    = true;
+
+            Status = CFE_ES_CreateChildTask(&ReplayPtr->TaskId, "CFE_SB_REPLAY", CFE_SB_ReplayTaskMain,
+                                            CFE_ES_TASK_STACK_ALLOCATE, CFE_PLATFORM_SB_REPLAY_TASK_STACK_SIZE,
+                                            CFE_PLATFORM_SB_REPLAY_TASK_PRIORITY, 0);
+            if (Status != CFE_SUCCESS)
+            {
+                ReplayPtr->IsActive = false;
+            }
+        }
+
+        if (Status == CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(CFE_SB_REPLAY_START_EID, CFE_EVS_EventType_DEBUG, "Replay of %s started,rate mode %u",
+                              ReplayPtr->FileName, (unsigned int)ReplayPtr->RateMode);
+        }
+        else
+        {
+            CFE_EVS_SendEvent(CFE_SB_REPLAY_ERR_EID, CFE_EVS_EventType_ERROR, "Start Replay Err:stat=0x%x",
+                              (unsigned int)Status);
+        }
+    }
+
+    CFE_SB_IncrCmdCtr(Status);
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_StopReplayCmd(const CFE_SB_StopReplayCmd_t *data)
+{
+    int32 Status;
+
+    if (CFE_SB_Global.Replay.IsActive)
+    {
+        /* the replay task reports its own completion */
+        CFE_SB_Global.Replay.StopRequest = true;
+        Status                           = CFE_SUCCESS;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(CFE_SB_REPLAY_ERR_EID, CFE_EVS_EventType_ERROR, "Stop Replay Err:No replay in progress");
+        Status = CFE_SB_BAD_ARGUMENT;
+    }
+
+    CFE_SB_IncrCmdCtr(Status);
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Waits out the recorded spacing between two messages, in slices so a
+ * stop request is noticed promptly
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_SB_ReplayDelay(CFE_TIME_SysTime_t PrevTime, CFE_TIME_SysTime_t ThisTime)
+{
+    CFE_SB_ReplayState_t *ReplayPtr;
+    CFE_TIME_SysTime_t    Delta;
+    uint64                TotalMsec;
+    uint32                DelayMsec;
+    uint32                SliceMsec;
+
+    ReplayPtr = &CFE_SB_Global.Replay;
+
+    /* no delay if time went backwards (e.g. a time update during capture) */
+    if (CFE_TIME_Compare(ThisTime, PrevTime) != CFE_TIME_A_GT_B)
+    {
+        return;
+    }
+
+    Delta     = CFE_TIME_Subtract(ThisTime, PrevTime);
+    TotalMsec = ((uint64)Delta.Seconds * 1000) + (CFE_TIME_Sub2MicroSecs(Delta.Subseconds) / 1000);
+
+    if (ReplayPtr->RateMode == CFE_SB_ReplayRate_SCALED)
+    {
+        /* RateScale is a percentage of the original rate, so a larger scale means a shorter delay */
+        TotalMsec = (TotalMsec * 100) / ReplayPtr->RateScale;
+    }
+
+    /* gaps longer than about 49 days are shortened */
+    if (TotalMsec > 0xFFFFFFFF)
+    {
+        DelayMsec = 0xFFFFFFFF;
+    }
+    else
+    {
+        DelayMsec = (uint32)TotalMsec;
+    }
+
+    while (DelayMsec > 0 && !ReplayPtr->StopRequest)
+    {
+        SliceMsec = DelayMsec;
+        if (SliceMsec > CFE_SB_REPLAY_MAX_DELAY_SLICE_MSEC)
+        {
+            SliceMsec = CFE_SB_REPLAY_MAX_DELAY_SLICE_MSEC;
+        }
+
+        OS_TaskDelay(SliceMsec);
+        DelayMsec -= SliceMsec;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Reads and sends a single recorded message from the capture file
+ *
+ * Returns false if the file cannot be read any further
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_SB_ReplayOneMessage(osal_id_t FileDes, const CFE_SB_CaptureFileEntry_t *EntryPtr)
+{
+    CFE_SB_ReplayState_t *ReplayPtr;
+    CFE_SB_Buffer_t *     BufPtr;
+    size_t                PadSize;
+    int32                 OsStatus;
+    int32                 Status;
+
+    ReplayPtr = &CFE_SB_Global.Replay;
+
+    if (EntryPtr->MsgSize < sizeof(CFE_MSG_Message_t) || EntryPtr->MsgSize > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+    {
+        /* a corrupted size means the remainder of the file cannot be parsed */
+        return false;
+    }
+
+    BufPtr = CFE_SB_AllocateMessageBuffer(EntryPtr->MsgSize);
+    if (BufPtr == NULL)
+    {
+        /* skip over this message but keep going, buffers may free up */
+        ++ReplayPtr->ErrorCount;
+        OsStatus = OS_lseek(FileDes, CFE_SB_CAPTURE_RECORD_SIZE(EntryPtr->MsgSize) - sizeof(*EntryPtr), OS_SEEK_CUR);
+        return (OsStatus >= 0);
+    }
+
+    OsStatus = OS_read(FileDes, BufPtr, EntryPtr->MsgSize);
+    if (OsStatus != (int32)EntryPtr->MsgSize)
+    {
+        CFE_SB_ReleaseMessageBuffer(BufPtr);
+        return false;
+    }
+
+    PadSize = CFE_SB_CAPTURE_RECORD_SIZE(EntryPtr->MsgSize) - sizeof(*EntryPtr) - EntryPtr->MsgSize;
+    if (PadSize > 0)
+    {
+        OsStatus = OS_lseek(FileDes, PadSize, OS_SEEK_CUR);
+        if (OsStatus < 0)
+        {
+            /* the next record cannot be found */
+            ++ReplayPtr->ErrorCount;
+            CFE_SB_ReleaseMessageBuffer(BufPtr);
+            return false;
+        }
+    }
+
+    /* the recorded sequence count is preserved */
+    Status = CFE_SB_TransmitBuffer(BufPtr, false);
+    if (Status == CFE_SUCCESS)
+    {
+        ++ReplayPtr->MsgCount;
+    }
+    else
+    {
+        CFE_SB_ReleaseMessageBuffer(BufPtr);
+        ++ReplayPtr->ErrorCount;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReplayTaskMain(void)
+{
+    CFE_SB_ReplayState_t *    ReplayPtr;
+    CFE_FS_Header_t           FileHdr;
+    CFE_SB_CaptureFileEntry_t Entry;
+    CFE_TIME_SysTime_t        PrevTime;
+    CFE_TIME_SysTime_t        ThisTime;
+    osal_id_t                 FileDes = OS_OBJECT_ID_UNDEFINED;
+    int32                     OsStatus;
+    int32                     Status;
+    bool                      IsFirst;
+
+    ReplayPtr = &CFE_SB_Global.Replay;
+
+    OsStatus = OS_OpenCreate(&FileDes, ReplayPtr->FileName, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CFE_SB_REPLAY_ERR_EID, CFE_EVS_EventType_ERROR, "Replay Err:Cannot open %s, RC=%ld",
+                          ReplayPtr->FileName, (long)OsStatus);
+    }
+    else
+    {
+        Status = CFE_FS_ReadHeader(&FileHdr, FileDes);
+        if (Status != sizeof(CFE_FS_Header_t) || FileHdr.SubType != CFE_FS_SubType_SB_CAPTUREDATA)
+        {
+            CFE_EVS_SendEvent(CFE_SB_REPLAY_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Replay Err:%s is not an SB capture file", ReplayPtr->FileName);
+        }
+        else
+        {
+            IsFirst = true;
+            memset(&PrevTime, 0, sizeof(PrevTime));
+
+            while (!ReplayPtr->StopRequest)
+            {
+                OsStatus = OS_read(FileDes, &Entry, sizeof(Entry));
+                if (OsStatus != sizeof(Entry))
+                {
+                    /* normal end of file */
+                    break;
+                }
+
+                ThisTime.Seconds    = Entry.TimeSeconds;
+                ThisTime.Subseconds = Entry.TimeSubseconds;
+
+                if (!IsFirst && ReplayPtr->RateMode != CFE_SB_ReplayRate_MAX)
+                {
+                    CFE_SB_ReplayDelay(PrevTime, ThisTime);
+                }
+
+                if (!CFE_SB_ReplayOneMessage(FileDes, &Entry))
+                {
+                    CFE_EVS_SendEvent(CFE_SB_REPLAY_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "Replay Err:Bad record after %u msgs in %s", (unsigned int)ReplayPtr->MsgCount,
+                                      ReplayPtr->FileName);
+                    break;
+                }
+
+                PrevTime = ThisTime;
+                IsFirst  = false;
+            }
+
+            CFE_EVS_SendEvent(CFE_SB_REPLAY_STOP_EID, CFE_EVS_EventType_INFORMATION,
+                              "Replay of %s %s,%u msgs sent,%u errors", ReplayPtr->FileName,
+                              ReplayPtr->StopRequest ? "stopped" : "complete", (unsigned int)ReplayPtr->MsgCount,
+                              (unsigned int)ReplayPtr->ErrorCount);
+        }
+
+        OS_close(FileDes);
+    }
+
+    ReplayPtr->IsActive = false;
+
+    CFE_ES_ExitChildTask();
+}
@@ -178,6 +178,41 @@ void CFE_SB_ProcessGroundCmd(const CFE_SB_Buffer_t *SBBufPtr)
             }
             break;
 
+        case CFE_SB_START_CAPTURE_CC:
+            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_StartCaptureCmd_t)))
+            {
+                CFE_SB_StartCaptureCmd((const CFE_SB_StartCaptureCmd_t *)SBBufPtr);
+            }
+            break;
+
+        case CFE_SB_STOP_CAPTURE_CC:
+            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_StopCaptureCmd_t)))
+            {
+                CFE_SB_StopCaptureCmd((const CFE_SB_StopCaptureCmd_t *)SBBufPtr);
+            }
+            break;
+
+        case CFE_SB_START_REPLAY_CC:
+            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_StartReplayCmd_t)))
+            {
+                CFE_SB_StartReplayCmd((const CFE_SB_StartReplayCmd_t *)SBBufPtr);
+            }
+            break;
+
+        case CFE_SB_STOP_REPLAY_CC:
+            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_StopReplayCmd_t)))
+            {
+                CFE_SB_StopReplayCmd((const CFE_SB_StopReplayCmd_t *)SBBufPtr);
+            }
+            break;
+
+        case CFE_SB_WRITE_SNAPSHOT_CC:
+            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_WriteSnapshotCmd_t)))
+            {
+                CFE_SB_WriteSnapshotCmd((const CFE_SB_WriteSnapshotCmd_t *)SBBufPtr);
+            }
+            break;
+
         default:
             CFE_EVS_SendEvent(CFE_SB_BAD_CMD_CODE_EID, CFE_EVS_EventType_ERROR,
                               "Invalid Cmd, Unexpected Command Code %u", FcnCode);
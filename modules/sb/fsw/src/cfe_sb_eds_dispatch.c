@@ -36,7 +36,12 @@ const EdsDispatchTable_EdsComponent_CFE_SB_Application_CFE_SB_Telecommand_t CFE_
         .WriteMapInfoCmd_indication     = CFE_SB_WriteMapInfoCmd,
         .WritePipeInfoCmd_indication    = CFE_SB_WritePipeInfoCmd,
         .WriteRoutingInfoCmd_indication = CFE_SB_WriteRoutingInfoCmd,
-        .SendSbStatsCmd_indication      = CFE_SB_SendStatsCmd
+        .SendSbStatsCmd_indication      = CFE_SB_SendStatsCmd,
+        .StartCaptureCmd_indication     = CFE_SB_StartCaptureCmd,
+        .StopCaptureCmd_indication      = CFE_SB_StopCaptureCmd,
+        .StartReplayCmd_indication      = CFE_SB_StartReplayCmd,
+        .StopReplayCmd_indication       = CFE_SB_StopReplayCmd,
+        .WriteSnapshotCmd_indication    = CFE_SB_WriteSnapshotCmd
     },
     .SUB_RPT_CTRL =
     {
@@ -89,22 +89,63 @@ int32 CFE_SB_EarlyInit(void)
 int32 CFE_SB_InitBuffers(void)
 {
     int32                   Stat = 0;
+    int32                   OsStatus;
     CFE_Config_ArrayValue_t MemPoolDefSize;
+    CFE_SB_BufPoolShard_t * ShardPtr;
+    uint8 *                 ShardMem;
+    uint32                  i;
+    char                    MutexName[OS_MAX_API_NAME];
 
     MemPoolDefSize = CFE_Config_GetArrayValue(CFE_CONFIGID_PLATFORM_SB_MEM_BLOCK_SIZE);
 
-    Stat = CFE_ES_PoolCreateEx(&CFE_SB_Global.Mem.PoolHdl, CFE_SB_Global.Mem.Partition.Data,
-                               CFE_PLATFORM_SB_BUF_MEMORY_BYTES, MemPoolDefSize.NumElements, MemPoolDefSize.ElementPtr,
-                               CFE_ES_NO_MUTEX);
-
-    if (Stat != CFE_SUCCESS)
+    /*
+     * The global pool occupies the start of the SB memory, followed by
+     * the per-producer shards (if any) each of a fixed size.
+     */
+    ShardMem = CFE_SB_Global.Mem.Partition.Data;
+    for (i = 0; i < CFE_SB_BUF_POOL_NUM_SHARDS; ++i)
     {
-        CFE_ES_WriteToSysLog("%s: PoolCreate failed for SB Buffers, gave adr 0x%lx,size %d,stat=0x%x\n", __func__,
-                             (unsigned long)CFE_SB_Global.Mem.Partition.Data, CFE_PLATFORM_SB_BUF_MEMORY_BYTES,
-                             (unsigned int)Stat);
-        return Stat;
+        ShardPtr = &CFE_SB_Global.Mem.Shard[i];
+
+        if (i == CFE_SB_BUF_POOL_GLOBAL_SHARD)
+        {
+            ShardPtr->PoolSize = CFE_PLATFORM_SB_BUF_MEMORY_BYTES -
+                                 (CFE_PLATFORM_SB_BUF_POOL_SHARDS * CFE_PLATFORM_SB_BUF_POOL_SHARD_BYTES);
+        }
+        else
+        {
+            ShardPtr->PoolSize = CFE_PLATFORM_SB_BUF_POOL_SHARD_BYTES;
+        }
+
+        /* Each shard has its own lock, so producers on different shards do not contend */
+        snprintf(MutexName, sizeof(MutexName), "CFE_SB_Buf%u", (unsigned int)i);
+        OsStatus = OS_MutSemCreate(&ShardPtr->MutexId, MutexName, 0);
+        if (OsStatus != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: Buffer shard %u mutex creation failed! RC=%ld\n", __func__, (unsigned int)i,
+                                 (long)OsStatus);
+            return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
+
+        Stat = CFE_ES_PoolCreateEx(&ShardPtr->PoolHdl, ShardMem, ShardPtr->PoolSize, MemPoolDefSize.NumElements,
+                                   MemPoolDefSize.ElementPtr, CFE_ES_NO_MUTEX);
+
+        if (Stat != CFE_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: PoolCreate failed for SB Buffers, shard %u, gave adr 0x%lx,size %lu,stat=0x%x\n",
+                                 __func__, (unsigned int)i, (unsigned long)ShardMem, (unsigned long)ShardPtr->PoolSize,
+                                 (unsigned int)Stat);
+            return Stat;
+        }
+
+        ShardMem += ShardPtr->PoolSize;
     }
 
+    CFE_SB_Global.Mem.PoolHdl = CFE_SB_Global.Mem.Shard[CFE_SB_BUF_POOL_GLOBAL_SHARD].PoolHdl;
+
+    /* Carve the configured buffer reservation, this is best effort and never fails init */
+    CFE_SB_ReserveBuffers();
+
     /*
      * Initialize the buffer tracking lists to be empty
      */
@@ -114,6 +155,99 @@ int32 CFE_SB_InitBuffers(void)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReserveBuffers(void)
+{
+    CFE_Config_ArrayValue_t BlockSizeList;
+    CFE_Config_ArrayValue_t BlockReserveList;
+    const size_t *          BlockSize;
+    const uint32 *          BlockReserve;
+    CFE_ES_MemPoolBuf_t     ReservedList;
+    CFE_ES_MemPoolBuf_t     BufPtr;
+    size_t                  ReserveBytes;
+    uint32                  i;
+    uint32                  Count;
+    int32                   Stat;
+
+    BlockSizeList    = CFE_Config_GetArrayValue(CFE_CONFIGID_PLATFORM_SB_MEM_BLOCK_SIZE);
+    BlockReserveList = CFE_Config_GetArrayValue(CFE_CONFIGID_PLATFORM_SB_MEM_BLOCK_RESERVE);
+    BlockSize        = BlockSizeList.ElementPtr;
+    BlockReserve     = BlockReserveList.ElementPtr;
+
+    CFE_SB_Global.Mem.ReservedBuffers = 0;
+
+    if (BlockReserveList.NumElements != BlockSizeList.NumElements)
+    {
+        CFE_ES_WriteToSysLog("%s: SB buffer reservation list does not match block size list (%lu/%lu)\n", __func__,
+                             (unsigned long)BlockReserveList.NumElements, (unsigned long)BlockSizeList.NumElements);
+        return;
+    }
+
+    /* Check up front, so the report gives the whole picture rather than the first failure */
+    ReserveBytes = 0;
+    for (i = 0; i < BlockSizeList.NumElements; ++i)
+    {
+        ReserveBytes += BlockSize[i] * BlockReserve[i];
+    }
+
+    if (ReserveBytes > CFE_SB_Global.Mem.Shard[CFE_SB_BUF_POOL_GLOBAL_SHARD].PoolSize)
+    {
+        CFE_ES_WriteToSysLog("%s: SB buffer reservation of %lu bytes exceeds the SB pool size of %lu bytes\n",
+                             __func__, (unsigned long)ReserveBytes,
+                             (unsigned long)CFE_SB_Global.Mem.Shard[CFE_SB_BUF_POOL_GLOBAL_SHARD].PoolSize);
+    }
+
+    /*
+     * Carve all blocks first, chaining them through their own first word, so
+     * each allocation creates a new block rather than recycling one just freed.
+     * Then release them all, which leaves them linked on the free lists.
+     */
+    ReservedList = NULL;
+    for (i = 0; i < BlockSizeList.NumElements; ++i)
+    {
+        if (BlockReserve[i] != 0 && BlockSize[i] < sizeof(CFE_ES_MemPoolBuf_t))
+        {
+            CFE_ES_WriteToSysLog("%s: SB buffer reservation skipped for block size %lu\n", __func__,
+                                 (unsigned long)BlockSize[i]);
+            continue;
+        }
+
+        for (Count = 0; Count < BlockReserve[i]; ++Count)
+        {
+            Stat = CFE_ES_GetPoolBuf(&BufPtr, CFE_SB_Global.Mem.PoolHdl, BlockSize[i]);
+            if (Stat < 0)
+            {
+                CFE_ES_WriteToSysLog("%s: SB buffer reservation does not fit, block size %lu stopped at %lu of %lu\n",
+                                     __func__, (unsigned long)BlockSize[i], (unsigned long)Count,
+                                     (unsigned long)BlockReserve[i]);
+                break;
+            }
+
+            *((CFE_ES_MemPoolBuf_t *)BufPtr) = ReservedList;
+            ReservedList                     = BufPtr;
+            ++CFE_SB_Global.Mem.ReservedBuffers;
+        }
+
+        if (Count < BlockReserve[i])
+        {
+            /* pool is exhausted, smaller blocks would only fragment what is left */
+            break;
+        }
+    }
+
+    while (ReservedList != NULL)
+    {
+        BufPtr       = ReservedList;
+        ReservedList = *((CFE_ES_MemPoolBuf_t *)BufPtr);
+        CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, BufPtr);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
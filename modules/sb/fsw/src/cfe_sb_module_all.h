@@ -38,6 +38,7 @@
 #include "cfe_perfids.h"
 
 #include "cfe_sb_core_internal.h"
+#include "cfe_es_core_internal.h"
 
 #include "cfe_sb_priv.h"
 #include "cfe_sb_eventids.h"
@@ -246,6 +246,79 @@ bool CFE_SB_CheckPipeDescSlotUsed(CFE_ResourceId_t CheckId)
     return (PipeDscPtr == NULL || CFE_SB_PipeDescIsUsed(PipeDscPtr));
 }
 
+/*----------------------------------------------------------------
+ *
+ * Local helper routine, not invoked outside of this unit
+ * Confirms a name index candidate against the pipe table
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_SB_PipeDescNameMatch(uint32 TableIdx, const char *Name, void *Arg)
+{
+    CFE_SB_PipeD_t *PipeDscPtr = &CFE_SB_Global.PipeTbl[TableIdx];
+
+    return CFE_SB_PipeDescIsUsed(PipeDscPtr) && strcmp(Name, PipeDscPtr->PipeName) == 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_PipeD_t *CFE_SB_LocatePipeDescByName(const char *PipeName)
+{
+    uint32 TableIdx;
+
+    if (!CFE_ResourceId_NameIndexFind(CFE_SB_Global.PipeNameIndex, CFE_SB_PIPE_NAMEINDEX_SLOTS, PipeName,
+                                      CFE_SB_PipeDescNameMatch, NULL, &TableIdx) &&
+        (!CFE_SB_Global.PipeNameIndexIncomplete ||
+         !CFE_ResourceId_NameIndexScan(CFE_PLATFORM_SB_MAX_PIPES, PipeName, CFE_SB_PipeDescNameMatch, NULL,
+                                       &TableIdx)))
+    {
+        return NULL;
+    }
+
+    return &CFE_SB_Global.PipeTbl[TableIdx];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_PipeDescSetName(CFE_SB_PipeD_t *PipeDscPtr, const char *PipeName)
+{
+    if (PipeName == NULL)
+    {
+        PipeDscPtr->PipeName[0] = 0;
+        return;
+    }
+
+    strncpy(PipeDscPtr->PipeName, PipeName, sizeof(PipeDscPtr->PipeName) - 1);
+    PipeDscPtr->PipeName[sizeof(PipeDscPtr->PipeName) - 1] = 0;
+
+    if (CFE_ResourceId_NameIndexAdd(CFE_SB_Global.PipeNameIndex, CFE_SB_PIPE_NAMEINDEX_SLOTS, PipeDscPtr->PipeName,
+                                    PipeDscPtr - CFE_SB_Global.PipeTbl) != CFE_SUCCESS)
+    {
+        /* name lookups that miss in the index will also scan the pipe table */
+        CFE_SB_Global.PipeNameIndexIncomplete = true;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_PipeDescClearName(CFE_SB_PipeD_t *PipeDscPtr)
+{
+    CFE_ResourceId_NameIndexRemove(CFE_SB_Global.PipeNameIndex, CFE_SB_PIPE_NAMEINDEX_SLOTS, PipeDscPtr->PipeName,
+                                   PipeDscPtr - CFE_SB_Global.PipeTbl);
+    PipeDscPtr->PipeName[0] = 0;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -950,15 +1023,6 @@ void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_
     /* For an invalid route / no subscribers this whole logic can be skipped */
     if (CFE_SBR_IsValidRouteId(BufDscPtr->DestRouteId))
     {
-        /* If this is the origination, then update the message content (while locked) before actually sending */
-        if (TxnPtr->IsEndpoint)
-        {
-            CFE_SBR_IncrementSequenceCounter(BufDscPtr->DestRouteId);
-
-            /* Set the sequence count from the route */
-            CFE_MSG_SetSequenceCount(&BufDscPtr->Content.Msg, CFE_SBR_GetSequenceCounter(BufDscPtr->DestRouteId));
-        }
-
         /* Send the packet to all destinations  */
         DestPtr = CFE_SBR_GetDestListHeadPtr(BufDscPtr->DestRouteId);
         while (DestPtr != NULL && TxnPtr->NumPipes < TxnPtr->MaxPipes)
@@ -1041,6 +1105,17 @@ void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_
 
     CFE_SB_UnlockSharedData(__func__, __LINE__);
 
+    /*
+     * If this is the origination, update the message content before actually sending.
+     * The route sequence counter is advanced atomically and routes are never removed
+     * once added, so this does not need to hold the SB lock.
+     */
+    if (TxnPtr->IsEndpoint && CFE_SBR_IsValidRouteId(BufDscPtr->DestRouteId))
+    {
+        /* Set the sequence count from the route */
+        CFE_MSG_SetSequenceCount(&BufDscPtr->Content.Msg, CFE_SBR_IncrementSequenceCounter(BufDscPtr->DestRouteId));
+    }
+
     /*
      * Lastly, if this is the origination point, now that all headers should
      * have known values (including sequence) - invoke the mission-specific
@@ -1210,6 +1285,12 @@ void CFE_SB_TransmitTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer
     /* Convert the route to a set of pipes/destinations */
     CFE_SB_TransmitTxn_FindDestinations(TxnPtr, BufDscPtr);
 
+    /* Record the message if a traffic capture is running (headers are final at this point) */
+    if (CFE_SB_Global.Capture.IsActive && CFE_SB_MessageTxn_IsOK(TxnPtr))
+    {
+        CFE_SB_CaptureMessage(BufDscPtr);
+    }
+
     /* Note the above function always succeeds - even if no pipes are subscribed,
      * the transaction will simply have 0 pipes and this next call becomes a no-op */
     CFE_SB_MessageTxn_ProcessPipes(CFE_SB_TransmitTxn_PipeHandler, TxnPtr, BufDscPtr);
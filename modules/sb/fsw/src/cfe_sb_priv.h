@@ -42,6 +42,7 @@
 #include "cfe_fs_api_typedefs.h"
 #include "cfe_resourceid_api_typedefs.h"
 #include "cfe_sb_destination_typedef.h"
+#include "cfe_resourceid_nameindex.h"
 #include "cfe_sb_msg.h"
 
 /*
@@ -154,10 +155,16 @@ typedef struct CFE_SB_BufferD
     size_t ContentSize;   /**< Actual size of message content currently stored in the buffer */
 
     uint16 UseCount; /**< Number of active references to this buffer in the system */
+    uint8  ShardIdx; /**< Index of the buffer pool shard this descriptor was allocated from */
 
     CFE_SB_Buffer_t Content; /* Variably sized content field, Keep last */
 } CFE_SB_BufferD_t;
 
+/**
+ * @brief Number of name index slots for the pipe table
+ */
+#define CFE_SB_PIPE_NAMEINDEX_SLOTS CFE_RESOURCEID_NAMEINDEX_SLOTS(CFE_PLATFORM_SB_MAX_PIPES)
+
 /******************************************************************************
 **  Typedef:  CFE_SB_PipeD_t
 **
@@ -178,17 +185,57 @@ typedef struct
     uint16            CurrentQueueDepth;
     uint16            PeakQueueDepth;
     CFE_SB_BufferD_t *LastBuffer;
+    char              PipeName[OS_MAX_API_NAME]; /* Empty for unnamed pipes, and while being created/deleted */
 } CFE_SB_PipeD_t;
 
+/******************************************************************************
+**  Typedef:  CFE_SB_BufPoolShard_t
+**
+**  Purpose:
+**     This structure defines one independent section of the SB buffer memory.
+**     Shard 0 is always the global pool; any additional shards are the
+**     per-producer pools selected via CFE_SB_GetBufferShard().
+**
+**     Each shard has its own mutex, which protects the pool and the usage
+**     counters of that shard only.  It is always the innermost lock: the SB
+**     shared data lock may be held when taking it, but never the other way round.
+*/
+typedef struct
+{
+    CFE_ES_MemHandle_t PoolHdl;          /**< Handle of the ES pool managing this shard */
+    osal_id_t          MutexId;          /**< Mutex serializing the pool and counters of this shard */
+    size_t             PoolSize;         /**< Number of bytes of SB memory assigned to this shard */
+    uint32             BuffersInUse;     /**< Number of message buffers currently allocated from this shard */
+    uint32             PeakBuffersInUse; /**< High water mark of BuffersInUse */
+    size_t             MemInUse;         /**< Number of bytes currently allocated from this shard */
+    size_t             PeakMemInUse;     /**< High water mark of MemInUse */
+    uint32             FallbackCount;    /**< Number of allocations that overflowed to the global pool */
+} CFE_SB_BufPoolShard_t;
+
+/**
+ * \brief Total number of buffer pool shards, including the global pool
+ */
+#define CFE_SB_BUF_POOL_NUM_SHARDS (1 + CFE_PLATFORM_SB_BUF_POOL_SHARDS)
+
+/**
+ * \brief Index of the global (fallback) buffer pool shard
+ */
+#define CFE_SB_BUF_POOL_GLOBAL_SHARD 0
+
 /******************************************************************************
 **  Typedef:  CFE_SB_BufParams_t
 **
 **  Purpose:
 **     This structure defines the variables related to the SB routing buffers.
+**
+**     The PoolHdl member always refers to the global pool, which is also
+**     used for destination descriptors.
 */
 typedef struct
 {
-    CFE_ES_MemHandle_t PoolHdl;
+    CFE_ES_MemHandle_t    PoolHdl;
+    CFE_SB_BufPoolShard_t Shard[CFE_SB_BUF_POOL_NUM_SHARDS];
+    uint32                ReservedBuffers; /**< Number of buffers pre-carved at init */
     CFE_ES_STATIC_POOL_TYPE(CFE_PLATFORM_SB_BUF_MEMORY_BYTES) Partition;
 } CFE_SB_MemParams_t;
 
@@ -205,16 +252,40 @@ typedef struct
     CFE_SB_RoutingFileEntry_t DestEntries[CFE_PLATFORM_SB_MAX_DEST_PER_PKT]; /**< Actual data written to file */
 } CFE_SB_BackgroundRouteInfoBuffer_t;
 
+/**
+ * \brief Number of table entries written per call of the snapshot data getter
+ *
+ * Bounds the amount of data the background file writer handles at once, so
+ * a large snapshot is streamed out over several cycles.
+ */
+#define CFE_SB_SNAPSHOT_ENTRIES_PER_RECORD 16
+
+/**
+** \brief SB routing/pipe snapshot temporary structure
+**
+** Holds a complete copy of the routing and pipe state, taken in a single
+** pass while the SB shared data is locked.  The file is then written from
+** this copy without touching the live tables.
+*/
+typedef struct
+{
+    CFE_SB_SnapshotFileHeader_t Header;
+    CFE_SB_SnapshotRouteEntry_t Routes[CFE_PLATFORM_SB_MAX_MSG_IDS];
+    CFE_SB_SnapshotDestEntry_t  Dests[CFE_PLATFORM_SB_SNAPSHOT_MAX_DESTINATIONS];
+    CFE_SB_PipeInfoEntry_t      Pipes[CFE_PLATFORM_SB_MAX_PIPES];
+} CFE_SB_BackgroundSnapshotBuffer_t;
+
 /**
  * \brief Temporary holding buffer for records being written to a file.
  *
- * This is shared/reused between all file types (msg map, route info, pipe info).
+ * This is shared/reused between all file types (msg map, route info, pipe info, snapshot).
  */
 typedef union
 {
     CFE_SB_BackgroundRouteInfoBuffer_t RouteInfo;
     CFE_SB_PipeInfoEntry_t             PipeInfo;
     CFE_SB_MsgMapFileEntry_t           MsgMapInfo;
+    CFE_SB_BackgroundSnapshotBuffer_t  Snapshot;
 } CFE_SB_BackgroundFileBuffer_t;
 
 /**
@@ -228,6 +299,55 @@ typedef struct
     CFE_SB_BackgroundFileBuffer_t Buffer;    /**< Temporary holding area for file record */
 } CFE_SB_BackgroundFileStateInfo_t;
 
+/**
+ * \brief Size of one record in the SB capture buffer/file
+ *
+ * Each record is a CFE_SB_CaptureFileEntry_t followed by the message
+ * content, padded so the next record header stays 4-byte aligned.
+ */
+#define CFE_SB_CAPTURE_RECORD_SIZE(MsgSize) \
+    (sizeof(CFE_SB_CaptureFileEntry_t) + (((MsgSize) + sizeof(uint32) - 1) & ~(sizeof(uint32) - 1)))
+
+/**
+ * \brief SB traffic capture state
+ *
+ * Messages are appended to a linear buffer while capture is active, and
+ * the buffer is written to a file via the FS background writer when the
+ * capture is stopped.
+ */
+typedef struct
+{
+    volatile bool  IsActive;    /**< Set while messages are being recorded */
+    bool           IsRetained;  /**< Set from the start of a capture until its file is written */
+    CFE_SB_MsgId_t MsgIdFilter; /**< MsgId value to match */
+    uint32         MsgIdMask;   /**< Bits of MsgId to compare, 0 matches all */
+    uint32         RecordCount; /**< Number of messages recorded */
+    uint32         DroppedCount; /**< Number of matching messages that did not fit */
+    size_t         UsedBytes;     /**< Bytes of buffer filled by recorded messages */
+    size_t         WritePosition; /**< Offset of the next record to write to file */
+
+    union
+    {
+        uint32 Align; /**< Forces alignment of the record headers */
+        uint8  Data[CFE_PLATFORM_SB_CAPTURE_BUFFER_BYTES];
+    } Buffer;
+} CFE_SB_CaptureState_t;
+
+/**
+ * \brief SB traffic replay state
+ */
+typedef struct
+{
+    volatile bool            IsActive;    /**< Set while the replay task is running */
+    volatile bool            StopRequest; /**< Set to ask the replay task to exit early */
+    CFE_ES_TaskId_t          TaskId;      /**< ID of the replay child task */
+    CFE_SB_ReplayRate_Enum_t RateMode;    /**< Pacing of replayed messages */
+    uint16                   RateScale;   /**< Percent of original rate for scaled replay */
+    uint32                   MsgCount;    /**< Number of messages replayed */
+    uint32                   ErrorCount;  /**< Number of messages that could not be replayed */
+    char                     FileName[OS_MAX_PATH_LEN]; /**< Capture file being replayed */
+} CFE_SB_ReplayState_t;
+
 /******************************************************************************
 **  Typedef:  CFE_SB_Global_t
 **
@@ -250,8 +370,14 @@ typedef struct
     CFE_SB_Qos_t                 Default_Qos;
     CFE_ResourceId_t             LastPipeId;
 
+    CFE_ResourceId_NameIndexSlot_t PipeNameIndex[CFE_SB_PIPE_NAMEINDEX_SLOTS];
+    bool                           PipeNameIndexIncomplete; /* set if a pipe could not be indexed */
+
     CFE_SB_BackgroundFileStateInfo_t BackgroundFile;
 
+    CFE_SB_CaptureState_t Capture;
+    CFE_SB_ReplayState_t  Replay;
+
     /* A list of buffers currently in-transit, owned by SB */
     CFE_SB_BufferLink_t InTransitList;
 
@@ -359,6 +485,16 @@ int32 CFE_SB_AppInit(void);
  */
 int32 CFE_SB_InitBuffers(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Pre-carves the configured number of buffers of each block size
+ *
+ * The buffers are allocated from the global SB pool and immediately
+ * released, leaving them on the free list of their block size.  Any
+ * reservation that does not fit is reported in the system log.
+ */
+void CFE_SB_ReserveBuffers(void);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * Initialize the Software Bus Pipe Table.
@@ -631,6 +767,18 @@ void CFE_SB_TrackingListRemove(CFE_SB_BufferLink_t *Node);
  */
 void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Selects the buffer pool shard used for allocations on behalf of an app
+ *
+ * Maps the producing application to its "home" shard.  If no producer shards
+ * are configured, or the AppId is not valid, this returns the global shard.
+ *
+ * \param[in] AppId The application that will own/produce the buffer
+ * \returns Index of the shard within CFE_SB_Global.Mem.Shard
+ */
+uint8 CFE_SB_GetBufferShard(CFE_ES_AppId_t AppId);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Allocates a new buffer descriptor from the SB memory pool.
@@ -640,25 +788,79 @@ void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node
  * by the SB to dynamically allocate memory to hold the message and a buffer
  * descriptor associated with the message during the sending of a message.
  *
- * @note This must only be invoked while holding the SB global lock
+ * The buffer is taken from the home shard of the producing app, or from the
+ * global pool if the home shard cannot satisfy the request.
  *
+ * @note This takes only the lock of the shard being allocated from, so it does not
+ * need the SB global lock.  It must not be invoked while holding a shard lock.
+ *
+ * \param[in] AppId      The application producing the message
  * \param[in] MaxMsgSize Maximum message content size that the buffer must be capable of holding
+ * \param[in] CallerAddr Code address of the application call site, recorded by the ES pool allocation tracker
  * \returns Pointer to buffer descriptor, or NULL on failure.
  */
-CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize);
+CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(CFE_ES_AppId_t AppId, size_t MaxMsgSize, cpuaddr CallerAddr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Allocates a zero-copy message buffer on behalf of a given call site
+ *
+ * Implements CFE_SB_AllocateMessageBuffer().  The public API and CFE_SB_TransmitMsg()
+ * pass the address of the application code that called them, so the ES pool
+ * allocation tracker reports the application rather than the SB wrapper.
+ *
+ * \param[in] MsgSize    Size of the message content to allocate
+ * \param[in] CallerAddr Code address of the application call site
+ * \returns Pointer to the message buffer, or NULL on failure.
+ */
+CFE_SB_Buffer_t *CFE_SB_AllocateMessageBufferForCaller(size_t MsgSize, cpuaddr CallerAddr);
 
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Returns a buffer to SB memory pool
  *
  * This function will return a block of memory back to the SB memory pool,
- * so it can be re-used for a future message
+ * so it can be re-used for a future message.  The block is always returned
+ * to the shard it was allocated from.
  *
- * @note This must only be invoked while holding the SB global lock
+ * @note This must only be invoked while holding the SB global lock, which protects
+ * the buffer tracking lists.  The shard lock is taken internally for the pool.
  * \param[in] bd Pointer to descriptor to return
  */
 void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Obtains exclusive access to one buffer pool shard
+ *
+ * \param[in] ShardPtr Pointer to the shard to lock
+ */
+void CFE_SB_LockBufferShard(CFE_SB_BufPoolShard_t *ShardPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Releases exclusive access to one buffer pool shard
+ *
+ * \param[in] ShardPtr Pointer to the shard to unlock
+ */
+void CFE_SB_UnlockBufferShard(CFE_SB_BufPoolShard_t *ShardPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Aggregates the per-shard buffer counters into the SB statistics packet
+ *
+ * The allocation paths only update the counters of their own shard.  This sums
+ * them into the buffer and memory usage fields of the statistics packet, for
+ * use in housekeeping and the statistics telemetry.
+ *
+ * The peak values are the sum of the per-shard high water marks.  This is exact
+ * with a single pool; with producer shards it is an upper bound, as the shards
+ * may not have peaked at the same time.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ */
+void CFE_SB_UpdateBufferStats(void);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Perform basic sanity check on the Zero Copy handle
@@ -1302,6 +1504,61 @@ int32 CFE_SB_WritePipeInfoCmd(const CFE_SB_WritePipeInfoCmd_t *data);
  */
 int32 CFE_SB_WriteMapInfoCmd(const CFE_SB_WriteMapInfoCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Command Message Handler function
+ *
+ * SB internal function to handle processing of 'Write Snapshot' Cmd
+ *
+ * \param[in] data Pointer to command structure
+ * \return Execution status, see \ref CFEReturnCodes
+ */
+int32 CFE_SB_WriteSnapshotCmd(const CFE_SB_WriteSnapshotCmd_t *data);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Command Message Handler function
+ *
+ * SB internal function to handle processing of 'Start Capture' Cmd
+ *
+ * \param[in] data Pointer to command structure
+ * \return Execution status, see \ref CFEReturnCodes
+ */
+int32 CFE_SB_StartCaptureCmd(const CFE_SB_StartCaptureCmd_t *data);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Command Message Handler function
+ *
+ * SB internal function to handle processing of 'Stop Capture' Cmd
+ *
+ * \param[in] data Pointer to command structure
+ * \return Execution status, see \ref CFEReturnCodes
+ */
+int32 CFE_SB_StopCaptureCmd(const CFE_SB_StopCaptureCmd_t *data);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Command Message Handler function
+ *
+ * SB internal function to handle processing of 'Start Replay' Cmd
+ *
+ * \param[in] data Pointer to command structure
+ * \return Execution status, see \ref CFEReturnCodes
+ */
+int32 CFE_SB_StartReplayCmd(const CFE_SB_StartReplayCmd_t *data);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Command Message Handler function
+ *
+ * SB internal function to handle processing of 'Stop Replay' Cmd
+ *
+ * \param[in] data Pointer to command structure
+ * \return Execution status, see \ref CFEReturnCodes
+ */
+int32 CFE_SB_StopReplayCmd(const CFE_SB_StopReplayCmd_t *data);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Command Message Handler function
@@ -1462,6 +1719,45 @@ static inline bool CFE_SB_PipeDescIsMatch(const CFE_SB_PipeD_t *PipeDscPtr, CFE_
  */
 bool CFE_SB_CheckPipeDescSlotUsed(CFE_ResourceId_t CheckId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Locate the Pipe table entry with the given name
+ *
+ * Looks up the pipe in the pipe name index, falling back to a scan of the
+ * pipe table only if some pipe could not be indexed.
+ *
+ * As this dereferences fields within the descriptors, global data must be
+ * locked prior to invoking this function.
+ *
+ * @param[in]   PipeName   the pipe name to locate
+ * @returns pointer to the Pipe table entry with the given name
+ * @retval NULL if no pipe with this name exists
+ */
+CFE_SB_PipeD_t *CFE_SB_LocatePipeDescByName(const char *PipeName);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Sets the name of a Pipe table entry and adds it to the pipe name index
+ *
+ * As this modifies fields within the descriptor, global data must be
+ * locked prior to invoking this function.
+ *
+ * @param[in]   PipeDscPtr   pointer to Pipe table entry
+ * @param[in]   PipeName     the pipe name, or NULL for an unnamed pipe
+ */
+void CFE_SB_PipeDescSetName(CFE_SB_PipeD_t *PipeDscPtr, const char *PipeName);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Removes a Pipe table entry from the pipe name index and clears its name
+ *
+ * As this modifies fields within the descriptor, global data must be
+ * locked prior to invoking this function.
+ *
+ * @param[in]   PipeDscPtr   pointer to Pipe table entry
+ */
+void CFE_SB_PipeDescClearName(CFE_SB_PipeD_t *PipeDscPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Internal version of CFE_SB_GetPipeName with deffered event reporting
@@ -1503,6 +1799,60 @@ bool CFE_SB_WritePipeInfoDataGetter(void *Meta, uint32 RecordNum, void **Buffer,
 void CFE_SB_BackgroundFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status, uint32 RecordNum,
                                        size_t BlockSize, size_t Position);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Local callback helper for taking a routing/pipe snapshot
+ * This copies one route and its destinations into the snapshot buffer.
+ * Unlike the other collectors it does not lock, the caller must hold the SB shared data lock.
+ */
+void CFE_SB_CollectSnapshotRoute(CFE_SBR_RouteId_t RouteId, void *ArgPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Copies the routing and pipe state into the snapshot buffer
+ *
+ * The routes, destinations and pipes are all copied under a single hold of the
+ * SB shared data lock.  Names are filled in afterward from other subsystems.
+ *
+ * @param SnapshotPtr  Buffer to fill
+ */
+void CFE_SB_TakeSnapshot(CFE_SB_BackgroundSnapshotBuffer_t *SnapshotPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Local callback helper for writing the snapshot to a file
+ * This streams the snapshot header and tables, a bounded number of entries per call
+ */
+bool CFE_SB_WriteSnapshotDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Local callback helper for writing the traffic capture buffer to a file
+ * This retrieves a single recorded message (header and content) from the capture buffer
+ */
+bool CFE_SB_WriteCaptureDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Records a message into the traffic capture buffer
+ *
+ * Called from the transmit path once the message headers are final.  The
+ * message is recorded only if capture is active and its MsgId passes the
+ * capture filter.  Takes the SB shared data lock internally.
+ *
+ * @param BufDscPtr  The buffer descriptor of the message being sent
+ */
+void CFE_SB_CaptureMessage(const CFE_SB_BufferD_t *BufDscPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Entry point of the SB replay child task
+ *
+ * Reads the capture file named in the replay state and sends each recorded
+ * message, paced according to the selected rate mode.
+ */
+void CFE_SB_ReplayTaskMain(void);
+
 /*
  * External variables private to the software bus module
  */
@@ -177,6 +177,7 @@ int32 CFE_SB_AppInit(void)
     CFE_SB_Global.StatTlmMsg.Payload.MaxPipeDepthAllowed = OS_QUEUE_MAX_DEPTH;
     CFE_SB_Global.StatTlmMsg.Payload.MaxSubscriptionsAllowed =
         ((CFE_PLATFORM_SB_MAX_MSG_IDS) * (CFE_PLATFORM_SB_MAX_DEST_PER_PKT));
+    CFE_SB_Global.StatTlmMsg.Payload.BufPoolShards = CFE_PLATFORM_SB_BUF_POOL_SHARDS;
 
     Status = CFE_SB_CreatePipe(&CFE_SB_Global.CmdPipe, CFE_SB_CMD_PIPE_DEPTH, CFE_SB_CMD_PIPE_NAME);
     if (Status != CFE_SUCCESS)
@@ -308,6 +309,8 @@ int32 CFE_SB_SendHKTlmCmd(const CFE_SB_SendHkCmd_t *data)
 {
     CFE_SB_LockSharedData(__FILE__, __LINE__);
 
+    CFE_SB_UpdateBufferStats();
+
     CFE_SB_Global.HKTlmMsg.Payload.MemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
     CFE_SB_Global.HKTlmMsg.Payload.UnmarkedMem =
         CFE_PLATFORM_SB_BUF_MEMORY_BYTES - CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse;
@@ -328,6 +331,8 @@ int32 CFE_SB_SendHKTlmCmd(const CFE_SB_SendHkCmd_t *data)
  *-----------------------------------------------------------------*/
 void CFE_SB_ResetCounters(void)
 {
+    uint32 ShardIdx;
+
     CFE_SB_Global.HKTlmMsg.Payload.CommandCounter                = 0;
     CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter           = 0;
     CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter          = 0;
@@ -339,6 +344,13 @@ void CFE_SB_ResetCounters(void)
     CFE_SB_Global.HKTlmMsg.Payload.SubscribeErrorCounter         = 0;
     CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter      = 0;
     CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter          = 0;
+
+    for (ShardIdx = 0; ShardIdx < CFE_SB_BUF_POOL_NUM_SHARDS; ++ShardIdx)
+    {
+        CFE_SB_LockBufferShard(&CFE_SB_Global.Mem.Shard[ShardIdx]);
+        CFE_SB_Global.Mem.Shard[ShardIdx].FallbackCount = 0;
+        CFE_SB_UnlockBufferShard(&CFE_SB_Global.Mem.Shard[ShardIdx]);
+    }
 }
 
 /*----------------------------------------------------------------
@@ -494,6 +506,9 @@ int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data)
 
     CFE_SB_LockSharedData(__FILE__, __LINE__);
 
+    /* Aggregate the buffer pool shard statistics */
+    CFE_SB_UpdateBufferStats();
+
     /* Collect data on pipes */
     PipeDscCount  = CFE_PLATFORM_SB_MAX_PIPES;
     PipeStatCount = CFE_MISSION_SB_MAX_PIPES;
@@ -1053,6 +1068,277 @@ int32 CFE_SB_WriteMapInfoCmd(const CFE_SB_WriteMapInfoCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_CollectSnapshotRoute(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
+{
+    CFE_SB_BackgroundSnapshotBuffer_t *SnapshotPtr;
+    CFE_SB_SnapshotRouteEntry_t *      RouteEntryPtr;
+    CFE_SB_SnapshotDestEntry_t *       DestEntryPtr;
+    CFE_SB_DestinationD_t *            DestPtr;
+    CFE_SB_MsgId_t                     RouteMsgId;
+    uint32                             Collisions;
+
+    /* Cast arguments for local use */
+    SnapshotPtr = (CFE_SB_BackgroundSnapshotBuffer_t *)ArgPtr;
+
+    RouteMsgId = CFE_SBR_GetMsgId(RouteId);
+    if (!CFE_SB_IsValidMsgId(RouteMsgId) || SnapshotPtr->Header.RouteCount >= CFE_PLATFORM_SB_MAX_MSG_IDS)
+    {
+        return;
+    }
+
+    Collisions = CFE_SBR_GetRouteCollisions(RouteId);
+
+    RouteEntryPtr = &SnapshotPtr->Routes[SnapshotPtr->Header.RouteCount];
+    ++SnapshotPtr->Header.RouteCount;
+
+    RouteEntryPtr->MsgId            = RouteMsgId;
+    RouteEntryPtr->Index            = CFE_SBR_RouteIdToValue(RouteId);
+    RouteEntryPtr->FirstDestination = SnapshotPtr->Header.DestinationCount;
+    RouteEntryPtr->DestinationCount = 0;
+    RouteEntryPtr->MapCollisions    = Collisions;
+    RouteEntryPtr->SequenceCount    = CFE_SBR_GetSequenceCounter(RouteId);
+
+    SnapshotPtr->Header.MapCollisions += Collisions;
+
+    /* Destinations of a route are stored contiguously, indexed from the route entry */
+    DestPtr = CFE_SBR_GetDestListHeadPtr(RouteId);
+    while (DestPtr != NULL)
+    {
+        if (SnapshotPtr->Header.DestinationCount < CFE_PLATFORM_SB_SNAPSHOT_MAX_DESTINATIONS)
+        {
+            DestEntryPtr = &SnapshotPtr->Dests[SnapshotPtr->Header.DestinationCount];
+            ++SnapshotPtr->Header.DestinationCount;
+            ++RouteEntryPtr->DestinationCount;
+
+            DestEntryPtr->PipeId        = DestPtr->PipeId;
+            DestEntryPtr->MsgCnt        = DestPtr->DestCnt;
+            DestEntryPtr->BuffCount     = DestPtr->BuffCount;
+            DestEntryPtr->MsgId2PipeLim = DestPtr->MsgId2PipeLim;
+            DestEntryPtr->State         = DestPtr->Active;
+            DestEntryPtr->Scope         = DestPtr->Scope;
+        }
+        else
+        {
+            ++SnapshotPtr->Header.DestinationsDropped;
+        }
+
+        DestPtr = DestPtr->Next;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TakeSnapshot(CFE_SB_BackgroundSnapshotBuffer_t *SnapshotPtr)
+{
+    CFE_SB_SnapshotFileHeader_t *HdrPtr;
+    CFE_SB_PipeD_t *             PipeDscPtr;
+    CFE_SB_PipeInfoEntry_t *     PipeEntryPtr;
+    osal_id_t                    SysQueueId[CFE_PLATFORM_SB_MAX_PIPES];
+    uint32                       i;
+
+    HdrPtr = &SnapshotPtr->Header;
+    memset(HdrPtr, 0, sizeof(*HdrPtr));
+
+    /*
+     * Copy everything in one pass under a single hold of the lock, so the
+     * routes, destinations and pipes are consistent with each other.  Only
+     * plain copies are done here, the names come from other subsystems and
+     * are looked up after unlocking.
+     */
+    CFE_SB_LockSharedData(__FILE__, __LINE__);
+
+    CFE_SBR_ForEachRouteId(CFE_SB_CollectSnapshotRoute, SnapshotPtr, NULL);
+
+    PipeDscPtr = CFE_SB_Global.PipeTbl;
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_PIPES; ++i)
+    {
+        if (CFE_SB_PipeDescIsUsed(PipeDscPtr))
+        {
+            PipeEntryPtr = &SnapshotPtr->Pipes[HdrPtr->PipeCount];
+            memset(PipeEntryPtr, 0, sizeof(*PipeEntryPtr));
+
+            PipeEntryPtr->PipeId            = CFE_SB_PipeDescGetID(PipeDscPtr);
+            PipeEntryPtr->AppId             = PipeDscPtr->AppId;
+            PipeEntryPtr->Opts              = PipeDscPtr->Opts;
+            PipeEntryPtr->SendErrors        = PipeDscPtr->SendErrors;
+            PipeEntryPtr->MaxQueueDepth     = PipeDscPtr->MaxQueueDepth;
+            PipeEntryPtr->CurrentQueueDepth = PipeDscPtr->CurrentQueueDepth;
+            PipeEntryPtr->PeakQueueDepth    = PipeDscPtr->PeakQueueDepth;
+
+            SysQueueId[HdrPtr->PipeCount] = PipeDscPtr->SysQueueId;
+            ++HdrPtr->PipeCount;
+        }
+
+        ++PipeDscPtr;
+    }
+
+    CFE_SB_UnlockSharedData(__FILE__, __LINE__);
+
+    /*
+     * Gather names while unlocked.  If a pipe is deleted in the meantime the
+     * lookups will fail and the names are simply left blank.
+     */
+    PipeEntryPtr = SnapshotPtr->Pipes;
+    for (i = 0; i < HdrPtr->PipeCount; ++i)
+    {
+        OS_GetResourceName(SysQueueId[i], PipeEntryPtr->PipeName, sizeof(PipeEntryPtr->PipeName));
+        CFE_ES_GetAppName(PipeEntryPtr->AppName, PipeEntryPtr->AppId, sizeof(PipeEntryPtr->AppName));
+        ++PipeEntryPtr;
+    }
+
+    /* Tables follow the snapshot header in a fixed order */
+    HdrPtr->RouteOffset       = sizeof(*HdrPtr);
+    HdrPtr->DestinationOffset = HdrPtr->RouteOffset + (HdrPtr->RouteCount * sizeof(CFE_SB_SnapshotRouteEntry_t));
+    HdrPtr->PipeOffset = HdrPtr->DestinationOffset + (HdrPtr->DestinationCount * sizeof(CFE_SB_SnapshotDestEntry_t));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_WriteSnapshotDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize)
+{
+    CFE_SB_BackgroundFileStateInfo_t * BgFilePtr;
+    CFE_SB_BackgroundSnapshotBuffer_t *SnapshotPtr;
+    void *                             TableBase[3];
+    size_t                             EntrySize[3];
+    uint32                             EntryCount[3];
+    uint32                             NumRecords;
+    uint32                             TotalRecords;
+    uint32                             Remaining;
+    uint32                             FirstEntry;
+    uint32                             i;
+
+    /* Cast arguments for local use */
+    BgFilePtr   = (CFE_SB_BackgroundFileStateInfo_t *)Meta;
+    SnapshotPtr = &BgFilePtr->Buffer.Snapshot;
+
+    TableBase[0]  = SnapshotPtr->Routes;
+    EntrySize[0]  = sizeof(SnapshotPtr->Routes[0]);
+    EntryCount[0] = SnapshotPtr->Header.RouteCount;
+    TableBase[1]  = SnapshotPtr->Dests;
+    EntrySize[1]  = sizeof(SnapshotPtr->Dests[0]);
+    EntryCount[1] = SnapshotPtr->Header.DestinationCount;
+    TableBase[2]  = SnapshotPtr->Pipes;
+    EntrySize[2]  = sizeof(SnapshotPtr->Pipes[0]);
+    EntryCount[2] = SnapshotPtr->Header.PipeCount;
+
+    /* Record 0 is the snapshot header, then each table takes as many records as needed */
+    if (RecordNum == 0)
+    {
+        *Buffer  = &SnapshotPtr->Header;
+        *BufSize = sizeof(SnapshotPtr->Header);
+    }
+    else
+    {
+        *Buffer  = NULL;
+        *BufSize = 0;
+    }
+
+    TotalRecords = 1;
+    Remaining    = RecordNum;
+    for (i = 0; i < 3; ++i)
+    {
+        NumRecords = (EntryCount[i] + CFE_SB_SNAPSHOT_ENTRIES_PER_RECORD - 1) / CFE_SB_SNAPSHOT_ENTRIES_PER_RECORD;
+
+        if (*Buffer == NULL && (Remaining - 1) < NumRecords)
+        {
+            FirstEntry = (Remaining - 1) * CFE_SB_SNAPSHOT_ENTRIES_PER_RECORD;
+            *Buffer    = (uint8 *)TableBase[i] + (FirstEntry * EntrySize[i]);
+            *BufSize   = EntrySize[i] * (EntryCount[i] - FirstEntry);
+            if (*BufSize > (EntrySize[i] * CFE_SB_SNAPSHOT_ENTRIES_PER_RECORD))
+            {
+                *BufSize = EntrySize[i] * CFE_SB_SNAPSHOT_ENTRIES_PER_RECORD;
+            }
+        }
+        else if (*Buffer == NULL)
+        {
+            Remaining -= NumRecords;
+        }
+
+        TotalRecords += NumRecords;
+    }
+
+    /* Check for EOF (last record) */
+    return (RecordNum >= (TotalRecords - 1));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_WriteSnapshotCmd(const CFE_SB_WriteSnapshotCmd_t *data)
+{
+    const CFE_SB_WriteFileInfoCmd_Payload_t *CmdPtr;
+    CFE_SB_BackgroundFileStateInfo_t *       StatePtr;
+    int32                                    Status;
+
+    StatePtr = &CFE_SB_Global.BackgroundFile;
+    CmdPtr   = &data->Payload;
+
+    /* If a file dump was already pending, do not overwrite the current request (it shares the buffer) */
+    if (!CFE_FS_BackgroundFileDumpIsPending(&StatePtr->FileWrite))
+    {
+        /* Reset the entire state object (just for good measure, ensure no stale data) */
+        memset(StatePtr, 0, sizeof(*StatePtr));
+
+        /*
+         * Fill out the remainder of meta data.
+         * This data is currently the same for every request
+         */
+        StatePtr->FileWrite.FileSubType = CFE_FS_SubType_SB_SNAPSHOT;
+        snprintf(StatePtr->FileWrite.Description, sizeof(StatePtr->FileWrite.Description), "SB Snapshot");
+
+        StatePtr->FileWrite.GetData = CFE_SB_WriteSnapshotDataGetter;
+        StatePtr->FileWrite.OnEvent = CFE_SB_BackgroundFileEventHandler;
+
+        /*
+        ** Copy the filename into local buffer with default name/path/extension if not specified
+        */
+        Status = CFE_FS_ParseInputFileNameEx(StatePtr->FileWrite.FileName, CmdPtr->Filename,
+                                             sizeof(StatePtr->FileWrite.FileName), sizeof(CmdPtr->Filename),
+                                             CFE_PLATFORM_SB_DEFAULT_SNAPSHOT_FILENAME,
+                                             CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
+                                             CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
+
+        if (Status == CFE_SUCCESS)
+        {
+            /* The copy is taken now, the background writer only streams it out */
+            CFE_SB_TakeSnapshot(&StatePtr->Buffer.Snapshot);
+
+            Status = CFE_FS_BackgroundFileDumpRequest(&StatePtr->FileWrite);
+        }
+    }
+    else
+    {
+        Status = CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        /* generate the same event as is generated when unable to create the file (same thing, really) */
+        CFE_SB_BackgroundFileEventHandler(StatePtr, CFE_FS_FileWriteEvent_CREATE_ERROR, Status, 0, 0, 0);
+    }
+
+    CFE_SB_IncrCmdCtr(Status);
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Internal helper routine only, not part of API.
@@ -64,6 +64,23 @@
 #error CFE_PLATFORM_SB_BUF_MEMORY_BYTES cannot be greater than UINT32_MAX (4 Gigabytes)!
 #endif
 
+#if CFE_PLATFORM_SB_BUF_POOL_SHARDS < 0
+#error CFE_PLATFORM_SB_BUF_POOL_SHARDS cannot be less than 0!
+#endif
+
+#if CFE_PLATFORM_SB_BUF_POOL_SHARDS > 254
+#error CFE_PLATFORM_SB_BUF_POOL_SHARDS cannot be greater than 254!
+#endif
+
+#if CFE_PLATFORM_SB_BUF_POOL_SHARDS > 0
+#if CFE_PLATFORM_SB_BUF_POOL_SHARD_BYTES < 512
+#error CFE_PLATFORM_SB_BUF_POOL_SHARD_BYTES cannot be less than 512 bytes!
+#endif
+#if (CFE_PLATFORM_SB_BUF_POOL_SHARDS * CFE_PLATFORM_SB_BUF_POOL_SHARD_BYTES) > (CFE_PLATFORM_SB_BUF_MEMORY_BYTES - 512)
+#error SB buffer pool shards must leave at least 512 bytes of CFE_PLATFORM_SB_BUF_MEMORY_BYTES for the global pool!
+#endif
+#endif
+
 /*
  * Legacy time formats no longer supported in core cFE, this will pass
  * if default is selected or if both defines are removed
@@ -98,4 +115,16 @@
 #error CFE_PLATFORM_SB_START_TASK_STACK_SIZE must be greater than or equal to 2048
 #endif
 
+#if CFE_PLATFORM_SB_REPLAY_TASK_STACK_SIZE < 2048
+#error CFE_PLATFORM_SB_REPLAY_TASK_STACK_SIZE must be greater than or equal to 2048
+#endif
+
+#if CFE_PLATFORM_SB_SNAPSHOT_MAX_DESTINATIONS < 1
+#error CFE_PLATFORM_SB_SNAPSHOT_MAX_DESTINATIONS cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_CAPTURE_BUFFER_BYTES < 1024
+#error CFE_PLATFORM_SB_CAPTURE_BUFFER_BYTES cannot be less than 1024 bytes!
+#endif
+
 #endif /* CFE_SB_VERIFY_H */
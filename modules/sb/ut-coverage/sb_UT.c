@@ -40,6 +40,7 @@
 #include "sb_ut_helpers.h"
 #include "cfe_msg.h"
 #include "cfe_core_resourceid_basevalues.h"
+#include "cfe_config.h"
 
 /*
  * A method to add an SB "Subtest"
@@ -339,6 +340,14 @@ void Test_SB_Cmds(void)
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_MapInfoDef);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_MapInfoAlreadyPending);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_MapInfoDataGetter);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_SnapshotDef);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_SnapshotAlreadyPending);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_SnapshotDataGetter);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_Capture);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_CaptureAlreadyPending);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_CaptureDataGetter);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_Replay);
+    SB_UT_ADD_SUBTEST(Test_SB_ReplayTaskMain);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_EnRouteValParam);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_EnRouteNonExist);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_EnRouteInvParam);
@@ -393,11 +402,13 @@ void Test_SB_Cmds_RstCtrs(void)
     } ResetCounters;
 
     memset(&ResetCounters, 0, sizeof(ResetCounters));
+    CFE_SB_Global.Mem.Shard[CFE_SB_BUF_POOL_NUM_SHARDS - 1].FallbackCount = 2;
 
     UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(ResetCounters.SBBuf), sizeof(ResetCounters.Cmd),
                     UT_TPID_CFE_SB_CMD_RESET_COUNTERS_CC);
 
     CFE_UtAssert_EVENTCOUNT(1);
+    UtAssert_ZERO(CFE_SB_Global.Mem.Shard[CFE_SB_BUF_POOL_NUM_SHARDS - 1].FallbackCount);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_CMD1_RCVD_EID);
 
@@ -439,12 +450,17 @@ void Test_SB_Cmds_Stats(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
 
+    /* Shard fallbacks are aggregated into the stats packet */
+    CFE_SB_Global.Mem.Shard[CFE_SB_BUF_POOL_GLOBAL_SHARD].FallbackCount = 1;
+    CFE_SB_Global.Mem.Shard[CFE_SB_BUF_POOL_NUM_SHARDS - 1].FallbackCount += 2;
+
     CFE_SB_ProcessCmdPipePkt(&SendSbStats.SBBuf);
 
     /* No subs event and command processing event */
     CFE_UtAssert_EVENTCOUNT(2);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_SND_STATS_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.BufPoolShardFallbacks, 3);
 
     UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(SendSbStats.SBBuf), 0, UT_TPID_CFE_SB_CMD_SEND_SB_STATS_CC);
     CFE_UtAssert_EVENTSENT(CFE_SB_LEN_ERR_EID);
@@ -918,6 +934,494 @@ void Test_SB_Cmds_MapInfoAlreadyPending(void)
     CFE_UtAssert_EVENTSENT(CFE_SB_SND_RTG_ERR1_EID);
 }
 
+/*
+** Test write snapshot command nominal path
+*/
+void Test_SB_Cmds_SnapshotDef(void)
+{
+    union
+    {
+        CFE_SB_Buffer_t           SBBuf;
+        CFE_SB_WriteSnapshotCmd_t Cmd;
+    } WriteSnapshot;
+    CFE_SB_PipeId_t                    PipeId1   = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t                    PipeId2   = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t                    PipeId3   = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t                     MsgId0    = SB_UT_TLM_MID1;
+    CFE_SB_MsgId_t                     MsgId1    = SB_UT_TLM_MID2;
+    CFE_SB_MsgId_t                     MsgId2    = SB_UT_TLM_MID3;
+    uint16                             PipeDepth = 10;
+    CFE_SB_BackgroundSnapshotBuffer_t *SnapshotPtr;
+
+    memset(&WriteSnapshot, 0, sizeof(WriteSnapshot));
+
+    CFE_SB_Global.HKTlmMsg.Payload.CommandCounter = 0;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId1, PipeDepth, "TestPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId2, PipeDepth, "TestPipe2"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId3, PipeDepth, "TestPipe3"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId0, PipeId1));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId0, PipeId2));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId1, PipeId1));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId2, PipeId3));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(WriteSnapshot.SBBuf), sizeof(WriteSnapshot.Cmd),
+                    UT_TPID_CFE_SB_CMD_WRITE_SNAPSHOT_CC);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandCounter, 1);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+
+    /* Check the copy taken at command time */
+    SnapshotPtr = &CFE_SB_Global.BackgroundFile.Buffer.Snapshot;
+    UtAssert_UINT32_EQ(SnapshotPtr->Header.RouteCount, 3);
+    UtAssert_UINT32_EQ(SnapshotPtr->Header.DestinationCount, 4);
+    UtAssert_UINT32_EQ(SnapshotPtr->Header.PipeCount, 3);
+    UtAssert_ZERO(SnapshotPtr->Header.DestinationsDropped);
+    UtAssert_UINT32_EQ(SnapshotPtr->Header.RouteOffset, sizeof(CFE_SB_SnapshotFileHeader_t));
+    UtAssert_UINT32_EQ(SnapshotPtr->Header.DestinationOffset,
+                       sizeof(CFE_SB_SnapshotFileHeader_t) + (3 * sizeof(CFE_SB_SnapshotRouteEntry_t)));
+    UtAssert_UINT32_EQ(SnapshotPtr->Header.PipeOffset, SnapshotPtr->Header.DestinationOffset +
+                                                           (4 * sizeof(CFE_SB_SnapshotDestEntry_t)));
+    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(SnapshotPtr->Routes[0].MsgId, MsgId0));
+    UtAssert_UINT32_EQ(SnapshotPtr->Routes[0].FirstDestination, 0);
+    UtAssert_UINT32_EQ(SnapshotPtr->Routes[0].DestinationCount, 2);
+    UtAssert_UINT32_EQ(SnapshotPtr->Routes[1].FirstDestination, 2);
+    UtAssert_UINT32_EQ(SnapshotPtr->Routes[1].DestinationCount, 1);
+    CFE_UtAssert_RESOURCEID_EQ(SnapshotPtr->Dests[2].PipeId, PipeId1);
+    CFE_UtAssert_RESOURCEID_EQ(SnapshotPtr->Pipes[0].PipeId, PipeId1);
+
+    /* Also test with a bad file name - should generate CFE_SB_SND_RTG_ERR1_EID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileNameEx), 1, CFE_FS_INVALID_PATH);
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(WriteSnapshot.SBBuf), sizeof(WriteSnapshot.Cmd),
+                    UT_TPID_CFE_SB_CMD_WRITE_SNAPSHOT_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SND_RTG_ERR1_EID);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+
+    /* Bad Size */
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(WriteSnapshot.SBBuf), 0,
+                    UT_TPID_CFE_SB_CMD_WRITE_SNAPSHOT_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_LEN_ERR_EID);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId2));
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId3));
+}
+
+/*
+** Test write snapshot command when already pending
+*/
+void Test_SB_Cmds_SnapshotAlreadyPending(void)
+{
+    union
+    {
+        CFE_SB_Buffer_t           SBBuf;
+        CFE_SB_WriteSnapshotCmd_t Cmd;
+    } WriteSnapshot;
+
+    memset(&WriteSnapshot, 0, sizeof(WriteSnapshot));
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), true);
+
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(WriteSnapshot.SBBuf), sizeof(WriteSnapshot.Cmd),
+                    UT_TPID_CFE_SB_CMD_WRITE_SNAPSHOT_CC);
+
+    CFE_UtAssert_EVENTCOUNT(1);
+
+    CFE_UtAssert_EVENTSENT(CFE_SB_SND_RTG_ERR1_EID);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 0);
+}
+
+/*
+** Test write snapshot data getter for background file write
+*/
+void Test_SB_Cmds_SnapshotDataGetter(void)
+{
+    static CFE_SB_BackgroundFileStateInfo_t State;
+    CFE_SB_BackgroundSnapshotBuffer_t *     SnapshotPtr;
+    CFE_SB_PipeId_t                         PipeId1 = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t                          MsgId0  = SB_UT_TLM_MID1;
+    void *                                  LocalBuffer;
+    size_t                                  LocalBufSize;
+
+    memset(&State, 0, sizeof(State));
+    SnapshotPtr = &State.Buffer.Snapshot;
+
+    /* Routes take two records, no destinations, pipes take one record */
+    SnapshotPtr->Header.RouteCount       = CFE_SB_SNAPSHOT_ENTRIES_PER_RECORD + 1;
+    SnapshotPtr->Header.DestinationCount = 0;
+    SnapshotPtr->Header.PipeCount        = 1;
+
+    UtAssert_BOOL_FALSE(CFE_SB_WriteSnapshotDataGetter(&State, 0, &LocalBuffer, &LocalBufSize));
+    UtAssert_ADDRESS_EQ(LocalBuffer, &SnapshotPtr->Header);
+    UtAssert_UINT32_EQ(LocalBufSize, sizeof(SnapshotPtr->Header));
+
+    UtAssert_BOOL_FALSE(CFE_SB_WriteSnapshotDataGetter(&State, 1, &LocalBuffer, &LocalBufSize));
+    UtAssert_ADDRESS_EQ(LocalBuffer, &SnapshotPtr->Routes[0]);
+    UtAssert_UINT32_EQ(LocalBufSize, CFE_SB_SNAPSHOT_ENTRIES_PER_RECORD * sizeof(CFE_SB_SnapshotRouteEntry_t));
+
+    UtAssert_BOOL_FALSE(CFE_SB_WriteSnapshotDataGetter(&State, 2, &LocalBuffer, &LocalBufSize));
+    UtAssert_ADDRESS_EQ(LocalBuffer, &SnapshotPtr->Routes[CFE_SB_SNAPSHOT_ENTRIES_PER_RECORD]);
+    UtAssert_UINT32_EQ(LocalBufSize, sizeof(CFE_SB_SnapshotRouteEntry_t));
+
+    UtAssert_BOOL_TRUE(CFE_SB_WriteSnapshotDataGetter(&State, 3, &LocalBuffer, &LocalBufSize));
+    UtAssert_ADDRESS_EQ(LocalBuffer, &SnapshotPtr->Pipes[0]);
+    UtAssert_UINT32_EQ(LocalBufSize, sizeof(CFE_SB_PipeInfoEntry_t));
+
+    UtAssert_BOOL_TRUE(CFE_SB_WriteSnapshotDataGetter(&State, 4, &LocalBuffer, &LocalBufSize));
+    UtAssert_NULL(LocalBuffer);
+    UtAssert_ZERO(LocalBufSize);
+
+    /* Empty snapshot is just the header */
+    memset(&State, 0, sizeof(State));
+    UtAssert_BOOL_TRUE(CFE_SB_WriteSnapshotDataGetter(&State, 0, &LocalBuffer, &LocalBufSize));
+    UtAssert_UINT32_EQ(LocalBufSize, sizeof(SnapshotPtr->Header));
+
+    /* Destinations beyond the table size are counted but not recorded */
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId1, 10, "TestPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId0, PipeId1));
+    SnapshotPtr->Header.DestinationCount = CFE_PLATFORM_SB_SNAPSHOT_MAX_DESTINATIONS;
+    CFE_SB_CollectSnapshotRoute(CFE_SBR_GetRouteId(MsgId0), SnapshotPtr);
+    UtAssert_UINT32_EQ(SnapshotPtr->Header.RouteCount, 1);
+    UtAssert_UINT32_EQ(SnapshotPtr->Header.DestinationsDropped, 1);
+    UtAssert_ZERO(SnapshotPtr->Routes[0].DestinationCount);
+
+    /* Routes without a valid MsgId are skipped */
+    CFE_SB_CollectSnapshotRoute(CFE_SBR_INVALID_ROUTE_ID, SnapshotPtr);
+    UtAssert_UINT32_EQ(SnapshotPtr->Header.RouteCount, 1);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+}
+
+/*
+** Test start/stop capture commands and message recording
+*/
+void Test_SB_Cmds_Capture(void)
+{
+    union
+    {
+        CFE_SB_Buffer_t          SBBuf;
+        CFE_SB_StartCaptureCmd_t Cmd;
+    } StartCapture;
+    union
+    {
+        CFE_SB_Buffer_t         SBBuf;
+        CFE_SB_StopCaptureCmd_t Cmd;
+    } StopCapture;
+    CFE_SB_BufferD_t *bd;
+
+    memset(&StartCapture, 0, sizeof(StartCapture));
+    memset(&StopCapture, 0, sizeof(StopCapture));
+
+    /* Stopping without a capture does not write a file */
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(StopCapture.SBBuf), sizeof(StopCapture.Cmd),
+                    UT_TPID_CFE_SB_CMD_STOP_CAPTURE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_CAPTURE_ERR_EID);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter, 1);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 0);
+
+    StartCapture.Cmd.Payload.MsgIdFilter = SB_UT_TLM_MID1;
+    StartCapture.Cmd.Payload.MsgIdMask   = 0xFFFFFFFF;
+
+    UT_ClearEventHistory();
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(StartCapture.SBBuf), sizeof(StartCapture.Cmd),
+                    UT_TPID_CFE_SB_CMD_START_CAPTURE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_CAPTURE_START_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandCounter, 1);
+    UtAssert_BOOL_TRUE(CFE_SB_Global.Capture.IsActive);
+
+    /* A capture in progress is not replaced by a new one */
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(StartCapture.SBBuf), sizeof(StartCapture.Cmd),
+                    UT_TPID_CFE_SB_CMD_START_CAPTURE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_CAPTURE_ERR_EID);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter, 2);
+    UtAssert_BOOL_TRUE(CFE_SB_Global.Capture.IsActive);
+
+    UtAssert_NOT_NULL(bd = CFE_SB_GetBufferFromPool(CFE_ES_APPID_UNDEFINED, 10, 0));
+    bd->ContentSize = 10;
+
+    /* matching MsgId is recorded, with padding */
+    bd->MsgId = SB_UT_TLM_MID1;
+    CFE_SB_CaptureMessage(bd);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Capture.RecordCount, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Capture.UsedBytes, sizeof(CFE_SB_CaptureFileEntry_t) + 12);
+
+    /* non-matching MsgId is ignored */
+    bd->MsgId = SB_UT_TLM_MID2;
+    CFE_SB_CaptureMessage(bd);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Capture.RecordCount, 1);
+
+    /* full buffer drops the message */
+    bd->MsgId                        = SB_UT_TLM_MID1;
+    CFE_SB_Global.Capture.UsedBytes = sizeof(CFE_SB_Global.Capture.Buffer.Data) - sizeof(uint32);
+    CFE_SB_CaptureMessage(bd);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Capture.RecordCount, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Capture.DroppedCount, 1);
+
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(StopCapture.SBBuf), sizeof(StopCapture.Cmd),
+                    UT_TPID_CFE_SB_CMD_STOP_CAPTURE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_CAPTURE_STOP_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandCounter, 2);
+    UtAssert_BOOL_FALSE(CFE_SB_Global.Capture.IsActive);
+    UtAssert_UINT32_EQ(CFE_SB_Global.BackgroundFile.FileWrite.FileSubType, CFE_FS_SubType_SB_CAPTUREDATA);
+    UtAssert_True(CFE_SB_Global.BackgroundFile.FileWrite.GetData == CFE_SB_WriteCaptureDataGetter,
+                  "Capture data getter selected");
+
+    /* inactive capture records nothing */
+    CFE_SB_CaptureMessage(bd);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Capture.DroppedCount, 1);
+
+    CFE_SB_ReturnBufferToPool(bd);
+
+    /* Also test with a bad file name - should generate CFE_SB_SND_RTG_ERR1_EID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileNameEx), 1, CFE_FS_INVALID_PATH);
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(StopCapture.SBBuf), sizeof(StopCapture.Cmd),
+                    UT_TPID_CFE_SB_CMD_STOP_CAPTURE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SND_RTG_ERR1_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter, 3);
+
+    /* Once the file is complete, a new capture can be started */
+    UT_ClearEventHistory();
+    UtAssert_BOOL_TRUE(CFE_SB_Global.Capture.IsRetained);
+    CFE_SB_Global.BackgroundFile.FileWrite.OnEvent(&CFE_SB_Global.BackgroundFile,
+                                                   CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, OS_ERROR, 1, 16, 0);
+    UtAssert_BOOL_TRUE(CFE_SB_Global.Capture.IsRetained);
+    CFE_SB_Global.BackgroundFile.FileWrite.OnEvent(&CFE_SB_Global.BackgroundFile, CFE_FS_FileWriteEvent_COMPLETE,
+                                                   CFE_SUCCESS, 1, 0, 0);
+    UtAssert_BOOL_FALSE(CFE_SB_Global.Capture.IsRetained);
+    CFE_UtAssert_EVENTSENT(CFE_SB_FILEWRITE_ERR_EID);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SND_RTG_EID);
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(StartCapture.SBBuf), sizeof(StartCapture.Cmd),
+                    UT_TPID_CFE_SB_CMD_START_CAPTURE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_CAPTURE_START_EID);
+    UtAssert_BOOL_TRUE(CFE_SB_Global.Capture.IsActive);
+
+    /* Bad Size */
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(StartCapture.SBBuf), 0, UT_TPID_CFE_SB_CMD_START_CAPTURE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_LEN_ERR_EID);
+}
+
+/*
+** Test start/stop capture commands when a file write is already pending
+*/
+void Test_SB_Cmds_CaptureAlreadyPending(void)
+{
+    union
+    {
+        CFE_SB_Buffer_t          SBBuf;
+        CFE_SB_StartCaptureCmd_t Cmd;
+    } StartCapture;
+    union
+    {
+        CFE_SB_Buffer_t         SBBuf;
+        CFE_SB_StopCaptureCmd_t Cmd;
+    } StopCapture;
+
+    memset(&StartCapture, 0, sizeof(StartCapture));
+    memset(&StopCapture, 0, sizeof(StopCapture));
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), true);
+
+    /* A pending write of another file type does not block a new capture */
+    CFE_SB_Global.BackgroundFile.FileWrite.GetData = CFE_SB_WriteRouteInfoDataGetter;
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(StartCapture.SBBuf), sizeof(StartCapture.Cmd),
+                    UT_TPID_CFE_SB_CMD_START_CAPTURE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_CAPTURE_START_EID);
+
+    /* but stopping cannot write the file, so the capture is kept */
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(StopCapture.SBBuf), sizeof(StopCapture.Cmd),
+                    UT_TPID_CFE_SB_CMD_STOP_CAPTURE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_CAPTURE_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter, 1);
+
+    /* A pending write of the capture buffer blocks a new capture */
+    UT_ClearEventHistory();
+    CFE_SB_Global.BackgroundFile.FileWrite.GetData = CFE_SB_WriteCaptureDataGetter;
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(StartCapture.SBBuf), sizeof(StartCapture.Cmd),
+                    UT_TPID_CFE_SB_CMD_START_CAPTURE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_CAPTURE_ERR_EID);
+    UtAssert_BOOL_FALSE(CFE_SB_Global.Capture.IsActive);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter, 2);
+}
+
+/*
+** Test capture data getter function
+*/
+void Test_SB_Cmds_CaptureDataGetter(void)
+{
+    CFE_SB_CaptureFileEntry_t *EntryPtr;
+    void *                     LocalBuffer;
+    size_t                     LocalBufSize;
+
+    LocalBuffer  = NULL;
+    LocalBufSize = 0;
+
+    /* empty buffer is immediately complete */
+    UtAssert_BOOL_TRUE(CFE_SB_WriteCaptureDataGetter(&CFE_SB_Global.BackgroundFile, 0, &LocalBuffer, &LocalBufSize));
+    UtAssert_NULL(LocalBuffer);
+    UtAssert_ZERO(LocalBufSize);
+
+    /* two records of different sizes */
+    EntryPtr          = (CFE_SB_CaptureFileEntry_t *)CFE_SB_Global.Capture.Buffer.Data;
+    EntryPtr->MsgSize = 8;
+    CFE_SB_Global.Capture.UsedBytes = CFE_SB_CAPTURE_RECORD_SIZE(8);
+    EntryPtr = (CFE_SB_CaptureFileEntry_t *)&CFE_SB_Global.Capture.Buffer.Data[CFE_SB_Global.Capture.UsedBytes];
+    EntryPtr->MsgSize = 5;
+    CFE_SB_Global.Capture.UsedBytes += CFE_SB_CAPTURE_RECORD_SIZE(5);
+
+    UtAssert_BOOL_FALSE(CFE_SB_WriteCaptureDataGetter(&CFE_SB_Global.BackgroundFile, 0, &LocalBuffer, &LocalBufSize));
+    UtAssert_ADDRESS_EQ(LocalBuffer, CFE_SB_Global.Capture.Buffer.Data);
+    UtAssert_UINT32_EQ(LocalBufSize, sizeof(CFE_SB_CaptureFileEntry_t) + 8);
+
+    UtAssert_BOOL_TRUE(CFE_SB_WriteCaptureDataGetter(&CFE_SB_Global.BackgroundFile, 1, &LocalBuffer, &LocalBufSize));
+    UtAssert_ADDRESS_EQ(LocalBuffer, EntryPtr);
+    UtAssert_UINT32_EQ(LocalBufSize, sizeof(CFE_SB_CaptureFileEntry_t) + 8);
+}
+
+/*
+** Test start/stop replay commands
+*/
+void Test_SB_Cmds_Replay(void)
+{
+    union
+    {
+        CFE_SB_Buffer_t         SBBuf;
+        CFE_SB_StartReplayCmd_t Cmd;
+    } StartReplay;
+    union
+    {
+        CFE_SB_Buffer_t        SBBuf;
+        CFE_SB_StopReplayCmd_t Cmd;
+    } StopReplay;
+
+    memset(&StartReplay, 0, sizeof(StartReplay));
+    memset(&StopReplay, 0, sizeof(StopReplay));
+
+    /* Stop with nothing running */
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(StopReplay.SBBuf), sizeof(StopReplay.Cmd),
+                    UT_TPID_CFE_SB_CMD_STOP_REPLAY_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_REPLAY_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter, 1);
+
+    /* Bad rate settings */
+    UT_ClearEventHistory();
+    StartReplay.Cmd.Payload.RateMode = CFE_SB_ReplayRate_MAX + 1;
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(StartReplay.SBBuf), sizeof(StartReplay.Cmd),
+                    UT_TPID_CFE_SB_CMD_START_REPLAY_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_REPLAY_ERR_EID);
+    StartReplay.Cmd.Payload.RateMode  = CFE_SB_ReplayRate_SCALED;
+    StartReplay.Cmd.Payload.RateScale = 0;
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(StartReplay.SBBuf), sizeof(StartReplay.Cmd),
+                    UT_TPID_CFE_SB_CMD_START_REPLAY_CC);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter, 3);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+
+    /* Child task creation failure */
+    UT_ClearEventHistory();
+    StartReplay.Cmd.Payload.RateScale = 200;
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, CFE_ES_ERR_CHILD_TASK_CREATE);
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(StartReplay.SBBuf), sizeof(StartReplay.Cmd),
+                    UT_TPID_CFE_SB_CMD_START_REPLAY_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_REPLAY_ERR_EID);
+    UtAssert_BOOL_FALSE(CFE_SB_Global.Replay.IsActive);
+
+    /* Nominal */
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(StartReplay.SBBuf), sizeof(StartReplay.Cmd),
+                    UT_TPID_CFE_SB_CMD_START_REPLAY_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_REPLAY_START_EID);
+    UtAssert_BOOL_TRUE(CFE_SB_Global.Replay.IsActive);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Replay.RateScale, 200);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandCounter, 1);
+
+    /* Already running */
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(StartReplay.SBBuf), sizeof(StartReplay.Cmd),
+                    UT_TPID_CFE_SB_CMD_START_REPLAY_CC);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter, 5);
+
+    /* Stop while running */
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(StopReplay.SBBuf), sizeof(StopReplay.Cmd),
+                    UT_TPID_CFE_SB_CMD_STOP_REPLAY_CC);
+    UtAssert_BOOL_TRUE(CFE_SB_Global.Replay.StopRequest);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandCounter, 2);
+
+    /* Bad Size */
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(StopReplay.SBBuf), 1, UT_TPID_CFE_SB_CMD_STOP_REPLAY_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_LEN_ERR_EID);
+}
+
+/*
+** Test the replay child task
+*/
+void Test_SB_ReplayTaskMain(void)
+{
+    CFE_FS_Header_t           FileHdr;
+    CFE_SB_CaptureFileEntry_t Entry;
+    struct
+    {
+        CFE_SB_CaptureFileEntry_t Entry;
+        uint8                     Content[sizeof(CFE_MSG_Message_t) + sizeof(uint32)];
+    } Record;
+
+    memset(&FileHdr, 0, sizeof(FileHdr));
+    memset(&Entry, 0, sizeof(Entry));
+
+    /* File open failure */
+    CFE_SB_Global.Replay.IsActive = true;
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 1, OS_ERROR);
+    UtAssert_VOIDCALL(CFE_SB_ReplayTaskMain());
+    CFE_UtAssert_EVENTSENT(CFE_SB_REPLAY_ERR_EID);
+    UtAssert_BOOL_FALSE(CFE_SB_Global.Replay.IsActive);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+
+    /* Not a capture file */
+    UT_ClearEventHistory();
+    FileHdr.SubType = CFE_FS_SubType_SB_ROUTEDATA;
+    UT_SetDataBuffer(UT_KEY(CFE_FS_ReadHeader), &FileHdr, sizeof(FileHdr), false);
+    UtAssert_VOIDCALL(CFE_SB_ReplayTaskMain());
+    CFE_UtAssert_EVENTSENT(CFE_SB_REPLAY_ERR_EID);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    /* Empty capture file */
+    UT_ClearEventHistory();
+    FileHdr.SubType = CFE_FS_SubType_SB_CAPTUREDATA;
+    UT_SetDataBuffer(UT_KEY(CFE_FS_ReadHeader), &FileHdr, sizeof(FileHdr), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+    UtAssert_VOIDCALL(CFE_SB_ReplayTaskMain());
+    CFE_UtAssert_EVENTSENT(CFE_SB_REPLAY_STOP_EID);
+    CFE_UtAssert_EVENTNOTSENT(CFE_SB_REPLAY_ERR_EID);
+    UtAssert_ZERO(CFE_SB_Global.Replay.MsgCount);
+
+    /* Corrupted record size */
+    UT_ClearEventHistory();
+    Entry.MsgSize = CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1;
+    UT_SetDataBuffer(UT_KEY(CFE_FS_ReadHeader), &FileHdr, sizeof(FileHdr), false);
+    UT_SetDataBuffer(UT_KEY(OS_read), &Entry, sizeof(Entry), false);
+    UtAssert_VOIDCALL(CFE_SB_ReplayTaskMain());
+    CFE_UtAssert_EVENTSENT(CFE_SB_REPLAY_ERR_EID);
+    CFE_UtAssert_EVENTSENT(CFE_SB_REPLAY_STOP_EID);
+
+    /* Stop requested before the first record */
+    UT_ClearEventHistory();
+    CFE_SB_Global.Replay.StopRequest = true;
+    UT_SetDataBuffer(UT_KEY(CFE_FS_ReadHeader), &FileHdr, sizeof(FileHdr), false);
+    UtAssert_VOIDCALL(CFE_SB_ReplayTaskMain());
+    CFE_UtAssert_EVENTSENT(CFE_SB_REPLAY_STOP_EID);
+    UtAssert_STUB_COUNT(OS_read, 2);
+
+    /* Failure to seek over the padding of a record */
+    UT_ClearEventHistory();
+    CFE_SB_Global.Replay.StopRequest = false;
+    memset(&Record, 0, sizeof(Record));
+    Record.Entry.MsgSize = sizeof(CFE_MSG_Message_t) + 1; /* not a multiple of 4, so the record is padded */
+    UT_SetDataBuffer(UT_KEY(CFE_FS_ReadHeader), &FileHdr, sizeof(FileHdr), false);
+    UT_SetDataBuffer(UT_KEY(OS_read), &Record, sizeof(Record.Entry) + Record.Entry.MsgSize, false);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, OS_ERROR);
+    UtAssert_VOIDCALL(CFE_SB_ReplayTaskMain());
+    CFE_UtAssert_EVENTSENT(CFE_SB_REPLAY_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Replay.ErrorCount, 1);
+    UtAssert_ZERO(CFE_SB_Global.Replay.MsgCount);
+}
+
 /*
 ** Test command to enable a specific route using a valid route
 */
@@ -1475,8 +1979,10 @@ void Test_SB_Cmds_UnexpMsgId(void)
 void Test_SB_EarlyInit(void)
 {
     SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_SemCreateError);
+    SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_ShardSemCreateError);
     SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_PoolCreateError);
     SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_NoErrors);
+    SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_ReserveBuffers);
 }
 
 /*
@@ -1488,6 +1994,17 @@ void Test_SB_EarlyInit_SemCreateError(void)
     UtAssert_INT32_EQ(CFE_SB_EarlyInit(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
 }
 
+/*
+** Test early initialization response to a buffer shard semaphore create failure
+*/
+void Test_SB_EarlyInit_ShardSemCreateError(void)
+{
+    /* The first mutex is the shared data lock, the second is the first shard */
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 2, OS_ERR_NO_FREE_IDS);
+    UtAssert_INT32_EQ(CFE_SB_EarlyInit(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_STUB_COUNT(CFE_ES_PoolCreateEx, 0);
+}
+
 /*
 ** Test early initialization response to a pool create ex failure
 */
@@ -1497,6 +2014,98 @@ void Test_SB_EarlyInit_PoolCreateError(void)
     UtAssert_INT32_EQ(CFE_SB_EarlyInit(), CFE_ES_BAD_ARGUMENT);
 }
 
+/*
+** Pool block configuration returned by the config stub for the reservation tests
+*/
+typedef struct
+{
+    CFE_Config_ArrayValue_t BlockSize;
+    CFE_Config_ArrayValue_t BlockReserve;
+} SB_UT_BlockConfig_t;
+
+static void SB_UT_BlockConfigHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const SB_UT_BlockConfig_t *CfgPtr   = UserObj;
+    CFE_ConfigId_t             ConfigId = UT_Hook_GetArgValueByName(Context, "ConfigId", CFE_ConfigId_t);
+    CFE_Config_ArrayValue_t    Val;
+
+    if (CFE_RESOURCEID_TEST_EQUAL(ConfigId, CFE_CONFIGID_PLATFORM_SB_MEM_BLOCK_RESERVE))
+    {
+        Val = CfgPtr->BlockReserve;
+    }
+    else
+    {
+        Val = CfgPtr->BlockSize;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, Val);
+}
+
+/*
+** Test early initialization with a buffer reservation
+*/
+void Test_SB_EarlyInit_ReserveBuffers(void)
+{
+    static union
+    {
+        CFE_ES_PoolAlign_t Align;
+        uint8              Bytes[512];
+    } PoolBuf;
+    static const size_t BlockSize[]     = {64, 16, 4};
+    static const uint32 BlockReserve[]  = {2, 1, 1};
+    static const size_t OversizeBlock[] = {CFE_PLATFORM_SB_BUF_MEMORY_BYTES};
+    SB_UT_BlockConfig_t Cfg;
+
+    Cfg.BlockSize.NumElements    = 3;
+    Cfg.BlockSize.ElementPtr     = BlockSize;
+    Cfg.BlockReserve.NumElements = 3;
+    Cfg.BlockReserve.ElementPtr  = BlockReserve;
+    UT_SetHandlerFunction(UT_KEY(CFE_Config_GetArrayValue), SB_UT_BlockConfigHandler, &Cfg);
+
+    /* Nominal, the block size too small to chain is skipped and reported */
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetPoolBuf), &PoolBuf, sizeof(PoolBuf), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_EarlyInit());
+    UtAssert_UINT32_EQ(CFE_SB_Global.Mem.ReservedBuffers, 3);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 3);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 3);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+
+    /* Pool exhausted partway, carved blocks are still released */
+    UT_ResetState(UT_KEY(CFE_ES_GetPoolBuf));
+    UT_ResetState(UT_KEY(CFE_ES_PutPoolBuf));
+    UT_ResetState(UT_KEY(CFE_ES_WriteToSysLog));
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetPoolBuf), &PoolBuf, sizeof(PoolBuf), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 2, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    CFE_UtAssert_SUCCESS(CFE_SB_EarlyInit());
+    UtAssert_UINT32_EQ(CFE_SB_Global.Mem.ReservedBuffers, 1);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 2);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+
+    /* Reservation larger than the pool is reported up front */
+    UT_ResetState(UT_KEY(CFE_ES_GetPoolBuf));
+    UT_ResetState(UT_KEY(CFE_ES_PutPoolBuf));
+    UT_ResetState(UT_KEY(CFE_ES_WriteToSysLog));
+    Cfg.BlockSize.NumElements    = 1;
+    Cfg.BlockReserve.NumElements = 1;
+    Cfg.BlockSize.ElementPtr     = OversizeBlock;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetPoolBuf), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    CFE_UtAssert_SUCCESS(CFE_SB_EarlyInit());
+    UtAssert_ZERO(CFE_SB_Global.Mem.ReservedBuffers);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 2);
+
+    /* Mismatched lists do nothing */
+    UT_ResetState(UT_KEY(CFE_ES_GetPoolBuf));
+    UT_ResetState(UT_KEY(CFE_ES_WriteToSysLog));
+    Cfg.BlockSize.NumElements = 3;
+    Cfg.BlockSize.ElementPtr  = BlockSize;
+    CFE_UtAssert_SUCCESS(CFE_SB_EarlyInit());
+    UtAssert_ZERO(CFE_SB_Global.Mem.ReservedBuffers);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 0);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+}
+
 /*
 ** Test successful early initialization
 */
@@ -1530,6 +2139,14 @@ void Test_SB_EarlyInit_NoErrors(void)
     UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.PeakSubscriptionsInUse);
     UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
     UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse);
+
+    /* One pool per shard, and the global pool handle is the first shard */
+    UtAssert_STUB_COUNT(CFE_ES_PoolCreateEx, 2 * CFE_SB_BUF_POOL_NUM_SHARDS);
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 2 * (1 + CFE_SB_BUF_POOL_NUM_SHARDS));
+    UtAssert_UINT32_EQ(CFE_SB_Global.Mem.Shard[CFE_SB_BUF_POOL_GLOBAL_SHARD].PoolSize,
+                       CFE_PLATFORM_SB_BUF_MEMORY_BYTES -
+                           (CFE_PLATFORM_SB_BUF_POOL_SHARDS * CFE_PLATFORM_SB_BUF_POOL_SHARD_BYTES));
+    UtAssert_ZERO(CFE_SB_Global.Mem.Shard[CFE_SB_BUF_POOL_GLOBAL_SHARD].FallbackCount);
 }
 
 /*
@@ -1982,23 +2599,20 @@ void Test_GetPipeIdByName_NullPtrs(void)
 */
 void Test_GetPipeIdByName_InvalidName(void)
 {
+    CFE_SB_PipeId_t PipeId = SB_UT_PIPEID_0;
     CFE_SB_PipeId_t PipeIdOut;
-    osal_id_t       OtherQueueId;
 
-    UT_SetDeferredRetcode(UT_KEY(OS_QueueGetIdByName), 1, OS_ERR_NAME_NOT_FOUND);
     UtAssert_INT32_EQ(CFE_SB_GetPipeIdByName(&PipeIdOut, "invalid"), CFE_SB_BAD_ARGUMENT);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_GETPIPEIDBYNAME_NAME_ERR_EID);
     UT_ClearEventHistory();
 
-    /* Set up a test case where OS_QueueGetIdByName() succeeds but returns an ID that
-       is not an SB pipe (i.e. if it was a queue belonging to some app other than SB) */
-    CFE_UtAssert_SETUP(OS_QueueCreate(&OtherQueueId, "nonsb", 4, 4, 0));
-    UT_SetDataBuffer(UT_KEY(OS_QueueGetIdByName), &OtherQueueId, sizeof(OtherQueueId), false);
+    /* A pipe that has been deleted can no longer be found by its name */
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "deleted"));
+    CFE_UtAssert_SETUP(CFE_SB_DeletePipe(PipeId));
 
-    UtAssert_INT32_EQ(CFE_SB_GetPipeIdByName(&PipeIdOut, "nonsb"), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_GetPipeIdByName(&PipeIdOut, "deleted"), CFE_SB_BAD_ARGUMENT);
     CFE_UtAssert_EVENTSENT(CFE_SB_GETPIPEIDBYNAME_NAME_ERR_EID);
-    CFE_UtAssert_TEARDOWN(OS_QueueDelete(OtherQueueId));
 }
 
 /*
@@ -2008,16 +2622,30 @@ void Test_GetPipeIdByName(void)
 {
     CFE_SB_PipeId_t PipeId = SB_UT_PIPEID_0;
     CFE_SB_PipeId_t PipeIdOut;
+    uint32          i;
 
     CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "TestPipe1"));
 
-    UT_SetDataBuffer(UT_KEY(OS_QueueGetIdByName), &(CFE_SB_Global.PipeTbl[0].SysQueueId),
-                     sizeof(CFE_SB_Global.PipeTbl[0].SysQueueId), false);
-
     CFE_UtAssert_SUCCESS(CFE_SB_GetPipeIdByName(&PipeIdOut, "TestPipe1"));
+    CFE_UtAssert_RESOURCEID_EQ(PipeIdOut, PipeId);
     CFE_UtAssert_EVENTSENT(CFE_SB_GETPIPEIDBYNAME_EID);
 
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+    /* A pipe that could not be indexed is still found by scanning the pipe table */
+    for (i = 0; i < CFE_SB_PIPE_NAMEINDEX_SLOTS; ++i)
+    {
+        CFE_SB_Global.PipeNameIndex[i].Entry = CFE_PLATFORM_SB_MAX_PIPES;
+    }
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "TestPipe2"));
+    UtAssert_BOOL_TRUE(CFE_SB_Global.PipeNameIndexIncomplete);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_GetPipeIdByName(&PipeIdOut, "TestPipe2"));
+    CFE_UtAssert_RESOURCEID_EQ(PipeIdOut, PipeId);
+    UtAssert_INT32_EQ(CFE_SB_GetPipeIdByName(&PipeIdOut, "TestPipe1"), CFE_SB_BAD_ARGUMENT);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
 /*
@@ -3803,8 +4431,10 @@ void Test_TransmitMsg_GetPoolBufErr(void)
 */
 void Test_AllocateMessageBuffer(void)
 {
-    size_t MsgSize = 10;
-    uint32 MemUse;
+    size_t                 MsgSize = 10;
+    uint32                 MemUse;
+    CFE_ES_AppId_t         AppId;
+    CFE_SB_BufPoolShard_t *ShardPtr;
 
     /* Attempt to allocate a message buffer greater than the max size */
     UtAssert_NULL(CFE_SB_AllocateMessageBuffer(CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1));
@@ -3826,17 +4456,24 @@ void Test_AllocateMessageBuffer(void)
      */
 
     /* predict memory use for a given descriptor (this needs to match what impl does) */
-    MemUse                                              = MsgSize + offsetof(CFE_SB_BufferD_t, Content);
-    CFE_SB_Global.StatTlmMsg.Payload.MemInUse           = 0;
-    CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse       = MemUse + 10;
-    CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse = CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse + 2;
+    CFE_ES_GetAppID(&AppId);
+    ShardPtr                   = &CFE_SB_Global.Mem.Shard[CFE_SB_GetBufferShard(AppId)];
+    MemUse                     = MsgSize + offsetof(CFE_SB_BufferD_t, Content);
+    ShardPtr->MemInUse         = 0;
+    ShardPtr->PeakMemInUse     = MemUse + 10;
+    ShardPtr->PeakBuffersInUse = ShardPtr->BuffersInUse + 2;
     UtAssert_NOT_NULL(CFE_SB_AllocateMessageBuffer(MsgSize));
 
-    UtAssert_INT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse, MemUse + 10); /* unchanged */
-    UtAssert_INT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, MemUse);          /* predicted value */
+    UtAssert_EQ(size_t, ShardPtr->PeakMemInUse, MemUse + 10); /* unchanged */
+    UtAssert_EQ(size_t, ShardPtr->MemInUse, MemUse);          /* predicted value */
+    UtAssert_UINT32_EQ(ShardPtr->PeakBuffersInUse, ShardPtr->BuffersInUse + 1);
 
-    UtAssert_INT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse,
-                      CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse + 1);
+    /* The statistics packet is only updated when the shard counters are aggregated */
+    CFE_SB_UpdateBufferStats();
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, MemUse);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse, MemUse + 10);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse,
+                       CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse + 1);
 
     CFE_UtAssert_EVENTCOUNT(0);
 }
@@ -4723,6 +5360,7 @@ void Test_SB_SpecialCases(void)
     SB_UT_ADD_SUBTEST(Test_ReqToSendEvent_ErrLogic);
     SB_UT_ADD_SUBTEST(Test_PutDestBlk_ErrLogic);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_Buffers);
+    SB_UT_ADD_SUBTEST(Test_CFE_SB_BufferShards);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_BadPipeInfo);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_UnsubResubPath);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_FalseEndpoint);
@@ -4816,12 +5454,15 @@ void Test_CFE_SB_Buffers(void)
 
     CFE_SB_BufferD_t *     bd;
     CFE_SB_DestinationD_t *destptr;
+    CFE_SB_BufPoolShard_t *ShardPtr;
 
-    CFE_SB_Global.StatTlmMsg.Payload.MemInUse     = 0;
-    CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = sizeof(CFE_SB_BufferD_t) * 4;
-    bd                                            = CFE_SB_GetBufferFromPool(0);
+    /* An undefined AppId always maps to the global pool */
+    ShardPtr               = &CFE_SB_Global.Mem.Shard[CFE_SB_BUF_POOL_GLOBAL_SHARD];
+    ShardPtr->MemInUse     = 0;
+    ShardPtr->PeakMemInUse = sizeof(CFE_SB_BufferD_t) * 4;
+    bd                     = CFE_SB_GetBufferFromPool(CFE_ES_APPID_UNDEFINED, 0, 0);
 
-    UtAssert_INT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse, sizeof(CFE_SB_BufferD_t) * 4);
+    UtAssert_EQ(size_t, ShardPtr->PeakMemInUse, sizeof(CFE_SB_BufferD_t) * 4);
 
     CFE_UtAssert_EVENTCOUNT(0);
 
@@ -4829,23 +5470,24 @@ void Test_CFE_SB_Buffers(void)
      * If returning to the pool fails SB still isn't going to use the buffer anymore,
      * so it shouldn't be tracked as "in use" - it is lost.
      */
-    ExpRtn = CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse - 1;
+    ExpRtn = ShardPtr->BuffersInUse - 1;
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 1, -1);
     CFE_SB_ReturnBufferToPool(bd);
-    UtAssert_INT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, ExpRtn);
+    UtAssert_INT32_EQ(ShardPtr->BuffersInUse, ExpRtn);
 
     CFE_UtAssert_EVENTCOUNT(0);
 
     bd->UseCount = 0;
     CFE_SB_DecrBufUseCnt(bd);
     UtAssert_INT32_EQ(bd->UseCount, 0);
-    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MemInUse);
+    UtAssert_ZERO(ShardPtr->MemInUse);
 
     CFE_UtAssert_EVENTCOUNT(0);
 
+    /* Destination descriptors are accounted to the global pool */
     destptr = CFE_SB_GetDestinationBlk();
     UtAssert_NOT_NULL(destptr);
-    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, sizeof(*destptr));
+    UtAssert_EQ(size_t, ShardPtr->MemInUse, sizeof(*destptr));
 
     /*
      * historical behavior has CFE_SB_PutDestinationBlk() return SUCCESS even if the underlying call fails,
@@ -4853,12 +5495,93 @@ void Test_CFE_SB_Buffers(void)
      */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 1, -1);
     CFE_UtAssert_SUCCESS(CFE_SB_PutDestinationBlk(destptr));
+    UtAssert_EQ(size_t, ShardPtr->MemInUse, sizeof(*destptr));
+    CFE_SB_UpdateBufferStats();
     UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, sizeof(*destptr));
 
     /* normal case should reduce MemInUse */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 1, sizeof(*destptr));
     CFE_UtAssert_SUCCESS(CFE_SB_PutDestinationBlk(destptr));
-    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MemInUse);
+    UtAssert_ZERO(ShardPtr->MemInUse);
+
+    /* Failure to get a destination block leaves the counters untouched */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_NULL(CFE_SB_GetDestinationBlk());
+    UtAssert_ZERO(ShardPtr->MemInUse);
+
+    /* Shard lock failures are reported, but do not stop the operation */
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemTake), 1, OS_SEM_FAILURE);
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemGive), 1, OS_SEM_FAILURE);
+    CFE_SB_UpdateBufferStats();
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 2);
+
+    CFE_UtAssert_EVENTCOUNT(0);
+}
+
+/*
+** Test allocation of buffers from the per-producer pool shards
+*/
+void Test_CFE_SB_BufferShards(void)
+{
+    CFE_SB_BufferD_t *bd;
+    CFE_ES_AppId_t    AppId;
+    uint32            AppIndex;
+    uint8             HomeShard;
+
+    AppId    = CFE_ES_APPID_C(CFE_ResourceId_FromInteger(3));
+    AppIndex = 3;
+    if (CFE_PLATFORM_SB_BUF_POOL_SHARDS > 0)
+    {
+        HomeShard = 1 + (AppIndex % CFE_PLATFORM_SB_BUF_POOL_SHARDS);
+    }
+    else
+    {
+        HomeShard = CFE_SB_BUF_POOL_GLOBAL_SHARD;
+    }
+
+    /* Invalid AppId always maps to the global pool */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_AppID_ToIndex), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_UINT32_EQ(CFE_SB_GetBufferShard(AppId), CFE_SB_BUF_POOL_GLOBAL_SHARD);
+
+    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    UtAssert_UINT32_EQ(CFE_SB_GetBufferShard(AppId), HomeShard);
+
+    /* Nominal allocation comes from (and returns to) the home shard */
+    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    UtAssert_NOT_NULL(bd = CFE_SB_GetBufferFromPool(AppId, 10, 0));
+    UtAssert_UINT32_EQ(bd->ShardIdx, HomeShard);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Mem.Shard[HomeShard].BuffersInUse, 1);
+    UtAssert_EQ(size_t, CFE_SB_Global.Mem.Shard[HomeShard].MemInUse, bd->AllocatedSize);
+    CFE_SB_UpdateBufferStats();
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, bd->AllocatedSize);
+    CFE_SB_ReturnBufferToPool(bd);
+    UtAssert_ZERO(CFE_SB_Global.Mem.Shard[HomeShard].BuffersInUse);
+    UtAssert_ZERO(CFE_SB_Global.Mem.Shard[HomeShard].MemInUse);
+
+    /* Exhausted home shard overflows into the global pool (if there is a separate home shard) */
+    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    bd = CFE_SB_GetBufferFromPool(AppId, 10, 0);
+    if (HomeShard != CFE_SB_BUF_POOL_GLOBAL_SHARD)
+    {
+        UtAssert_NOT_NULL(bd);
+        UtAssert_UINT32_EQ(bd->ShardIdx, CFE_SB_BUF_POOL_GLOBAL_SHARD);
+        UtAssert_UINT32_EQ(CFE_SB_Global.Mem.Shard[HomeShard].FallbackCount, 1);
+        UtAssert_UINT32_EQ(CFE_SB_Global.Mem.Shard[CFE_SB_BUF_POOL_GLOBAL_SHARD].BuffersInUse, 1);
+        CFE_SB_ReturnBufferToPool(bd);
+        UtAssert_ZERO(CFE_SB_Global.Mem.Shard[CFE_SB_BUF_POOL_GLOBAL_SHARD].BuffersInUse);
+    }
+    else
+    {
+        UtAssert_NULL(bd);
+    }
+
+    /* Both pools exhausted */
+    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetPoolBuf), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_NULL(CFE_SB_GetBufferFromPool(AppId, 10, 0));
+    UT_ClearDefaultReturnValue(UT_KEY(CFE_ES_GetPoolBuf));
 
     CFE_UtAssert_EVENTCOUNT(0);
 }
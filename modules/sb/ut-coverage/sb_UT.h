@@ -769,6 +769,102 @@ void Test_SB_Cmds_MapInfoAlreadyPending(void);
 ******************************************************************************/
 void Test_SB_Cmds_MapInfoDataGetter(void);
 
+/*****************************************************************************/
+/**
+** \brief Test write snapshot command using the default file name
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_Cmds_SnapshotDef(void);
+
+/*****************************************************************************/
+/**
+** \brief Test write snapshot command when a file write is already pending
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_Cmds_SnapshotAlreadyPending(void);
+
+/*****************************************************************************/
+/**
+** \brief Test snapshot data getter and route collection functions
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_Cmds_SnapshotDataGetter(void);
+
+/*****************************************************************************/
+/**
+** \brief Test start and stop capture commands and message recording
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_Cmds_Capture(void);
+
+/*****************************************************************************/
+/**
+** \brief Test capture commands when a file write is already pending
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_Cmds_CaptureAlreadyPending(void);
+
+/*****************************************************************************/
+/**
+** \brief Test capture data getter function
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_Cmds_CaptureDataGetter(void);
+
+/*****************************************************************************/
+/**
+** \brief Test start and stop replay commands
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_Cmds_Replay(void);
+
+/*****************************************************************************/
+/**
+** \brief Test the replay child task
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_ReplayTaskMain(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test command to enable a specific route using a valid route
@@ -1092,6 +1188,23 @@ void Test_SB_EarlyInit(void);
 ******************************************************************************/
 void Test_SB_EarlyInit_SemCreateError(void);
 
+/*****************************************************************************/
+/**
+** \brief Test early initialization response to a buffer shard semaphore
+**        create failure
+**
+** \par Description
+**        This function tests the early initialization response to a failure
+**        creating the mutex of a buffer pool shard.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_EarlyInit_ShardSemCreateError(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test early initialization response to a pool create ex failure
@@ -1123,6 +1236,22 @@ void Test_SB_EarlyInit_PoolCreateError(void);
 ******************************************************************************/
 void Test_SB_EarlyInit_NoErrors(void);
 
+/*****************************************************************************/
+/**
+** \brief Test early initialization with a configured buffer reservation
+**
+** \par Description
+**        This function tests the pre-carving of SB buffers, including
+**        reservations that do not fit in the pool.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_EarlyInit_ReserveBuffers(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB API test functions
@@ -2442,6 +2571,22 @@ void Test_PutDestBlk_ErrLogic(void);
 ******************************************************************************/
 void Test_CFE_SB_Buffers(void);
 
+/*****************************************************************************/
+/**
+** \brief Test allocation of buffers from the per-producer pool shards
+**
+** \par Description
+**        This function tests the selection of the home buffer pool shard,
+**        the fallback to the global pool, and the per-shard accounting.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_SB_BufferShards(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test functions that involve bad pipe information
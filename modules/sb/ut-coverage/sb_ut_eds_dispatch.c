@@ -73,6 +73,16 @@ const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_ENABLE_ROUTE_CC =
     { SB_UT_CC_DISPATCH(CMD,CFE_SB_ENABLE_ROUTE_CC,EnableRouteCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_DISABLE_ROUTE_CC =
     { SB_UT_CC_DISPATCH(CMD,CFE_SB_DISABLE_ROUTE_CC,DisableRouteCmd) };
+const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_START_CAPTURE_CC =
+    { SB_UT_CC_DISPATCH(CMD,CFE_SB_START_CAPTURE_CC,StartCaptureCmd) };
+const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_STOP_CAPTURE_CC =
+    { SB_UT_CC_DISPATCH(CMD,CFE_SB_STOP_CAPTURE_CC,StopCaptureCmd) };
+const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_START_REPLAY_CC =
+    { SB_UT_CC_DISPATCH(CMD,CFE_SB_START_REPLAY_CC,StartReplayCmd) };
+const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_STOP_REPLAY_CC =
+    { SB_UT_CC_DISPATCH(CMD,CFE_SB_STOP_REPLAY_CC,StopReplayCmd) };
+const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_WRITE_SNAPSHOT_CC =
+    { SB_UT_CC_DISPATCH(CMD,CFE_SB_WRITE_SNAPSHOT_CC,WriteSnapshotCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_SEND_HK =
     { SB_UT_MSG_DISPATCH(SEND_HK,SendHkCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_SUB_RPT_CTL_SEND_PREV_SUBS_CC =
@@ -75,6 +75,11 @@ extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_WRITE_PIPE_INFO_CC;
 extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_WRITE_MAP_INFO_CC;
 extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_ENABLE_ROUTE_CC;
 extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_DISABLE_ROUTE_CC;
+extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_START_CAPTURE_CC;
+extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_STOP_CAPTURE_CC;
+extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_START_REPLAY_CC;
+extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_STOP_REPLAY_CC;
+extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_WRITE_SNAPSHOT_CC;
 extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_SEND_HK;
 extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_SUB_RPT_CTL_SEND_PREV_SUBS_CC;
 extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_SUB_RPT_CTL_ENABLE_SUB_REPORTING_CC;
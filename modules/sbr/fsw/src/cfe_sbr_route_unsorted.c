@@ -33,6 +33,7 @@
 #include "common_types.h"
 #include "cfe_sbr.h"
 #include "cfe_sbr_priv.h"
+#include "cfe_core_atomic.h"
 #include <string.h>
 
 #include "cfe_sb.h"
@@ -47,7 +48,8 @@ typedef struct
 {
     CFE_SB_DestinationD_t * ListHeadPtr; /**< \brief Destination list head */
     CFE_SB_MsgId_t          MsgId;       /**< \brief Message ID associated with route */
-    CFE_MSG_SequenceCount_t SeqCnt;      /**< \brief Message sequence counter */
+    CFE_Atomic_Uint32_t     SeqCnt;      /**< \brief Message sequence counter, updated without the SB lock */
+    uint32                  Collisions;  /**< \brief Map collisions encountered when the route was added */
 } CFE_SBR_RouteEntry_t;
 
 /** \brief Module data */
@@ -101,7 +103,8 @@ CFE_SBR_RouteId_t CFE_SBR_AddRoute(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr)
         routeid    = CFE_SBR_ValueToRouteId(CFE_SBR_RDATA.RouteIdxTop);
         collisions = CFE_SBR_SetRouteId(MsgId, routeid);
 
-        CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RDATA.RouteIdxTop].MsgId = MsgId;
+        CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RDATA.RouteIdxTop].MsgId      = MsgId;
+        CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RDATA.RouteIdxTop].Collisions = collisions;
         CFE_SBR_RDATA.RouteIdxTop++;
     }
 
@@ -165,15 +168,28 @@ void CFE_SBR_SetDestListHeadPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t
  * Internal helper routine only, not part of API.
  *
  *-----------------------------------------------------------------*/
-void CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId)
+CFE_MSG_SequenceCount_t CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId)
 {
-    CFE_MSG_SequenceCount_t *cnt;
+    CFE_Atomic_Uint32_t *   cnt;
+    uint32                  prev;
+    CFE_MSG_SequenceCount_t next = 0;
 
     if (CFE_SBR_IsValidRouteId(RouteId))
     {
-        cnt  = &CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].SeqCnt;
-        *cnt = CFE_MSG_GetNextSequenceCount(*cnt);
+        cnt = &CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].SeqCnt;
+
+        /*
+         * The wrap point is defined by the MSG module, so a plain fetch-add cannot
+         * be used.  Retry until no other sender has advanced the count in between.
+         */
+        prev = CFE_Atomic_Load(cnt);
+        do
+        {
+            next = CFE_MSG_GetNextSequenceCount((CFE_MSG_SequenceCount_t)prev);
+        } while (!CFE_Atomic_CompareExchange(cnt, &prev, next));
     }
+
+    return next;
 }
 
 /*----------------------------------------------------------------
@@ -187,12 +203,29 @@ CFE_MSG_SequenceCount_t CFE_SBR_GetSequenceCounter(CFE_SBR_RouteId_t RouteId)
 
     if (CFE_SBR_IsValidRouteId(RouteId))
     {
-        seqcnt = CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].SeqCnt;
+        seqcnt = CFE_Atomic_Load(&CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].SeqCnt);
     }
 
     return seqcnt;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SBR_GetRouteCollisions(CFE_SBR_RouteId_t RouteId)
+{
+    uint32 collisions = 0;
+
+    if (CFE_SBR_IsValidRouteId(RouteId))
+    {
+        collisions = CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].Collisions;
+    }
+
+    return collisions;
+}
+
 /*----------------------------------------------------------------
  *
  * Internal helper routine only, not part of API.
@@ -91,6 +91,7 @@ void Test_SBR_Route_Unsort_General(void)
     /* Check that maximum msgid is still in the table */
     UtAssert_INT32_EQ(CFE_SB_MsgIdToValue(CFE_SBR_GetMsgId(routeid)), CFE_PLATFORM_SB_HIGHEST_VALID_MSGID);
     UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid).RouteId, routeid.RouteId);
+    UtAssert_UINT32_EQ(CFE_SBR_GetRouteCollisions(routeid), collisions);
 
     UtPrintf("Callback test with full route");
     count = 0;
@@ -127,8 +128,9 @@ void Test_SBR_Route_Unsort_GetSet(void)
         UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(routeid[i]), CFE_SB_INVALID_MSG_ID));
         UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid[i]), NULL);
         UtAssert_INT32_EQ(CFE_SBR_GetSequenceCounter(routeid[i]), 0);
+        UtAssert_UINT32_EQ(CFE_SBR_GetRouteCollisions(routeid[i]), 0);
         UtAssert_VOIDCALL(CFE_SBR_SetDestListHeadPtr(routeid[i], NULL));
-        UtAssert_VOIDCALL(CFE_SBR_IncrementSequenceCounter(routeid[i]));
+        UtAssert_INT32_EQ(CFE_SBR_IncrementSequenceCounter(routeid[i]), 0);
     }
 
     /*
@@ -176,7 +178,7 @@ void Test_SBR_Route_Unsort_GetSet(void)
 
     /* Increment route 1 once and set dest pointers */
     UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_GetNextSequenceCount), seqcntexpected[1]);
-    CFE_SBR_IncrementSequenceCounter(routeid[1]);
+    UtAssert_UINT32_EQ(CFE_SBR_IncrementSequenceCounter(routeid[1]), seqcntexpected[1]);
     UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, 4);
     CFE_SBR_SetDestListHeadPtr(routeid[1], &dest[1]);
     CFE_SBR_SetDestListHeadPtr(routeid[2], &dest[0]);
@@ -97,7 +97,7 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
             /* Get pointer to Registry Record Entry to speed up processing */
             RegRecPtr = CFE_TBL_TxnRegRec(&Txn);
 
-            Status = CFE_TBL_SetupTableBuffers(RegRecPtr, &TableCfg);
+            Status = CFE_TBL_SetupTableBuffers(RegRecPtr, &TableCfg, CFE_ES_CALLER_ADDRESS());
         }
 
         /* If memory allocation was successful, register with table services and the CDS (if applicable) */
@@ -108,8 +108,8 @@ int32 CFE_TBL_EarlyInit(void)
         {
             LoadBuffPtr = &CFE_TBL_Global.LoadBuffs[j];
 
-            /* Allocate memory for shared load buffers */
-            Status = CFE_TBL_AllocateTableLoadBuffer(LoadBuffPtr, CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE);
+            /* Allocate memory for shared load buffers (owned by TBL itself, no application call site) */
+            Status = CFE_TBL_AllocateTableLoadBuffer(LoadBuffPtr, CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE, 0);
 
             if (Status != CFE_SUCCESS)
             {
@@ -835,13 +835,13 @@ CFE_Status_t CFE_TBL_ValidateTableOptions(CFE_TBL_TableConfig_t *TableCfg, uint1
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CFE_TBL_AllocateTableLoadBuffer(CFE_TBL_LoadBuff_t *LoadBuffPtr, size_t Size)
+CFE_Status_t CFE_TBL_AllocateTableLoadBuffer(CFE_TBL_LoadBuff_t *LoadBuffPtr, size_t Size, cpuaddr CallerAddr)
 {
     CFE_Status_t Status;
     void *       MemPtr;
 
     /* Allocate the memory buffer(s) for the table and inactive table, if necessary */
-    Status = CFE_ES_GetPoolBuf(&MemPtr, CFE_TBL_Global.Buf.PoolHdl, Size);
+    Status = CFE_ES_GetPoolBufForCaller(&MemPtr, CFE_TBL_Global.Buf.PoolHdl, Size, CallerAddr);
 
     if (Status < 0)
     {
@@ -884,7 +884,8 @@ void CFE_TBL_MarkNameAsModified(char *NameBufPtr, size_t NameBufSize)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CFE_TBL_SetupTableBuffers(CFE_TBL_RegistryRec_t *RegRecPtr, const CFE_TBL_TableConfig_t *ReqCfg)
+CFE_Status_t CFE_TBL_SetupTableBuffers(CFE_TBL_RegistryRec_t *RegRecPtr, const CFE_TBL_TableConfig_t *ReqCfg,
+                                       cpuaddr CallerAddr)
 {
     CFE_Status_t Status;
 
@@ -903,12 +904,12 @@ CFE_Status_t CFE_TBL_SetupTableBuffers(CFE_TBL_RegistryRec_t *RegRecPtr, const C
     else
     {
         /* Allocate the local buffer for storing table content */
-        Status = CFE_TBL_AllocateTableLoadBuffer(&RegRecPtr->Buffers[0], ReqCfg->Size);
+        Status = CFE_TBL_AllocateTableLoadBuffer(&RegRecPtr->Buffers[0], ReqCfg->Size, CallerAddr);
 
         /* Secondary only needed on double buffered tables */
         if (Status == CFE_SUCCESS && ReqCfg->DoubleBuffered)
         {
-            Status = CFE_TBL_AllocateTableLoadBuffer(&RegRecPtr->Buffers[1], ReqCfg->Size);
+            Status = CFE_TBL_AllocateTableLoadBuffer(&RegRecPtr->Buffers[1], ReqCfg->Size, CallerAddr);
             if (Status == CFE_SUCCESS)
             {
                 /* double buffering was set up successfully */
@@ -342,12 +342,13 @@ CFE_Status_t CFE_TBL_ValidateTableOptions(CFE_TBL_TableConfig_t *TableCfg, uint1
 **         of double-buffered tables.
 **
 ** \par Assumptions, External Events, and Notes:
-**          None
+**          CallerAddr is the code address of the application call site, recorded by
+**          the ES pool allocation tracker.  It is 0 for buffers owned by TBL itself.
 **
 ** \retval #CFE_SUCCESS                     \copydoc CFE_SUCCESS
 **
 */
-CFE_Status_t CFE_TBL_AllocateTableLoadBuffer(CFE_TBL_LoadBuff_t *LoadBuffPtr, size_t Size);
+CFE_Status_t CFE_TBL_AllocateTableLoadBuffer(CFE_TBL_LoadBuff_t *LoadBuffPtr, size_t Size, cpuaddr CallerAddr);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -365,12 +366,14 @@ CFE_Status_t CFE_TBL_AllocateTableLoadBuffer(CFE_TBL_LoadBuff_t *LoadBuffPtr, si
 **         This also takes care of allocating the buffers as indicated
 **
 ** \par Assumptions, External Events, and Notes:
-**          None
+**          CallerAddr is the code address of the application that called CFE_TBL_Register(),
+**          recorded against the buffers by the ES pool allocation tracker.
 **
 ** \retval #CFE_SUCCESS                     \copydoc CFE_SUCCESS
 **
 */
-CFE_Status_t CFE_TBL_SetupTableBuffers(CFE_TBL_RegistryRec_t *RegRecPtr, const CFE_TBL_TableConfig_t *ReqCfg);
+CFE_Status_t CFE_TBL_SetupTableBuffers(CFE_TBL_RegistryRec_t *RegRecPtr, const CFE_TBL_TableConfig_t *ReqCfg,
+                                       cpuaddr CallerAddr);
 
 /*---------------------------------------------------------------------------------------*/
 /**
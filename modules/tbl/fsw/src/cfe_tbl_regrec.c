@@ -58,6 +58,19 @@ static void CFE_TBL_CheckInactiveBufferHelper(CFE_TBL_AccessDescriptor_t *AccDes
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Confirms a name index candidate against the registry
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_TBL_RegRecNameMatch(uint32 TableIdx, const char *Name, void *Arg)
+{
+    CFE_TBL_RegistryRec_t *RegRecPtr = &CFE_TBL_Global.Registry[TableIdx];
+
+    return CFE_TBL_RegRecIsUsed(RegRecPtr) && strcmp(Name, CFE_TBL_RegRecGetName(RegRecPtr)) == 0;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -130,28 +143,52 @@ CFE_Status_t CFE_TBL_RegId_ToIndex(CFE_TBL_RegId_t RegId, uint32 *Idx)
  *-----------------------------------------------------------------*/
 CFE_TBL_RegistryRec_t *CFE_TBL_LocateRegRecByName(const char *Name)
 {
-    CFE_TBL_RegistryRec_t *RegRecPtr;
-    uint32                 i;
+    uint32 TableIdx;
 
     /*
-    ** Search the Registry table for an app with a matching name.
+    ** Look up the name in the registry index; the whole registry only needs
+    ** to be scanned if some record could not be indexed.
     */
-    for (i = 0; i < CFE_PLATFORM_TBL_MAX_NUM_TABLES; ++i)
+    if (!CFE_ResourceId_NameIndexFind(CFE_TBL_Global.RegNameIndex, CFE_TBL_REG_NAMEINDEX_SLOTS, Name,
+                                      CFE_TBL_RegRecNameMatch, NULL, &TableIdx) &&
+        (!CFE_TBL_Global.RegNameIndexIncomplete ||
+         !CFE_ResourceId_NameIndexScan(CFE_PLATFORM_TBL_MAX_NUM_TABLES, Name, CFE_TBL_RegRecNameMatch, NULL,
+                                       &TableIdx)))
     {
-        RegRecPtr = &CFE_TBL_Global.Registry[i];
-
-        if (CFE_TBL_RegRecIsUsed(RegRecPtr) && strcmp(Name, CFE_TBL_RegRecGetName(RegRecPtr)) == 0)
-        {
-            break;
-        }
+        return NULL;
     }
 
-    if (i >= CFE_PLATFORM_TBL_MAX_NUM_TABLES)
+    return &CFE_TBL_Global.Registry[TableIdx];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_RegRecIndexName(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    if (CFE_ResourceId_NameIndexAdd(CFE_TBL_Global.RegNameIndex, CFE_TBL_REG_NAMEINDEX_SLOTS,
+                                    CFE_TBL_RegRecGetName(RegRecPtr),
+                                    RegRecPtr - CFE_TBL_Global.Registry) != CFE_SUCCESS)
     {
-        RegRecPtr = NULL;
+        /* name lookups that miss in the index will also scan the registry */
+        CFE_TBL_Global.RegNameIndexIncomplete = true;
     }
+}
 
-    return RegRecPtr;
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_RegRecSetFree(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    CFE_ResourceId_NameIndexRemove(CFE_TBL_Global.RegNameIndex, CFE_TBL_REG_NAMEINDEX_SLOTS,
+                                   CFE_TBL_RegRecGetName(RegRecPtr), RegRecPtr - CFE_TBL_Global.Registry);
+    RegRecPtr->RegId = CFE_TBL_REGID_UNDEFINED;
 }
 
 /*----------------------------------------------------------------
@@ -362,6 +399,7 @@ void CFE_TBL_SetupTableRegistryRecord(CFE_TBL_RegistryRec_t *RegRecPtr, CFE_ES_A
 
     /* Save Table Name in Registry (note that the string length was already validated) */
     strncpy(RegRecPtr->Config.Name, ReqCfg->Name, sizeof(RegRecPtr->Config.Name));
+    CFE_TBL_RegRecIndexName(RegRecPtr);
 
     /* Save the EDS ID */
     RegRecPtr->Config.EdsId = ReqCfg->EdsId;
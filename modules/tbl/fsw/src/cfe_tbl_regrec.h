@@ -284,18 +284,31 @@ static inline void CFE_TBL_RegRecSetUsed(CFE_TBL_RegistryRec_t *RegRecPtr, CFE_R
 /**
  * @brief Marks a registry entry as available (not in use)
  *
- * This clears the internal field(s) within this entry, and marks
- * it as not being associated with any registry ID.
+ * This clears the internal field(s) within this entry, marks
+ * it as not being associated with any registry ID, and removes
+ * it from the registry name index.
  *
  * @note This internal helper function must only be used on record pointers
  * that are known to refer to an actual table location (i.e. non-null).
  *
  * @param[in]   RegRecPtr   pointer to registry entry
  */
-static inline void CFE_TBL_RegRecSetFree(CFE_TBL_RegistryRec_t *RegRecPtr)
-{
-    RegRecPtr->RegId = CFE_TBL_REGID_UNDEFINED;
-}
+void CFE_TBL_RegRecSetFree(CFE_TBL_RegistryRec_t *RegRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Adds a registry record to the registry name index
+ *
+ * This must be invoked once the table name has been stored in the record,
+ * so that CFE_TBL_LocateRegRecByName() can find it without scanning the
+ * whole registry.  The index entry is removed by CFE_TBL_RegRecSetFree().
+ *
+ * @note This internal helper function must only be used on record pointers
+ * that are known to refer to an actual table location (i.e. non-null).
+ *
+ * @param[in]   RegRecPtr   pointer to registry entry
+ */
+void CFE_TBL_RegRecIndexName(CFE_TBL_RegistryRec_t *RegRecPtr);
 
 /*---------------------------------------------------------------------------------------*/
 /**
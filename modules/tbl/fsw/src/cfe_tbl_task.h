@@ -40,6 +40,7 @@
 #include "cfe_tbl_valresult.h"
 #include "cfe_tbl_regrec.h"
 #include "cfe_tbl_loadbuff.h"
+#include "cfe_resourceid_nameindex.h"
 
 /*************************************************************************/
 
@@ -60,6 +61,11 @@
 #define CFE_TBL_TASK_PIPE_DEPTH 12             /**< \brief Number of Commands that can be queued */
 /** \} */
 
+/**
+ * @brief Number of name index slots for the table registry
+ */
+#define CFE_TBL_REG_NAMEINDEX_SLOTS CFE_RESOURCEID_NAMEINDEX_SLOTS(CFE_PLATFORM_TBL_MAX_NUM_TABLES)
+
 /*******************************************************************************/
 /**   \brief Memory Pool Data Structure
 **
@@ -194,6 +200,12 @@ typedef struct
     CFE_TBL_DumpControl_t DumpControlBlocks[CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS]; /**< \brief Array of Dump-Only
                                                                                          Dump Control Blocks */
 
+    /*
+    ** Registry name index, used by name lookups instead of scanning the registry
+    */
+    CFE_ResourceId_NameIndexSlot_t RegNameIndex[CFE_TBL_REG_NAMEINDEX_SLOTS]; /**< \brief Registry name index */
+    bool                           RegNameIndexIncomplete; /**< \brief Set if a record could not be indexed */
+
     /*
      * Registry dump state info (background job)
      */
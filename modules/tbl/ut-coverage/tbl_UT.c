@@ -1097,6 +1097,7 @@ void Test_CFE_TBL_DumpCmd(void)
     UT_InitData_TBL();
 
     UT_TBL_SetName(UT_TBL_Config(RegRecPtr)->Name, sizeof(UT_TBL_Config(RegRecPtr)->Name), "DumpCmdTest");
+    CFE_TBL_RegRecIndexName(RegRecPtr);
     RegRecPtr->OwnerAppId = AppID;
     UT_TBL_SetName(DumpCmd.Payload.TableName, sizeof(DumpCmd.Payload.TableName), CFE_TBL_RegRecGetName(RegRecPtr));
     DumpCmd.Payload.ActiveTableFlag = CFE_TBL_BufferSelect_ACTIVE;
@@ -3720,6 +3721,27 @@ void Test_CFE_TBL_ResourceID_RegistryRecord(void)
     /* When called with an invalid regrec, this should reject it */
     CFE_TBL_RegRecSetFree(RegRecPtr);
     UtAssert_NULL(CFE_TBL_GetInactiveBufferExclusive(RegRecPtr));
+
+    /* Name lookups go through the registry name index */
+    UT_ResetTableRegistry();
+    UT_TBL_SetupRegRec(RegRecPtr);
+    UtAssert_ADDRESS_EQ(CFE_TBL_LocateRegRecByName(CFE_TBL_RegRecGetName(RegRecPtr)), RegRecPtr);
+    UtAssert_NULL(CFE_TBL_LocateRegRecByName("notfound"));
+
+    /* Freeing the record removes it from the index */
+    CFE_TBL_RegRecSetFree(RegRecPtr);
+    UtAssert_NULL(CFE_TBL_LocateRegRecByName(CFE_TBL_RegRecGetName(RegRecPtr)));
+
+    /* A record that could not be indexed is still found by scanning the registry */
+    UT_ResetTableRegistry();
+    for (Idx = 0; Idx < CFE_TBL_REG_NAMEINDEX_SLOTS; ++Idx)
+    {
+        CFE_TBL_Global.RegNameIndex[Idx].Entry = CFE_PLATFORM_TBL_MAX_NUM_TABLES;
+    }
+    UT_TBL_SetupRegRec(RegRecPtr);
+    UtAssert_BOOL_TRUE(CFE_TBL_Global.RegNameIndexIncomplete);
+    UtAssert_ADDRESS_EQ(CFE_TBL_LocateRegRecByName(CFE_TBL_RegRecGetName(RegRecPtr)), RegRecPtr);
+    UtAssert_NULL(CFE_TBL_LocateRegRecByName("notfound"));
 }
 
 /*
@@ -479,6 +479,7 @@ void UT_TBL_SetupRegRec(CFE_TBL_RegistryRec_t *RegRecPtr)
     /* make up an ID */
     PendingId = CFE_ResourceId_FromInteger(CFE_TBL_REGID_BASE + Idx);
     CFE_TBL_RegRecSetUsed(RegRecPtr, PendingId);
+    CFE_TBL_RegRecIndexName(RegRecPtr);
 }
 
 void UT_TBL_SetupAccDesc(CFE_TBL_AccessDescriptor_t *AccDescPtr)
@@ -502,6 +503,8 @@ void UT_ResetTableRegistry(void)
     int32 i;
 
     UT_TBL_ForEveryRegRec(CFE_TBL_InitRegistryRecord);
+    CFE_ResourceId_NameIndexClear(CFE_TBL_Global.RegNameIndex, CFE_TBL_REG_NAMEINDEX_SLOTS);
+    CFE_TBL_Global.RegNameIndexIncomplete = false;
 
     /* Initialize the table access descriptors */
     UT_TBL_ForEveryAccDesc(UT_TBL_SetupAccDesc);